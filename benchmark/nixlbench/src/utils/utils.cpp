@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstring>
 #include <numeric>
 #include <sstream>
@@ -61,7 +62,7 @@ NB_ARG_STRING(worker_type, XFERBENCH_WORKER_NIXL, "Type of worker [nixl, nvshmem
 NB_ARG_STRING(backend,
               XFERBENCH_BACKEND_UCX,
               "Name of NIXL backend [UCX, GDS, GDS_MT, POSIX, GPUNETIO, Mooncake, HF3FS, OBJ, "
-              "GUSLI, AZURE_BLOB] (only used with nixl worker)");
+              "GUSLI, AZURE_BLOB, SHM] (only used with nixl worker)");
 NB_ARG_STRING(initiator_seg_type,
               XFERBENCH_SEG_TYPE_DRAM,
               "Type of memory segment for initiator [DRAM, VRAM]. Note: Storage backends always "
@@ -94,6 +95,23 @@ NB_ARG_INT32(num_threads,
              "Number of threads used by benchmark."
              " Num_iter must be greater or equal than num_threads and equally divisible by"
              " num_threads.");
+NB_ARG_INT32(inflight,
+             1,
+             "Number of transfer requests kept outstanding per thread (only used with nixl "
+             "worker)");
+NB_ARG_UINT64(rate,
+              0,
+              "Open-loop arrival rate in requests per second per thread. Latency is measured from "
+              "the scheduled issue time. 0 means closed loop (only used with nixl worker)");
+NB_ARG_INT32(bulk_threads,
+             0,
+             "Number of threads posting BULK traffic class transfers, the other threads post "
+             "LATENCY class transfers and per class latency is reported. 0 leaves all transfers "
+             "in the default class (only used with nixl worker)");
+NB_ARG_UINT64(bulk_rate_limit,
+              0,
+              "Rate limit of the BULK traffic class in MB/s, paced by the agent. 0 means no limit "
+              "(only used with nixl worker)");
 NB_ARG_INT32(num_initiator_dev, 1, "Number of device in initiator process");
 NB_ARG_INT32(num_target_dev, 1, "Number of device in target process");
 NB_ARG_BOOL(enable_pt, false, "Enable Progress Thread (only used with nixl worker)");
@@ -113,6 +131,9 @@ NB_ARG_INT32(gds_batch_pool_size,
 NB_ARG_INT32(gds_batch_limit, 128, "Batch limit for GDS operations (only used with GDS backend)");
 NB_ARG_INT32(gds_mt_num_threads, 1, "Number of threads used by GDS MT plugin");
 
+// SHM options - only used when backend is SHM
+NB_ARG_INT32(shm_num_threads, 4, "Number of copy threads used by SHM plugin");
+
 // TODO: We should take rank wise device list as input to extend support
 // <rank>:<device_list>, ...
 // For example- 0:mlx5_0,mlx5_1,mlx5_2,1:mlx5_3,mlx5_4, ...
@@ -250,6 +271,10 @@ int xferBenchConfig::num_iter = 0;
 int xferBenchConfig::large_blk_iter_ftr = 16;
 int xferBenchConfig::warmup_iter = 0;
 int xferBenchConfig::num_threads = 0;
+int xferBenchConfig::inflight = 1;
+uint64_t xferBenchConfig::rate = 0;
+int xferBenchConfig::bulk_threads = 0;
+uint64_t xferBenchConfig::bulk_rate_limit = 0;
 bool xferBenchConfig::enable_pt = false;
 size_t xferBenchConfig::progress_threads = 0;
 bool xferBenchConfig::enable_vmm = false;
@@ -261,6 +286,7 @@ std::string xferBenchConfig::benchmark_group = "default";
 int xferBenchConfig::gds_batch_pool_size = 0;
 int xferBenchConfig::gds_batch_limit = 0;
 int xferBenchConfig::gds_mt_num_threads = 0;
+int xferBenchConfig::shm_num_threads = 0;
 std::string xferBenchConfig::gpunetio_device_list = "";
 std::string xferBenchConfig::gpunetio_oob_list = "";
 std::vector<std::string> devices = {};
@@ -381,6 +407,10 @@ xferBenchConfig::loadParams(void) {
             gds_mt_num_threads = NB_ARG(gds_mt_num_threads);
         }
 
+        if (backend == XFERBENCH_BACKEND_SHM) {
+            shm_num_threads = NB_ARG(shm_num_threads);
+        }
+
         // Load POSIX-specific configurations if backend is POSIX
         if (backend == XFERBENCH_BACKEND_POSIX) {
             posix_api_type = NB_ARG(posix_api_type);
@@ -474,6 +504,10 @@ xferBenchConfig::loadParams(void) {
     large_blk_iter_ftr = NB_ARG(large_blk_iter_ftr);
     warmup_iter = NB_ARG(warmup_iter);
     num_threads = NB_ARG(num_threads);
+    inflight = NB_ARG(inflight);
+    rate = NB_ARG(rate);
+    bulk_threads = NB_ARG(bulk_threads);
+    bulk_rate_limit = NB_ARG(bulk_rate_limit);
     etcd_endpoints = NB_ARG(etcd_endpoints);
     asio_address = NB_ARG(asio_address);
     asio_port = NB_ARG(asio_port);
@@ -523,6 +557,12 @@ xferBenchConfig::loadParams(void) {
         }
     }
 
+    if (XFERBENCH_BACKEND_SHM == backend && (XFERBENCH_SEG_TYPE_DRAM != initiator_seg_type ||
+                                             XFERBENCH_SEG_TYPE_DRAM != target_seg_type)) {
+        std::cerr << "SHM backend only supports DRAM segments" << std::endl;
+        return -1;
+    }
+
     if ((max_block_size * max_batch_size) > (total_buffer_size / num_initiator_dev)) {
         std::cerr
             << "Incorrect buffer size configuration for Initiator"
@@ -546,6 +586,19 @@ xferBenchConfig::loadParams(void) {
         return -1;
     }
 
+    if (inflight <= 0) {
+        std::cerr << "inflight must be greater than 0" << std::endl;
+        return -1;
+    }
+    if ((inflight > 1 || rate > 0) && recreate_xfer) {
+        std::cerr << "inflight and rate modes are not supported with recreate_xfer" << std::endl;
+        return -1;
+    }
+    if (bulk_threads < 0 || bulk_threads > num_threads) {
+        std::cerr << "bulk_threads must be between 0 and num_threads" << std::endl;
+        return -1;
+    }
+
     if (large_blk_iter_ftr <= 0) {
         std::cerr << "iter_factor must be greater than 0" << std::endl;
         return -1;
@@ -611,7 +664,7 @@ xferBenchConfig::printConfig() {
     }
     printOption("Worker type (--worker_type=[nixl,nvshmem])", worker_type);
     if (worker_type == XFERBENCH_WORKER_NIXL) {
-        printOption("Backend (--backend=[UCX,GDS,GDS_MT,POSIX,Mooncake,HF3FS,OBJ,AZURE_BLOB])",
+        printOption("Backend (--backend=[UCX,GDS,GDS_MT,POSIX,Mooncake,HF3FS,OBJ,AZURE_BLOB,SHM])",
                     backend);
         printOption("Enable pt (--enable_pt=[0,1])", std::to_string(enable_pt));
         printOption("Progress threads (--progress_threads=N)", std::to_string(progress_threads));
@@ -632,6 +685,11 @@ xferBenchConfig::printConfig() {
                         std::to_string(gds_mt_num_threads));
         }
 
+        if (backend == XFERBENCH_BACKEND_SHM) {
+            printOption("SHM Number of copy threads (--shm_num_threads=N)",
+                        std::to_string(shm_num_threads));
+        }
+
         // Print POSIX options if backend is POSIX
         if (backend == XFERBENCH_BACKEND_POSIX) {
             printOption("POSIX API type (--posix_api_type=[AIO,URING,POSIXAIO])", posix_api_type);
@@ -711,6 +769,14 @@ xferBenchConfig::printConfig() {
     printOption("Large block iter factor (--large_blk_iter_ftr=N)",
                 std::to_string(large_blk_iter_ftr));
     printOption("Num threads (--num_threads=N)", std::to_string(num_threads));
+    if (worker_type == XFERBENCH_WORKER_NIXL) {
+        printOption("Inflight requests per thread (--inflight=N)", std::to_string(inflight));
+        printOption("Open-loop rate per thread (--rate=N req/s)",
+                    rate > 0 ? std::to_string(rate) : "0 (closed loop)");
+        printOption("BULK class threads (--bulk_threads=N)", std::to_string(bulk_threads));
+        printOption("BULK class rate limit (--bulk_rate_limit=N MB/s)",
+                    bulk_rate_limit > 0 ? std::to_string(bulk_rate_limit) : "0 (no limit)");
+    }
     printSeparator('-');
     std::cout << std::endl;
 }
@@ -1092,6 +1158,7 @@ xferBenchUtils::printStatsHeader() {
                   << std::setw(15) << "P99 Post (us)"
                   << std::setw(15) << "Avg Tx (us)"
                   << std::setw(15) << "P99 Tx (us)"
+                  << std::setw(15) << "P99.9 Tx (us)"
                   << std::endl;
         // clang-format on
     } else {
@@ -1107,6 +1174,7 @@ xferBenchUtils::printStatsHeader() {
                   << std::setw(15) << "P99 Post (us)"
                   << std::setw(15) << "Avg Tx (us)"
                   << std::setw(15) << "P99 Tx (us)"
+                  << std::setw(15) << "P99.9 Tx (us)"
                   << std::endl;
         // clang-format on
     }
@@ -1164,6 +1232,7 @@ xferBenchUtils::printStats(bool is_target,
     double post_p99_duration = stats.post_duration.p99();
     double transfer_duration = stats.transfer_duration.avg();
     double transfer_p99_duration = stats.transfer_duration.p99();
+    double transfer_p999_duration = stats.transfer_duration.p999();
 
     // Tabulate print with fixed width for each string
     if (IS_PAIRWISE_AND_SG() && rt->getSize() > 2) {
@@ -1182,6 +1251,7 @@ xferBenchUtils::printStats(bool is_target,
                   << std::setw(15) << post_p99_duration
                   << std::setw(15) << transfer_duration
                   << std::setw(15) << transfer_p99_duration
+                  << std::setw(15) << transfer_p999_duration
                   << std::endl;
         // clang-format on
     } else {
@@ -1198,9 +1268,28 @@ xferBenchUtils::printStats(bool is_target,
                   << std::setw(15) << post_p99_duration
                   << std::setw(15) << transfer_duration
                   << std::setw(15) << transfer_p99_duration
+                  << std::setw(15) << transfer_p999_duration
                   << std::endl;
         // clang-format on
     }
+
+    if (xferBenchConfig::bulk_threads > 0) {
+        printClassStats("LATENCY", stats.latency_class_duration);
+        printClassStats("BULK", stats.bulk_class_duration);
+    }
+}
+
+void
+xferBenchUtils::printClassStats(const std::string &traffic_class,
+                                const xferMetricStats &duration) {
+    if (duration.count() == 0) {
+        return;
+    }
+
+    std::cout << std::left << std::fixed << std::setprecision(1) << "  " << std::setw(8)
+              << traffic_class << " class: Avg Tx " << duration.avg() << " us, P99 Tx "
+              << duration.p99() << " us, P99.9 Tx " << duration.p999() << " us over "
+              << duration.count() << " transfers" << std::endl;
 }
 
 std::string
@@ -1474,66 +1563,146 @@ xferBenchUtils::buildCommonAzCliBlobParams(const std::string &blob_name) {
  * xferMetricStats
  */
 
+namespace {
+// Histogram layout: each power-of-two range is split into 2^HIST_SUB_BUCKET_HALF_BITS linear
+// sub-buckets, which bounds the relative error of a recorded value to 1/128.
+constexpr unsigned HIST_SUB_BUCKET_HALF_BITS = 7;
+constexpr unsigned HIST_SUB_BUCKET_BITS = HIST_SUB_BUCKET_HALF_BITS + 1;
+constexpr uint64_t HIST_SUB_BUCKET_HALF = 1ULL << HIST_SUB_BUCKET_HALF_BITS;
+constexpr uint64_t HIST_SUB_BUCKET_MASK = (1ULL << HIST_SUB_BUCKET_BITS) - 1;
+// Largest trackable value is 2^HIST_MAX_VALUE_BITS ns (~73 minutes); larger values are clamped.
+constexpr unsigned HIST_MAX_VALUE_BITS = 42;
+constexpr uint64_t HIST_MAX_VALUE = (1ULL << HIST_MAX_VALUE_BITS) - 1;
+constexpr size_t HIST_NUM_COUNTS = (HIST_MAX_VALUE_BITS - HIST_SUB_BUCKET_BITS + 2)
+    << HIST_SUB_BUCKET_HALF_BITS;
+} // namespace
+
+size_t
+xferMetricStats::bucketIndex(uint64_t value) {
+    const unsigned pow2_ceiling = 64 - __builtin_clzll(value | HIST_SUB_BUCKET_MASK);
+    const unsigned bucket = pow2_ceiling - HIST_SUB_BUCKET_BITS;
+    const uint64_t sub_bucket = value >> bucket;
+    return ((bucket + 1) << HIST_SUB_BUCKET_HALF_BITS) + sub_bucket - HIST_SUB_BUCKET_HALF;
+}
+
+uint64_t
+xferMetricStats::bucketHighestValue(size_t index) {
+    int bucket = static_cast<int>(index >> HIST_SUB_BUCKET_HALF_BITS) - 1;
+    uint64_t sub_bucket = (index & (HIST_SUB_BUCKET_HALF - 1)) + HIST_SUB_BUCKET_HALF;
+    if (bucket < 0) {
+        sub_bucket -= HIST_SUB_BUCKET_HALF;
+        bucket = 0;
+    }
+    return (sub_bucket << bucket) + (1ULL << bucket) - 1;
+}
+
 double
 xferMetricStats::min() const {
-    if (samples.empty()) return 0;
-    return *std::min_element(samples.begin(), samples.end());
+    if (total_count_ == 0) return 0;
+    return min_ / 1e3;
 }
 
 double
 xferMetricStats::max() const {
-    if (samples.empty()) return 0;
-    return *std::max_element(samples.begin(), samples.end());
+    if (total_count_ == 0) return 0;
+    return max_ / 1e3;
 }
 
 double
 xferMetricStats::avg() const {
-    if (samples.empty()) return 0;
-    return std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    if (total_count_ == 0) return 0;
+    return sum_ / total_count_;
+}
+
+double
+xferMetricStats::percentile(double pct) const {
+    if (total_count_ == 0) return 0;
+    const uint64_t target = std::max<uint64_t>(1, std::ceil(total_count_ * pct / 100.0));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        seen += counts_[i];
+        if (seen >= target) {
+            return std::clamp(bucketHighestValue(i), min_, max_) / 1e3;
+        }
+    }
+    return max_ / 1e3;
 }
 
 double
-xferMetricStats::p90() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.9;
-    return samples[std::min(index, samples.size() - 1)];
+xferMetricStats::p50() const {
+    return percentile(50);
 }
 
 double
-xferMetricStats::p95() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.95;
-    return samples[std::min(index, samples.size() - 1)];
+xferMetricStats::p90() const {
+    return percentile(90);
 }
 
 double
-xferMetricStats::p99() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.99;
-    return samples[std::min(index, samples.size() - 1)];
+xferMetricStats::p95() const {
+    return percentile(95);
+}
+
+double
+xferMetricStats::p99() const {
+    return percentile(99);
+}
+
+double
+xferMetricStats::p999() const {
+    return percentile(99.9);
+}
+
+uint64_t
+xferMetricStats::count() const {
+    return total_count_;
 }
 
 void
 xferMetricStats::add(double value) {
-    samples.push_back(value);
+    const uint64_t ns = value > 0 ? std::llround(value * 1e3) : 0;
+    if (counts_.empty()) {
+        counts_.resize(HIST_NUM_COUNTS, 0);
+    }
+    counts_[bucketIndex(std::min(ns, HIST_MAX_VALUE))]++;
+    total_count_++;
+    min_ = std::min(min_, ns);
+    max_ = std::max(max_, ns);
+    sum_ += value;
 }
 
 void
 xferMetricStats::add(const xferMetricStats &other) {
-    samples.insert(samples.end(), other.samples.begin(), other.samples.end());
+    if (other.total_count_ == 0) {
+        return;
+    }
+    if (counts_.empty()) {
+        counts_.resize(HIST_NUM_COUNTS, 0);
+    }
+    for (size_t i = 0; i < HIST_NUM_COUNTS; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    total_count_ += other.total_count_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    sum_ += other.sum_;
 }
 
 void
-xferMetricStats::reserve(size_t n) {
-    samples.reserve(n);
+xferMetricStats::reserve(size_t) {
+    // Histogram storage is fixed-size; allocate it up front to keep it off the hot path
+    if (counts_.empty()) {
+        counts_.resize(HIST_NUM_COUNTS, 0);
+    }
 }
 
 void
 xferMetricStats::clear() {
-    samples.clear();
+    std::fill(counts_.begin(), counts_.end(), 0);
+    total_count_ = 0;
+    min_ = UINT64_MAX;
+    max_ = 0;
+    sum_ = 0;
 }
 
 /*
@@ -1546,6 +1715,8 @@ xferBenchStats::clear() {
     prepare_duration.clear();
     post_duration.clear();
     transfer_duration.clear();
+    latency_class_duration.clear();
+    bulk_class_duration.clear();
 }
 
 void
@@ -1554,6 +1725,8 @@ xferBenchStats::add(const xferBenchStats &other) {
     prepare_duration.add(other.prepare_duration);
     post_duration.add(other.post_duration);
     transfer_duration.add(other.transfer_duration);
+    latency_class_duration.add(other.latency_class_duration);
+    bulk_class_duration.add(other.bulk_class_duration);
 }
 
 void
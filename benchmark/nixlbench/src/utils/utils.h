@@ -80,6 +80,7 @@
 #define XFERBENCH_BACKEND_GUSLI "GUSLI"
 #define XFERBENCH_BACKEND_UCCL "UCCL"
 #define XFERBENCH_BACKEND_AZURE_BLOB "AZURE_BLOB"
+#define XFERBENCH_BACKEND_SHM "SHM"
 
 // POSIX API types
 #define XFERBENCH_POSIX_API_AIO "AIO"
@@ -153,6 +154,10 @@ public:
     static int large_blk_iter_ftr;
     static int warmup_iter;
     static int num_threads;
+    static int inflight;
+    static uint64_t rate;
+    static int bulk_threads;
+    static uint64_t bulk_rate_limit;
     static bool enable_pt;
     static size_t progress_threads;
     static std::string device_list;
@@ -171,6 +176,7 @@ public:
     static int gds_batch_pool_size;
     static int gds_batch_limit;
     static int gds_mt_num_threads;
+    static int shm_num_threads;
     static std::string gpunetio_device_list;
     static std::string gpunetio_oob_list;
     static long page_size;
@@ -247,7 +253,10 @@ private:
     nixlTime::us_t start_;
 };
 
-// Stats class for measuring arbitrary numeric metrics with multiple samples
+// Stats class for measuring arbitrary numeric metrics with multiple samples.
+// Samples are durations in microseconds recorded into an HDR-style log-linear histogram
+// with nanosecond resolution, so memory is constant regardless of the sample count and
+// merging per-thread stats is O(buckets). Percentiles are accurate to within 1%.
 class xferMetricStats {
 public:
     double
@@ -257,11 +266,19 @@ public:
     double
     avg() const;
     double
-    p90();
+    p50() const;
     double
-    p95();
+    p90() const;
     double
-    p99();
+    p95() const;
+    double
+    p99() const;
+    double
+    p999() const;
+    double
+    percentile(double pct) const;
+    uint64_t
+    count() const;
 
     void
     add(double value);
@@ -273,7 +290,16 @@ public:
     clear();
 
 private:
-    std::vector<double> samples;
+    static size_t
+    bucketIndex(uint64_t value);
+    static uint64_t
+    bucketHighestValue(size_t index);
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_count_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+    double sum_ = 0;
 };
 
 // Stats class for measuring benchmark metrics
@@ -282,6 +308,9 @@ struct xferBenchStats {
     xferMetricStats prepare_duration;
     xferMetricStats post_duration;
     xferMetricStats transfer_duration;
+    // Transfer durations per traffic class, only filled with --bulk_threads
+    xferMetricStats latency_class_duration;
+    xferMetricStats bulk_class_duration;
 
     void
     clear();
@@ -373,6 +402,8 @@ public:
     printStatsHeader();
     static void
     printStats(bool is_target, size_t block_size, size_t batch_size, xferBenchStats stats);
+    static void
+    printClassStats(const std::string &traffic_class, const xferMetricStats &duration);
 };
 
 #endif
@@ -118,6 +118,10 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
     nixlAgentConfig dev_meta;
     dev_meta.useProgThread = enable_pt;
     dev_meta.syncMode = sync_mode;
+    if (xferBenchConfig::bulk_rate_limit > 0) {
+        dev_meta.trafficClassLimits[nixl_traffic_class_t::BULK].bytesPerSec =
+            xferBenchConfig::bulk_rate_limit * 1000 * 1000;
+    }
 
     agent = new nixlAgent(name, dev_meta);
 
@@ -128,6 +132,7 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
         0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_GPUNETIO) ||
         0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_MOONCAKE) ||
         0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_UCCL) ||
+        0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_SHM) ||
         xferBenchConfig::isStorageBackend()) {
         backend_name = xferBenchConfig::backend;
     } else {
@@ -309,6 +314,12 @@ xferBenchNixlWorker::xferBenchNixlWorker(const std::vector<std::string> &devices
         backend_params["container_name"] = xferBenchConfig::azure_blob_container_name;
         backend_params["connection_string"] = xferBenchConfig::azure_blob_connection_string;
         std::cout << "AZURE_BLOB backend" << std::endl;
+    } else if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_SHM)) {
+        backend_params["num_threads"] = std::to_string(xferBenchConfig::shm_num_threads);
+        // Benchmark processes are not related, so Yama would refuse cross-memory attach
+        backend_params["set_ptracer"] = "1";
+        std::cout << "SHM backend with " << xferBenchConfig::shm_num_threads << " copy threads"
+                  << std::endl;
     } else {
         std::cerr << "Unsupported NIXLBench backend: " << xferBenchConfig::backend << std::endl;
         exit(EXIT_FAILURE);
@@ -1335,6 +1346,129 @@ execTransferIterations(nixlAgent *agent,
     return 0;
 }
 
+// Execute transfers keeping up to xferBenchConfig::inflight requests outstanding.
+// With a non-zero xferBenchConfig::rate, requests are issued open-loop on a fixed schedule and
+// latency is measured from the scheduled issue time, so queueing delay shows up in the tail.
+static int
+execPipelinedIterations(nixlAgent *agent,
+                        const nixl_xfer_op_t op,
+                        nixl_xfer_dlist_t &local_desc,
+                        nixl_xfer_dlist_t &remote_desc,
+                        const std::string &target,
+                        nixl_opt_args_t &params,
+                        const int num_iter,
+                        xferBenchTimer &timer,
+                        xferBenchStats &thread_stats,
+                        const std::atomic<int> *terminate_ptr = nullptr) {
+    const int depth = std::min(xferBenchConfig::inflight, num_iter);
+    std::vector<nixlXferReqH *> reqs(depth, nullptr);
+    std::vector<nixlTime::ns_t> issue_ns(depth, 0);
+    std::vector<int> free_slots;
+    std::vector<int> active_slots;
+    free_slots.reserve(depth);
+    active_slots.reserve(depth);
+
+    auto release_all = [&]() {
+        for (nixlXferReqH *req : reqs) {
+            if (req != nullptr) {
+                agent->releaseXferReq(req);
+            }
+        }
+    };
+
+    for (int slot = depth - 1; slot >= 0; --slot) {
+        nixl_status_t create_rc =
+            agent->createXferReq(op, local_desc, remote_desc, target, reqs[slot], &params);
+        if (NIXL_SUCCESS != create_rc) {
+            std::cerr << "createXferReq failed: " << nixlEnumStrings::statusStr(create_rc)
+                      << std::endl;
+            release_all();
+            return -1;
+        }
+        free_slots.push_back(slot);
+    }
+    if (depth > 0) {
+        thread_stats.prepare_duration.add(double(timer.lap()) / depth);
+    }
+
+    const nixlTime::ns_t interval_ns =
+        xferBenchConfig::rate > 0 ? 1000000000 / xferBenchConfig::rate : 0;
+    nixlTime::ns_t next_issue_ns = nixlTime::getNs();
+    int posted = 0;
+    int completed = 0;
+
+    auto complete = [&](int slot, nixlTime::ns_t now_ns) {
+        thread_stats.transfer_duration.add((now_ns - issue_ns[slot]) / 1e3);
+        free_slots.push_back(slot);
+        ++completed;
+    };
+
+    while (completed < num_iter) {
+        // Check for signal (SIGTERM/SIGINT) to allow fast exit on peer death
+        if (__builtin_expect(terminate_ptr && terminate_ptr->load(), 0)) {
+            release_all();
+            return -1;
+        }
+
+        // Issue into free slots; in open-loop mode only once the scheduled time has arrived
+        while (posted < num_iter && !free_slots.empty()) {
+            const nixlTime::ns_t now_ns = nixlTime::getNs();
+            if (interval_ns > 0 && now_ns < next_issue_ns) {
+                break;
+            }
+
+            const int slot = free_slots.back();
+            free_slots.pop_back();
+            issue_ns[slot] = interval_ns > 0 ? next_issue_ns : now_ns;
+            next_issue_ns += interval_ns;
+
+            nixl_status_t rc = agent->postXferReq(reqs[slot]);
+            const nixlTime::ns_t posted_ns = nixlTime::getNs();
+            thread_stats.post_duration.add((posted_ns - now_ns) / 1e3);
+            ++posted;
+
+            if (NIXL_SUCCESS == rc) {
+                complete(slot, posted_ns);
+            } else if (NIXL_IN_PROG == rc) {
+                active_slots.push_back(slot);
+            } else {
+                std::cout << "NIXL Xfer failed with status: " << nixlEnumStrings::statusStr(rc)
+                          << std::endl;
+                release_all();
+                return -1;
+            }
+        }
+
+        for (size_t i = 0; i < active_slots.size();) {
+            const int slot = active_slots[i];
+            nixl_status_t rc = agent->getXferStatus(reqs[slot]);
+            if (NIXL_IN_PROG == rc) {
+                ++i;
+                continue;
+            }
+            if (__builtin_expect(rc != NIXL_SUCCESS, 0)) {
+                std::cout << "NIXL Xfer failed with status: " << nixlEnumStrings::statusStr(rc)
+                          << std::endl;
+                release_all();
+                return -1;
+            }
+            complete(slot, nixlTime::getNs());
+            active_slots[i] = active_slots.back();
+            active_slots.pop_back();
+        }
+    }
+    timer.lap();
+
+    for (nixlXferReqH *req : reqs) {
+        if (__builtin_expect(agent->releaseXferReq(req) != NIXL_SUCCESS, 0)) {
+            std::cout << "NIXL releaseXferReq failed" << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 static int
 execTransfer(nixlAgent *agent,
              const std::vector<std::vector<xferBenchIOV>> &local_iovs,
@@ -1368,24 +1502,46 @@ execTransfer(nixlAgent *agent,
         if (!xferBenchConfig::isStorageBackend()) {
             params.notif = "0xBEEF";
         }
+        const bool bulk_thread = tid < xferBenchConfig::bulk_threads;
+        if (xferBenchConfig::bulk_threads > 0) {
+            params.trafficClass =
+                bulk_thread ? nixl_traffic_class_t::BULK : nixl_traffic_class_t::LATENCY;
+        }
 
         // Execute transfers
-        const int result = execTransferIterations(agent,
-                                                  op,
-                                                  local_desc,
-                                                  remote_desc,
-                                                  target,
-                                                  params,
-                                                  num_iter,
-                                                  timer,
-                                                  thread_stats,
-                                                  xferBenchConfig::recreate_xfer,
-                                                  terminate_ptr);
+        const bool pipelined = xferBenchConfig::inflight > 1 || xferBenchConfig::rate > 0;
+        const int result = pipelined ? execPipelinedIterations(agent,
+                                                               op,
+                                                               local_desc,
+                                                               remote_desc,
+                                                               target,
+                                                               params,
+                                                               num_iter,
+                                                               timer,
+                                                               thread_stats,
+                                                               terminate_ptr) :
+                                       execTransferIterations(agent,
+                                                              op,
+                                                              local_desc,
+                                                              remote_desc,
+                                                              target,
+                                                              params,
+                                                              num_iter,
+                                                              timer,
+                                                              thread_stats,
+                                                              xferBenchConfig::recreate_xfer,
+                                                              terminate_ptr);
 
         if (__builtin_expect(result != 0, 0)) {
             ret = result;
         }
 
+        if (xferBenchConfig::bulk_threads > 0) {
+            auto &class_duration = bulk_thread ? thread_stats.bulk_class_duration :
+                                                 thread_stats.latency_class_duration;
+            class_duration.add(thread_stats.transfer_duration);
+        }
+
 #pragma omp critical
         { stats.add(thread_stats); }
     }
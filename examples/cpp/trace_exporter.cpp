@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "telemetry/trace.h"
+
+namespace fs = std::filesystem;
+
+void
+usage() {
+    std::cout << "Usage: trace_exporter <trace_dir> [output_file]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  <trace_dir>      Directory set in " << TRACE_DIR_VAR << " for the agents"
+              << std::endl;
+    std::cout << "  [output_file]    Chrome trace JSON output, stdout if omitted. It can be"
+              << std::endl;
+    std::cout << "                   opened in chrome://tracing or ui.perfetto.dev" << std::endl;
+    exit(0);
+}
+
+int
+main(int argc, char *argv[]) {
+    if (argc < 2 || argv[1] == std::string("-h") || argv[1] == std::string("--help")) {
+        usage();
+    }
+
+    const fs::path trace_dir = argv[1];
+    if (!fs::is_directory(trace_dir)) {
+        std::cerr << "Trace directory " << trace_dir << " does not exist" << std::endl;
+        return 1;
+    }
+
+    std::ofstream out_file;
+    if (argc > 2) {
+        out_file.open(argv[2]);
+        if (!out_file) {
+            std::cerr << "Failed to open output file " << argv[2] << std::endl;
+            return 1;
+        }
+    }
+
+    // Draining consumes the events, so the agents can keep tracing into the same buffers
+    std::ostream &out = out_file.is_open() ? out_file : std::cout;
+    const int64_t count = nixlTraceWriteChrome(trace_dir, out);
+    if (count < 0) {
+        return 1;
+    }
+
+    std::cerr << "Exported " << count << " trace events" << std::endl;
+    return 0;
+}
@@ -33,7 +33,7 @@ logging.basicConfig(
 logger = logging.getLogger(__name__)
 
 # Constants from telemetry_event.h
-TELEMETRY_VERSION = 2
+TELEMETRY_VERSION = 3
 
 # NIXL telemetry categories
 NIXL_TELEMETRY_MEMORY = 0
@@ -67,6 +67,20 @@ AGENT_ERR_NOT_SUPPORTED = 16
 AGENT_ERR_REMOTE_DISCONNECT = 17
 AGENT_ERR_CANCELED = 18
 AGENT_ERR_NO_TELEMETRY = 19
+AGENT_REG_CACHE_HITS = 20
+AGENT_REG_CACHE_MISSES = 21
+AGENT_THROTTLED_REQUESTS = 22
+AGENT_THROTTLE_TIME = 23
+
+# Label kinds (nixl_telemetry_label_t) and reserved label ids
+LABEL_BACKEND = 0
+LABEL_PEER = 1
+TELEMETRY_LABEL_NONE = 0
+
+# Suffix of the file, next to the buffer, that maps label ids to names
+TELEMETRY_LABELS_SUFFIX = ".labels"
+
+_OP_STRINGS = {1: "READ", 2: "WRITE"}
 
 # Global flag for graceful shutdown
 running = True
@@ -89,6 +103,10 @@ class NixlTelemetryEvent(ctypes.Structure):
         ("event_type", ctypes.c_uint8),
         ("_padding", ctypes.c_char * 3),
         ("value", ctypes.c_uint64),
+        ("backend_id", ctypes.c_uint16),
+        ("peer_id", ctypes.c_uint16),
+        ("op", ctypes.c_uint8),
+        ("_padding2", ctypes.c_char * 3),
     ]
 
 
@@ -262,9 +280,45 @@ _EVENT_TYPE_STRINGS = {
     AGENT_ERR_REMOTE_DISCONNECT: "agent_err_remote_disconnect",
     AGENT_ERR_CANCELED: "agent_err_canceled",
     AGENT_ERR_NO_TELEMETRY: "agent_err_no_telemetry",
+    AGENT_REG_CACHE_HITS: "agent_reg_cache_hits",
+    AGENT_REG_CACHE_MISSES: "agent_reg_cache_misses",
+    AGENT_THROTTLED_REQUESTS: "agent_throttled_requests",
+    AGENT_THROTTLE_TIME: "agent_throttle_time",
 }
 
 
+class TelemetryLabels:
+    """Label names of the ids carried by events, read from the exporter's labels file"""
+
+    def __init__(self, file_path):
+        self.file_path = file_path + TELEMETRY_LABELS_SUFFIX
+        self.offset = 0
+        self.names = {LABEL_BACKEND: {}, LABEL_PEER: {}}
+
+    def _load(self):
+        """Read the labels appended since the last load"""
+        try:
+            with open(self.file_path) as labels_file:
+                labels_file.seek(self.offset)
+                for line in iter(labels_file.readline, ""):
+                    if not line.endswith("\n"):
+                        break
+                    self.offset = labels_file.tell()
+                    kind, label_id, name = line.rstrip("\n").split("\t", 2)
+                    self.names.setdefault(int(kind), {})[int(label_id)] = name
+        except (OSError, ValueError) as e:
+            logger.debug("Could not read labels file %s: %s", self.file_path, e)
+
+    def resolve(self, kind, label_id):
+        """Name of a label id, or None for events without this label"""
+        if label_id == TELEMETRY_LABEL_NONE:
+            return None
+        names = self.names.setdefault(kind, {})
+        if label_id not in names:
+            self._load()
+        return names.get(label_id, f"unknown_{label_id}")
+
+
 def get_telemetry_category_string(category):
     """Get string representation of telemetry category"""
     return _CATEGORY_STRINGS.get(category, f"UNKNOWN_CATEGORY_{category}")
@@ -275,7 +329,7 @@ def get_telemetry_event_type_string(event_type):
     return _EVENT_TYPE_STRINGS.get(event_type, f"unknown_event_{event_type}")
 
 
-def print_telemetry_event(event):
+def print_telemetry_event(event, labels):
     """Print telemetry event in a formatted way"""
     logger.info("\n=== NIXL Telemetry Event ===")
 
@@ -285,6 +339,15 @@ def print_telemetry_event(event):
     logger.info("Category: %s", category_str)
     logger.info("Event: %s", event_name)
     logger.info("Value: %s", event.value)
+
+    backend = labels.resolve(LABEL_BACKEND, event.backend_id)
+    if backend is not None:
+        logger.info("Backend: %s", backend)
+    remote_agent = labels.resolve(LABEL_PEER, event.peer_id)
+    if remote_agent is not None:
+        logger.info("Remote agent: %s", remote_agent)
+    if event.op in _OP_STRINGS:
+        logger.info("Operation: %s", _OP_STRINGS[event.op])
     logger.info("===========================")
 
 
@@ -310,6 +373,7 @@ def main():
         logger.info("Press Ctrl+C to stop reading telemetry...")
 
         buffer = SharedRingBuffer(telemetry_file_name, version=TELEMETRY_VERSION)
+        labels = TelemetryLabels(telemetry_file_name)
 
         logger.info(
             "Successfully opened telemetry buffer (version: %d)", buffer.get_version()
@@ -325,7 +389,7 @@ def main():
             event = buffer.pop()
             if event:
                 event_count += 1
-                print_telemetry_event(event)
+                print_telemetry_event(event, labels)
             else:
                 # No events available, sleep briefly
                 time.sleep(0.5)
@@ -33,6 +33,8 @@ struct nixlBackendOptionalArgs {
     nixl_blob_t notifMsg;
     bool        hasNotif = false;
     nixl_blob_t customParam;
+    // Traffic class of the transfer, a backend can map classes to separate resources
+    nixl_traffic_class_t trafficClass = nixl_traffic_class_t::DEFAULT;
 };
 
 using nixl_opt_b_args_t = nixlBackendOptionalArgs;
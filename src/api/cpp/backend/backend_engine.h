@@ -152,6 +152,15 @@ class nixlBackendEngine {
         //Backend aborts the transfer if necessary, and destructs the relevant objects
         virtual nixl_status_t releaseReqH(nixlBackendReqH* handle) const = 0;
 
+        // Aborts a posted transfer and keeps the handle. Returns NIXL_ERR_CANCELED once the
+        // buffers are not accessed anymore, or NIXL_IN_PROG while the abort completes in the
+        // background, in which case checkXfer returns NIXL_ERR_CANCELED afterwards. A transfer
+        // that completed before it could be aborted returns its final status.
+        virtual nixl_status_t
+        cancelXfer(nixlBackendReqH *handle) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
         // Prepare a memory view for remote buffers
         virtual nixl_status_t
         prepMemView(const nixl_remote_meta_dlist_t &,
@@ -223,6 +232,51 @@ class nixlBackendEngine {
 
         // *** Optional virtual methods that are good to be implemented in any backend *** //
 
+        // Determines if loadRemoteMD can be called from several threads at once for the same
+        // remote agent, so the agent can spread loading large metadata over a few threads
+        virtual bool
+        supportsConcurrentLoadMD() const {
+            return false;
+        }
+
+        // Determines if a handle from prepXfer can be posted again with other descriptors of
+        // the same count, memory types and remote agent, so the agent can keep it for the next
+        // request of a transfer plan instead of preparing a new one
+        virtual bool
+        supportsPrepReuse() const {
+            return false;
+        }
+
+        // Determines if the backend is only used by transfers that name it in their backends
+        // list, so that the agent never selects it on its own, e.g. a backend moving no data
+        virtual bool
+        explicitSelectionOnly() const {
+            return false;
+        }
+
+        // Register all the memories of a list at once, so a backend can register them in
+        // parallel or with vectored calls. On success out holds one metadata per descriptor
+        // in list order, on failure nothing stays registered and out is left empty.
+        virtual nixl_status_t
+        registerMems(const nixl_reg_dlist_t &mems, std::vector<nixlBackendMD *> &out) {
+            const nixl_mem_t nixl_mem = mems.getType();
+            out.clear();
+            out.reserve(mems.descCount());
+            for (const auto &mem : mems) {
+                nixlBackendMD *meta = nullptr;
+                const nixl_status_t ret = registerMem(mem, nixl_mem, meta);
+                if (ret != NIXL_SUCCESS) {
+                    for (nixlBackendMD *registered : out) {
+                        deregisterMem(registered);
+                    }
+                    out.clear();
+                    return ret;
+                }
+                out.push_back(meta);
+            }
+            return NIXL_SUCCESS;
+        }
+
         // Query information about a list of memory/storage
         virtual nixl_status_t
         queryMem(const nixl_reg_dlist_t &descs, std::vector<nixl_query_resp_t> &resp) const {
@@ -232,7 +286,8 @@ class nixlBackendEngine {
             return NIXL_ERR_NOT_SUPPORTED;
         }
 
-        // Estimate the cost (duration) of a transfer operation.
+        // Estimate the cost (duration) of a transfer operation. The handle is null when the
+        // agent estimates before prepXfer to choose between backends in createXferReq.
         virtual nixl_status_t
         estimateXferCost(const nixl_xfer_op_t &operation,
                          const nixl_meta_dlist_t &local,
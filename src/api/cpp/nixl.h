@@ -36,6 +36,14 @@ class nixlAgent {
         /** @var  data  The members in agent class wrapped into single nixlAgentData member. */
         const std::unique_ptr<nixlAgentData> data;
 
+        nixl_status_t
+        createStagedXferReq(const nixl_xfer_op_t &operation,
+                            const nixl_xfer_dlist_t &local_descs,
+                            const nixl_xfer_dlist_t &remote_descs,
+                            const std::string &remote_agent,
+                            nixlXferReqH *&req_hndl,
+                            const nixl_opt_args_t &extra_params) const;
+
     public:
         /*** Initialization and Registering Methods ***/
 
@@ -220,6 +228,30 @@ class nixlAgent {
                      const std::vector<int> &remote_indices,
                      nixlXferReqH* &req_hndl,
                      const nixl_opt_args_t* extra_params = nullptr) const;
+        /**
+         * @brief  Make a transfer request `req_hndl` from compact index runs over already
+         *         prepared descriptor list handles. Equivalent to the index list version with
+         *         the runs expanded in order, but the runs are validated in O(runs) and the
+         *         merged descriptors are emitted directly, without per-index vectors. Both sides
+         *         must expand to the same number of indices.
+         *
+         * @param  operation        Operation for transfer (e.g., NIXL_WRITE)
+         * @param  local_side       Local prepared descriptor list handle
+         * @param  local_runs       Index runs into the local prepared descriptor list handle
+         * @param  remote_side      Remote (or loopback) prepared descriptor list handle
+         * @param  remote_runs      Index runs into the remote prepared descriptor list handle
+         * @param  req_handle [out] Transfer request handle output
+         * @param  extra_params     Optional additional parameters used in making a transfer request
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        makeXferReq(const nixl_xfer_op_t &operation,
+                    const nixlDlistH *local_side,
+                    const nixl_index_runs_t &local_runs,
+                    const nixlDlistH *remote_side,
+                    const nixl_index_runs_t &remote_runs,
+                    nixlXferReqH *&req_hndl,
+                    const nixl_opt_args_t *extra_params = nullptr) const;
         /**
          * @brief  A combined API, to create a transfer request from two descriptor lists.
          *         NIXL will prepare each side and create a transfer handle `req_hndl`.
@@ -238,6 +270,8 @@ class nixlAgent {
          *         pre-processing done in the preparation step. If a list of backends hints is
          *         provided (via extra_params), the selection is limited to the specified backends.
          *         Optionally, a notification message can also be provided through extra_params.
+         *         With a staging pool in extra_params, the local descriptors can be unregistered
+         *         DRAM, which is copied through buffers of the pool (see createStagingPool).
          *
          * @param  operation      Operation for transfer (e.g., NIXL_WRITE)
          * @param  local_descs    Local descriptor list
@@ -255,6 +289,61 @@ class nixlAgent {
                        nixlXferReqH* &req_hndl,
                        const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Compile a transfer plan from two descriptor lists, for transfers that repeat
+         *         the same shape at other addresses, e.g. the same blocks of other layers or
+         *         sequences. The backend is selected as in createXferReq, and the descriptors
+         *         are resolved and merged once. Requests are then made from the plan by
+         *         makeXferReq with byte offsets, without any lookup. The plan must be
+         *         recompiled if the memory it covers is deregistered or the remote metadata
+         *         is invalidated.
+         *
+         * @param  operation      Operation for transfer (e.g., NIXL_WRITE)
+         * @param  local_descs    Local descriptor list of the template
+         * @param  remote_descs   Remote (or loopback) descriptor list of the template
+         * @param  remote_agent   Remote (or self) agent name for accessing the remote (local) data
+         * @param  plan [out]     Transfer plan handle output
+         * @param  extra_params   Optional extra parameters, as in createXferReq
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        compileXferPlan(const nixl_xfer_op_t &operation,
+                        const nixl_xfer_dlist_t &local_descs,
+                        const nixl_xfer_dlist_t &remote_descs,
+                        const std::string &remote_agent,
+                        nixlXferPlanH *&plan,
+                        const nixl_opt_args_t *extra_params = nullptr) const;
+
+        /**
+         * @brief  Make a transfer request from a transfer plan. Each pair of offsets adds a
+         *         copy of the plan's descriptors, shifted by the local and remote offset in
+         *         bytes, and every copy must stay in the registered regions of the template.
+         *         Copies that are back to back in memory are merged. When the backend can reuse
+         *         prepared handles, the handles of released requests of the plan are reused
+         *         instead of preparing new ones.
+         *
+         * @param  plan           Transfer plan handle from compileXferPlan
+         * @param  local_offsets  Byte offsets of the local descriptors, one per copy
+         * @param  remote_offsets Byte offsets of the remote descriptors, one per copy
+         * @param  req_hndl [out] Transfer request handle output
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        makeXferReq(nixlXferPlanH *plan,
+                    const std::vector<int64_t> &local_offsets,
+                    const std::vector<int64_t> &remote_offsets,
+                    nixlXferReqH *&req_hndl) const;
+
+        /**
+         * @brief  Release a transfer plan. All the requests made from it must have been
+         *         released.
+         *
+         * @param  plan           Transfer plan handle to be released
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        releaseXferPlan(nixlXferPlanH *plan) const;
+
         /*** Operations on prepared Transfer Request ***/
 
         /**
@@ -280,7 +369,9 @@ class nixlAgent {
          *         In case of small transfers that are completed within the call, return value
          *         will be NIXL_SUCCESS. Otherwise, the output status will be NIXL_IN_PROG until
          *         completion. Notification  message  can be preovided through the extra_params,
-         *         and can be updated per re-post.
+         *         and can be updated per re-post. A request over a rate limit of its traffic
+         *         class, backend or remote agent is queued by the agent, reported as
+         *         NIXL_IN_PROG, and posted by later postXferReq/getXferStatus calls.
          *
          * @param  req_hndl      Transfer request handle obtained from makeXferReq/createXferReq
          * @param  extra_params  Optional extra parameters used in posting a transfer request
@@ -299,6 +390,21 @@ class nixlAgent {
         nixl_status_t
         getXferStatus (nixlXferReqH* req_hndl) const;
 
+        /**
+         * @brief  Cancel the transfer of `req_hndl` if it is still in progress. The request
+         *         is kept and can be reposted or released. A backend may complete the abort
+         *         in the background, in which case getXferStatus returns NIXL_IN_PROG until
+         *         the buffers are not accessed anymore, and then NIXL_ERR_CANCELED.
+         *
+         * @param  req_hndl      Transfer request handle after postXferReq
+         * @return nixl_status_t NIXL_ERR_CANCELED if the transfer was canceled, NIXL_IN_PROG
+         *                       while it is being canceled, NIXL_ERR_NOT_SUPPORTED if the
+         *                       backend cannot cancel transfers, or the final status of a
+         *                       transfer that was not in progress anymore
+         */
+        nixl_status_t
+        cancelXferReq(nixlXferReqH *req_hndl) const;
+
 
         /**
          * @brief  Get the telemetry data associated with `req_hndl`.
@@ -322,6 +428,24 @@ class nixlAgent {
         queryXferBackend (const nixlXferReqH* req_hndl,
                           nixlBackendH* &backend) const;
 
+        /**
+         * @brief  Query the backend associated with `req_hndl` and the reason it was selected.
+         *         createXferReq picks among the backends that can perform the transfer by the
+         *         lowest duration learned from completed transfers, then by the backends' own
+         *         estimateXferCost, and finally by preference order: the order of
+         *         extra_params->backends, or the backend creation order. Periodically the
+         *         backend sampled least recently is picked instead, to keep learning its cost.
+         *
+         * @param  req_hndl      Transfer request handle obtained from makeXferReq/createXferReq
+         * @param  backend [out] Output backend handle chosen for the transfer request
+         * @param  choice  [out] Output reason for which the backend was chosen
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        queryXferBackend(const nixlXferReqH *req_hndl,
+                         nixlBackendH *&backend,
+                         nixl_backend_choice_t &choice) const;
+
         /**
          * @brief  Release the transfer request `req_hndl`. If the transfer is active,
          *         it will be canceled, or return an error if the transfer cannot be aborted.
@@ -389,6 +513,57 @@ class nixlAgent {
         nixl_status_t
         releasedDlistH (nixlDlistH* dlist_hndl) const;
 
+        /**
+         * @brief  Create a pool of DRAM staging buffers and register it once. The pool is
+         *         mapped on 1 GB huge pages when it is at least 1 GB, else on 2 MB huge pages,
+         *         and on regular pages with transparent huge pages requested when none are
+         *         reserved. It is registered with all the backends supporting DRAM, or the
+         *         ones listed in extra_params. Buffers are then taken from the pool without
+         *         locking or registering, and can be used in transfers right away.
+         *
+         * @param  pool_size     Size of the pool in bytes, rounded up to the page size
+         * @param  buffer_size   Size of each staging buffer in bytes
+         * @param  pool [out]    Handle of the created pool
+         * @param  extra_params  Optional extra parameters used in registering the pool
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        createStagingPool(size_t pool_size,
+                          size_t buffer_size,
+                          nixlStagingPoolH *&pool,
+                          const nixl_opt_args_t *extra_params = nullptr);
+
+        /**
+         * @brief  Take a free buffer from a staging pool. This call is thread safe and
+         *         lock-free.
+         *
+         * @param  pool          Staging pool handle
+         * @param  buffer [out]  Descriptor of the buffer, of the buffer size of the pool
+         * @return nixl_status_t NIXL_ERR_NOT_FOUND if all the buffers are in use
+         */
+        nixl_status_t
+        getStagingBuffer(nixlStagingPoolH *pool, nixlBasicDesc &buffer) const;
+
+        /**
+         * @brief  Return a buffer taken by getStagingBuffer to its staging pool.
+         *
+         * @param  pool          Staging pool handle
+         * @param  buffer        Descriptor of the buffer
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseStagingBuffer(nixlStagingPoolH *pool, const nixlBasicDesc &buffer) const;
+
+        /**
+         * @brief  Deregister and release a staging pool. All of its buffers must have been
+         *         released, including the ones held by staged transfer requests.
+         *
+         * @param  pool          Staging pool handle to be released
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseStagingPool(nixlStagingPoolH *pool);
+
 
         /*** Notification Handling ***/
 
@@ -406,6 +581,50 @@ class nixlAgent {
         getNotifs (nixl_notifs_t &notif_map,
                    const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Remove and return all notifications received from `remote_agent` that
+         *         match `tag`, in the order they were received. New notifications are first
+         *         collected from the backends, and the ones that do not match are kept by
+         *         the agent. They are returned by later calls, including getNotifs.
+         *
+         * @param  remote_agent  Name of the agent that sent the notifications
+         * @param  tag           Tag to match, an empty tag matches every message
+         * @param  msgs    [out] Matching messages, appended to the vector
+         * @param  match         Whether the tag must be a prefix of the message, or any part of it
+         * @param  extra_params  Optional extra parameters used in getting notifications
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        popMatchingNotifs(const std::string &remote_agent,
+                          const nixl_blob_t &tag,
+                          std::vector<nixl_blob_t> &msgs,
+                          nixl_notif_match_t match = nixl_notif_match_t::PREFIX,
+                          const nixl_opt_args_t *extra_params = nullptr);
+
+        /**
+         * @brief  Wait for a notification from `remote_agent` matching `tag`, and remove it.
+         *         Notifications are collected from the backends until a match arrives or the
+         *         timeout expires, polling with a short backoff that releases the agent lock
+         *         between polls. Non-matching notifications are kept by the agent, as in
+         *         popMatchingNotifs. A zero timeout checks once without waiting.
+         *
+         * @param  remote_agent  Name of the agent that sent the notification
+         * @param  tag           Tag to match, an empty tag matches every message
+         * @param  msg     [out] The earliest matching message
+         * @param  timeout       Maximum time to wait
+         * @param  match         Whether the tag must be a prefix of the message, or any part of it
+         * @param  extra_params  Optional extra parameters used in getting notifications
+         * @return nixl_status_t NIXL_SUCCESS if a message was found, NIXL_IN_PROG if none
+         *                       arrived before the timeout, or an error code
+         */
+        nixl_status_t
+        waitNotif(const std::string &remote_agent,
+                  const nixl_blob_t &tag,
+                  nixl_blob_t &msg,
+                  chrono_period_us_t timeout,
+                  nixl_notif_match_t match = nixl_notif_match_t::PREFIX,
+                  const nixl_opt_args_t *extra_params = nullptr);
+
         /**
          * @brief  Generate a notification, not bound to a transfer, e.g., for control.
          *         Metadata of remote agent should be available before this call. The
@@ -518,7 +737,9 @@ class nixlAgent {
          * @brief  Fetch other agent's metadata from a peer or central metadata server,
          *         then unpack it internally. When fetching from a peer, only the full metadata
          *         is supported. When fetching from a central metadata server, the metadataLabel
-         *         can be specified to fetch partial metadata.
+         *         can be specified to fetch partial metadata. With the central metadata server
+         *         or the node-local store, metadata that is not published yet is loaded once
+         *         it appears, use checkRemoteMD to wait for it.
          *
          * @param  remote_name   Name of remote agent to fetch from ETCD or socket.
          * @param  extra_params  Only to optionally specify IP address and/or port.
@@ -535,6 +756,27 @@ class nixlAgent {
         fetchRemoteMD (const std::string remote_name,
                        const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Fetch the metadata of many agents from the central metadata server with a
+         *         single range read of the metadata namespace, then unpack it internally.
+         *         A single prefix watch keeps a local copy of the namespace up to date
+         *         afterwards, so later fetchRemoteMD calls for these agents, and their
+         *         invalidation, need no further requests per agent. Agents that have not
+         *         published their metadata yet are loaded once they do.
+         *
+         * @param  remote_names  Names of remote agents to fetch. If empty, all other agents
+         *                       that published metadata under the label are fetched.
+         * @param  extra_params  If metadataLabel is specified, it will be used as the label of
+         *                       the metadata to be fetched. Otherwise, the default label of the
+         *                       full metadata will be used. Peer to peer fetching through
+         *                       ipAddr is not supported.
+         *
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        prefetchRemoteMD(const std::vector<std::string> &remote_names,
+                         const nixl_opt_args_t *extra_params = nullptr);
+
         /**
          * @brief  Invalidate your own memory in one/all remote agent(s).
          *
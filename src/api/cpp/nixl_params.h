@@ -19,8 +19,29 @@
 
 #include <string>
 #include <cstdint>
+#include <unordered_map>
 #include "nixl_types.h"
 
+/**
+ * @struct nixlRateLimit
+ * @brief Limit on the rate of transfers, enforced by the agent with a token bucket per
+ *        limited quantity. Each descriptor of a request counts as one operation.
+ */
+struct nixlRateLimit {
+    /** @var Sustained rate in bytes per second, 0 for no limit */
+    uint64_t bytesPerSec = 0;
+    /**
+     * @var Bucket depth in bytes, the bytes that can be posted at once after an idle period.
+     *      0 selects the bytes of 10 ms at bytesPerSec. A request larger than the depth is
+     *      posted once the bucket is full, and the next posts wait until it is paid back.
+     */
+    uint64_t burstBytes = 0;
+    /** @var Sustained rate in operations (descriptors) per second, 0 for no limit */
+    uint64_t opsPerSec = 0;
+    /** @var Bucket depth in operations, 0 selects the operations of 10 ms at opsPerSec */
+    uint64_t burstOps = 0;
+};
+
 /**
  * @struct nixlAgentConfig
  * @brief Per Agent configuration information, such as if progress thread should be used.
@@ -68,6 +89,28 @@ struct nixlAgentConfig {
      */
     std::chrono::microseconds etcdWatchTimeout = kDefaultEtcdWatchTimeout;
 
+    /**
+     * @var Rate limits of traffic classes. Posts of a limited class are paced by a token
+     *      bucket: a request over the limit is queued by postXferReq, which returns
+     *      NIXL_IN_PROG, and is posted in order by a later postXferReq or getXferStatus
+     *      call of any request once tokens are available. Other classes are not paced.
+     */
+    std::unordered_map<nixl_traffic_class_t, nixlRateLimit> trafficClassLimits;
+
+    /**
+     * @var Rate limits of backends, by backend type. Posts through a limited backend are
+     *      queued and posted like those of a limited traffic class, so that bulk transfers
+     *      do not saturate the device the backend drives.
+     */
+    std::unordered_map<nixl_backend_t, nixlRateLimit> backendLimits;
+
+    /**
+     * @var Rate limits of remote agents, by agent name. Posts to a limited agent are queued
+     *      and posted like those of a limited traffic class. A request is posted once all
+     *      the limits that apply to it (class, backend and remote agent) admit it.
+     */
+    std::unordered_map<std::string, nixlRateLimit> remoteAgentLimits;
+
     /**
      * @brief  Default constructor.
      */
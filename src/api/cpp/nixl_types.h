@@ -28,7 +28,9 @@ class nixlSerDes;
 class nixlDlistH;
 class nixlBackendH;
 class nixlXferReqH;
+class nixlXferPlanH;
 class nixlAgentData;
+class nixlStagingPoolH;
 
 
 /*** NIXL memory type, operation and status enums ***/
@@ -78,6 +80,42 @@ enum class nixl_thread_sync_t {
     NIXL_THREAD_SYNC_DEFAULT = NIXL_THREAD_SYNC_NONE,
 };
 
+/**
+ * @enum nixl_backend_choice_t
+ * @brief An enumeration of the reasons for which createXferReq selected a backend,
+ *        when more than one backend could perform the transfer.
+ */
+enum class nixl_backend_choice_t {
+    SINGLE_CANDIDATE = 0, // Only one backend had the required registrations
+    LEARNED_COST = 1, // Lowest duration predicted from completed transfers
+    BACKEND_ESTIMATE = 2, // Lowest duration reported by the backends' estimateXferCost
+    PREFERENCE_ORDER = 3, // First in the backends hint list, or in backend creation order
+    EXPLORATION = 4, // Sampled least recently, chosen periodically to keep its learned cost,
+                     // never when a backends hint list is given
+};
+
+/**
+ * @enum nixl_notif_match_t
+ * @brief An enumeration of the ways a tag is matched against notification messages
+ *        in waitNotif and popMatchingNotifs.
+ */
+enum class nixl_notif_match_t {
+    PREFIX = 0, // Message starts with the tag
+    SUBSTRING = 1, // Message contains the tag anywhere
+};
+
+/**
+ * @enum nixl_traffic_class_t
+ * @brief An enumeration of traffic classes of transfer requests. The agent paces the posts
+ *        of a class by the rate limit configured for it in nixlAgentConfig, and posts the
+ *        requests held back by the limits in class order, highest priority first.
+ */
+enum class nixl_traffic_class_t {
+    LATENCY = 0, // Latency sensitive transfers, highest priority
+    DEFAULT = 1, // Transfers that did not specify a class
+    BULK = 2, // Throughput oriented background transfers, lowest priority
+};
+
 /**
  * @namespace nixlEnumStrings
  * @brief     This namespace to get string representation
@@ -87,6 +125,8 @@ namespace nixlEnumStrings {
     std::string memTypeStr(const nixl_mem_t &mem);
     std::string xferOpStr (const nixl_xfer_op_t &op);
     std::string statusStr (const nixl_status_t &status);
+    std::string backendChoiceStr(const nixl_backend_choice_t &choice);
+    std::string trafficClassStr(const nixl_traffic_class_t &traffic_class);
 }
 
 
@@ -160,6 +200,26 @@ enum class nixl_cost_t {
  */
 using nixl_query_resp_t = std::optional<nixl_b_params_t>;
 
+/**
+ * @struct nixlIndexRun
+ * @brief  A compact run of indices into a prepared descriptor list handle, selecting
+ *         `count` descriptors starting at `start` and advancing by `stride` each step,
+ *         i.e. start, start + stride, ..., start + (count - 1) * stride.
+ *         The layout is three packed 32-bit integers, so an (N, 3) int32 array can be
+ *         reinterpreted as a list of runs.
+ */
+struct nixlIndexRun {
+    int start;
+    int count;
+    int stride = 1;
+};
+
+/**
+ * @brief A typedef for a std::vector<nixlIndexRun>, a compressed list of descriptor
+ *        indices used in makeXferReq. Runs are expanded in order.
+ */
+using nixl_index_runs_t = std::vector<nixlIndexRun>;
+
 
 /**
  * @struct nixlAgentOptionalArgs
@@ -227,6 +287,33 @@ struct nixlAgentOptionalArgs {
      */
     std::string metadataLabel;
 
+    /**
+     * @var stagingPool Staging pool used in createXferReq for local DRAM descriptors that are
+     *                  not registered. The transfer goes through buffers of the pool, which are
+     *                  held until the request is released. Data is copied into them before each
+     *                  post of a write, and out of them when a read completes.
+     */
+    nixlStagingPoolH *stagingPool = nullptr;
+
+    /**
+     * @var deadline Optional deadline of a transfer, used in createXferReq / makeXferReq /
+     *               postXferReq. A deadline applies to a single post: one given to postXferReq
+     *               to that post, and one given at creation to the first post only. A repost
+     *               without a deadline has none, whether or not an earlier deadline passed.
+     *               A request posted after its deadline is canceled without being posted, and
+     *               one still in progress at its deadline is canceled by getXferStatus. Both
+     *               then report NIXL_ERR_CANCELED.
+     */
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+
+    /**
+     * @var trafficClass Optional traffic class of a transfer, used in createXferReq /
+     *                   makeXferReq / compileXferPlan / postXferReq. A value given to
+     *                   postXferReq replaces the one given at creation. Requests without a
+     *                   class are in nixl_traffic_class_t::DEFAULT.
+     */
+    std::optional<nixl_traffic_class_t> trafficClass;
+
     /**
      * @var Backend custom parameter
      */
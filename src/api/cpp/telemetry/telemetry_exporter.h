@@ -63,6 +63,14 @@ public:
     virtual nixl_status_t
     exportEvent(const nixlTelemetryEvent &event) = 0;
 
+    /**
+     * @brief Announces the name behind a label id, before the first event carrying it is
+     *        exported. Called from the same thread as exportEvent. Ids are unique per kind
+     *        for the lifetime of the exporter.
+     */
+    virtual void
+    registerLabel(nixl_telemetry_label_t kind, uint16_t id, const std::string &name) {}
+
 private:
     const size_t maxEventsBuffered_;
 };
@@ -538,9 +538,12 @@ class nixl_agent:
     @param local_xfer_side Handle to the local transfer descriptor list,
             received from prep_xfer_dlist.
     @param local_indices List or numpy array (dtype=int32) of indices for selecting local descriptors.
+            An (N, 3) numpy array (dtype=int32) of [start, count, stride] rows selects runs of
+            indices instead, which NIXL validates per run without expanding them.
     @param remote_xfer_side Handle to the remote (or loopback) transfer descriptor list,
             received from prep_xfer_dlist.
     @param remote_indices List or numpy array (dtype=int32) of indices for selecting remote descriptors.
+            Accepts (N, 3) index runs the same way as local_indices.
     @param notif_msg Optional notification message to send after transfer is done.
            notif_msg should be bytes, as that is what will be returned to the target, but will work with str too.
     @param backends Optional list of backend names to limit which backends NIXL can use.
@@ -685,6 +688,17 @@ class nixl_agent:
             if backendH == b_handle
         )
 
+    """
+    @brief Query why the backend of a transfer operation was chosen over other candidates.
+
+    @param handle Handle to the transfer operation.
+    @return One of "SINGLE_CANDIDATE", "LEARNED_COST", "BACKEND_ESTIMATE", "PREFERENCE_ORDER"
+            or "EXPLORATION".
+    """
+
+    def query_xfer_backend_choice(self, handle: nixl_xfer_handle) -> str:
+        return self.agent.queryXferBackendChoice(handle._handle)
+
     """
     @brief  Releases a transfer handle, which internally frees the memory used for the handle.
             If the transfer is active, NIXL will attempt to cancel it.
@@ -756,21 +770,80 @@ class nixl_agent:
         handle_list = []
         for backend_string in backends:
             handle_list.append(self.backends[backend_string])
-        self.notifs = self.agent.getNotifs(self.notifs, handle_list)  # Adds new notifs
-        found = False
-        message = None
 
-        if remote_agent_name in self.notifs:
-            for msg in self.notifs[remote_agent_name]:
+        # Notifications already pulled into self.notifs by update_notifs are checked first
+        if self.notifs.get(remote_agent_name):
+            for i, msg in enumerate(self.notifs[remote_agent_name]):
                 if (tag_is_prefix and msg.startswith(lookup_tag)) or (
                     not tag_is_prefix and lookup_tag in msg
                 ):
-                    message = msg
-                    found = True
-                    break
-        if message:
-            self.notifs[remote_agent_name].remove(message)
-        return found
+                    del self.notifs[remote_agent_name][i]
+                    return True
+
+        # Matching is done by the agent, only a matched message is copied into Python
+        return (
+            self.agent.waitNotif(
+                remote_agent_name, lookup_tag, 0, tag_is_prefix, handle_list
+            )
+            is not None
+        )
+
+    """
+    @brief Wait for a notification from a remote agent matching a tag, and remove it.
+           Non-matching notifications are kept by the agent for later calls.
+           The GIL is released while waiting.
+
+    @param remote_agent_name Name of the remote agent.
+    @param lookup_tag A tag to match against received messages.
+    @param timeout_s Maximum time to wait in seconds, 0 checks once without waiting.
+    @param backends Optional list of backend names to limit which backends are checked for notifications.
+    @param tag_is_prefix Optionally specify that the tag is just a prefix, or can be searched as a substring of the full message.
+    @return The matching message, or None if none arrived before the timeout.
+    """
+
+    def wait_notif(
+        self,
+        remote_agent_name: str,
+        lookup_tag: bytes,
+        timeout_s: float = 0,
+        backends: list[str] = [],
+        tag_is_prefix=True,
+    ) -> Optional[bytes]:
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+        return self.agent.waitNotif(
+            remote_agent_name,
+            lookup_tag,
+            int(timeout_s * 1e6),
+            tag_is_prefix,
+            handle_list,
+        )
+
+    """
+    @brief Remove and return all notifications from a remote agent matching a tag,
+           in the order they were received. Non-matching notifications are kept by the agent.
+
+    @param remote_agent_name Name of the remote agent.
+    @param lookup_tag A tag to match against received messages.
+    @param backends Optional list of backend names to limit which backends are checked for notifications.
+    @param tag_is_prefix Optionally specify that the tag is just a prefix, or can be searched as a substring of the full message.
+    @return List of matching messages.
+    """
+
+    def pop_matching_notifs(
+        self,
+        remote_agent_name: str,
+        lookup_tag: bytes,
+        backends: list[str] = [],
+        tag_is_prefix=True,
+    ) -> list[bytes]:
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+        return self.agent.popMatchingNotifs(
+            remote_agent_name, lookup_tag, tag_is_prefix, handle_list
+        )
 
     """
     @brief Send a standalone notification to a remote agent, not bound to a transfer.
@@ -902,6 +975,22 @@ class nixl_agent:
     ):
         self.agent.fetchRemoteMD(remote_agent, ip_addr, port, label)
 
+    """
+    @brief Retrieve the metadata of many agents from the central metadata server in one request.
+           A local copy of the metadata namespace is kept updated afterwards, so later fetches
+           of these agents are served without further requests.
+
+    @param remote_agents Agents to fetch. If empty, fetches every agent that published the label.
+    @param label         If specified, fetches metadata published under this label.
+    """
+
+    def prefetch_remote_metadata(
+        self,
+        remote_agents: list[str] = [],
+        label: str = "",
+    ):
+        self.agent.prefetchRemoteMD(remote_agents, label)
+
     """
     @brief Invalidate your own metadata in the central metadata server, or from a specific peer.
 
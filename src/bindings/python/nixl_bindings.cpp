@@ -629,6 +629,53 @@ PYBIND11_MODULE(_bindings, m) {
                     }
                 };
 
+                // An (N, 3) int32 array of [start, count, stride] rows selects index runs,
+                // matching the nixlIndexRun layout so it can be copied in one go
+                auto is_runs_lambda = [](py::object &indices) -> bool {
+                    return py::isinstance<py::array>(indices) &&
+                        indices.cast<py::array>().ndim() == 2;
+                };
+
+                auto init_runs_lambda = [&](py::object &indices) -> nixl_index_runs_t {
+                    if (!is_runs_lambda(indices)) {
+                        std::vector<int> indices_vec = init_indices_lambda(indices);
+                        nixl_index_runs_t ret;
+                        ret.reserve(indices_vec.size());
+                        for (int index : indices_vec)
+                            ret.push_back({index, 1, 1});
+                        return ret;
+                    }
+
+                    auto runs_array = indices.cast<py::array>();
+                    if (!py::dtype::of<int32_t>().equal(runs_array.dtype()))
+                        throw std::invalid_argument("index runs numpy array must be of int32");
+                    if (runs_array.shape(1) != 3)
+                        throw std::invalid_argument(
+                            "index runs numpy array must have shape (N, 3) of [start, count, "
+                            "stride]");
+                    if (!(runs_array.flags() & py::array::c_style))
+                        throw std::invalid_argument(
+                            "index runs numpy array must be C-contiguous");
+                    static_assert(sizeof(nixlIndexRun) == 3 * sizeof(int32_t));
+                    nixl_index_runs_t ret(runs_array.shape(0));
+                    std::memcpy(ret.data(), runs_array.data(), ret.size() * sizeof(nixlIndexRun));
+                    return ret;
+                };
+
+                if (is_runs_lambda(local_indices) || is_runs_lambda(remote_indices)) {
+                    nixl_index_runs_t local_runs = init_runs_lambda(local_indices);
+                    nixl_index_runs_t remote_runs = init_runs_lambda(remote_indices);
+
+                    throw_nixl_exception(agent.makeXferReq(operation,
+                                                           (nixlDlistH *)local_side,
+                                                           local_runs,
+                                                           (nixlDlistH *)remote_side,
+                                                           remote_runs,
+                                                           handle,
+                                                           &extra_params));
+                    return (uintptr_t)handle;
+                }
+
                 local_indices_vec = init_indices_lambda(local_indices);
                 remote_indices_vec = init_indices_lambda(remote_indices);
 
@@ -733,6 +780,14 @@ PYBIND11_MODULE(_bindings, m) {
                  throw_nixl_exception(agent.queryXferBackend((nixlXferReqH *)reqh, backend));
                  return (uintptr_t)backend;
              })
+        .def("queryXferBackendChoice",
+             [](nixlAgent &agent, uintptr_t reqh) -> std::string {
+                 nixlBackendH *backend = nullptr;
+                 nixl_backend_choice_t choice;
+                 throw_nixl_exception(
+                     agent.queryXferBackend((nixlXferReqH *)reqh, backend, choice));
+                 return nixlEnumStrings::backendChoiceStr(choice);
+             })
         .def("releaseXferReq",
              [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
                  nixl_status_t ret = agent.releaseXferReq((nixlXferReqH *)reqh);
@@ -771,6 +826,74 @@ PYBIND11_MODULE(_bindings, m) {
             },
             py::arg("notif_map"),
             py::arg("backends") = std::vector<uintptr_t>({}))
+        .def(
+            "popMatchingNotifs",
+            [](nixlAgent &agent,
+               const std::string &remote_agent,
+               const std::string &tag,
+               bool tag_is_prefix,
+               const std::vector<uintptr_t> &backends) -> py::list {
+                std::vector<nixl_blob_t> msgs;
+                nixl_opt_args_t extra_params;
+
+                {
+                    py::gil_scoped_release release;
+                    for (uintptr_t backend : backends)
+                        extra_params.backends.push_back((nixlBackendH *)backend);
+
+                    const auto match = tag_is_prefix ? nixl_notif_match_t::PREFIX :
+                                                       nixl_notif_match_t::SUBSTRING;
+                    const nixl_status_t ret =
+                        agent.popMatchingNotifs(remote_agent, tag, msgs, match, &extra_params);
+                    // Do not drop matches already removed from the agent on a backend error
+                    if (msgs.empty()) throw_nixl_exception(ret);
+                }
+
+                py::list result;
+                for (const auto &msg : msgs)
+                    result.append(py::bytes(msg));
+                return result;
+            },
+            py::arg("remote_agent"),
+            py::arg("tag"),
+            py::arg("tag_is_prefix") = true,
+            py::arg("backends") = std::vector<uintptr_t>({}))
+        .def(
+            "waitNotif",
+            [](nixlAgent &agent,
+               const std::string &remote_agent,
+               const std::string &tag,
+               int64_t timeout_us,
+               bool tag_is_prefix,
+               const std::vector<uintptr_t> &backends) -> py::object {
+                nixl_blob_t msg;
+                nixl_opt_args_t extra_params;
+                nixl_status_t ret;
+
+                {
+                    py::gil_scoped_release release;
+                    for (uintptr_t backend : backends)
+                        extra_params.backends.push_back((nixlBackendH *)backend);
+
+                    const auto match = tag_is_prefix ? nixl_notif_match_t::PREFIX :
+                                                       nixl_notif_match_t::SUBSTRING;
+                    ret = agent.waitNotif(remote_agent,
+                                          tag,
+                                          msg,
+                                          chrono_period_us_t(timeout_us),
+                                          match,
+                                          &extra_params);
+                    throw_nixl_exception(ret);
+                }
+
+                if (ret == NIXL_IN_PROG) return py::none();
+                return py::bytes(msg);
+            },
+            py::arg("remote_agent"),
+            py::arg("tag"),
+            py::arg("timeout_us") = 0,
+            py::arg("tag_is_prefix") = true,
+            py::arg("backends") = std::vector<uintptr_t>({}))
         .def(
             "genNotif",
             [](nixlAgent &agent,
@@ -893,6 +1016,17 @@ PYBIND11_MODULE(_bindings, m) {
             py::arg("port") = 0,
             py::arg("label") = std::string(""),
             py::call_guard<py::gil_scoped_release>())
+        .def(
+            "prefetchRemoteMD",
+            [](nixlAgent &agent, std::vector<std::string> remote_agents, std::string label) {
+                nixl_opt_args_t extra_params;
+                extra_params.metadataLabel = label;
+
+                throw_nixl_exception(agent.prefetchRemoteMD(remote_agents, &extra_params));
+            },
+            py::arg("remote_agents") = std::vector<std::string>({}),
+            py::arg("label") = std::string(""),
+            py::call_guard<py::gil_scoped_release>())
         .def(
             "invalidateLocalMD",
             [](nixlAgent &agent, std::string ip_addr, int port) {
@@ -17,10 +17,16 @@
 #ifndef NIXL_SRC_CORE_AGENT_DATA_H
 #define NIXL_SRC_CORE_AGENT_DATA_H
 
+#include "local_copy.h"
+#include "local_md_store.h"
 #include "mem_section.h"
+#include "notif_store.h"
 #include "telemetry.h"
+#include "telemetry/trace.h"
 #include "stream/metadata_stream.h"
 #include "sync.h"
+#include "xfer_cost_model.h"
+#include "xfer_scheduler.h"
 
 #include <memory>
 
@@ -46,6 +52,7 @@ enum nixl_comm_t {
 #if HAVE_ETCD
     ETCD_SEND,
     ETCD_FETCH,
+    ETCD_PREFETCH,
     ETCD_INVAL
 #endif // HAVE_ETCD
 };
@@ -66,6 +73,7 @@ class nixlAgentData {
         const std::string name_;
         const nixlAgentConfig config_;
         const bool useEtcd_;
+        const bool useLocalMD_;
         const bool needsCommThread_;
         nixlLock        lock;
         bool telemetryEnabled = false;
@@ -103,10 +111,32 @@ class nixlAgentData {
         std::unique_ptr<nixlTelemetry> telemetry_;
         nixlLocalSection localSection_;
 
+        // Learned per-backend transfer costs, fed by requests whose backend was chosen by cost
+        nixlXferCostModel costModel_;
+
+        // Request lifecycle tracing, null unless enabled through NIXL_TRACE_DIR
+        std::unique_ptr<nixlTracer> tracer_;
+
+        // Copies transfers between DRAM buffers of this agent, null unless enabled through
+        // NIXL_LOCAL_COPY_THREADS
+        std::unique_ptr<nixlLocalCopyEngine> localCopy_;
+
+        // Notifications collected by popMatchingNotifs and waitNotif but not yet returned
+        nixlNotifStore notifStore_;
+
+        // Node-local shared memory metadata store, null unless enabled through NIXL_LOCAL_MD_DIR
+        std::unique_ptr<nixlLocalMDStore> localMD_;
+
+        // Paces posts per traffic class, backend and remote agent, null unless the config
+        // sets a rate limit
+        std::unique_ptr<nixlXferScheduler> scheduler_;
+
         void
         commWorker(nixlAgent &myAgent) noexcept;
         void
         commWorkerInternal(nixlAgent *myAgent);
+        void
+        processLocalMDChanges(nixlAgent *myAgent);
         void enqueueCommWork(nixl_comm_req_t request);
         void getCommWork(std::vector<nixl_comm_req_t> &req_list);
         nixl_status_t
@@ -116,7 +146,30 @@ class nixlAgentData {
         nixl_status_t
         loadRemoteSections(const std::string &remote_name, nixlSerDes &sd);
         nixl_status_t
+        collectNotifs(const nixl_opt_args_t *extra_params, notif_list_t &notif_list);
+        nixl_status_t
         invalidateRemoteData(const std::string &remote_name);
+        // Shared by the index list and index run variants of nixlAgent::makeXferReq
+        template<typename indexSeqT>
+        nixl_status_t
+        makeXferReq(const nixl_xfer_op_t &operation,
+                    const nixlDlistH *local_side,
+                    const indexSeqT &local_seq,
+                    const nixlDlistH *remote_side,
+                    const indexSeqT &remote_seq,
+                    nixlXferReqH *&req_hndl,
+                    const nixl_opt_args_t *extra_params);
+        nixl_status_t
+        postXfer(nixlXferReqH *req_hndl);
+        nixl_status_t
+        cancelXfer(nixlXferReqH *req_hndl);
+        nixl_status_t
+        completeXferCheck(nixlXferReqH *req_hndl, nixl_status_t status);
+        void
+        recordXferCost(const nixlXferReqH *req_hndl);
+        // Only called with tracing enabled, for a request that is no longer in progress
+        void
+        traceCompletion(const nixlXferReqH *req_hndl, uint64_t post_ns, uint64_t end_ns);
         [[nodiscard]] static backend_set_t
         getBackends(const nixl_opt_args_t *opt_args,
                     const nixlMemSection &section,
@@ -0,0 +1,445 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "local_copy.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include "common/configuration.h"
+#include "common/cpu_affinity.h"
+#include "common/nixl_log.h"
+
+namespace {
+// Transfers below this size are copied inline by postXfer
+constexpr size_t kMinParallelBytes = 256 * 1024;
+// Target size of the chunks handed to the threads, a huge page so a chunk usually sits on a
+// single NUMA node
+constexpr size_t kChunkBytes = 2 * 1024 * 1024;
+// Copies below this size stay in the caches, larger ones use non-temporal stores
+constexpr size_t kStreamBytes = 256 * 1024;
+
+#if defined(__x86_64__)
+// Copies blocks of four vectors with non-temporal stores to an aligned destination. The AVX
+// variant is compiled for AVX whatever the build flags, and only used when the CPU has it.
+struct sse2Stream {
+    static constexpr size_t vecLen = sizeof(__m128i);
+
+    static void
+    copyBlocks(char *dst, const char *src, size_t num_blocks) {
+        for (; num_blocks > 0; --num_blocks, dst += 4 * vecLen, src += 4 * vecLen) {
+            for (size_t i = 0; i < 4; ++i) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src) + i);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(dst) + i, v);
+            }
+        }
+    }
+};
+
+struct avxStream {
+    static constexpr size_t vecLen = sizeof(__m256i);
+
+    __attribute__((target("avx"))) static void
+    copyBlocks(char *dst, const char *src, size_t num_blocks) {
+        for (; num_blocks > 0; --num_blocks, dst += 4 * vecLen, src += 4 * vecLen) {
+            for (size_t i = 0; i < 4; ++i) {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src) + i);
+                _mm256_stream_si256(reinterpret_cast<__m256i *>(dst) + i, v);
+            }
+        }
+    }
+};
+
+template<typename stream_t>
+void
+streamCopy(char *dst, const char *src, size_t len) {
+    constexpr size_t vec_len = stream_t::vecLen;
+    constexpr size_t block_len = 4 * vec_len;
+
+    // Streaming stores need an aligned destination
+    const size_t head = (vec_len - reinterpret_cast<uintptr_t>(dst) % vec_len) % vec_len;
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    len -= head;
+
+    const size_t num_blocks = len / block_len;
+    stream_t::copyBlocks(dst, src, num_blocks);
+    // Order the streaming stores before the completion is published
+    _mm_sfence();
+    const size_t copied = num_blocks * block_len;
+    std::memcpy(dst + copied, src + copied, len - copied);
+}
+#endif
+
+void
+copyMemory(char *dst, const char *src, size_t len) {
+#if defined(__x86_64__)
+    if (len >= kStreamBytes) {
+        static const bool has_avx = __builtin_cpu_supports("avx");
+        if (has_avx) {
+            streamCopy<avxStream>(dst, src, len);
+        } else {
+            streamCopy<sse2Stream>(dst, src, len);
+        }
+        return;
+    }
+#endif
+    std::memcpy(dst, src, len);
+}
+
+// NUMA nodes with their CPUs, a single node without CPU list if sysfs has no NUMA information
+std::vector<std::pair<int, std::vector<unsigned>>>
+getNumaNodes() {
+    std::vector<std::pair<int, std::vector<unsigned>>> nodes;
+    std::ifstream file("/sys/devices/system/node/online");
+    std::string node_list;
+    if (file.is_open() && std::getline(file, node_list)) {
+        try {
+            for (const unsigned node : nixl::parseCpuList(node_list)) {
+                auto cpus = nixl::getNumaNodeCpus(node);
+                if (!cpus.empty()) {
+                    nodes.emplace_back(static_cast<int>(node), std::move(cpus));
+                }
+            }
+        }
+        catch (const std::invalid_argument &e) {
+            NIXL_WARN << "Failed to parse the online NUMA nodes: " << e.what();
+            nodes.clear();
+        }
+    }
+
+    if (nodes.empty()) {
+        nodes.emplace_back(-1, std::vector<unsigned>());
+    }
+    return nodes;
+}
+} // namespace
+
+class nixlLocalCopyReqH : public nixlBackendReqH {
+public:
+    struct segment {
+        char *dst;
+        const char *src;
+        size_t len;
+    };
+
+    // Segments [first, last) copied by one thread of a queue
+    struct chunk {
+        size_t first;
+        size_t last;
+        size_t queue;
+    };
+
+    std::vector<segment> segments;
+    std::vector<chunk> chunks;
+    size_t bytes = 0;
+
+    std::atomic<size_t> pending{0};
+    // Signaled when pending reaches 0, for releaseReqH
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+    // Chunks not started yet are skipped
+    std::atomic<bool> canceled{false};
+    bool notifPending = false;
+    nixl_blob_t notifMsg;
+
+    void
+    copyChunk(size_t index) const {
+        for (size_t i = chunks[index].first; i < chunks[index].last; ++i) {
+            copyMemory(segments[i].dst, segments[i].src, segments[i].len);
+        }
+    }
+};
+
+std::unique_ptr<nixlLocalCopyEngine>
+nixlLocalCopyEngine::createFromEnv(const std::string &agent_name) {
+    const auto num_threads = nixl::config::getValueOptional<size_t>(LOCAL_COPY_THREADS_VAR);
+    if (!num_threads || *num_threads == 0) {
+        return nullptr;
+    }
+
+    nixl_b_params_t params;
+    nixlBackendInitParams init_params;
+    init_params.localAgent = agent_name;
+    init_params.type = LOCAL_COPY_TYPE;
+    init_params.customParams = &params;
+    init_params.enableProgTh = false;
+    init_params.pthrDelay = 0;
+    init_params.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_DEFAULT;
+    init_params.enableTelemetry_ = false;
+    return std::make_unique<nixlLocalCopyEngine>(&init_params, *num_threads);
+}
+
+nixlLocalCopyEngine::nixlLocalCopyEngine(const nixlBackendInitParams *init_params,
+                                         size_t num_threads)
+    : nixlBackendEngine(init_params) {
+    auto nodes = getNumaNodes();
+    // Nodes without a thread would leave their chunks unserved
+    if (nodes.size() > num_threads) {
+        nodes.resize(num_threads);
+    }
+
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        nodeIds_.push_back(nodes[i].first);
+        queues_.push_back(std::make_unique<nodeQueue>());
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+        const size_t node = i % nodes.size();
+        workers_.emplace_back(
+            &nixlLocalCopyEngine::worker, this, std::ref(*queues_[node]), nodes[node].second);
+    }
+    NIXL_INFO << "Local DRAM transfers are copied by " << num_threads << " threads on "
+              << nodes.size() << " NUMA nodes";
+}
+
+nixlLocalCopyEngine::~nixlLocalCopyEngine() {
+    stop_ = true;
+    for (auto &queue : queues_) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->cv.notify_all();
+    }
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+void
+nixlLocalCopyEngine::worker(nodeQueue &queue, const std::vector<unsigned> &cpus) {
+    (void)nixl::setThreadAffinity(cpus);
+
+    while (true) {
+        task next;
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.cv.wait(lock, [&]() { return stop_ || !queue.tasks.empty(); });
+            if (queue.tasks.empty()) {
+                return;
+            }
+            next = queue.tasks.front();
+            queue.tasks.pop_front();
+        }
+
+        if (!next.req->canceled.load(std::memory_order_relaxed)) {
+            next.req->copyChunk(next.index);
+        }
+        // Last access to the request. The count drops under doneMutex, so releaseReqH cannot
+        // see it reach 0 and delete the request before the notify is done.
+        std::lock_guard<std::mutex> lock(next.req->doneMutex);
+        if (next.req->pending.fetch_sub(1, std::memory_order_release) == 1) {
+            next.req->doneCv.notify_all();
+        }
+    }
+}
+
+size_t
+nixlLocalCopyEngine::queueOf(const void *addr, size_t fallback) const {
+    if (queues_.size() == 1) {
+        return 0;
+    }
+
+    // move_pages without target nodes reports the node of each page, or a negative errno
+    // for pages not faulted in yet
+    void *page = const_cast<void *>(addr);
+    int node = -1;
+    if (syscall(SYS_move_pages, 0, 1, &page, nullptr, &node, 0) == 0 && node >= 0) {
+        const auto it = std::find(nodeIds_.begin(), nodeIds_.end(), node);
+        if (it != nodeIds_.end()) {
+            return it - nodeIds_.begin();
+        }
+    }
+    return fallback % queues_.size();
+}
+
+nixl_status_t
+nixlLocalCopyEngine::prepXfer(const nixl_xfer_op_t &operation,
+                              const nixl_meta_dlist_t &local,
+                              const nixl_meta_dlist_t &remote,
+                              const std::string &remote_agent,
+                              nixlBackendReqH *&handle,
+                              const nixl_opt_b_args_t *opt_args) const {
+    if ((local.getType() != DRAM_SEG) || (remote.getType() != DRAM_SEG) ||
+        (local.descCount() != remote.descCount())) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto req = std::make_unique<nixlLocalCopyReqH>();
+    req->segments.reserve(local.descCount());
+    for (int i = 0; i < local.descCount(); ++i) {
+        if (local[i].len != remote[i].len) {
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        char *local_addr = reinterpret_cast<char *>(local[i].addr);
+        char *remote_addr = reinterpret_cast<char *>(remote[i].addr);
+        if (operation == NIXL_WRITE) {
+            req->segments.push_back({remote_addr, local_addr, local[i].len});
+        } else {
+            req->segments.push_back({local_addr, remote_addr, local[i].len});
+        }
+        req->bytes += local[i].len;
+    }
+
+    if (req->bytes < kMinParallelBytes) {
+        handle = req.release();
+        return NIXL_SUCCESS;
+    }
+
+    // Split large segments and group small ones, so every chunk is about kChunkBytes
+    std::vector<nixlLocalCopyReqH::segment> segments;
+    segments.reserve(req->segments.size());
+    size_t chunk_bytes = 0;
+    size_t chunk_first = 0;
+    auto close_chunk = [&]() {
+        const size_t queue = queueOf(segments[chunk_first].dst, req->chunks.size());
+        req->chunks.push_back({chunk_first, segments.size(), queue});
+        chunk_first = segments.size();
+        chunk_bytes = 0;
+    };
+
+    for (const auto &seg : req->segments) {
+        for (size_t offset = 0; offset < seg.len;) {
+            const size_t len = std::min(seg.len - offset, kChunkBytes - chunk_bytes);
+            segments.push_back({seg.dst + offset, seg.src + offset, len});
+            offset += len;
+            chunk_bytes += len;
+            if (chunk_bytes == kChunkBytes) {
+                close_chunk();
+            }
+        }
+    }
+    if (chunk_bytes > 0) {
+        close_chunk();
+    }
+
+    req->segments = std::move(segments);
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalCopyEngine::postXfer(const nixl_xfer_op_t &operation,
+                              const nixl_meta_dlist_t &local,
+                              const nixl_meta_dlist_t &remote,
+                              const std::string &remote_agent,
+                              nixlBackendReqH *&handle,
+                              const nixl_opt_b_args_t *opt_args) const {
+    auto &req = static_cast<nixlLocalCopyReqH &>(*handle);
+    const bool has_notif = opt_args && opt_args->hasNotif;
+    req.canceled.store(false, std::memory_order_relaxed);
+
+    if (req.chunks.size() <= 1) {
+        for (const auto &seg : req.segments) {
+            copyMemory(seg.dst, seg.src, seg.len);
+        }
+        if (has_notif) {
+            addNotif(opt_args->notifMsg);
+        }
+        return NIXL_SUCCESS;
+    }
+
+    req.notifPending = has_notif;
+    req.notifMsg = has_notif ? opt_args->notifMsg : nixl_blob_t();
+    req.pending.store(req.chunks.size(), std::memory_order_relaxed);
+
+    // Group the chunks per queue, so each queue is locked once
+    for (size_t q = 0; q < queues_.size(); ++q) {
+        nodeQueue &queue = *queues_[q];
+        size_t added = 0;
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            for (size_t i = 0; i < req.chunks.size(); ++i) {
+                if (req.chunks[i].queue == q) {
+                    queue.tasks.push_back({&req, i});
+                    added++;
+                }
+            }
+        }
+        if (added == 1) {
+            queue.cv.notify_one();
+        } else if (added > 1) {
+            queue.cv.notify_all();
+        }
+    }
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlLocalCopyEngine::checkXfer(nixlBackendReqH *handle) const {
+    auto &req = static_cast<nixlLocalCopyReqH &>(*handle);
+    if (req.pending.load(std::memory_order_acquire) != 0) {
+        return NIXL_IN_PROG;
+    }
+    if (req.canceled.load(std::memory_order_relaxed)) {
+        req.notifPending = false;
+        return NIXL_ERR_CANCELED;
+    }
+    if (req.notifPending) {
+        req.notifPending = false;
+        addNotif(req.notifMsg);
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalCopyEngine::cancelXfer(nixlBackendReqH *handle) const {
+    auto &req = static_cast<nixlLocalCopyReqH &>(*handle);
+    if (req.pending.load(std::memory_order_acquire) != 0) {
+        req.canceled.store(true, std::memory_order_relaxed);
+    }
+    return checkXfer(handle);
+}
+
+nixl_status_t
+nixlLocalCopyEngine::releaseReqH(nixlBackendReqH *handle) const {
+    auto *req = static_cast<nixlLocalCopyReqH *>(handle);
+    // Queued chunks are skipped, the ones being copied still write to the buffers
+    req->canceled.store(true, std::memory_order_relaxed);
+    {
+        std::unique_lock<std::mutex> lock(req->doneMutex);
+        req->doneCv.wait(lock, [req]() {
+            return req->pending.load(std::memory_order_acquire) == 0;
+        });
+    }
+    delete req;
+    return NIXL_SUCCESS;
+}
+
+void
+nixlLocalCopyEngine::addNotif(const nixl_blob_t &msg) const {
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    notifs_.emplace_back(localAgent, msg);
+}
+
+nixl_status_t
+nixlLocalCopyEngine::getNotifs(notif_list_t &notif_list) {
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    if (notif_list.empty()) {
+        notif_list.swap(notifs_);
+    } else {
+        std::move(notifs_.begin(), notifs_.end(), std::back_inserter(notif_list));
+        notifs_.clear();
+    }
+    return NIXL_SUCCESS;
+}
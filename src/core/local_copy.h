@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_LOCAL_COPY_H
+#define NIXL_SRC_CORE_LOCAL_COPY_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "backend/backend_engine.h"
+
+inline constexpr char LOCAL_COPY_THREADS_VAR[] = "NIXL_LOCAL_COPY_THREADS";
+inline constexpr char LOCAL_COPY_TYPE[] = "LOCAL_COPY";
+
+class nixlLocalCopyReqH;
+
+// Copy engine for transfers between DRAM buffers of the same agent, which would otherwise go
+// through the loopback path of the selected backend. The agent hands it those requests after
+// selecting a backend, so the request handle, status and notifications work as usual.
+// Transfers are cut into chunks that a pool of threads copies. The threads are pinned per
+// NUMA node, and each chunk goes to a thread of the node holding its destination pages. Large
+// chunks are written with non-temporal stores, which do not pollute the caches.
+class nixlLocalCopyEngine : public nixlBackendEngine {
+public:
+    // Returns nullptr unless NIXL_LOCAL_COPY_THREADS is set above 0
+    [[nodiscard]] static std::unique_ptr<nixlLocalCopyEngine>
+    createFromEnv(const std::string &agent_name);
+
+    nixlLocalCopyEngine(const nixlBackendInitParams *init_params, size_t num_threads);
+    ~nixlLocalCopyEngine() override;
+
+    bool
+    supportsRemote() const override {
+        return false;
+    }
+
+    bool
+    supportsLocal() const override {
+        return true;
+    }
+
+    bool
+    supportsNotif() const override {
+        return true;
+    }
+
+    nixl_mem_list_t
+    getSupportedMems() const override {
+        return {DRAM_SEG};
+    }
+
+    // The engine works on the descriptors populated for the selected backend, it never
+    // registers memory nor loads metadata itself
+    nixl_status_t
+    registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixl_status_t
+    deregisterMem(nixlBackendMD *meta) override {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    nixl_status_t
+    connect(const std::string &remote_agent) override {
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    disconnect(const std::string &remote_agent) override {
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    unloadMD(nixlBackendMD *input) override {
+        return NIXL_SUCCESS;
+    }
+
+    nixl_status_t
+    prepXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    nixl_status_t
+    postXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    nixl_status_t
+    checkXfer(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    releaseReqH(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    getNotifs(notif_list_t &notif_list) override;
+
+    [[nodiscard]] size_t
+    getNumThreads() const noexcept {
+        return workers_.size();
+    }
+
+private:
+    struct task {
+        nixlLocalCopyReqH *req;
+        size_t index;
+    };
+
+    // Chunks waiting for the threads of one NUMA node
+    struct nodeQueue {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<task> tasks;
+    };
+
+    void
+    worker(nodeQueue &queue, const std::vector<unsigned> &cpus);
+
+    // Index of the queue serving the NUMA node that holds addr
+    [[nodiscard]] size_t
+    queueOf(const void *addr, size_t fallback) const;
+
+    void
+    addNotif(const nixl_blob_t &msg) const;
+
+    // NUMA node ids served by queues_, in the same order
+    std::vector<int> nodeIds_;
+    std::vector<std::unique_ptr<nodeQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> stop_{false};
+
+    mutable std::mutex notifMutex_;
+    mutable notif_list_t notifs_;
+};
+
+#endif
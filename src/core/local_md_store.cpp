@@ -0,0 +1,491 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "local_md_store.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/configuration.h"
+#include "common/nixl_log.h"
+
+namespace {
+
+constexpr uint32_t LOCAL_MD_MAGIC = 0x4e584d44; // "NXMD"
+constexpr int MAX_READ_ATTEMPTS = 1000;
+// How often poll looks for awaited entries, and checks that publishers of watched entries are
+// still running. Both cost a system call per entry.
+constexpr std::chrono::milliseconds AWAIT_CHECK_INTERVAL{10};
+constexpr std::chrono::seconds LIVENESS_CHECK_INTERVAL{1};
+
+enum localMDState : uint32_t {
+    LIVE = 0,
+    // The blob outgrew the file and a new file took its path
+    REPLACED = 1,
+    INVALID = 2,
+};
+
+// Keep agent and label names from escaping the directory or colliding on the separator
+std::string
+encodeName(const std::string &name) {
+    std::string encoded;
+    encoded.reserve(name.size());
+    for (const char c : name) {
+        if (c == '/') {
+            encoded += "%2F";
+        } else if (c == '%') {
+            encoded += "%25";
+        } else if (c == '.') {
+            encoded += "%2E";
+        } else {
+            encoded += c;
+        }
+    }
+    return encoded;
+}
+
+} // namespace
+
+struct nixlLocalMDStore::header {
+    uint32_t magic;
+    uint32_t layoutVersion;
+    // Odd while the blob is rewritten in place, bumped on every change
+    std::atomic<uint64_t> version;
+    std::atomic<uint32_t> state;
+    int32_t publisherPid;
+    std::atomic<uint64_t> size;
+    uint64_t capacity;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "shared memory atomics must be lock free");
+
+/*** mapping ***/
+
+nixlLocalMDStore::mapping::mapping(mapping &&other) noexcept
+    : addr_(std::exchange(other.addr_, nullptr)),
+      length_(std::exchange(other.length_, 0)) {}
+
+nixlLocalMDStore::mapping &
+nixlLocalMDStore::mapping::operator=(mapping &&other) noexcept {
+    if (this != &other) {
+        if (addr_) {
+            munmap(addr_, length_);
+        }
+        addr_ = std::exchange(other.addr_, nullptr);
+        length_ = std::exchange(other.length_, 0);
+    }
+    return *this;
+}
+
+nixlLocalMDStore::mapping::~mapping() {
+    if (addr_) {
+        munmap(addr_, length_);
+    }
+}
+
+nixlLocalMDStore::header *
+nixlLocalMDStore::mapping::getHeader() const {
+    return static_cast<header *>(addr_);
+}
+
+char *
+nixlLocalMDStore::mapping::getData() const {
+    return static_cast<char *>(addr_) + sizeof(header);
+}
+
+size_t
+nixlLocalMDStore::mapping::getCapacity() const {
+    return length_ - sizeof(header);
+}
+
+/*** nixlLocalMDStore ***/
+
+std::optional<std::string>
+nixlLocalMDStore::dirFromEnv() {
+    auto dir = nixl::config::getValueOptional<std::string>(LOCAL_MD_DIR_VAR);
+    if (dir && dir->empty()) {
+        return std::nullopt;
+    }
+    return dir;
+}
+
+std::unique_ptr<nixlLocalMDStore>
+nixlLocalMDStore::createFromEnv() {
+    const auto dir = dirFromEnv();
+    if (!dir) {
+        return nullptr;
+    }
+
+    try {
+        return std::make_unique<nixlLocalMDStore>(*dir);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "Node-local metadata store is disabled: " << e.what();
+        return nullptr;
+    }
+}
+
+nixlLocalMDStore::nixlLocalMDStore(const std::string &dir) : dir_(dir) {
+    std::error_code ec;
+    std::filesystem::create_directories(dir_, ec);
+    if (ec) {
+        throw std::runtime_error("Failed to create directory " + dir_ + ": " + ec.message());
+    }
+    NIXL_DEBUG << "Using node-local metadata store in " << dir_;
+}
+
+nixlLocalMDStore::~nixlLocalMDStore() {
+    std::vector<std::string> agents;
+    {
+        const std::lock_guard lock(mutex_);
+        for (const auto &[key, map] : published_) {
+            if (agents.empty() || agents.back() != key.first) {
+                agents.push_back(key.first);
+            }
+        }
+    }
+
+    for (const auto &agent_name : agents) {
+        invalidate(agent_name);
+    }
+}
+
+std::string
+nixlLocalMDStore::makePath(const std::string &agent_name, const std::string &label) const {
+    return dir_ + "/" + encodeName(agent_name) + "." + encodeName(label) + LOCAL_MD_FILE_EXT;
+}
+
+nixl_status_t
+nixlLocalMDStore::createFile(const std::string &path,
+                             const nixl_blob_t &metadata,
+                             uint64_t version,
+                             mapping &out) {
+    // Room to update the blob in place when it grows a little
+    const size_t capacity = metadata.size() + metadata.size() / 4 + 64;
+    const size_t length = sizeof(header) + capacity;
+    const std::string tmp_path = path + "." + std::to_string(getpid()) + ".tmp";
+
+    const int fd =
+        open(tmp_path.c_str(), O_CREAT | O_TRUNC | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd == -1) {
+        NIXL_PERROR << "Failed to create metadata file " << tmp_path;
+        return NIXL_ERR_BACKEND;
+    }
+
+    if (ftruncate(fd, length) == -1) {
+        NIXL_PERROR << "Failed to size metadata file " << tmp_path;
+        close(fd);
+        unlink(tmp_path.c_str());
+        return NIXL_ERR_BACKEND;
+    }
+
+    void *addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        NIXL_PERROR << "Failed to map metadata file " << tmp_path;
+        unlink(tmp_path.c_str());
+        return NIXL_ERR_BACKEND;
+    }
+
+    mapping map(addr, length);
+    header *hdr = new (addr) header();
+    hdr->magic = LOCAL_MD_MAGIC;
+    hdr->layoutVersion = LOCAL_MD_LAYOUT_VERSION;
+    hdr->capacity = capacity;
+    hdr->publisherPid = getpid();
+    hdr->state.store(LIVE, std::memory_order_relaxed);
+    hdr->size.store(metadata.size(), std::memory_order_relaxed);
+    std::memcpy(map.getData(), metadata.data(), metadata.size());
+    hdr->version.store(version, std::memory_order_release);
+
+    // Readers only ever see a complete file at the final path
+    if (rename(tmp_path.c_str(), path.c_str()) == -1) {
+        NIXL_PERROR << "Failed to move metadata file into " << path;
+        unlink(tmp_path.c_str());
+        return NIXL_ERR_BACKEND;
+    }
+
+    out = std::move(map);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalMDStore::openFile(const std::string &path, mapping &out) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        if (errno == ENOENT) {
+            return NIXL_ERR_NOT_FOUND;
+        }
+        NIXL_PERROR << "Failed to open metadata file " << path;
+        return NIXL_ERR_BACKEND;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || static_cast<size_t>(st.st_size) < sizeof(header)) {
+        NIXL_ERROR << "Metadata file " << path << " is truncated";
+        close(fd);
+        return NIXL_ERR_MISMATCH;
+    }
+
+    void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        NIXL_PERROR << "Failed to map metadata file " << path;
+        return NIXL_ERR_BACKEND;
+    }
+
+    mapping map(addr, st.st_size);
+    const header *hdr = map.getHeader();
+    if (hdr->magic != LOCAL_MD_MAGIC || hdr->layoutVersion != LOCAL_MD_LAYOUT_VERSION ||
+        hdr->capacity > map.getCapacity()) {
+        NIXL_ERROR << "Metadata file " << path << " has an unexpected layout";
+        return NIXL_ERR_MISMATCH;
+    }
+
+    out = std::move(map);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalMDStore::read(const mapping &map, nixl_blob_t &metadata, uint64_t &version) {
+    const header *hdr = map.getHeader();
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt) {
+        const uint64_t before = hdr->version.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (hdr->state.load(std::memory_order_acquire) != LIVE || isStale(map)) {
+            return NIXL_ERR_NOT_FOUND;
+        }
+
+        const uint64_t size = hdr->size.load(std::memory_order_relaxed);
+        if (size > hdr->capacity) {
+            continue;
+        }
+        metadata.assign(map.getData(), size);
+
+        // Seqlock check, the copy is valid only if no update started meanwhile
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (hdr->version.load(std::memory_order_relaxed) == before) {
+            version = before;
+            return NIXL_SUCCESS;
+        }
+    }
+
+    NIXL_ERROR << "Metadata kept changing while being read";
+    return NIXL_ERR_UNKNOWN;
+}
+
+bool
+nixlLocalMDStore::isStale(const mapping &map) {
+    const pid_t pid = map.getHeader()->publisherPid;
+    return pid > 0 && kill(pid, 0) == -1 && errno == ESRCH;
+}
+
+nixl_status_t
+nixlLocalMDStore::publish(const std::string &agent_name,
+                          const std::string &label,
+                          const nixl_blob_t &metadata) {
+    const std::lock_guard lock(mutex_);
+    auto it = published_.find({agent_name, label});
+
+    // Rewrite in place when the blob fits
+    if (it != published_.end() && metadata.size() <= it->second.getHeader()->capacity) {
+        header *hdr = it->second.getHeader();
+        const uint64_t version = hdr->version.load(std::memory_order_relaxed);
+        hdr->version.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(it->second.getData(), metadata.data(), metadata.size());
+        hdr->size.store(metadata.size(), std::memory_order_relaxed);
+        hdr->version.store(version + 2, std::memory_order_release);
+        return NIXL_SUCCESS;
+    }
+
+    const uint64_t version =
+        (it != published_.end()) ? it->second.getHeader()->version.load() + 2 : 2;
+    mapping map;
+    const nixl_status_t ret = createFile(makePath(agent_name, label), metadata, version, map);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    if (it != published_.end()) {
+        // Readers of the old file reopen the path
+        header *old_hdr = it->second.getHeader();
+        old_hdr->state.store(REPLACED, std::memory_order_release);
+        old_hdr->version.fetch_add(2, std::memory_order_release);
+        it->second = std::move(map);
+    } else {
+        published_.emplace(entry_key_t{agent_name, label}, std::move(map));
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalMDStore::invalidate(const std::string &agent_name) {
+    const std::lock_guard lock(mutex_);
+    auto it = published_.lower_bound({agent_name, ""});
+    if (it == published_.end() || it->first.first != agent_name) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    while (it != published_.end() && it->first.first == agent_name) {
+        unlink(makePath(agent_name, it->first.second).c_str());
+        header *hdr = it->second.getHeader();
+        hdr->state.store(INVALID, std::memory_order_release);
+        hdr->version.fetch_add(2, std::memory_order_release);
+        it = published_.erase(it);
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLocalMDStore::fetch(const std::string &agent_name,
+                        const std::string &label,
+                        nixl_blob_t &metadata) {
+    mapping map;
+    nixl_status_t ret = openFile(makePath(agent_name, label), map);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    uint64_t version;
+    ret = read(map, metadata, version);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    const std::lock_guard lock(mutex_);
+    watched_[{agent_name, label}] = watched{std::move(map), version};
+    awaited_.erase({agent_name, label});
+    return NIXL_SUCCESS;
+}
+
+void
+nixlLocalMDStore::waitFor(const std::string &agent_name, const std::string &label) {
+    const std::lock_guard lock(mutex_);
+    if (watched_.count({agent_name, label}) == 0) {
+        awaited_.emplace(agent_name, label);
+    }
+}
+
+std::vector<nixlLocalMDStore::change>
+nixlLocalMDStore::poll() {
+    std::vector<change> changes;
+    const std::lock_guard lock(mutex_);
+    const auto now = std::chrono::steady_clock::now();
+
+    // A publisher that exited without invalidating never bumps the version
+    const bool check_liveness = now >= nextLivenessCheck_;
+    if (check_liveness) {
+        nextLivenessCheck_ = now + LIVENESS_CHECK_INTERVAL;
+    }
+
+    for (auto it = watched_.begin(); it != watched_.end();) {
+        const auto &[agent_name, label] = it->first;
+        watched &entry = it->second;
+        const header *hdr = entry.map.getHeader();
+
+        if (hdr->version.load(std::memory_order_acquire) == entry.version) {
+            if (check_liveness && isStale(entry.map)) {
+                NIXL_WARN << "Publisher of the node-local metadata of agent " << agent_name
+                          << " exited without invalidating it";
+                changes.push_back({agent_name, true, {}});
+                it = watched_.erase(it);
+                continue;
+            }
+            ++it;
+            continue;
+        }
+
+        if (hdr->state.load(std::memory_order_acquire) == REPLACED) {
+            mapping map;
+            if (openFile(makePath(agent_name, label), map) == NIXL_SUCCESS) {
+                entry.map = std::move(map);
+            }
+        }
+
+        nixl_blob_t metadata;
+        uint64_t version;
+        const nixl_status_t ret = read(entry.map, metadata, version);
+        if (ret == NIXL_ERR_NOT_FOUND) {
+            changes.push_back({agent_name, true, {}});
+            it = watched_.erase(it);
+            continue;
+        }
+
+        if (ret == NIXL_SUCCESS && version != entry.version) {
+            entry.version = version;
+            changes.push_back({agent_name, false, std::move(metadata)});
+        }
+        ++it;
+    }
+
+    if (!awaited_.empty() && now >= nextAwaitCheck_) {
+        nextAwaitCheck_ = now + AWAIT_CHECK_INTERVAL;
+        for (auto it = awaited_.begin(); it != awaited_.end();) {
+            const auto &[agent_name, label] = *it;
+            mapping map;
+            nixl_blob_t metadata;
+            uint64_t version;
+            nixl_status_t ret = openFile(makePath(agent_name, label), map);
+            if (ret == NIXL_SUCCESS) {
+                ret = read(map, metadata, version);
+            }
+            if (ret == NIXL_ERR_NOT_FOUND) {
+                ++it;
+                continue;
+            }
+            if (ret != NIXL_SUCCESS) {
+                // Already logged, an unreadable file is not retried
+                it = awaited_.erase(it);
+                continue;
+            }
+
+            changes.push_back({agent_name, false, std::move(metadata)});
+            watched_[*it] = watched{std::move(map), version};
+            it = awaited_.erase(it);
+        }
+    }
+    return changes;
+}
+
+void
+nixlLocalMDStore::forget(const std::string &agent_name) {
+    const std::lock_guard lock(mutex_);
+    auto it = watched_.lower_bound({agent_name, ""});
+    while (it != watched_.end() && it->first.first == agent_name) {
+        it = watched_.erase(it);
+    }
+
+    auto awaited_it = awaited_.lower_bound({agent_name, ""});
+    while (awaited_it != awaited_.end() && awaited_it->first == agent_name) {
+        awaited_it = awaited_.erase(awaited_it);
+    }
+}
@@ -0,0 +1,171 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_LOCAL_MD_STORE_H
+#define NIXL_SRC_CORE_LOCAL_MD_STORE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nixl_types.h"
+
+inline constexpr char LOCAL_MD_DIR_VAR[] = "NIXL_LOCAL_MD_DIR";
+inline constexpr char LOCAL_MD_FILE_EXT[] = ".md";
+inline constexpr uint32_t LOCAL_MD_LAYOUT_VERSION = 2;
+
+// Node-local metadata store in file-backed shared memory, e.g. under /dev/shm, following the
+// sharedRingBuffer approach. Each agent publishes every metadata label to its own file, and
+// agents on the same host map that file and read the blob without any socket or etcd round
+// trip. A version counter in the file header changes on every update, so readers can detect
+// updated and invalidated metadata by polling the mapping. The header also records the pid of
+// the publisher, so the metadata of a process that died without invalidating it is treated as
+// invalidated. Agents sharing the directory must therefore share a pid namespace.
+class nixlLocalMDStore {
+public:
+    // A change of a watched agent's metadata found by poll
+    struct change {
+        std::string agentName;
+        bool invalidated;
+        nixl_blob_t metadata;
+    };
+
+    // Directory set through NIXL_LOCAL_MD_DIR, if set and not empty
+    [[nodiscard]] static std::optional<std::string>
+    dirFromEnv();
+
+    // Returns nullptr unless dirFromEnv() has a value
+    [[nodiscard]] static std::unique_ptr<nixlLocalMDStore>
+    createFromEnv();
+
+    explicit nixlLocalMDStore(const std::string &dir);
+    // Invalidates all metadata published through this store
+    ~nixlLocalMDStore();
+
+    nixlLocalMDStore(const nixlLocalMDStore &) = delete;
+    nixlLocalMDStore &
+    operator=(const nixlLocalMDStore &) = delete;
+
+    nixl_status_t
+    publish(const std::string &agent_name, const std::string &label, const nixl_blob_t &metadata);
+
+    // Invalidate all labels the agent published through this store
+    nixl_status_t
+    invalidate(const std::string &agent_name);
+
+    // Read an agent's metadata, NIXL_ERR_NOT_FOUND if it is not published on this host.
+    // The entry is watched afterwards, so poll reports its updates and invalidation.
+    nixl_status_t
+    fetch(const std::string &agent_name, const std::string &label, nixl_blob_t &metadata);
+
+    // Keep looking for metadata that fetch did not find, poll reports it once published
+    void
+    waitFor(const std::string &agent_name, const std::string &label);
+
+    // Check the version counters of watched entries, the liveness of their publishers, and
+    // whether awaited entries were published
+    [[nodiscard]] std::vector<change>
+    poll();
+
+    // Stop watching and waiting for all of the agent's entries
+    void
+    forget(const std::string &agent_name);
+
+    [[nodiscard]] const std::string &
+    getDir() const {
+        return dir_;
+    }
+
+private:
+    struct header;
+
+    // Shared mapping of one metadata file
+    class mapping {
+    public:
+        mapping() = default;
+        mapping(void *addr, size_t length) : addr_(addr), length_(length) {}
+        mapping(mapping &&other) noexcept;
+        mapping &
+        operator=(mapping &&other) noexcept;
+        ~mapping();
+
+        [[nodiscard]] header *
+        getHeader() const;
+
+        [[nodiscard]] char *
+        getData() const;
+
+        [[nodiscard]] size_t
+        getCapacity() const;
+
+        explicit operator bool() const {
+            return addr_ != nullptr;
+        }
+
+    private:
+        void *addr_ = nullptr;
+        size_t length_ = 0;
+    };
+
+    struct watched {
+        mapping map;
+        uint64_t version;
+    };
+
+    using entry_key_t = std::pair<std::string, std::string>;
+
+    [[nodiscard]] std::string
+    makePath(const std::string &agent_name, const std::string &label) const;
+
+    // Create a file holding the metadata and move it into place at path
+    nixl_status_t
+    createFile(const std::string &path,
+               const nixl_blob_t &metadata,
+               uint64_t version,
+               mapping &out);
+
+    // Map an existing file for reading, NIXL_ERR_NOT_FOUND if it does not exist
+    static nixl_status_t
+    openFile(const std::string &path, mapping &out);
+
+    // Consistent copy of the blob, NIXL_ERR_NOT_FOUND if the mapping is no longer live or
+    // its publisher exited
+    static nixl_status_t
+    read(const mapping &map, nixl_blob_t &metadata, uint64_t &version);
+
+    // Whether the process that published the mapping no longer exists
+    [[nodiscard]] static bool
+    isStale(const mapping &map);
+
+    const std::string dir_;
+
+    std::mutex mutex_;
+    std::map<entry_key_t, mapping> published_;
+    std::map<entry_key_t, watched> watched_;
+    std::set<entry_key_t> awaited_;
+    std::chrono::steady_clock::time_point nextAwaitCheck_;
+    std::chrono::steady_clock::time_point nextLivenessCheck_;
+};
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "md_cache.h"
+
+#include "common/nixl_log.h"
+
+namespace {
+const std::chrono::seconds recoveryInterval(1);
+} // namespace
+
+nixlRemoteMDCache::nixlRemoteMDCache(nixlMDStoreClient &client,
+                                     const std::string &namespace_prefix)
+    : client_(client),
+      prefix_(namespace_prefix + "/") {}
+
+nixlRemoteMDCache::~nixlRemoteMDCache() {
+    // Cancel the watch before any state its callback touches goes away
+    watch_.reset();
+}
+
+std::string
+nixlRemoteMDCache::makeKey(const std::string &agent_name, const std::string &label) const {
+    return prefix_ + agent_name + "/" + label;
+}
+
+bool
+nixlRemoteMDCache::parseKey(const std::string &key,
+                            std::string &agent_name,
+                            std::string &label) const {
+    if (key.compare(0, prefix_.size(), prefix_) != 0) {
+        return false;
+    }
+
+    // Labels never contain '/', agent names may
+    const size_t sep = key.rfind('/');
+    if (sep == std::string::npos || sep <= prefix_.size()) {
+        return false;
+    }
+
+    agent_name = key.substr(prefix_.size(), sep - prefix_.size());
+    label = key.substr(sep + 1);
+    return true;
+}
+
+nixl_status_t
+nixlRemoteMDCache::prefetch() {
+    std::unique_ptr<nixlMDWatch> stale_watch;
+    {
+        const std::lock_guard lock(mutex_);
+        if (watching_) {
+            return NIXL_SUCCESS;
+        }
+        stale_watch = std::move(watch_);
+    }
+    // Canceling may wait for a callback that needs the mutex
+    stale_watch.reset();
+
+    std::vector<nixlMDKeyValue> kvs;
+    int64_t revision = 0;
+    const nixl_status_t ret = client_.getPrefix(prefix_, kvs, revision);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR << "Failed to read metadata under " << prefix_ << ": " << ret;
+        return ret;
+    }
+
+    {
+        const std::lock_guard lock(mutex_);
+        entries_.clear();
+        for (const auto &kv : kvs) {
+            std::string agent_name, label;
+            if (parseKey(kv.key, agent_name, label)) {
+                putLocked(agent_name, label, kv.value);
+            }
+        }
+
+        // Keys deleted while no watch was running
+        for (auto it = tracked_.begin(); it != tracked_.end();) {
+            if (entries_.count(*it) == 0) {
+                invalidated_.push_back(*it);
+                it = tracked_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        watching_ = true;
+    }
+
+    NIXL_DEBUG << "Read " << kvs.size() << " metadata keys under " << prefix_ << " at revision "
+               << revision;
+
+    auto watch = client_.watchPrefix(
+        prefix_,
+        revision + 1,
+        [this](const std::vector<nixlMDWatchEvent> &events) { applyEvents(events); },
+        [this]() { onWatchError(); });
+
+    const std::lock_guard lock(mutex_);
+    if (!watch) {
+        NIXL_ERROR << "Failed to watch metadata under " << prefix_;
+        watching_ = false;
+        return NIXL_ERR_BACKEND;
+    }
+    watch_ = std::move(watch);
+    broken_ = false;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlRemoteMDCache::recover() {
+    {
+        const std::lock_guard lock(mutex_);
+        const auto now = std::chrono::steady_clock::now();
+        if (!broken_ || (now < nextRecovery_)) {
+            return NIXL_SUCCESS;
+        }
+        nextRecovery_ = now + recoveryInterval;
+    }
+
+    NIXL_INFO << "Restarting the metadata watch under " << prefix_;
+    return prefetch();
+}
+
+bool
+nixlRemoteMDCache::isWatching() const {
+    const std::lock_guard lock(mutex_);
+    return watching_;
+}
+
+bool
+nixlRemoteMDCache::lookup(const std::string &agent_name,
+                          const std::string &label,
+                          nixl_blob_t &metadata) const {
+    const std::lock_guard lock(mutex_);
+    if (!watching_) {
+        return false;
+    }
+
+    const auto agent_it = entries_.find(agent_name);
+    if (agent_it == entries_.end()) {
+        return false;
+    }
+
+    const auto label_it = agent_it->second.find(label);
+    if (label_it == agent_it->second.end()) {
+        return false;
+    }
+
+    metadata = label_it->second;
+    return true;
+}
+
+std::vector<std::string>
+nixlRemoteMDCache::agentsWithLabel(const std::string &label) const {
+    std::vector<std::string> agents;
+    const std::lock_guard lock(mutex_);
+    for (const auto &[agent_name, labels] : entries_) {
+        if (labels.count(label) != 0) {
+            agents.push_back(agent_name);
+        }
+    }
+    return agents;
+}
+
+void
+nixlRemoteMDCache::track(const std::string &agent_name) {
+    const std::lock_guard lock(mutex_);
+    tracked_.insert(agent_name);
+}
+
+void
+nixlRemoteMDCache::want(const std::string &agent_name, const std::string &label) {
+    const std::lock_guard lock(mutex_);
+    wanted_.emplace(agent_name, label);
+}
+
+std::vector<std::pair<std::string, nixl_blob_t>>
+nixlRemoteMDCache::takeReady() {
+    const std::lock_guard lock(mutex_);
+    return std::exchange(ready_, {});
+}
+
+std::vector<std::string>
+nixlRemoteMDCache::takeInvalidated() {
+    const std::lock_guard lock(mutex_);
+    return std::exchange(invalidated_, {});
+}
+
+void
+nixlRemoteMDCache::putLocked(const std::string &agent_name,
+                             const std::string &label,
+                             const nixl_blob_t &value) {
+    entries_[agent_name][label] = value;
+    if (label.empty()) {
+        return;
+    }
+
+    const auto wanted_it = wanted_.find({agent_name, label});
+    if (wanted_it != wanted_.end()) {
+        wanted_.erase(wanted_it);
+        ready_.emplace_back(agent_name, value);
+    }
+}
+
+void
+nixlRemoteMDCache::removeAgentLocked(const std::string &agent_name) {
+    entries_.erase(agent_name);
+    if (tracked_.erase(agent_name) != 0) {
+        invalidated_.push_back(agent_name);
+    }
+}
+
+void
+nixlRemoteMDCache::applyEvents(const std::vector<nixlMDWatchEvent> &events) {
+    const std::lock_guard lock(mutex_);
+    // A broken watch may have missed events, the next prefetch reconciles from a fresh read
+    if (!watching_) {
+        return;
+    }
+
+    for (const auto &event : events) {
+        std::string agent_name, label;
+        if (!parseKey(event.key, agent_name, label)) {
+            continue;
+        }
+
+        if (!event.deleted) {
+            putLocked(agent_name, label, event.value);
+        } else if (label.empty()) {
+            NIXL_DEBUG << "Metadata of agent " << agent_name << " was invalidated";
+            removeAgentLocked(agent_name);
+        } else {
+            const auto agent_it = entries_.find(agent_name);
+            if (agent_it != entries_.end()) {
+                agent_it->second.erase(label);
+            }
+        }
+    }
+}
+
+void
+nixlRemoteMDCache::onWatchError() {
+    NIXL_WARN << "Metadata watch under " << prefix_ << " failed, reading it again";
+    const std::lock_guard lock(mutex_);
+    watching_ = false;
+    broken_ = true;
+}
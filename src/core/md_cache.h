@@ -0,0 +1,164 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_MD_CACHE_H
+#define NIXL_SRC_CORE_MD_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nixl_types.h"
+
+// A key-value pair read from the metadata server
+struct nixlMDKeyValue {
+    std::string key;
+    nixl_blob_t value;
+};
+
+// A change under a watched prefix. Deleted keys carry an empty value.
+struct nixlMDWatchEvent {
+    bool deleted;
+    std::string key;
+    nixl_blob_t value;
+};
+
+using nixl_md_watch_cb_t = std::function<void(const std::vector<nixlMDWatchEvent> &events)>;
+
+// Handle of an active prefix watch, the watch is canceled when it is destroyed
+class nixlMDWatch {
+public:
+    virtual ~nixlMDWatch() = default;
+};
+
+// Minimal view of the central metadata server used by nixlRemoteMDCache, implemented on top of
+// etcd by the listener thread, and by in-memory stand-ins in tests.
+class nixlMDStoreClient {
+public:
+    virtual ~nixlMDStoreClient() = default;
+
+    // Read every key under the prefix in a single range request. revision is the store
+    // revision the read was served at.
+    virtual nixl_status_t
+    getPrefix(const std::string &prefix, std::vector<nixlMDKeyValue> &kvs, int64_t &revision) = 0;
+
+    // Report every change under the prefix made after from_revision. on_error is called once
+    // if the watch breaks, after which no more events are delivered.
+    virtual std::unique_ptr<nixlMDWatch>
+    watchPrefix(const std::string &prefix,
+                int64_t from_revision,
+                nixl_md_watch_cb_t on_events,
+                std::function<void()> on_error) = 0;
+};
+
+// Local copy of all agents' metadata in an etcd namespace. The first prefetch reads the whole
+// namespace in one range request, then a single prefix watch keeps the copy up to date, so
+// later lookups need no round trip. Keys are "<namespace>/<agent>/<label>", and each agent also
+// owns an empty "<namespace>/<agent>/" key whose deletion invalidates all of its metadata.
+//
+// The watch callback runs on the client's thread, everything else is called by the listener
+// thread, so all state is guarded by one mutex.
+class nixlRemoteMDCache {
+public:
+    nixlRemoteMDCache(nixlMDStoreClient &client, const std::string &namespace_prefix);
+    ~nixlRemoteMDCache();
+
+    nixlRemoteMDCache(const nixlRemoteMDCache &) = delete;
+    nixlRemoteMDCache &
+    operator=(const nixlRemoteMDCache &) = delete;
+
+    [[nodiscard]] std::string
+    makeKey(const std::string &agent_name, const std::string &label) const;
+
+    // Populate the cache and start the prefix watch. No-op while the watch is healthy.
+    nixl_status_t
+    prefetch();
+
+    // After the watch broke, read the namespace again and restart the watch, so tracked agents
+    // invalidated in between are reported. Called periodically, retries at most once a second.
+    nixl_status_t
+    recover();
+
+    [[nodiscard]] bool
+    isWatching() const;
+
+    [[nodiscard]] bool
+    lookup(const std::string &agent_name, const std::string &label, nixl_blob_t &metadata) const;
+
+    // Agents that currently publish metadata under the label
+    [[nodiscard]] std::vector<std::string>
+    agentsWithLabel(const std::string &label) const;
+
+    // Report the deletion of the agent's keys through takeInvalidated
+    void
+    track(const std::string &agent_name);
+
+    // Report the agent's metadata through takeReady once it is published
+    void
+    want(const std::string &agent_name, const std::string &label);
+
+    // Wanted metadata published since the last call, as (agent, metadata) pairs
+    [[nodiscard]] std::vector<std::pair<std::string, nixl_blob_t>>
+    takeReady();
+
+    // Tracked agents whose keys were deleted since the last call. They are no longer tracked.
+    [[nodiscard]] std::vector<std::string>
+    takeInvalidated();
+
+private:
+    // Split a key into agent and label, false if it is outside the namespace
+    bool
+    parseKey(const std::string &key, std::string &agent_name, std::string &label) const;
+
+    void
+    applyEvents(const std::vector<nixlMDWatchEvent> &events);
+
+    void
+    onWatchError();
+
+    void
+    putLocked(const std::string &agent_name, const std::string &label, const nixl_blob_t &value);
+
+    void
+    removeAgentLocked(const std::string &agent_name);
+
+    nixlMDStoreClient &client_;
+    const std::string prefix_;
+
+    mutable std::mutex mutex_;
+    // Agent name to label to metadata blob
+    std::map<std::string, std::map<std::string, nixl_blob_t>> entries_;
+    std::set<std::string> tracked_;
+    std::set<std::pair<std::string, std::string>> wanted_;
+    std::vector<std::pair<std::string, nixl_blob_t>> ready_;
+    std::vector<std::string> invalidated_;
+    bool watching_ = false;
+    // The watch broke and was not restarted yet
+    bool broken_ = false;
+    std::chrono::steady_clock::time_point nextRecovery_;
+
+    // Destroyed first, so no callback runs on a partially destroyed cache
+    std::unique_ptr<nixlMDWatch> watch_;
+};
+
+#endif
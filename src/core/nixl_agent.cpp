@@ -15,10 +15,16 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <chrono>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <iterator>
 #include <numeric>
+#include <stdexcept>
+#include <thread>
 
 #include "nixl.h"
 #include "serdes/serdes.h"
@@ -32,6 +38,7 @@
 #include "common/hw_info.h"
 #include "telemetry.h"
 #include "telemetry_event.h"
+#include <absl/strings/str_join.h>
 
 namespace {
 
@@ -39,6 +46,10 @@ const std::vector<std::vector<std::string>> illegal_plugin_combinations = {
     {"GDS", "GDS_MT"},
 };
 
+// Bounds of the sleep between polls in waitNotif, it doubles while nothing arrives
+constexpr chrono_period_us_t notifWaitMinSleep{1};
+constexpr chrono_period_us_t notifWaitMaxSleep{1000};
+
 } // namespace
 
 void
@@ -81,8 +92,10 @@ nixlXferReqH::updateRequestStats(nixlTelemetry *telemetry_pub,
     }
 
     if (telemetry_pub && (stat_status != NIXL_TELEMETRY_POST)) {
-        telemetry_pub->addPostTime(telemetry.postDuration);
-        telemetry_pub->addXferTime(duration, backendOp == NIXL_WRITE, telemetry.totalBytes);
+        const nixlTelemetryLabels labels{engine->getType(), remoteAgent};
+        telemetry_pub->addPostTime(telemetry.postDuration, backendOp == NIXL_WRITE, labels);
+        telemetry_pub->addXferTime(
+            duration, backendOp == NIXL_WRITE, telemetry.totalBytes, labels);
     }
 
     NIXL_TRACE << "[NIXL TELEMETRY]: From backend " << engine->getType()
@@ -91,9 +104,91 @@ nixlXferReqH::updateRequestStats(nixlTelemetry *telemetry_pub,
                << duration.count() << "us.";
 }
 
-nixlDlistH::nixlDlistH(const std::string &remote_agent, descs_t &&descs)
+void
+nixlXferReqH::stageIn() const {
+    for (const auto &copy : stagedCopies) {
+        std::memcpy(copy.staging, copy.user, copy.len);
+    }
+}
+
+void
+nixlXferReqH::stageOut() const {
+    for (const auto &copy : stagedCopies) {
+        std::memcpy(copy.user, copy.staging, copy.len);
+    }
+}
+
+nixlXferPlanH::nixlXferPlanH(const std::string &remote_agent,
+                             const nixl_xfer_op_t backend_op,
+                             const nixl_mem_t local_type,
+                             const nixl_mem_t remote_type)
+    : remoteAgent(remote_agent),
+      backendOp(backend_op),
+      initiatorDescs(local_type),
+      targetDescs(remote_type) {}
+
+nixlXferPlanH::~nixlXferPlanH() {
+    for (const auto &[desc_count, handle] : handles_) {
+        engine->releaseReqH(handle);
+    }
+}
+
+nixlBackendReqH *
+nixlXferPlanH::takeHandle(int desc_count) {
+    std::lock_guard<std::mutex> lock(handlesMutex_);
+    for (auto it = handles_.begin(); it != handles_.end(); ++it) {
+        if (it->first == desc_count) {
+            nixlBackendReqH *handle = it->second;
+            *it = handles_.back();
+            handles_.pop_back();
+            return handle;
+        }
+    }
+    return nullptr;
+}
+
+bool
+nixlXferPlanH::keepHandle(int desc_count, nixlBackendReqH *handle) {
+    std::lock_guard<std::mutex> lock(handlesMutex_);
+    if (handles_.size() >= maxKeptHandles) {
+        return false;
+    }
+    handles_.emplace_back(desc_count, handle);
+    return true;
+}
+
+nixlDlistH::nixlDlistH(const std::string &remote_agent,
+                       backends_t &&backends,
+                       std::unique_ptr<nixl_meta_dlist_t> first_descs)
     : remoteAgent(remote_agent),
-      descs(std::move(descs)) {}
+      backends_(std::move(backends)),
+      firstDescs_(std::move(first_descs)),
+      lazyDescs_(backends_.size() > 1 ? std::make_unique<lazyDescs[]>(backends_.size() - 1) :
+                                        nullptr) {}
+
+const nixl_meta_dlist_t *
+nixlDlistH::getDescs(nixlBackendEngine *backend, const nixlMemSection &section) const {
+    const auto it = std::find(backends_.begin(), backends_.end(), backend);
+    if (it == backends_.end()) {
+        return nullptr;
+    }
+    if (it == backends_.begin()) {
+        return firstDescs_.get();
+    }
+
+    // Resolve against the already populated list, which holds the original descriptors
+    lazyDescs &lazy = lazyDescs_[it - backends_.begin() - 1];
+    std::call_once(lazy.once, [&]() {
+        auto descs = std::make_unique<nixl_meta_dlist_t>(firstDescs_->getType());
+        if (section.populate(*firstDescs_, backend, *descs) == NIXL_SUCCESS) {
+            lazy.descs = std::move(descs);
+        } else {
+            NIXL_DEBUG << "backend '" << backend->getType()
+                       << "' could not resolve the prepared descriptors";
+        }
+    });
+    return lazy.descs.get();
+}
 
 /*** nixlAgentData constructor/destructor, as part of nixlAgent's ***/
 
@@ -127,7 +222,8 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &con
     : name_(name),
       config_(config),
       useEtcd_(detectEtcd()),
-      needsCommThread_(useEtcd_ || config.useListenThread),
+      useLocalMD_(nixlLocalMDStore::dirFromEnv().has_value()),
+      needsCommThread_(useEtcd_ || useLocalMD_ || config.useListenThread),
       lock(effectiveSyncMode(config.syncMode, needsCommThread_)) {
 #if HAVE_ETCD
     NIXL_DEBUG << "NIXL ETCD is " << (useEtcd_ ? "enabled" : "disabled");
@@ -155,6 +251,14 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &con
         telemetryEnabled = true;
         NIXL_DEBUG << "Capturing NIXL telemetry based on config (without an output file)";
     }
+
+    tracer_ = nixlTracer::createFromEnv(name);
+    localCopy_ = nixlLocalCopyEngine::createFromEnv(name);
+    localMD_ = nixlLocalMDStore::createFromEnv();
+
+    if (nixlXferScheduler::hasLimits(config)) {
+        scheduler_ = std::make_unique<nixlXferScheduler>(config, telemetry_.get());
+    }
 }
 
 /*** nixlAgent implementation ***/
@@ -428,11 +532,14 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
 
     // Best effort, if at least one succeeds NIXL_SUCCESS is returned
     // Can become more sophisticated to have a soft error case
+    size_t cache_hits = 0;
+    size_t cache_misses = 0;
     for (size_t i=0; i<backend_list->size(); ++i) {
         nixlBackendEngine* backend = (*backend_list)[i];
         // meta_descs use to be passed to loadLocalData
         nixl_sec_dlist_t sec_descs(descs.getType());
-        nixl_status_t ret = data->localSection_.addDescList(descs, backend, sec_descs);
+        size_t hits = 0;
+        nixl_status_t ret = data->localSection_.addDescList(descs, backend, sec_descs, &hits);
         if (ret == NIXL_SUCCESS) {
             if (backend->supportsLocal()) {
                 const auto [it, inserted] =
@@ -448,6 +555,11 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
                 count++;
             }
         } // a bad_ret can be saved in an else
+
+        if (ret == NIXL_SUCCESS) {
+            cache_hits += hits;
+            cache_misses += descs.descCount() - hits;
+        }
     }
 
     if (extra_params && extra_params->backends.size() > 0)
@@ -462,6 +574,12 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
                 uint64_t{0},
                 [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
             data->telemetry_->updateMemoryRegistered(total_size);
+            if (cache_hits > 0) {
+                data->telemetry_->updateRegCacheHits(cache_hits);
+            }
+            if (cache_misses > 0) {
+                data->telemetry_->updateRegCacheMisses(cache_misses);
+            }
         }
         return NIXL_SUCCESS;
     }
@@ -579,10 +697,10 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
                           nixlDlistH* &dlist_hndl,
                           const nixl_opt_args_t* extra_params) const {
 
-    // Using a set as order is not important to revert the operation
-    backend_set_t *backend_set;
     const bool init_side = (agent_name == NIXL_INIT_AGENT);
 
+    dlist_hndl = nullptr;
+
     NIXL_LOCK_GUARD(data->lock);
     // When central KV is supported, still it should return error,
     // just we can add a call to fetchRemoteMD for next time
@@ -596,38 +714,45 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
     nixlMemSection &section = init_side ? static_cast<nixlMemSection &>(data->localSection_) :
                                           static_cast<nixlMemSection &>(rem_sec_it->second);
 
+    // Candidate backends in preference order: the order of the backends hint list if
+    // provided, otherwise the backend creation order for the memory type, leaving out the
+    // backends only used when named.
+    nixlDlistH::backends_t backends;
     if (!extra_params || (extra_params->backends.size() == 0)) {
-        backend_set = section.queryBackends(descs.getType());
+        const backend_set_t *backend_set = section.queryBackends(descs.getType());
 
         if (!backend_set || backend_set->empty()) {
             NIXL_ERROR_FUNC << "no available backends for mem type '" << descs.getType() << "'";
             data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
             return NIXL_ERR_NOT_FOUND;
         }
+
+        for (auto &elm : data->memToBackend[descs.getType()]) {
+            if (!elm->explicitSelectionOnly() && (backend_set->count(elm) != 0)) {
+                backends.push_back(elm);
+            }
+        }
     } else {
-        backend_set = new backend_set_t();
         for (auto &elm : extra_params->backends) {
-            backend_set->insert(elm->engine);
+            if (std::find(backends.begin(), backends.end(), elm->engine) == backends.end()) {
+                backends.push_back(elm->engine);
+            }
         }
     }
 
     // TODO [Perf]: Avoid heap allocation on the datapath, maybe use a mem pool
 
-    std::unordered_map<nixlBackendEngine *, std::unique_ptr<nixl_meta_dlist_t>> dlists;
-
-    for (const auto &backend : *backend_set) {
-        nixl_meta_dlist_t dlist(descs.getType());
-        if (section.populate(descs, backend, dlist) == NIXL_SUCCESS) {
-            dlists.try_emplace(backend, std::make_unique<nixl_meta_dlist_t>(std::move(dlist)));
+    // Populate the first backend that can resolve the descriptors; the ones after it are
+    // populated on demand, and the ones before it are dropped.
+    auto first_descs = std::make_unique<nixl_meta_dlist_t>(descs.getType());
+    auto first_it = backends.begin();
+    for (; first_it != backends.end(); ++first_it) {
+        if (section.populate(descs, *first_it, *first_descs) == NIXL_SUCCESS) {
+            break;
         }
     }
 
-    if (extra_params && (extra_params->backends.size() > 0)) {
-        delete backend_set;
-    }
-
-    if (dlists.empty()) {
-        dlist_hndl = nullptr;
+    if (first_it == backends.end()) {
         NIXL_ERROR_FUNC << "failed to prepare the descriptors for any of "
                            "the specified or potential backends for agent '"
                         << agent_name << "'";
@@ -635,7 +760,8 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
         return NIXL_ERR_NOT_FOUND;
     }
 
-    dlist_hndl = new nixlDlistH(agent_name, std::move(dlists));
+    backends.erase(backends.begin(), first_it);
+    dlist_hndl = new nixlDlistH(agent_name, std::move(backends), std::move(first_descs));
     return NIXL_SUCCESS;
 }
 
@@ -646,61 +772,225 @@ nixlAgent::prepXferDlist(const nixl_xfer_dlist_t &descs,
     return prepXferDlist(NIXL_INIT_AGENT, descs, dlist_hndl, extra_params);
 }
 
+namespace {
+
+// True if the next pair of descriptors continues the last pair on both sides, with the same
+// registrations, so the two pairs can be merged
+bool
+continuesPair(const nixlMetaDesc &local,
+              const nixlMetaDesc &remote,
+              const nixlMetaDesc &next_local,
+              const nixlMetaDesc &next_remote) {
+    return ((local.addr + local.len) == next_local.addr) &&
+        ((remote.addr + remote.len) == next_remote.addr) &&
+        (local.metadataP == next_local.metadataP) &&
+        (remote.metadataP == next_remote.metadataP) && (local.devId == next_local.devId) &&
+        (remote.devId == next_remote.devId);
+}
+
+// Index sequences accepted by nixlAgentData::makeXferReq. Each provides size(), validate()
+// against the prepared descriptor list it indexes into, and a forward cursor over the expanded
+// indices.
+class indexListSeq {
+public:
+    class cursor {
+    public:
+        explicit cursor(const int *pos) : pos_(pos) {}
+
+        int
+        operator*() const {
+            return *pos_;
+        }
+
+        cursor &
+        operator++() {
+            ++pos_;
+            return *this;
+        }
+
+    private:
+        const int *pos_;
+    };
+
+    explicit indexListSeq(const std::vector<int> &indices) : indices_(indices) {}
+
+    size_t
+    size() const {
+        return indices_.size();
+    }
+
+    bool
+    validate(const nixl_meta_dlist_t &descs, const char *side) const {
+        for (size_t i = 0; i < indices_.size(); ++i) {
+            if ((indices_[i] >= descs.descCount()) || (indices_[i] < 0)) {
+                NIXL_ERROR << "makeXferReq: " << side << " index out of range at index " << i
+                           << " with value " << indices_[i];
+                return false;
+            }
+        }
+        return true;
+    }
+
+    cursor
+    begin() const {
+        return cursor(indices_.data());
+    }
+
+private:
+    const std::vector<int> &indices_;
+};
+
+class indexRunSeq {
+public:
+    class cursor {
+    public:
+        explicit cursor(const nixlIndexRun *run)
+            : run_(run),
+              left_(run->count),
+              value_(run->start) {}
+
+        int
+        operator*() const {
+            return value_;
+        }
+
+        // Callers never advance past the last index, so the next run always exists here
+        cursor &
+        operator++() {
+            if (--left_ > 0) {
+                value_ += run_->stride;
+            } else {
+                ++run_;
+                left_ = run_->count;
+                value_ = run_->start;
+            }
+            return *this;
+        }
+
+    private:
+        const nixlIndexRun *run_;
+        int left_;
+        int value_;
+    };
+
+    explicit indexRunSeq(const nixl_index_runs_t &runs) : runs_(runs) {
+        for (const auto &run : runs_) {
+            total_ += std::max(run.count, 0);
+        }
+    }
+
+    size_t
+    size() const {
+        return total_;
+    }
+
+    bool
+    validate(const nixl_meta_dlist_t &descs, const char *side) const {
+        if (total_ > static_cast<size_t>(std::numeric_limits<int>::max())) {
+            NIXL_ERROR << "makeXferReq: " << side << " index runs expand to " << total_
+                       << " indices, more than supported";
+            return false;
+        }
+
+        for (size_t i = 0; i < runs_.size(); ++i) {
+            const nixlIndexRun &run = runs_[i];
+            if (run.count <= 0) {
+                NIXL_ERROR << "makeXferReq: " << side << " index run " << i
+                           << " has non-positive count " << run.count;
+                return false;
+            }
+
+            const int64_t last = static_cast<int64_t>(run.start) +
+                static_cast<int64_t>(run.count - 1) * static_cast<int64_t>(run.stride);
+            if ((run.start < 0) || (run.start >= descs.descCount()) || (last < 0) ||
+                (last >= descs.descCount())) {
+                NIXL_ERROR << "makeXferReq: " << side << " index run " << i << " (start "
+                           << run.start << ", count " << run.count << ", stride " << run.stride
+                           << ") out of range";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    cursor
+    begin() const {
+        return cursor(runs_.data());
+    }
+
+private:
+    const nixl_index_runs_t &runs_;
+    size_t total_ = 0;
+};
+
+} // namespace
+
+template<typename indexSeqT>
 nixl_status_t
-nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
-                        const nixlDlistH* local_side,
-                        const std::vector<int> &local_indices,
-                        const nixlDlistH* remote_side,
-                        const std::vector<int> &remote_indices,
-                        nixlXferReqH* &req_hndl,
-                        const nixl_opt_args_t* extra_params) const {
+nixlAgentData::makeXferReq(const nixl_xfer_op_t &operation,
+                           const nixlDlistH *local_side,
+                           const indexSeqT &local_seq,
+                           const nixlDlistH *remote_side,
+                           const indexSeqT &remote_seq,
+                           nixlXferReqH *&req_hndl,
+                           const nixl_opt_args_t *extra_params) {
 
     nixl_opt_b_args_t  opt_args;
     nixl_status_t      ret;
-    int                desc_count = (int) local_indices.size();
     nixlBackendEngine* backend    = nullptr;
 
     req_hndl = nullptr;
+    const uint64_t trace_start = tracer_ ? nixlTracer::now() : 0;
 
     if (!local_side || !remote_side) {
         NIXL_ERROR_FUNC << "local or remote side handle is null";
-        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
         return NIXL_ERR_INVALID_PARAM;
     }
 
     if ((!local_side->remoteAgent.empty()) || remote_side->remoteAgent.empty()) {
         NIXL_ERROR_FUNC << "invalid sides (local must be local, remote must be remote)";
-        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    NIXL_LOCK_GUARD(data->lock);
+    NIXL_LOCK_GUARD(lock);
     // The remote was invalidated in between prepXferDlist and this call
-    if (data->remoteSections_.count(remote_side->remoteAgent) == 0) {
+    if (remoteSections_.count(remote_side->remoteAgent) == 0) {
         NIXL_ERROR_FUNC << "remote agent '" << remote_side->remoteAgent
                         << "' was invalidated in between prepXferDlist and this call";
-        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
         return NIXL_ERR_NOT_FOUND;
     }
 
+    const nixlMemSection &remote_section = remoteSections_.at(remote_side->remoteAgent);
+    const nixl_meta_dlist_t *local_descs_p = nullptr;
+    const nixl_meta_dlist_t *remote_descs_p = nullptr;
+
+    // Descriptors of backends not populated at prep time are populated here, on first use
+    auto try_backend = [&](nixlBackendEngine *engine) {
+        local_descs_p = local_side->getDescs(engine, localSection_);
+        remote_descs_p = local_descs_p ? remote_side->getDescs(engine, remote_section) : nullptr;
+        if (local_descs_p && remote_descs_p) {
+            backend = engine;
+        }
+        return backend != nullptr;
+    };
+
     if (extra_params && extra_params->backends.size() > 0) {
         for (auto & elm : extra_params->backends) {
-            if ((local_side->descs.count(elm->engine) > 0) &&
-                (remote_side->descs.count(elm->engine) > 0)) {
-                backend = elm->engine;
+            if (try_backend(elm->engine)) {
                 break;
             }
         }
     } else {
-        for (auto & loc_bknd : local_side->descs) {
-            for (auto & rem_bknd : remote_side->descs) {
-                if (loc_bknd.first == rem_bknd.first) {
-                    backend = loc_bknd.first;
-                    break;
-                }
-            }
-            if (backend)
+        const auto &remote_backends = remote_side->getBackends();
+        for (auto &loc_bknd : local_side->getBackends()) {
+            if ((std::find(remote_backends.begin(), remote_backends.end(), loc_bknd) !=
+                 remote_backends.end()) &&
+                try_backend(loc_bknd)) {
                 break;
+            }
         }
     }
 
@@ -710,34 +1000,35 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    const nixl_meta_dlist_t &local_descs = *local_side->descs.at(backend);
-    const nixl_meta_dlist_t &remote_descs = *remote_side->descs.at(backend);
+    const nixl_meta_dlist_t &local_descs = *local_descs_p;
+    const nixl_meta_dlist_t &remote_descs = *remote_descs_p;
     size_t total_bytes = 0;
 
-    if ((desc_count == 0) || (remote_indices.size() == 0) ||
-        (desc_count != (int)remote_indices.size())) {
-        NIXL_ERROR_FUNC << "different number of indices for local (" << desc_count << "), remote ("
-                        << remote_indices.size() << ")";
+    if ((local_seq.size() == 0) || (remote_seq.size() == 0) ||
+        (local_seq.size() != remote_seq.size())) {
+        NIXL_ERROR_FUNC << "different number of indices for local (" << local_seq.size()
+                        << "), remote (" << remote_seq.size() << ")";
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    for (int i=0; i<desc_count; ++i) {
-        if ((local_indices[i] >= local_descs.descCount()) || (local_indices[i] < 0)) {
-            NIXL_ERROR_FUNC << "local index out of range at index " << i << " with value "
-                            << local_indices[i];
-            return NIXL_ERR_INVALID_PARAM;
-        }
-        if ((remote_indices[i] >= remote_descs.descCount()) || (remote_indices[i] < 0)) {
-            NIXL_ERROR_FUNC << "remote index out of range at index " << i << " with value "
-                            << remote_indices[i];
-            return NIXL_ERR_INVALID_PARAM;
+    if (!local_seq.validate(local_descs, "local") || !remote_seq.validate(remote_descs, "remote")) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    const int desc_count = static_cast<int>(local_seq.size());
+    auto local_it = local_seq.begin();
+    auto remote_it = remote_seq.begin();
+    for (int i = 0; i < desc_count; ++i) {
+        if (i > 0) {
+            ++local_it;
+            ++remote_it;
         }
-        if (local_descs[local_indices[i]].len != remote_descs[remote_indices[i]].len) {
+        if (local_descs[*local_it].len != remote_descs[*remote_it].len) {
             NIXL_ERROR_FUNC << "length mismatch at index pair " << i << " with local index "
-                            << local_indices[i] << " and remote index " << remote_indices[i];
+                            << *local_it << " and remote index " << *remote_it;
             return NIXL_ERR_INVALID_PARAM;
         }
-        total_bytes += local_descs[local_indices[i]].len;
+        total_bytes += local_descs[*local_it].len;
     }
 
     if (extra_params) {
@@ -748,6 +1039,10 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
             opt_args.notifMsg = extra_params->notifMsg;
             opt_args.hasNotif = true;
         }
+
+        if (extra_params->trafficClass) {
+            opt_args.trafficClass = *extra_params->trafficClass;
+        }
     }
 
     if ((opt_args.hasNotif) && (!backend->supportsNotif())) {
@@ -762,44 +1057,45 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
                                                  remote_descs.getType(),
                                                  desc_count);
 
+    local_it = local_seq.begin();
+    remote_it = remote_seq.begin();
     if (extra_params && extra_params->skipDescMerge) {
         for (int i=0; i<desc_count; ++i) {
-            handle->initiatorDescs[i] = local_descs[local_indices[i]];
-            handle->targetDescs[i] = remote_descs[remote_indices[i]];
+            if (i > 0) {
+                ++local_it;
+                ++remote_it;
+            }
+            handle->initiatorDescs[i] = local_descs[*local_it];
+            handle->targetDescs[i] = remote_descs[*remote_it];
         }
     } else {
-        int i = 0, j = 0; //final list size
-        while (i<(desc_count)) {
-            nixlMetaDesc local_desc1 = local_descs[local_indices[i]];
-            nixlMetaDesc remote_desc1 = remote_descs[remote_indices[i]];
-
-            if(i != (desc_count-1) ) {
-                const nixlMetaDesc *local_desc2 = &(local_descs[local_indices[i + 1]]);
-                const nixlMetaDesc *remote_desc2 = &(remote_descs[remote_indices[i + 1]]);
-
-                while (((local_desc1.addr + local_desc1.len) == local_desc2->addr) &&
-                       ((remote_desc1.addr + remote_desc1.len) == remote_desc2->addr) &&
-                       (local_desc1.metadataP == local_desc2->metadataP) &&
-                       (remote_desc1.metadataP == remote_desc2->metadataP) &&
-                       (local_desc1.devId == local_desc2->devId) &&
-                       (remote_desc1.devId == remote_desc2->devId)) {
-
-                    local_desc1.len += local_desc2->len;
-                    remote_desc1.len += remote_desc2->len;
-
-                    i++;
-                    if(i == (desc_count-1)) break;
-
-                    local_desc2 = &(local_descs[local_indices[i + 1]]);
-                    remote_desc2 = &(remote_descs[remote_indices[i + 1]]);
-                }
+        int j = 0; //final list size
+        nixlMetaDesc local_desc1 = local_descs[*local_it];
+        nixlMetaDesc remote_desc1 = remote_descs[*remote_it];
+
+        for (int i = 1; i < desc_count; ++i) {
+            ++local_it;
+            ++remote_it;
+            const nixlMetaDesc &local_desc2 = local_descs[*local_it];
+            const nixlMetaDesc &remote_desc2 = remote_descs[*remote_it];
+
+            if (continuesPair(local_desc1, remote_desc1, local_desc2, remote_desc2)) {
+                local_desc1.len += local_desc2.len;
+                remote_desc1.len += remote_desc2.len;
+                continue;
             }
 
             handle->initiatorDescs[j] = local_desc1;
             handle->targetDescs[j] = remote_desc1;
             j++;
-            i++;
+            local_desc1 = local_desc2;
+            remote_desc1 = remote_desc2;
         }
+
+        handle->initiatorDescs[j] = local_desc1;
+        handle->targetDescs[j] = remote_desc1;
+        j++;
+
         NIXL_DEBUG << "reqH descList size down to " << j;
         handle->initiatorDescs.resize(j);
         handle->targetDescs.resize(j);
@@ -808,12 +1104,35 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     handle->engine = backend;
     handle->notifMsg = opt_args.notifMsg;
     handle->hasNotif = opt_args.hasNotif;
+    handle->trafficClass = opt_args.trafficClass;
+    if (extra_params) {
+        handle->deadline = extra_params->deadline;
+    }
 
-    if (data->telemetryEnabled) {
+    // Transfers between DRAM buffers of this agent skip the backend's loopback
+    if (localCopy_ && (handle->remoteAgent == name_) &&
+        (local_descs.getType() == DRAM_SEG) && (remote_descs.getType() == DRAM_SEG)) {
+        handle->selectedBackend = backend;
+        handle->engine = backend = localCopy_.get();
+    }
+
+    if (telemetryEnabled) {
         handle->telemetry.totalBytes = total_bytes;
         handle->telemetry.descCount = handle->initiatorDescs.descCount();
     }
 
+    uint64_t trace_prep = 0;
+    if (tracer_) {
+        handle->traceId = tracer_->nextReqId();
+        trace_prep = nixlTracer::now();
+        tracer_->record(nixl_trace_stage_t::POPULATE,
+                        handle->traceId,
+                        trace_start,
+                        trace_prep,
+                        handle->initiatorDescs.descCount(),
+                        backend->getType());
+    }
+
     ret = handle->engine->prepXfer(handle->backendOp,
                                    handle->initiatorDescs,
                                    handle->targetDescs,
@@ -823,14 +1142,64 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     if (ret != NIXL_SUCCESS) {
         NIXL_ERROR_FUNC << "backend '" << backend->getType()
                         << "' failed to prepare the transfer request with status " << ret;
-        data->addErrorTelemetry(ret);
+        addErrorTelemetry(ret);
         return ret;
     }
 
+    if (tracer_) {
+        const uint64_t trace_end = nixlTracer::now();
+        tracer_->record(nixl_trace_stage_t::BACKEND_PREP,
+                        handle->traceId,
+                        trace_prep,
+                        trace_end,
+                        0,
+                        backend->getType());
+        tracer_->record(nixl_trace_stage_t::CREATE,
+                        handle->traceId,
+                        trace_start,
+                        trace_end,
+                        total_bytes,
+                        backend->getType());
+    }
+
     req_hndl = handle.release();
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
+                        const nixlDlistH* local_side,
+                        const std::vector<int> &local_indices,
+                        const nixlDlistH* remote_side,
+                        const std::vector<int> &remote_indices,
+                        nixlXferReqH* &req_hndl,
+                        const nixl_opt_args_t* extra_params) const {
+    return data->makeXferReq(operation,
+                             local_side,
+                             indexListSeq(local_indices),
+                             remote_side,
+                             indexListSeq(remote_indices),
+                             req_hndl,
+                             extra_params);
+}
+
+nixl_status_t
+nixlAgent::makeXferReq(const nixl_xfer_op_t &operation,
+                       const nixlDlistH *local_side,
+                       const nixl_index_runs_t &local_runs,
+                       const nixlDlistH *remote_side,
+                       const nixl_index_runs_t &remote_runs,
+                       nixlXferReqH *&req_hndl,
+                       const nixl_opt_args_t *extra_params) const {
+    return data->makeXferReq(operation,
+                             local_side,
+                             indexRunSeq(local_runs),
+                             remote_side,
+                             indexRunSeq(remote_runs),
+                             req_hndl,
+                             extra_params);
+}
+
 nixl_status_t
 nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
                          const nixl_xfer_dlist_t &local_descs,
@@ -840,9 +1209,14 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
                          const nixl_opt_args_t* extra_params) const {
     nixl_status_t ret1, ret2;
     nixl_opt_b_args_t opt_args;
-    backend_set_t backend_set;
 
     req_hndl = nullptr;
+    if (extra_params && extra_params->stagingPool) {
+        return createStagedXferReq(
+            operation, local_descs, remote_descs, remote_agent, req_hndl, *extra_params);
+    }
+
+    const uint64_t trace_start = data->tracer_ ? nixlTracer::now() : 0;
 
     // Check the correspondence between descriptor lists
     if (local_descs.descCount() != remote_descs.descCount()) {
@@ -868,6 +1242,10 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
         total_bytes += local_descs[i].len;
     }
 
+    // Candidate backends in preference order: the order of the backends hint list if
+    // provided, otherwise the backend creation order for the local memory type, leaving out
+    // the backends only used when named.
+    backend_list_t candidates;
     if (!extra_params || extra_params->backends.size() == 0) {
         // Finding backends that support the corresponding memories
         // locally and remotely, and find the common ones.
@@ -879,18 +1257,21 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
             return NIXL_ERR_NOT_FOUND;
         }
 
-        for (auto & elm : *local_set)
-            if (remote_set->count(elm) != 0) {
-                backend_set.insert(elm);
+        for (auto &elm : data->memToBackend[local_descs.getType()])
+            if (!elm->explicitSelectionOnly() && (local_set->count(elm) != 0) &&
+                (remote_set->count(elm) != 0)) {
+                candidates.push_back(elm);
             }
 
-        if (backend_set.empty()) {
+        if (candidates.empty()) {
             NIXL_ERROR_FUNC << "no potential backend found to be able to do the transfer";
             return NIXL_ERR_NOT_FOUND;
         }
     } else {
-        for (auto & elm : extra_params->backends)
-            backend_set.insert(elm->engine);
+        for (auto &elm : extra_params->backends)
+            if (std::find(candidates.begin(), candidates.end(), elm->engine) == candidates.end()) {
+                candidates.push_back(elm->engine);
+            }
     }
 
     // TODO: when central KV is supported, add a call to fetchRemoteMD
@@ -900,18 +1281,109 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
     std::unique_ptr<nixlXferReqH> handle = std::make_unique<nixlXferReqH>(
         remote_agent, operation, local_descs.getType(), remote_descs.getType());
 
-    // Currently we loop through and find first local match. Can use a
-    // preference list or more exhaustive search.
-    for (auto &backend : backend_set) {
+    // The first backend with the required registrations populates the handle directly. Others
+    // that also qualify keep their own descriptors, to be compared against it below.
+    struct viableBackend {
+        nixlBackendEngine *engine;
+        nixl_meta_dlist_t local;
+        nixl_meta_dlist_t remote;
+    };
+    std::vector<viableBackend> others;
+
+    for (auto &backend : candidates) {
+        const bool first = !handle->engine;
+        nixl_meta_dlist_t *local_resp = &handle->initiatorDescs;
+        nixl_meta_dlist_t *remote_resp = &handle->targetDescs;
+        if (!first) {
+            if (others.empty()) {
+                others.reserve(candidates.size() - 1);
+            }
+            others.push_back({backend,
+                              nixl_meta_dlist_t(local_descs.getType()),
+                              nixl_meta_dlist_t(remote_descs.getType())});
+            local_resp = &others.back().local;
+            remote_resp = &others.back().remote;
+        }
+
         // If populate fails, it clears the resp before return
-        ret1 = data->localSection_.populate(local_descs, backend, handle->initiatorDescs);
-        ret2 = rem_sec_it->second.populate(remote_descs, backend, handle->targetDescs);
+        ret1 = data->localSection_.populate(local_descs, backend, *local_resp);
+        ret2 = rem_sec_it->second.populate(remote_descs, backend, *remote_resp);
 
         if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
-            NIXL_INFO << "Selected backend: " << backend->getType();
-            handle->engine = backend;
-            break;
+            if (first) {
+                handle->engine = backend;
+            }
+        } else if (!first) {
+            others.pop_back();
+        }
+    }
+
+    if (handle->engine && !others.empty()) {
+        // Compare on a single source of costs, so every viable backend needs one. Index 0 is
+        // the handle's backend, and ties keep the earlier backend in preference order.
+        const size_t num_viable = others.size() + 1;
+        auto viable_engine = [&](size_t i) { return i ? others[i - 1].engine : handle->engine; };
+        std::vector<const nixlBackendEngine *> engines(num_viable);
+        for (size_t i = 0; i < num_viable; ++i) {
+            engines[i] = viable_engine(i);
+        }
+        std::vector<double> costs(num_viable);
+        // Backends named by the caller are a preference, not a choice left to exploration
+        const bool hinted = extra_params && !extra_params->backends.empty();
+        const auto explored = hinted ? std::nullopt : data->costModel_.explore(engines);
+
+        handle->backendChoice = explored ? nixl_backend_choice_t::EXPLORATION :
+                                           nixl_backend_choice_t::LEARNED_COST;
+        for (size_t i = 0; !explored && (i < num_viable); ++i) {
+            const auto predicted = data->costModel_.predict(viable_engine(i), total_bytes);
+            if (!predicted) {
+                handle->backendChoice = nixl_backend_choice_t::BACKEND_ESTIMATE;
+                break;
+            }
+            costs[i] = *predicted;
+        }
+
+        if (handle->backendChoice == nixl_backend_choice_t::BACKEND_ESTIMATE) {
+            for (size_t i = 0; i < num_viable; ++i) {
+                std::chrono::microseconds duration, err_margin;
+                nixl_cost_t method;
+                // No backend request handle exists yet at this point
+                ret1 = viable_engine(i)->estimateXferCost(
+                    operation,
+                    i ? others[i - 1].local : handle->initiatorDescs,
+                    i ? others[i - 1].remote : handle->targetDescs,
+                    remote_agent,
+                    nullptr,
+                    duration,
+                    err_margin,
+                    method,
+                    extra_params);
+                if (ret1 != NIXL_SUCCESS) {
+                    handle->backendChoice = nixl_backend_choice_t::PREFERENCE_ORDER;
+                    break;
+                }
+                costs[i] = static_cast<double>(duration.count());
+            }
+        }
+
+        size_t chosen = 0;
+        if (explored) {
+            chosen = *explored;
+        } else if (handle->backendChoice != nixl_backend_choice_t::PREFERENCE_ORDER) {
+            chosen = std::min_element(costs.begin(), costs.end()) - costs.begin();
+        }
+
+        if (chosen > 0) {
+            handle->engine = others[chosen - 1].engine;
+            handle->initiatorDescs = others[chosen - 1].local;
+            handle->targetDescs = others[chosen - 1].remote;
         }
+
+        NIXL_INFO << "Selected backend: " << handle->engine->getType() << " out of "
+                  << num_viable << " viable, by "
+                  << nixlEnumStrings::backendChoiceStr(handle->backendChoice);
+    } else if (handle->engine) {
+        NIXL_INFO << "Selected backend: " << handle->engine->getType();
     }
 
     if (!handle->engine) {
@@ -932,6 +1404,10 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
 
         if (extra_params->customParam.length() > 0)
             opt_args.customParam = extra_params->customParam;
+
+        if (extra_params->trafficClass) {
+            opt_args.trafficClass = *extra_params->trafficClass;
+        }
     }
 
     if (opt_args.hasNotif && (!handle->engine->supportsNotif())) {
@@ -943,10 +1419,32 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
 
     handle->notifMsg = opt_args.notifMsg;
     handle->hasNotif = opt_args.hasNotif;
+    handle->trafficClass = opt_args.trafficClass;
+    if (extra_params) {
+        handle->deadline = extra_params->deadline;
+    }
 
-    if (data->telemetryEnabled) {
-        handle->telemetry.totalBytes = total_bytes;
-        handle->telemetry.descCount = handle->initiatorDescs.descCount();
+    // Transfers between DRAM buffers of this agent skip the backend's loopback
+    if (data->localCopy_ && (remote_agent == data->name_) &&
+        (local_descs.getType() == DRAM_SEG) && (remote_descs.getType() == DRAM_SEG)) {
+        handle->selectedBackend = handle->engine;
+        handle->engine = data->localCopy_.get();
+    }
+
+    // The cost model also needs the size of requests without telemetry
+    handle->telemetry.totalBytes = total_bytes;
+    handle->telemetry.descCount = handle->initiatorDescs.descCount();
+
+    uint64_t trace_prep = 0;
+    if (data->tracer_) {
+        handle->traceId = data->tracer_->nextReqId();
+        trace_prep = nixlTracer::now();
+        data->tracer_->record(nixl_trace_stage_t::POPULATE,
+                              handle->traceId,
+                              trace_start,
+                              trace_prep,
+                              handle->initiatorDescs.descCount(),
+                              handle->engine->getType());
     }
 
     ret1 = handle->engine->prepXfer(handle->backendOp,
@@ -962,67 +1460,418 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
         return ret1;
     }
 
+    if (data->tracer_) {
+        const uint64_t trace_end = nixlTracer::now();
+        data->tracer_->record(nixl_trace_stage_t::BACKEND_PREP,
+                              handle->traceId,
+                              trace_prep,
+                              trace_end,
+                              0,
+                              handle->engine->getType());
+        data->tracer_->record(nixl_trace_stage_t::CREATE,
+                              handle->traceId,
+                              trace_start,
+                              trace_end,
+                              total_bytes,
+                              handle->engine->getType());
+    }
+
     req_hndl = handle.release();
     return NIXL_SUCCESS;
 }
 
 nixl_status_t
-nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
-                            std::chrono::microseconds &duration,
-                            std::chrono::microseconds &err_margin,
-                            nixl_cost_t &method,
-                            const nixl_opt_args_t* extra_params) const
-{
-    nixl_status_t ret;
-    NIXL_SHARED_LOCK_GUARD(data->lock);
+nixlAgent::createStagedXferReq(const nixl_xfer_op_t &operation,
+                               const nixl_xfer_dlist_t &local_descs,
+                               const nixl_xfer_dlist_t &remote_descs,
+                               const std::string &remote_agent,
+                               nixlXferReqH *&req_hndl,
+                               const nixl_opt_args_t &extra_params) const {
+    nixlStagingPoolH *pool = extra_params.stagingPool;
+    const size_t buffer_size = pool->getBufferSize();
+
+    if (local_descs.getType() != DRAM_SEG) {
+        NIXL_ERROR_FUNC << "only local DRAM can be staged, got memory type "
+                        << nixlEnumStrings::memTypeStr(local_descs.getType());
+        return NIXL_ERR_INVALID_PARAM;
+    }
 
-    // Check if the remote agent connection info is still valid
-    // (assuming cost estimation requires connection info like transfers)
-    if (!req_hndl->remoteAgent.empty() &&
-        (data->remoteSections_.count(req_hndl->remoteAgent) == 0)) {
-        NIXL_ERROR_FUNC << "invalid request handle, remote agent was invalidated "
-                           "after transfer request creation";
-        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
-        return NIXL_ERR_NOT_FOUND;
+    if (local_descs.descCount() != remote_descs.descCount()) {
+        NIXL_ERROR_FUNC << "different descriptor list sizes (local=" << local_descs.descCount()
+                        << ", remote=" << remote_descs.descCount() << ")";
+        return NIXL_ERR_INVALID_PARAM;
     }
 
-    if (!req_hndl->engine) {
-        NIXL_ERROR_FUNC << "invalid request handle: engine is null";
-        data->addErrorTelemetry(NIXL_ERR_UNKNOWN);
-        return NIXL_ERR_UNKNOWN;
+    // Descriptors are packed back to back into the staging buffers, and split where they
+    // cross the end of a buffer. The remote descriptors are split at the same offsets.
+    nixl_xfer_dlist_t staged_local(DRAM_SEG);
+    nixl_xfer_dlist_t staged_remote(remote_descs.getType());
+    std::vector<char *> buffers;
+    std::vector<nixlXferReqH::stagedCopy> copies;
+    char *buffer = nullptr;
+    size_t buffer_offset = buffer_size;
+
+    const auto release_buffers = [&]() {
+        for (char *held : buffers) {
+            pool->free(held);
+        }
+    };
+
+    for (int i = 0; i < local_descs.descCount(); ++i) {
+        const nixlBasicDesc &local = local_descs[i];
+        const nixlBasicDesc &remote = remote_descs[i];
+        if (local.len != remote.len) {
+            NIXL_ERROR_FUNC << "length mismatch at index " << i;
+            release_buffers();
+            return NIXL_ERR_INVALID_PARAM;
+        }
+
+        for (size_t offset = 0; offset < local.len;) {
+            if (buffer_offset == buffer_size) {
+                buffer = pool->alloc();
+                if (!buffer) {
+                    NIXL_ERROR_FUNC << "staging pool has no free buffer left, "
+                                    << pool->getNumBuffers() << " buffers are in use";
+                    release_buffers();
+                    return NIXL_ERR_NOT_FOUND;
+                }
+                buffers.push_back(buffer);
+                buffer_offset = 0;
+            }
+
+            const size_t len = std::min(local.len - offset, buffer_size - buffer_offset);
+            char *staging = buffer + buffer_offset;
+            copies.push_back({reinterpret_cast<char *>(local.addr + offset), staging, len});
+            staged_local.addDesc(nixlBasicDesc(reinterpret_cast<uintptr_t>(staging), len, 0));
+            staged_remote.addDesc(nixlBasicDesc(remote.addr + offset, len, remote.devId));
+            offset += len;
+            buffer_offset += len;
+        }
     }
 
-    ret = req_hndl->engine->estimateXferCost(req_hndl->backendOp,
-                                             req_hndl->initiatorDescs,
-                                             req_hndl->targetDescs,
-                                             req_hndl->remoteAgent,
-                                             req_hndl->backendHandle,
-                                             duration,
-                                             err_margin,
-                                             method,
-                                             extra_params);
+    nixl_opt_args_t staged_params = extra_params;
+    staged_params.stagingPool = nullptr;
+    const nixl_status_t ret = createXferReq(
+        operation, staged_local, staged_remote, remote_agent, req_hndl, &staged_params);
     if (ret != NIXL_SUCCESS) {
-        NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
-                        << "' failed to estimate the transfer cost with status " << ret;
+        release_buffers();
+        return ret;
     }
-    return ret;
+
+    req_hndl->stagingPool = pool;
+    req_hndl->stagingBuffers = std::move(buffers);
+    req_hndl->stagedCopies = std::move(copies);
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t
-nixlAgent::postXferReq(nixlXferReqH *req_hndl,
-                       const nixl_opt_args_t* extra_params) const {
-    nixl_opt_b_args_t opt_args;
+nixlAgent::compileXferPlan(const nixl_xfer_op_t &operation,
+                           const nixl_xfer_dlist_t &local_descs,
+                           const nixl_xfer_dlist_t &remote_descs,
+                           const std::string &remote_agent,
+                           nixlXferPlanH *&plan,
+                           const nixl_opt_args_t *extra_params) const {
+    plan = nullptr;
+
+    if (extra_params && extra_params->stagingPool) {
+        NIXL_ERROR_FUNC << "staged transfers cannot be compiled into a plan";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (local_descs.descCount() == 0) {
+        NIXL_ERROR_FUNC << "cannot compile a transfer plan without descriptors";
+        return NIXL_ERR_INVALID_PARAM;
+    }
 
-    opt_args.hasNotif = false;
+    // The backend is selected by createXferReq, its request is only kept for the result
+    nixlXferReqH *req = nullptr;
+    nixl_status_t ret =
+        createXferReq(operation, local_descs, remote_descs, remote_agent, req, extra_params);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+    std::unique_ptr<nixlXferReqH> selected(req);
 
-    if (!req_hndl) {
-        NIXL_ERROR_FUNC << "transfer request handle is null";
+    auto new_plan = std::make_unique<nixlXferPlanH>(
+        remote_agent, operation, local_descs.getType(), remote_descs.getType());
+    new_plan->engine = selected->engine;
+    new_plan->selectedBackend = selected->selectedBackend;
+    new_plan->backendChoice = selected->backendChoice;
+    new_plan->optArgs.notifMsg = selected->notifMsg;
+    new_plan->optArgs.hasNotif = selected->hasNotif;
+    new_plan->optArgs.trafficClass = selected->trafficClass;
+    if (extra_params) {
+        new_plan->optArgs.customParam = extra_params->customParam;
+        new_plan->skipDescMerge = extra_params->skipDescMerge;
+    }
+
+    // Resolve again with the registered regions, from the backend holding the registrations
+    nixlBackendEngine *reg_backend =
+        selected->selectedBackend ? selected->selectedBackend : selected->engine;
+    nixl_meta_dlist_t local_meta(local_descs.getType());
+    nixl_meta_dlist_t remote_meta(remote_descs.getType());
+    std::vector<nixlBasicDesc> local_regions, remote_regions;
+    {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        const auto rem_sec_it = data->remoteSections_.find(remote_agent);
+        if ((rem_sec_it == data->remoteSections_.end()) ||
+            (data->localSection_.populate(local_descs, reg_backend, local_meta, &local_regions) !=
+             NIXL_SUCCESS) ||
+            (rem_sec_it->second.populate(
+                 remote_descs, reg_backend, remote_meta, &remote_regions) != NIXL_SUCCESS)) {
+            NIXL_ERROR_FUNC << "registrations or remote metadata changed during compilation";
+            return NIXL_ERR_NOT_FOUND;
+        }
+    }
+
+    std::vector<nixlBasicDesc> plan_local_regions, plan_remote_regions;
+    for (int i = 0; i < local_meta.descCount(); ++i) {
+        new_plan->totalBytes += local_meta[i].len;
+        const int last = new_plan->initiatorDescs.descCount() - 1;
+        if ((last >= 0) && !new_plan->skipDescMerge &&
+            (plan_local_regions[last] == local_regions[i]) &&
+            (plan_remote_regions[last] == remote_regions[i]) &&
+            continuesPair(new_plan->initiatorDescs[last],
+                          new_plan->targetDescs[last],
+                          local_meta[i],
+                          remote_meta[i])) {
+            new_plan->initiatorDescs[last].len += local_meta[i].len;
+            new_plan->targetDescs[last].len += remote_meta[i].len;
+            continue;
+        }
+        new_plan->initiatorDescs.addDesc(local_meta[i]);
+        new_plan->targetDescs.addDesc(remote_meta[i]);
+        plan_local_regions.push_back(local_regions[i]);
+        plan_remote_regions.push_back(remote_regions[i]);
+    }
+
+    for (int i = 0; i < new_plan->initiatorDescs.descCount(); ++i) {
+        const nixlMetaDesc &local = new_plan->initiatorDescs[i];
+        const nixlMetaDesc &remote = new_plan->targetDescs[i];
+        const nixlBasicDesc &local_region = plan_local_regions[i];
+        const nixlBasicDesc &remote_region = plan_remote_regions[i];
+        new_plan->minLocalOffset = std::max(new_plan->minLocalOffset,
+                                            -static_cast<int64_t>(local.addr - local_region.addr));
+        new_plan->maxLocalOffset =
+            std::min(new_plan->maxLocalOffset,
+                     static_cast<int64_t>((local_region.addr + local_region.len) -
+                                          (local.addr + local.len)));
+        new_plan->minRemoteOffset = std::max(
+            new_plan->minRemoteOffset, -static_cast<int64_t>(remote.addr - remote_region.addr));
+        new_plan->maxRemoteOffset =
+            std::min(new_plan->maxRemoteOffset,
+                     static_cast<int64_t>((remote_region.addr + remote_region.len) -
+                                          (remote.addr + remote.len)));
+    }
+
+    // The prepared handle of the selection request serves the first request of the plan
+    if (selected->backendHandle && selected->engine->supportsPrepReuse() &&
+        new_plan->keepHandle(selected->initiatorDescs.descCount(), selected->backendHandle)) {
+        selected->backendHandle = nullptr;
+    }
+
+    NIXL_DEBUG << "Compiled a transfer plan of " << new_plan->initiatorDescs.descCount()
+               << " descriptors on backend " << new_plan->engine->getType();
+    plan = new_plan.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::makeXferReq(nixlXferPlanH *plan,
+                       const std::vector<int64_t> &local_offsets,
+                       const std::vector<int64_t> &remote_offsets,
+                       nixlXferReqH *&req_hndl) const {
+    req_hndl = nullptr;
+    const uint64_t trace_start = data->tracer_ ? nixlTracer::now() : 0;
+
+    if (!plan) {
+        NIXL_ERROR_FUNC << "transfer plan handle is null";
         data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    if (data->telemetryEnabled) {
-        req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
+    if (local_offsets.empty() || (local_offsets.size() != remote_offsets.size())) {
+        NIXL_ERROR_FUNC << "different number of offsets for local (" << local_offsets.size()
+                        << "), remote (" << remote_offsets.size() << ")";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (data->remoteSections_.count(plan->remoteAgent) == 0) {
+        NIXL_ERROR_FUNC << "remote agent '" << plan->remoteAgent
+                        << "' was invalidated after transfer plan compilation";
+        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    const int plan_count = plan->initiatorDescs.descCount();
+    const size_t num_copies = local_offsets.size();
+    for (size_t k = 0; k < num_copies; ++k) {
+        if ((local_offsets[k] < plan->minLocalOffset) ||
+            (local_offsets[k] > plan->maxLocalOffset) ||
+            (remote_offsets[k] < plan->minRemoteOffset) ||
+            (remote_offsets[k] > plan->maxRemoteOffset)) {
+            NIXL_ERROR_FUNC << "offset index " << k << " shifts descriptors out of their "
+                            << "registered regions";
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    auto handle = std::make_unique<nixlXferReqH>(plan->remoteAgent,
+                                                 plan->backendOp,
+                                                 plan->initiatorDescs.getType(),
+                                                 plan->targetDescs.getType(),
+                                                 plan_count * num_copies);
+
+    int j = 0; // final list size
+    nixlMetaDesc local_desc1 = plan->initiatorDescs[0];
+    nixlMetaDesc remote_desc1 = plan->targetDescs[0];
+    local_desc1.addr += local_offsets[0];
+    remote_desc1.addr += remote_offsets[0];
+    for (size_t k = 0; k < num_copies; ++k) {
+        for (int i = (k == 0) ? 1 : 0; i < plan_count; ++i) {
+            nixlMetaDesc local_desc2 = plan->initiatorDescs[i];
+            nixlMetaDesc remote_desc2 = plan->targetDescs[i];
+            local_desc2.addr += local_offsets[k];
+            remote_desc2.addr += remote_offsets[k];
+
+            if (!plan->skipDescMerge &&
+                continuesPair(local_desc1, remote_desc1, local_desc2, remote_desc2)) {
+                local_desc1.len += local_desc2.len;
+                remote_desc1.len += remote_desc2.len;
+                continue;
+            }
+
+            handle->initiatorDescs[j] = local_desc1;
+            handle->targetDescs[j] = remote_desc1;
+            j++;
+            local_desc1 = local_desc2;
+            remote_desc1 = remote_desc2;
+        }
+    }
+    handle->initiatorDescs[j] = local_desc1;
+    handle->targetDescs[j] = remote_desc1;
+    j++;
+    handle->initiatorDescs.resize(j);
+    handle->targetDescs.resize(j);
+
+    handle->engine = plan->engine;
+    handle->selectedBackend = plan->selectedBackend;
+    handle->backendChoice = plan->backendChoice;
+    handle->notifMsg = plan->optArgs.notifMsg;
+    handle->hasNotif = plan->optArgs.hasNotif;
+    handle->trafficClass = plan->optArgs.trafficClass;
+
+    // The cost model also needs the size of requests without telemetry
+    handle->telemetry.totalBytes = plan->totalBytes * num_copies;
+    handle->telemetry.descCount = j;
+
+    uint64_t trace_prep = 0;
+    if (data->tracer_) {
+        handle->traceId = data->tracer_->nextReqId();
+        trace_prep = nixlTracer::now();
+        data->tracer_->record(nixl_trace_stage_t::POPULATE,
+                              handle->traceId,
+                              trace_start,
+                              trace_prep,
+                              j,
+                              handle->engine->getType());
+    }
+
+    if (handle->engine->supportsPrepReuse()) {
+        handle->backendHandle = plan->takeHandle(j);
+    }
+
+    if (!handle->backendHandle) {
+        const nixl_status_t ret = handle->engine->prepXfer(handle->backendOp,
+                                                           handle->initiatorDescs,
+                                                           handle->targetDescs,
+                                                           handle->remoteAgent,
+                                                           handle->backendHandle,
+                                                           &plan->optArgs);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "backend '" << handle->engine->getType()
+                            << "' failed to prepare the transfer request with status " << ret;
+            data->addErrorTelemetry(ret);
+            return ret;
+        }
+    }
+
+    if (data->tracer_) {
+        const uint64_t trace_end = nixlTracer::now();
+        data->tracer_->record(nixl_trace_stage_t::BACKEND_PREP,
+                              handle->traceId,
+                              trace_prep,
+                              trace_end,
+                              0,
+                              handle->engine->getType());
+        data->tracer_->record(nixl_trace_stage_t::CREATE,
+                              handle->traceId,
+                              trace_start,
+                              trace_end,
+                              plan->totalBytes * num_copies,
+                              handle->engine->getType());
+    }
+
+    handle->plan = plan;
+    plan->numReqs++;
+    req_hndl = handle.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
+                            std::chrono::microseconds &duration,
+                            std::chrono::microseconds &err_margin,
+                            nixl_cost_t &method,
+                            const nixl_opt_args_t* extra_params) const
+{
+    nixl_status_t ret;
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    // Check if the remote agent connection info is still valid
+    // (assuming cost estimation requires connection info like transfers)
+    if (!req_hndl->remoteAgent.empty() &&
+        (data->remoteSections_.count(req_hndl->remoteAgent) == 0)) {
+        NIXL_ERROR_FUNC << "invalid request handle, remote agent was invalidated "
+                           "after transfer request creation";
+        data->addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    if (!req_hndl->engine) {
+        NIXL_ERROR_FUNC << "invalid request handle: engine is null";
+        data->addErrorTelemetry(NIXL_ERR_UNKNOWN);
+        return NIXL_ERR_UNKNOWN;
+    }
+
+    ret = req_hndl->engine->estimateXferCost(req_hndl->backendOp,
+                                             req_hndl->initiatorDescs,
+                                             req_hndl->targetDescs,
+                                             req_hndl->remoteAgent,
+                                             req_hndl->backendHandle,
+                                             duration,
+                                             err_margin,
+                                             method,
+                                             extra_params);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                        << "' failed to estimate the transfer cost with status " << ret;
+    }
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::postXferReq(nixlXferReqH *req_hndl,
+                       const nixl_opt_args_t* extra_params) const {
+    if (!req_hndl) {
+        NIXL_ERROR_FUNC << "transfer request handle is null";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (data->telemetryEnabled) {
+        req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
     }
 
     NIXL_SHARED_LOCK_GUARD(data->lock);
@@ -1034,6 +1883,12 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         return NIXL_ERR_NOT_FOUND;
     }
 
+    // A request held back by its rate limit is not posted yet, but still active
+    if (data->scheduler_ && data->scheduler_->isQueued(req_hndl)) {
+        NIXL_ERROR_FUNC << "transfer request is still queued and cannot be reposted";
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
     // We can't repost while a request is in progress
     if (req_hndl->status == NIXL_IN_PROG) {
         req_hndl->status = req_hndl->engine->checkXfer(
@@ -1051,37 +1906,100 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         }
     }
 
-    // Carrying over notification from xfer handle creation time
-    if (req_hndl->hasNotif) {
-        opt_args.notifMsg = req_hndl->notifMsg;
-        opt_args.hasNotif = true;
+    // A deadline applies to one post, the one given at creation only to the first post
+    if (extra_params && extra_params->deadline) {
+        req_hndl->deadline = extra_params->deadline;
+    } else if (req_hndl->status != NIXL_ERR_NOT_POSTED) {
+        req_hndl->deadline.reset();
     }
 
-    // Updating the notification based on opt_args
+    // A stale request is shed without being posted
+    if (req_hndl->deadline && (std::chrono::steady_clock::now() >= *req_hndl->deadline)) {
+        NIXL_DEBUG << "transfer request is canceled, its deadline passed before the post";
+        req_hndl->status = NIXL_ERR_CANCELED;
+        data->addErrorTelemetry(NIXL_ERR_CANCELED);
+        return NIXL_ERR_CANCELED;
+    }
+    req_hndl->cancelRequested = false;
+
+    // Updating the notification based on opt_args, otherwise the one given at creation is kept
     if (extra_params) {
         if (extra_params->notif) {
             req_hndl->notifMsg = *extra_params->notif;
-            opt_args.notifMsg = *extra_params->notif;
             req_hndl->hasNotif = true;
-            opt_args.hasNotif = true;
         } else if (extra_params->hasNotif) {
             req_hndl->notifMsg = extra_params->notifMsg;
-            opt_args.notifMsg = extra_params->notifMsg;
             req_hndl->hasNotif = true;
-            opt_args.hasNotif = true;
         } else {
             req_hndl->hasNotif = false;
-            opt_args.hasNotif = false;
+        }
+
+        if (extra_params->trafficClass) {
+            req_hndl->trafficClass = *extra_params->trafficClass;
         }
     }
 
-    if (opt_args.hasNotif && (!req_hndl->engine->supportsNotif())) {
+    if (req_hndl->hasNotif && (!req_hndl->engine->supportsNotif())) {
         NIXL_ERROR_FUNC << "the selected backend '" << req_hndl->engine->getType()
                         << "' does not support notifications";
         data->addErrorTelemetry(NIXL_ERR_BACKEND);
         return NIXL_ERR_BACKEND;
     }
 
+    if (!data->scheduler_) {
+        return data->postXfer(req_hndl);
+    }
+
+    // Held back requests are posted by later calls, and reported in progress until then
+    req_hndl->status = NIXL_IN_PROG;
+    if (!data->scheduler_->submit(req_hndl,
+                                  [this](nixlXferReqH *req) { data->postXfer(req); })) {
+        NIXL_DEBUG << "transfer request to '" << req_hndl->remoteAgent << "' through backend '"
+                   << req_hndl->engine->getType() << "' of traffic class "
+                   << nixlEnumStrings::trafficClassStr(req_hndl->trafficClass)
+                   << " is queued by its rate limits";
+        return NIXL_IN_PROG;
+    }
+    return req_hndl->status;
+}
+
+// Posts a request to its backend, requests queued by the scheduler are posted from here too
+nixl_status_t
+nixlAgentData::postXfer(nixlXferReqH *req_hndl) {
+    // The remote may have been invalidated while the scheduler held the request back, its
+    // target metadata is released then
+    if (remoteSections_.count(req_hndl->remoteAgent) == 0) {
+        NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
+                        << "' was invalidated before the transfer request was posted";
+        req_hndl->status = NIXL_ERR_NOT_FOUND;
+        addErrorTelemetry(NIXL_ERR_NOT_FOUND);
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    // A request queued past its deadline is shed without being posted
+    if (req_hndl->deadline && (std::chrono::steady_clock::now() >= *req_hndl->deadline)) {
+        NIXL_DEBUG << "transfer request is canceled, its deadline passed before the post";
+        req_hndl->status = NIXL_ERR_CANCELED;
+        addErrorTelemetry(NIXL_ERR_CANCELED);
+        return NIXL_ERR_CANCELED;
+    }
+
+    nixl_opt_b_args_t opt_args;
+    opt_args.notifMsg = req_hndl->notifMsg;
+    opt_args.hasNotif = req_hndl->hasNotif;
+    opt_args.trafficClass = req_hndl->trafficClass;
+
+    const uint64_t trace_post = tracer_ ? nixlTracer::now() : 0;
+
+    if (req_hndl->backendOp == NIXL_WRITE) {
+        req_hndl->stageIn();
+    }
+
+    // Measured from here so that time spent queued by the scheduler is not a cost
+    if (req_hndl->backendChoice != nixl_backend_choice_t::SINGLE_CANDIDATE) {
+        req_hndl->costPostTime = std::chrono::steady_clock::now();
+    }
+
     // If status is not NIXL_IN_PROG we can repost,
     req_hndl->status = req_hndl->engine->postXfer(req_hndl->backendOp,
                                                   req_hndl->initiatorDescs,
@@ -1090,11 +2008,31 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
                                                   req_hndl->backendHandle,
                                                   &opt_args);
 
+    if (req_hndl->status == NIXL_SUCCESS && req_hndl->backendOp == NIXL_READ) {
+        req_hndl->stageOut();
+    }
+
+    if (tracer_) {
+        const uint64_t trace_end = nixlTracer::now();
+        const nixl_backend_t &backend_type = req_hndl->engine->getType();
+        req_hndl->tracePostNs = trace_post;
+        req_hndl->traceProgressed = false;
+        tracer_->record(nixl_trace_stage_t::POST,
+                        req_hndl->traceId,
+                        trace_post,
+                        trace_end,
+                        req_hndl->initiatorDescs.descCount(),
+                        backend_type);
+        if (req_hndl->status != NIXL_IN_PROG) {
+            traceCompletion(req_hndl, trace_post, trace_end);
+        }
+    }
+
     if (req_hndl->status < 0) {
         if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
             NIXL_ERROR_FUNC << "remote agent '" << req_hndl->remoteAgent
                             << "' was disconnected after transfer request creation";
-            data->invalidateRemoteData(req_hndl->remoteAgent);
+            invalidateRemoteData(req_hndl->remoteAgent);
             return NIXL_ERR_REMOTE_DISCONNECT;
         } else {
             NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
@@ -1103,25 +2041,142 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         }
     }
 
-    if (data->telemetryEnabled) {
+    if (telemetryEnabled) {
         NIXL_DEBUG << req_hndl->initiatorDescs.to_string(true);
 
         if (req_hndl->status < 0) {
-            data->addErrorTelemetry(req_hndl->status);
+            addErrorTelemetry(req_hndl->status);
         } else if (req_hndl->status == NIXL_IN_PROG) {
-            req_hndl->updateRequestStats(data->telemetry_.get(), NIXL_TELEMETRY_POST);
+            req_hndl->updateRequestStats(telemetry_.get(), NIXL_TELEMETRY_POST);
         } else {
-            req_hndl->updateRequestStats(data->telemetry_.get(), NIXL_TELEMETRY_POST_AND_FINISH);
+            req_hndl->updateRequestStats(telemetry_.get(), NIXL_TELEMETRY_POST_AND_FINISH);
         }
     }
 
+    if (req_hndl->status == NIXL_SUCCESS) {
+        recordXferCost(req_hndl);
+    }
+
     return req_hndl->status;
 }
 
+// Asks the backend to abort the current post of a request in progress
+nixl_status_t
+nixlAgentData::cancelXfer(nixlXferReqH *req_hndl) {
+    const nixl_status_t ret = req_hndl->engine->cancelXfer(req_hndl->backendHandle);
+    if (ret == NIXL_ERR_NOT_SUPPORTED) {
+        NIXL_WARN << "backend '" << req_hndl->engine->getType()
+                  << "' cannot cancel transfers, the transfer continues";
+    }
+    return ret;
+}
+
+void
+nixlAgentData::traceCompletion(const nixlXferReqH *req_hndl, uint64_t post_ns, uint64_t end_ns) {
+    const nixl_backend_t &backend_type = req_hndl->engine->getType();
+    tracer_->record(nixl_trace_stage_t::COMPLETION,
+                    req_hndl->traceId,
+                    post_ns,
+                    end_ns,
+                    req_hndl->status,
+                    backend_type);
+
+    // The backend hands the notification over with the data, so it is delivered by now
+    if (req_hndl->status == NIXL_SUCCESS && req_hndl->hasNotif) {
+        tracer_->record(nixl_trace_stage_t::NOTIF_DELIVERY,
+                        req_hndl->traceId,
+                        end_ns,
+                        end_ns,
+                        req_hndl->notifMsg.size(),
+                        backend_type);
+    }
+}
+
+// Records the status of a request in progress returned by its backend
+nixl_status_t
+nixlAgentData::completeXferCheck(nixlXferReqH *req_hndl, nixl_status_t status) {
+    req_hndl->status = status;
+
+    if (req_hndl->status == NIXL_SUCCESS && req_hndl->backendOp == NIXL_READ) {
+        req_hndl->stageOut();
+    }
+
+    if (tracer_) {
+        const uint64_t trace_now = nixlTracer::now();
+        const nixl_backend_t &backend_type = req_hndl->engine->getType();
+        if (!req_hndl->traceProgressed) {
+            req_hndl->traceProgressed = true;
+            tracer_->record(nixl_trace_stage_t::FIRST_PROGRESS,
+                            req_hndl->traceId,
+                            trace_now,
+                            trace_now,
+                            req_hndl->status,
+                            backend_type);
+        }
+        if (req_hndl->status != NIXL_IN_PROG) {
+            traceCompletion(req_hndl, req_hndl->tracePostNs, trace_now);
+        }
+    }
+
+    if (req_hndl->status < 0) {
+        if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
+            invalidateRemoteData(req_hndl->remoteAgent);
+            return NIXL_ERR_REMOTE_DISCONNECT;
+        } else if (req_hndl->status == NIXL_ERR_CANCELED) {
+            NIXL_DEBUG << "transfer request was canceled";
+        } else {
+            NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
+                            << "' returned error status " << req_hndl->status;
+        }
+    }
+    if (telemetryEnabled) {
+        if (req_hndl->status == NIXL_SUCCESS) {
+            req_hndl->updateRequestStats(telemetry_.get(), NIXL_TELEMETRY_FINISH);
+        } else if (req_hndl->status < 0) {
+            addErrorTelemetry(req_hndl->status);
+        }
+    }
+
+    if (req_hndl->status == NIXL_SUCCESS) {
+        recordXferCost(req_hndl);
+    }
+    return req_hndl->status;
+}
+
+// Feeds the duration of a completed request to the cost model, if its backend was chosen among
+// several. Transfers done by the local copy engine say nothing about the selected backend.
+void
+nixlAgentData::recordXferCost(const nixlXferReqH *req_hndl) {
+    if ((req_hndl->backendChoice == nixl_backend_choice_t::SINGLE_CANDIDATE) ||
+        req_hndl->selectedBackend) {
+        return;
+    }
+
+    costModel_.record(req_hndl->engine,
+                      req_hndl->telemetry.totalBytes,
+                      std::chrono::duration_cast<chrono_period_us_t>(
+                          std::chrono::steady_clock::now() - req_hndl->costPostTime));
+}
+
 nixl_status_t
 nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
 
     NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Requests held back by their rate limits are posted as the limits get tokens
+    if (data->scheduler_ &&
+        data->scheduler_->progress(req_hndl,
+                                   [this](nixlXferReqH *req) { data->postXfer(req); })) {
+        if (!req_hndl->deadline || (std::chrono::steady_clock::now() < *req_hndl->deadline)) {
+            return NIXL_IN_PROG;
+        }
+        if (data->scheduler_->remove(req_hndl)) {
+            NIXL_DEBUG << "queued transfer request is canceled, its deadline passed";
+            req_hndl->status = NIXL_ERR_CANCELED;
+            data->addErrorTelemetry(NIXL_ERR_CANCELED);
+            return NIXL_ERR_CANCELED;
+        }
+    }
+
     // If the status is done, no need to recheck and no state changes.
     // Same for users incorrectly recalling this method in error/done.
     if (req_hndl->status == NIXL_IN_PROG) {
@@ -1132,29 +2187,56 @@ nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
             return NIXL_ERR_NOT_FOUND;
         }
 
-        req_hndl->status = req_hndl->engine->checkXfer(req_hndl->backendHandle);
-        if (req_hndl->status < 0) {
-            if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
-                data->invalidateRemoteData(req_hndl->remoteAgent);
-                return NIXL_ERR_REMOTE_DISCONNECT;
-            } else {
-                NIXL_ERROR_FUNC << "backend '" << req_hndl->engine->getType()
-                                << "' returned error status " << req_hndl->status;
-            }
-        }
-        if (data->telemetryEnabled) {
-            if (req_hndl->status == NIXL_SUCCESS) {
-                req_hndl->updateRequestStats(data->telemetry_.get(), NIXL_TELEMETRY_FINISH);
-            } else if (req_hndl->status < 0) {
-                data->addErrorTelemetry(req_hndl->status);
+        nixl_status_t status = req_hndl->engine->checkXfer(req_hndl->backendHandle);
+        if ((status == NIXL_IN_PROG) && req_hndl->deadline && !req_hndl->cancelRequested &&
+            (std::chrono::steady_clock::now() >= *req_hndl->deadline)) {
+            NIXL_DEBUG << "transfer request is canceled, its deadline passed";
+            req_hndl->cancelRequested = true;
+            status = data->cancelXfer(req_hndl);
+            if (status == NIXL_ERR_NOT_SUPPORTED) {
+                status = NIXL_IN_PROG;
             }
         }
+        return data->completeXferCheck(req_hndl, status);
     }
 
     // If the status is error when entering this method, it was already logged
     return req_hndl->status;
 }
 
+nixl_status_t
+nixlAgent::cancelXferReq(nixlXferReqH *req_hndl) const {
+    if (!req_hndl) {
+        NIXL_ERROR_FUNC << "transfer request handle is null";
+        data->addErrorTelemetry(NIXL_ERR_INVALID_PARAM);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (data->scheduler_ && data->scheduler_->remove(req_hndl)) {
+        NIXL_DEBUG << "queued transfer request is canceled before its post";
+        req_hndl->status = NIXL_ERR_CANCELED;
+        return NIXL_ERR_CANCELED;
+    }
+
+    if (req_hndl->status != NIXL_IN_PROG) {
+        return req_hndl->status;
+    }
+
+    // An abort already running in the background is only polled
+    if (req_hndl->cancelRequested) {
+        return data->completeXferCheck(req_hndl,
+                                       req_hndl->engine->checkXfer(req_hndl->backendHandle));
+    }
+
+    const nixl_status_t status = data->cancelXfer(req_hndl);
+    if (status == NIXL_ERR_NOT_SUPPORTED) {
+        return status;
+    }
+    req_hndl->cancelRequested = true;
+    return data->completeXferCheck(req_hndl, status);
+}
+
 nixl_status_t
 nixlAgent::getXferTelemetry(const nixlXferReqH *req_hndl, nixl_xfer_telem_t &telemetry) const {
 
@@ -1176,14 +2258,29 @@ nixl_status_t
 nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
                             nixlBackendH* &backend) const {
     NIXL_LOCK_GUARD(data->lock);
-    backend = data->backendHandles_[req_hndl->engine->getType()].get();
+    const nixlBackendEngine *engine =
+        req_hndl->selectedBackend ? req_hndl->selectedBackend : req_hndl->engine;
+    backend = data->backendHandles_[engine->getType()].get();
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::queryXferBackend(const nixlXferReqH *req_hndl,
+                            nixlBackendH *&backend,
+                            nixl_backend_choice_t &choice) const {
+    const nixl_status_t ret = queryXferBackend(req_hndl, backend);
+    choice = req_hndl->backendChoice;
+    return ret;
+}
+
 nixl_status_t
 nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) const {
 
     NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (data->scheduler_ && data->scheduler_->remove(req_hndl)) {
+        req_hndl->status = NIXL_ERR_NOT_POSTED;
+    }
+
     //attempt to cancel request
     if(req_hndl->status == NIXL_IN_PROG) {
         req_hndl->status = req_hndl->engine->checkXfer(
@@ -1205,6 +2302,19 @@ nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) const {
             req_hndl->backendHandle = nullptr;
         }
     }
+
+    // Prepared handles of completed or unposted requests go back to their plan
+    if (req_hndl->plan) {
+        nixlXferPlanH *plan = req_hndl->plan;
+        if (req_hndl->backendHandle &&
+            ((req_hndl->status == NIXL_SUCCESS) || (req_hndl->status == NIXL_ERR_NOT_POSTED)) &&
+            req_hndl->engine->supportsPrepReuse() &&
+            plan->keepHandle(req_hndl->initiatorDescs.descCount(), req_hndl->backendHandle)) {
+            req_hndl->backendHandle = nullptr;
+        }
+        plan->numReqs--;
+    }
+
     delete req_hndl;
     return NIXL_SUCCESS;
 }
@@ -1217,15 +2327,101 @@ nixlAgent::releasedDlistH (nixlDlistH* dlist_hndl) const {
 }
 
 nixl_status_t
-nixlAgent::getNotifs(nixl_notifs_t &notif_map,
-                     const nixl_opt_args_t* extra_params) {
+nixlAgent::releaseXferPlan(nixlXferPlanH *plan) const {
+    if (!plan) {
+        NIXL_ERROR_FUNC << "transfer plan handle is null";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // makeXferReq counts requests under the shared lock, so none can be made during the check
+    NIXL_LOCK_GUARD(data->lock);
+    if (plan->numReqs.load() != 0) {
+        NIXL_ERROR_FUNC << plan->numReqs.load() << " requests made from the plan are not released";
+        return NIXL_ERR_NOT_ALLOWED;
+    }
+
+    delete plan;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::createStagingPool(size_t pool_size,
+                             size_t buffer_size,
+                             nixlStagingPoolH *&pool,
+                             const nixl_opt_args_t *extra_params) {
+    pool = nullptr;
+
+    std::unique_ptr<nixlStagingPoolH> new_pool;
+    try {
+        new_pool = std::make_unique<nixlStagingPoolH>(pool_size, buffer_size);
+    }
+    catch (const std::invalid_argument &e) {
+        NIXL_ERROR_FUNC << e.what();
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR_FUNC << e.what();
+        return NIXL_ERR_UNKNOWN;
+    }
+
+    if (extra_params) {
+        new_pool->regArgs.backends = extra_params->backends;
+    }
+
+    const nixl_status_t ret = registerMem(new_pool->getRegDescs(), &new_pool->regArgs);
+    if (ret != NIXL_SUCCESS) {
+        NIXL_ERROR_FUNC << "failed to register the staging pool with status " << ret;
+        return ret;
+    }
+
+    pool = new_pool.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getStagingBuffer(nixlStagingPoolH *pool, nixlBasicDesc &buffer) const {
+    char *start = pool->alloc();
+    if (!start) {
+        NIXL_DEBUG << "staging pool has no free buffer left";
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    buffer = nixlBasicDesc(reinterpret_cast<uintptr_t>(start), pool->getBufferSize(), 0);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::releaseStagingBuffer(nixlStagingPoolH *pool, const nixlBasicDesc &buffer) const {
+    char *start = pool->bufferOf(buffer.addr);
+    if (!start || reinterpret_cast<uintptr_t>(start) != buffer.addr) {
+        NIXL_ERROR_FUNC << "address " << buffer.addr << " is not a buffer of the staging pool";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    pool->free(start);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::releaseStagingPool(nixlStagingPoolH *pool) {
+    if (pool->getNumInUse() != 0) {
+        NIXL_ERROR_FUNC << pool->getNumInUse() << " buffers of the staging pool are still in use";
+        return NIXL_ERR_NOT_ALLOWED;
+    }
+
+    const nixl_status_t ret = deregisterMem(pool->getRegDescs(), &pool->regArgs);
+    delete pool;
+    return ret;
+}
+
+nixl_status_t
+nixlAgentData::collectNotifs(const nixl_opt_args_t *extra_params, notif_list_t &notif_list) {
     notif_list_t    bknd_notif_list;
     nixl_status_t   ret, bad_ret=NIXL_SUCCESS;
     backend_list_t* backend_list;
 
-    NIXL_LOCK_GUARD(data->lock);
     if (!extra_params || extra_params->backends.size() == 0) {
-        backend_list = &data->notifEngines;
+        backend_list = &notifEngines;
         if (backend_list->empty()) {
             NIXL_ERROR_FUNC << "no backends support notifications";
             return NIXL_ERR_BACKEND;
@@ -1248,31 +2444,125 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     // the backend to the msg, but user could put it themselves.
     for (auto & eng: *backend_list) {
         bknd_notif_list.clear();
+        const uint64_t trace_start = tracer_ ? nixlTracer::now() : 0;
         ret = eng->getNotifs(bknd_notif_list);
+        if (tracer_ && !bknd_notif_list.empty()) {
+            tracer_->record(nixl_trace_stage_t::NOTIF_RECEIVE,
+                            0,
+                            trace_start,
+                            nixlTracer::now(),
+                            bknd_notif_list.size(),
+                            eng->getType());
+        }
         if (ret < 0) {
             NIXL_ERROR_FUNC << "backend '" << eng->getType() << "' returned error status " << ret
                             << " while getting notifications";
             bad_ret=ret;
         }
 
-        if (bknd_notif_list.size() == 0)
-            continue;
-
-        for (auto & elm: bknd_notif_list) {
-            if (notif_map.count(elm.first) == 0)
-                notif_map[elm.first] = std::vector<nixl_blob_t>();
-
-            notif_map[elm.first].push_back(elm.second);
+        if (notif_list.empty()) {
+            notif_list = std::move(bknd_notif_list);
+        } else {
+            std::move(bknd_notif_list.begin(),
+                      bknd_notif_list.end(),
+                      std::back_inserter(notif_list));
         }
     }
 
     if (extra_params && extra_params->backends.size() > 0)
         delete backend_list;
 
+    // Notifications of transfers within this agent, whichever backend was selected for them
+    if (localCopy_) {
+        bknd_notif_list.clear();
+        localCopy_->getNotifs(bknd_notif_list);
+        std::move(bknd_notif_list.begin(), bknd_notif_list.end(), std::back_inserter(notif_list));
+    }
+
     // If any backend had an error, it was already logged
     return bad_ret;
 }
 
+nixl_status_t
+nixlAgent::getNotifs(nixl_notifs_t &notif_map,
+                     const nixl_opt_args_t* extra_params) {
+    notif_list_t notif_list;
+
+    NIXL_LOCK_GUARD(data->lock);
+    const nixl_status_t ret = data->collectNotifs(extra_params, notif_list);
+
+    // Notifications kept by popMatchingNotifs or waitNotif were received earlier
+    if (!data->notifStore_.empty()) {
+        data->notifStore_.drain(notif_map);
+    }
+
+    for (auto &elm : notif_list) {
+        notif_map[elm.first].push_back(std::move(elm.second));
+    }
+
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::popMatchingNotifs(const std::string &remote_agent,
+                             const nixl_blob_t &tag,
+                             std::vector<nixl_blob_t> &msgs,
+                             nixl_notif_match_t match,
+                             const nixl_opt_args_t *extra_params) {
+    notif_list_t notif_list;
+
+    NIXL_LOCK_GUARD(data->lock);
+    const nixl_status_t ret = data->collectNotifs(extra_params, notif_list);
+    for (auto &elm : notif_list) {
+        data->notifStore_.add(elm.first, std::move(elm.second));
+    }
+
+    data->notifStore_.popAll(remote_agent, tag, match, msgs);
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::waitNotif(const std::string &remote_agent,
+                     const nixl_blob_t &tag,
+                     nixl_blob_t &msg,
+                     chrono_period_us_t timeout,
+                     nixl_notif_match_t match,
+                     const nixl_opt_args_t *extra_params) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    chrono_period_us_t backoff = notifWaitMinSleep;
+
+    while (true) {
+        {
+            notif_list_t notif_list;
+
+            NIXL_LOCK_GUARD(data->lock);
+            const nixl_status_t ret = data->collectNotifs(extra_params, notif_list);
+            for (auto &elm : notif_list) {
+                data->notifStore_.add(elm.first, std::move(elm.second));
+            }
+
+            if (data->notifStore_.pop(remote_agent, tag, match, msg)) {
+                return NIXL_SUCCESS;
+            }
+
+            // Unlike getNotifs, a failing backend ends the wait
+            if (ret < 0) {
+                return ret;
+            }
+        }
+
+        // Backends offer no wakeup for notifications, so poll with the lock released,
+        // backing off while nothing arrives and never sleeping past the deadline
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return NIXL_IN_PROG;
+        }
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+            backoff, deadline - now));
+        backoff = std::min(backoff * 2, notifWaitMaxSleep);
+    }
+}
+
 nixl_status_t
 nixlAgent::genNotif(const std::string &remote_agent,
                     const nixl_blob_t &msg,
@@ -1540,6 +2830,10 @@ nixl_status_t
 nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
     NIXL_LOCK_GUARD(data->lock);
 
+    if (data->localMD_) {
+        data->localMD_->forget(remote_agent);
+    }
+
     if (remote_agent == data->name_) {
         NIXL_ERROR_FUNC << "remote agent same as local agent, cannot invalidate local metadata";
         return NIXL_ERR_INVALID_PARAM;
@@ -1583,6 +2877,18 @@ nixlAgent::sendLocalMD (const nixl_opt_args_t* extra_params) const {
         return NIXL_SUCCESS;
     }
 
+    // Agents on this host read it from the node-local store, others from etcd
+    if (data->localMD_) {
+        ret = data->localMD_->publish(data->name_, default_metadata_label, myMD);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "failed to publish metadata to the node-local store: " << ret;
+            return ret;
+        }
+        if (!data->useEtcd_) {
+            return NIXL_SUCCESS;
+        }
+    }
+
 #if HAVE_ETCD
     // If no IP is provided, use etcd (now via thread)
     if (data->useEtcd_) {
@@ -1614,6 +2920,21 @@ nixlAgent::sendLocalPartialMD(const nixl_reg_dlist_t &descs,
         return NIXL_SUCCESS;
     }
 
+    if (data->localMD_) {
+        if (!extra_params || extra_params->metadataLabel.empty()) {
+            NIXL_ERROR_FUNC << "metadata label is required to publish local partial metadata";
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        ret = data->localMD_->publish(data->name_, extra_params->metadataLabel, myMD);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR_FUNC << "failed to publish metadata to the node-local store: " << ret;
+            return ret;
+        }
+        if (!data->useEtcd_) {
+            return NIXL_SUCCESS;
+        }
+    }
+
 #if HAVE_ETCD
     // If no IP is provided, use etcd (now via thread)
     if (data->useEtcd_) {
@@ -1641,6 +2962,41 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
         return NIXL_SUCCESS;
     }
 
+    // Agents on the same host are loaded directly from the node-local store
+    if (data->localMD_) {
+        const std::string &metadata_label = extra_params && !extra_params->metadataLabel.empty() ?
+                                            extra_params->metadataLabel :
+                                            default_metadata_label;
+        nixl_blob_t remote_md;
+        nixl_status_t ret = data->localMD_->fetch(remote_name, metadata_label, remote_md);
+        if (ret == NIXL_SUCCESS) {
+            std::string remote_name_from_md;
+            ret = loadRemoteMD(remote_md, remote_name_from_md);
+            if (ret == NIXL_SUCCESS && remote_name_from_md != remote_name) {
+                NIXL_ERROR_FUNC << "metadata mismatch for agent " << remote_name
+                                << " from md: " << remote_name_from_md;
+                ret = NIXL_ERR_MISMATCH;
+            }
+            if (ret != NIXL_SUCCESS) {
+                data->localMD_->forget(remote_name);
+            }
+            return ret;
+        }
+        if (ret != NIXL_ERR_NOT_FOUND) {
+            NIXL_ERROR_FUNC << "failed to fetch metadata of agent " << remote_name
+                            << " from the node-local store: " << ret;
+            return ret;
+        }
+        // As with etcd, metadata that is not published yet is loaded by the listener thread
+        // once it appears, unless etcd can provide it
+        if (!data->useEtcd_) {
+            NIXL_DEBUG << "Waiting for agent " << remote_name
+                       << " to publish its metadata in the node-local store";
+            data->localMD_->waitFor(remote_name, metadata_label);
+            return NIXL_SUCCESS;
+        }
+    }
+
 #if HAVE_ETCD
     // If no IP is provided, use etcd via thread with watch capability
     if (data->useEtcd_) {
@@ -1658,6 +3014,41 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
 #endif // HAVE_ETCD
 }
 
+nixl_status_t
+nixlAgent::prefetchRemoteMD(const std::vector<std::string> &remote_names,
+                            const nixl_opt_args_t *extra_params) {
+    if (extra_params && !extra_params->ipAddr.empty()) {
+        NIXL_ERROR_FUNC << "prefetching metadata is only supported from the metadata server";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+#if HAVE_ETCD
+    if (data->useEtcd_) {
+        for (const auto &remote_name : remote_names) {
+            if (remote_name.empty() || remote_name.find('\0') != std::string::npos) {
+                NIXL_ERROR_FUNC << "invalid remote agent name";
+                return NIXL_ERR_INVALID_PARAM;
+            }
+        }
+
+        std::string metadata_label = extra_params && !extra_params->metadataLabel.empty() ?
+                                     extra_params->metadataLabel :
+                                     default_metadata_label;
+        // The listener thread splits the names back on the NUL separator
+        data->enqueueCommWork(std::make_tuple(ETCD_PREFETCH,
+                                              std::move(metadata_label),
+                                              0,
+                                              absl::StrJoin(remote_names, std::string(1, '\0'))));
+        return NIXL_SUCCESS;
+    }
+    NIXL_ERROR_FUNC << "metadata server is not configured";
+    return NIXL_ERR_INVALID_PARAM;
+#else
+    NIXL_ERROR_FUNC << "ETCD is not supported";
+    return NIXL_ERR_NOT_SUPPORTED;
+#endif // HAVE_ETCD
+}
+
 nixl_status_t
 nixlAgent::invalidateLocalMD (const nixl_opt_args_t* extra_params) const {
     // If IP is provided, use socket-based communication
@@ -1666,6 +3057,13 @@ nixlAgent::invalidateLocalMD (const nixl_opt_args_t* extra_params) const {
         return NIXL_SUCCESS;
     }
 
+    if (data->localMD_) {
+        data->localMD_->invalidate(data->name_);
+        if (!data->useEtcd_) {
+            return NIXL_SUCCESS;
+        }
+    }
+
 #if HAVE_ETCD
     // If no IP is provided, use etcd via thread
     if (data->useEtcd_) {
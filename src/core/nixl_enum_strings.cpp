@@ -84,4 +84,34 @@ statusStr(const nixl_status_t &status) {
     return "BAD_STATUS";
 }
 
+std::string
+backendChoiceStr(const nixl_backend_choice_t &choice) {
+    switch (choice) {
+    case nixl_backend_choice_t::SINGLE_CANDIDATE:
+        return "SINGLE_CANDIDATE";
+    case nixl_backend_choice_t::LEARNED_COST:
+        return "LEARNED_COST";
+    case nixl_backend_choice_t::BACKEND_ESTIMATE:
+        return "BACKEND_ESTIMATE";
+    case nixl_backend_choice_t::PREFERENCE_ORDER:
+        return "PREFERENCE_ORDER";
+    case nixl_backend_choice_t::EXPLORATION:
+        return "EXPLORATION";
+    }
+    return "BAD_CHOICE";
+}
+
+std::string
+trafficClassStr(const nixl_traffic_class_t &traffic_class) {
+    switch (traffic_class) {
+    case nixl_traffic_class_t::LATENCY:
+        return "LATENCY";
+    case nixl_traffic_class_t::DEFAULT:
+        return "DEFAULT";
+    case nixl_traffic_class_t::BULK:
+        return "BULK";
+    }
+    return "BAD_CLASS";
+}
+
 } // namespace nixlEnumStrings
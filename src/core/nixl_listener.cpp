@@ -22,6 +22,7 @@
 #include "agent_data.h"
 #include "common/nixl_log.h"
 #if HAVE_ETCD
+#include "md_cache.h"
 #include <etcd/SyncClient.hpp>
 #include <etcd/Watcher.hpp>
 #include <future>
@@ -29,6 +30,7 @@
 #include <absl/strings/str_format.h>
 #include <absl/strings/str_split.h>
 #include <poll.h>
+#include <set>
 
 const std::string default_metadata_label = "metadata";
 
@@ -191,7 +193,54 @@ recvCommMessage(int fd, std::string &msg) {
 }
 
 #if HAVE_ETCD
-class nixlEtcdClient {
+// Recursive etcd watch on a key prefix, canceled on destruction
+class nixlEtcdPrefixWatch : public nixlMDWatch {
+public:
+    nixlEtcdPrefixWatch(etcd::SyncClient &client,
+                        const std::string &prefix,
+                        int64_t from_revision,
+                        nixl_md_watch_cb_t on_events,
+                        std::function<void()> on_error)
+        : watcher_(
+              client,
+              prefix,
+              from_revision,
+              [on_events, on_error](etcd::Response response) {
+                  if (!response.is_ok()) {
+                      NIXL_ERROR << "Prefix watch failed: " << response.error_message();
+                      on_error();
+                      return;
+                  }
+
+                  std::vector<nixlMDWatchEvent> events;
+                  events.reserve(response.events().size());
+                  for (const auto &event : response.events()) {
+                      const bool deleted =
+                          event.event_type() == etcd::Event::EventType::DELETE_;
+                      events.push_back({deleted,
+                                        event.kv().key(),
+                                        deleted ? nixl_blob_t() : event.kv().as_string()});
+                  }
+                  on_events(events);
+              },
+              true) {
+        // Called once the watcher stops, canceled is false when it stopped on an error
+        watcher_.Wait([on_error](bool canceled) {
+            if (!canceled) {
+                on_error();
+            }
+        });
+    }
+
+    ~nixlEtcdPrefixWatch() override {
+        watcher_.Cancel();
+    }
+
+private:
+    etcd::Watcher watcher_;
+};
+
+class nixlEtcdClient : public nixlMDStoreClient {
 private:
     std::unique_ptr<etcd::SyncClient> etcd;
     const std::string namespace_prefix;
@@ -199,13 +248,13 @@ private:
     std::mutex invalidated_agents_mutex;
     std::unordered_map<std::string, std::unique_ptr<etcd::Watcher>> agentWatchers;
     std::chrono::microseconds watchTimeout_;
+    // Namespace-wide copy of the metadata, filled by prefetchMetadataFromEtcd
+    nixlRemoteMDCache mdCache_;
 
     // Helper function to create etcd key
     std::string makeKey(const std::string& agent_name,
                         const std::string& metadata_type) {
-        std::stringstream ss;
-        ss << namespace_prefix << "/" << agent_name << "/" << metadata_type;
-        return ss.str();
+        return mdCache_.makeKey(agent_name, metadata_type);
     }
 
 public:
@@ -215,7 +264,8 @@ public:
         : namespace_prefix(
               nixl::config::getValueDefaulted<std::string>("NIXL_ETCD_NAMESPACE",
                                                            NIXL_ETCD_NAMESPACE_DEFAULT)),
-          watchTimeout_(timeout) {
+          watchTimeout_(timeout),
+          mdCache_(*this, namespace_prefix) {
         const auto etcd_endpoints = nixl::config::getNonEmptyString("NIXL_ETCD_ENDPOINTS");
 
         try {
@@ -372,10 +422,89 @@ public:
         }
     }
 
+    nixl_status_t
+    getPrefix(const std::string &prefix,
+              std::vector<nixlMDKeyValue> &kvs,
+              int64_t &revision) override {
+        if (!etcd) {
+            NIXL_ERROR << "ETCD client not available";
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        try {
+            etcd::Response response = etcd->ls(prefix);
+            if (!response.is_ok()) {
+                NIXL_ERROR << "Failed to list prefix: " << prefix
+                           << " from etcd: " << response.error_message();
+                return NIXL_ERR_BACKEND;
+            }
+
+            kvs.clear();
+            kvs.reserve(response.values().size());
+            for (const auto &value : response.values()) {
+                kvs.push_back({value.key(), value.as_string()});
+            }
+            revision = response.index();
+            return NIXL_SUCCESS;
+        }
+        catch (const std::exception &e) {
+            NIXL_ERROR << "Error listing prefix: " << prefix << " from etcd: " << e.what();
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    std::unique_ptr<nixlMDWatch>
+    watchPrefix(const std::string &prefix,
+                int64_t from_revision,
+                nixl_md_watch_cb_t on_events,
+                std::function<void()> on_error) override {
+        if (!etcd) {
+            return nullptr;
+        }
+
+        try {
+            return std::make_unique<nixlEtcdPrefixWatch>(
+                *etcd, prefix, from_revision, std::move(on_events), std::move(on_error));
+        }
+        catch (const std::exception &e) {
+            NIXL_ERROR << "Error watching prefix: " << prefix << " in etcd: " << e.what();
+            return nullptr;
+        }
+    }
+
+    // Read all agents' metadata with one range request, then keep it updated with a prefix watch
+    nixl_status_t
+    prefetchMetadataFromEtcd() {
+        if (!etcd) {
+            NIXL_ERROR << "ETCD client not available";
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+        return mdCache_.prefetch();
+    }
+
+    // Restart a broken prefix watch, so that invalidations of tracked agents are not missed
+    void
+    recoverMetadataWatch() {
+        const nixl_status_t ret = mdCache_.recover();
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to restart the metadata watch: " << ret;
+        }
+    }
+
+    nixlRemoteMDCache &
+    getMetadataCache() {
+        return mdCache_;
+    }
+
     // Fetch metadata from etcd or wait for it to be available
     nixl_status_t fetchOrWaitForMetadataFromEtcd(const std::string& remote_agent,
                                                  const std::string& metadata_label,
                                                  nixl_blob_t& remote_metadata) {
+        if (mdCache_.lookup(remote_agent, metadata_label, remote_metadata)) {
+            NIXL_DEBUG << "Found metadata of agent " << remote_agent << " in the local cache";
+            return NIXL_SUCCESS;
+        }
+
         nixl_status_t ret = fetchMetadataFromEtcd(remote_agent, metadata_label, remote_metadata);
         if (ret == NIXL_SUCCESS) {
             return NIXL_SUCCESS;
@@ -393,6 +522,12 @@ public:
             return;
         }
 
+        // The prefix watch already reports this agent's invalidation
+        if (mdCache_.isWatching()) {
+            mdCache_.track(agent_name);
+            return;
+        }
+
         // DELETE events are enqueued to be deleted in commWorker (can't be done inside the Watcher callback)
         auto process_response = [this, agent_name](etcd::Response response) -> void {
             if (!response.is_ok()) {
@@ -423,12 +558,44 @@ public:
         agentWatchers[agent_name] = std::make_unique<etcd::Watcher>(*etcd, agent_prefix, process_response);
     }
 
+    // Load metadata fetched for remote_agent and watch for its invalidation
+    nixl_status_t
+    loadFetchedMetadata(nixlAgent *my_agent,
+                        const std::string &remote_agent,
+                        const nixl_blob_t &remote_metadata) {
+        std::string remote_agent_from_md;
+        const nixl_status_t ret = my_agent->loadRemoteMD(remote_metadata, remote_agent_from_md);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to load remote metadata: " << ret;
+            return ret;
+        } else if (remote_agent_from_md != remote_agent) {
+            NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
+                       << " from md: " << remote_agent_from_md;
+            return NIXL_ERR_MISMATCH;
+        }
+        NIXL_DEBUG << "Successfully loaded metadata for agent: " << remote_agent;
+
+        setupAgentWatcher(remote_agent);
+        return NIXL_SUCCESS;
+    }
+
+    // Load the metadata of prefetched agents that was published after the prefetch
+    void
+    processPrefetchedAgents(nixlAgent *my_agent) {
+        for (const auto &[agent, metadata] : mdCache_.takeReady()) {
+            loadFetchedMetadata(my_agent, agent, metadata);
+        }
+    }
+
     // Process invalidated agents from watchers
     void processInvalidatedAgents(nixlAgent* my_agent) {
-        std::vector<std::string> tmp_invalidated_agents;
+        std::vector<std::string> tmp_invalidated_agents = mdCache_.takeInvalidated();
         {
             std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
-            tmp_invalidated_agents = std::move(invalidated_agents);
+            tmp_invalidated_agents.insert(tmp_invalidated_agents.end(),
+                                          invalidated_agents.begin(),
+                                          invalidated_agents.end());
+            invalidated_agents.clear();
         }
         for (const auto &agent : tmp_invalidated_agents) {
             NIXL_DEBUG << "Invalidated agent: " << agent;
@@ -590,7 +757,7 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
                     const std::string &metadata_label = req_ip;
                     const std::string &remote_agent = my_MD;
 
-                    // First try a direct get
+                    // First try the local cache or a direct get
                     nixl_blob_t remote_metadata;
                     nixl_status_t ret = etcdClient->fetchOrWaitForMetadataFromEtcd(remote_agent, metadata_label,
                                                                                    remote_metadata);
@@ -599,19 +766,52 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
                         break;
                     }
 
-                    std::string remote_agent_from_md;
-                    ret = myAgent->loadRemoteMD(remote_metadata, remote_agent_from_md);
+                    etcdClient->loadFetchedMetadata(myAgent, remote_agent, remote_metadata);
+                    break;
+                }
+                case ETCD_PREFETCH:
+                {
+                    if (!useEtcd_) {
+                        throw std::runtime_error("ETCD is not enabled");
+                    }
+
+                    const std::string &metadata_label = req_ip;
+                    const nixl_status_t ret = etcdClient->prefetchMetadataFromEtcd();
                     if (ret != NIXL_SUCCESS) {
-                        NIXL_ERROR << "Failed to load remote metadata: " << ret;
-                        break;
-                    } else if (remote_agent_from_md != remote_agent) {
-                        NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
-                                   << " from md: " << remote_agent_from_md;
+                        NIXL_ERROR << "Failed to prefetch metadata from etcd: " << ret;
                         break;
                     }
-                    NIXL_DEBUG << "Successfully loaded metadata for agent: " << remote_agent;
 
-                    etcdClient->setupAgentWatcher(remote_agent);
+                    // An empty list selects every other agent that published the label
+                    auto &cache = etcdClient->getMetadataCache();
+                    std::vector<std::string> remote_agents;
+                    if (my_MD.empty()) {
+                        remote_agents = cache.agentsWithLabel(metadata_label);
+                    } else {
+                        remote_agents = absl::StrSplit(my_MD, '\0');
+                    }
+
+                    size_t loaded = 0;
+                    for (const auto &remote_agent : remote_agents) {
+                        if (remote_agent == name_) {
+                            continue;
+                        }
+
+                        nixl_blob_t remote_metadata;
+                        if (!cache.lookup(remote_agent, metadata_label, remote_metadata)) {
+                            NIXL_DEBUG << "Metadata of agent " << remote_agent
+                                       << " is not published yet, loading it once it is";
+                            cache.want(remote_agent, metadata_label);
+                            continue;
+                        }
+
+                        if (etcdClient->loadFetchedMetadata(
+                                myAgent, remote_agent, remote_metadata) == NIXL_SUCCESS) {
+                            ++loaded;
+                        }
+                    }
+                    NIXL_DEBUG << "Prefetched metadata of " << loaded << " agents with label "
+                               << metadata_label;
                     break;
                 }
                 case ETCD_INVAL:
@@ -713,8 +913,14 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
             }
         }
 
+        if (localMD_) {
+            processLocalMDChanges(myAgent);
+        }
+
 #if HAVE_ETCD
         if (etcdClient) {
+            etcdClient->recoverMetadataWatch();
+            etcdClient->processPrefetchedAgents(myAgent);
             etcdClient->processInvalidatedAgents(myAgent);
         }
 #endif // HAVE_ETCD
@@ -726,6 +932,37 @@ nixlAgentData::commWorkerInternal(nixlAgent *myAgent) {
     }
 }
 
+void
+nixlAgentData::processLocalMDChanges(nixlAgent *myAgent) {
+    std::set<std::string> invalidated;
+    for (auto &change : localMD_->poll()) {
+        if (change.invalidated) {
+            // Reported once per label, the agent is invalidated on the first one
+            if (!invalidated.insert(change.agentName).second) {
+                continue;
+            }
+            localMD_->forget(change.agentName);
+            const nixl_status_t ret = myAgent->invalidateRemoteMD(change.agentName);
+            if (ret != NIXL_SUCCESS && ret != NIXL_ERR_NOT_FOUND) {
+                NIXL_ERROR << "Failed to invalidate remote metadata for agent: "
+                           << change.agentName << ": " << ret;
+            }
+            continue;
+        }
+
+        if (invalidated.count(change.agentName) != 0) {
+            continue;
+        }
+
+        std::string remote_agent;
+        const nixl_status_t ret = myAgent->loadRemoteMD(change.metadata, remote_agent);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to reload updated metadata of agent: " << change.agentName
+                       << ": " << ret;
+        }
+    }
+}
+
 void nixlAgentData::enqueueCommWork(nixl_comm_req_t request){
     if (agentShutdown) {
         NIXL_WARN << "Agent shutting down, unable to accept new requests";
@@ -779,8 +1016,11 @@ nixlAgentData::loadConnInfo(const std::string &remote_name,
 
 nixl_status_t
 nixlAgentData::loadRemoteSections(const std::string &remote_name, nixlSerDes &sd) {
+    static const std::unordered_map<nixl_backend_t, nixl_blob_t> no_conn_infos;
+    const auto conn_it = remoteBackends_.find(remote_name);
     const auto [it, inserted] = remoteSections_.try_emplace(remote_name, remote_name);
-    const nixl_status_t ret = it->second.loadRemoteData(&sd, backendEngines_);
+    const nixl_status_t ret = it->second.loadRemoteData(
+        &sd, backendEngines_, (conn_it != remoteBackends_.end()) ? conn_it->second : no_conn_infos);
     // TODO: can be more graceful, if just the new MD blob was improper
     if (ret != NIXL_SUCCESS) {
         remoteSections_.erase(it);
@@ -186,9 +186,9 @@ telemetryLoader(void *handle, const std::string &plugin_path) {
         return nullptr;
     }
 
-    if (plugin->api_version != nixl_telemetry_plugin_api_version::V2) {
+    if (plugin->api_version != nixl_telemetry_plugin_api_version::V3) {
         NIXL_ERROR << "Plugin API version mismatch for " << plugin_path << ": expected "
-                   << static_cast<unsigned int>(nixl_telemetry_plugin_api_version::V2) << ", got "
+                   << static_cast<unsigned int>(nixl_telemetry_plugin_api_version::V3) << ", got "
                    << static_cast<unsigned int>(plugin->api_version);
         dlclose(handle);
         return nullptr;
@@ -706,5 +706,13 @@ void nixlPluginManager::registerBuiltinPlugins() {
 #ifdef STATIC_PLUGIN_HF3FS
     NIXL_REGISTER_STATIC_PLUGIN(Backend, HF3FS)
 #endif
+
+#ifdef STATIC_PLUGIN_SHM
+    NIXL_REGISTER_STATIC_PLUGIN(Backend, SHM)
+#endif
+
+#ifdef STATIC_PLUGIN_LOOPBACK
+    NIXL_REGISTER_STATIC_PLUGIN(Backend, LOOPBACK)
+#endif
     NIXL_REGISTER_STATIC_PLUGIN(Telemetry, BUFFER)
 }
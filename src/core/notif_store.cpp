@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "notif_store.h"
+
+#include <algorithm>
+
+void
+nixlNotifStore::add(const std::string &agent_name, nixl_blob_t msg) {
+    notifs_[agent_name].emplace(std::move(msg), nextSeq_++);
+}
+
+namespace {
+// Calls visit with the iterator of every entry whose message matches the tag, in message order
+template<typename entrySet, typename visitor>
+void
+forEachMatch(entrySet &entries,
+             const nixl_blob_t &tag,
+             nixl_notif_match_t match,
+             const visitor &visit) {
+    if (match == nixl_notif_match_t::PREFIX) {
+        for (auto it = entries.lower_bound({tag, 0});
+             it != entries.end() && it->first.compare(0, tag.size(), tag) == 0;
+             ++it) {
+            visit(it);
+        }
+    } else {
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->first.find(tag) != nixl_blob_t::npos) {
+                visit(it);
+            }
+        }
+    }
+}
+} // namespace
+
+std::vector<nixlNotifStore::entry_set_t::iterator>
+nixlNotifStore::findMatches(entry_set_t &entries,
+                            const nixl_blob_t &tag,
+                            nixl_notif_match_t match) {
+    std::vector<entry_set_t::iterator> matches;
+    forEachMatch(entries, tag, match, [&](entry_set_t::iterator it) { matches.push_back(it); });
+
+    std::sort(matches.begin(), matches.end(), [](const auto &a, const auto &b) {
+        return a->second < b->second;
+    });
+    return matches;
+}
+
+nixlNotifStore::entry_set_t::iterator
+nixlNotifStore::findFirst(entry_set_t &entries, const nixl_blob_t &tag, nixl_notif_match_t match) {
+    auto first = entries.end();
+    forEachMatch(entries, tag, match, [&](entry_set_t::iterator it) {
+        if (first == entries.end() || it->second < first->second) {
+            first = it;
+        }
+    });
+    return first;
+}
+
+bool
+nixlNotifStore::pop(const std::string &agent_name,
+                    const nixl_blob_t &tag,
+                    nixl_notif_match_t match,
+                    nixl_blob_t &msg) {
+    const auto agent_it = notifs_.find(agent_name);
+    if (agent_it == notifs_.end()) {
+        return false;
+    }
+
+    auto &entries = agent_it->second;
+    const auto first = findFirst(entries, tag, match);
+    if (first == entries.end()) {
+        return false;
+    }
+
+    msg = std::move(entries.extract(first).value().first);
+    if (entries.empty()) {
+        notifs_.erase(agent_it);
+    }
+    return true;
+}
+
+size_t
+nixlNotifStore::popAll(const std::string &agent_name,
+                       const nixl_blob_t &tag,
+                       nixl_notif_match_t match,
+                       std::vector<nixl_blob_t> &msgs) {
+    const auto agent_it = notifs_.find(agent_name);
+    if (agent_it == notifs_.end()) {
+        return 0;
+    }
+
+    auto &entries = agent_it->second;
+    const auto matches = findMatches(entries, tag, match);
+    msgs.reserve(msgs.size() + matches.size());
+    for (const auto &it : matches) {
+        msgs.push_back(std::move(entries.extract(it).value().first));
+    }
+
+    if (entries.empty()) {
+        notifs_.erase(agent_it);
+    }
+    return matches.size();
+}
+
+void
+nixlNotifStore::drain(nixl_notifs_t &notif_map) {
+    for (auto &[agent_name, entries] : notifs_) {
+        std::vector<entry_t> ordered;
+        ordered.reserve(entries.size());
+        while (!entries.empty()) {
+            ordered.push_back(std::move(entries.extract(entries.begin()).value()));
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const auto &a, const auto &b) {
+            return a.second < b.second;
+        });
+
+        auto &msgs = notif_map[agent_name];
+        for (auto &entry : ordered) {
+            msgs.push_back(std::move(entry.first));
+        }
+    }
+    notifs_.clear();
+}
@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_NOTIF_STORE_H
+#define NIXL_SRC_CORE_NOTIF_STORE_H
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nixl_types.h"
+
+// Notifications received by the agent but not yet handed to the user. Messages are kept sorted
+// per sending agent, so all messages starting with a tag form one contiguous range that is found
+// in logarithmic time. Each message also carries its arrival sequence, so matches are still
+// returned in the order they were received.
+class nixlNotifStore {
+public:
+    void
+    add(const std::string &agent_name, nixl_blob_t msg);
+
+    // Remove the earliest message from agent_name matching the tag
+    bool
+    pop(const std::string &agent_name,
+        const nixl_blob_t &tag,
+        nixl_notif_match_t match,
+        nixl_blob_t &msg);
+
+    // Remove all messages from agent_name matching the tag, appended to msgs in arrival order
+    size_t
+    popAll(const std::string &agent_name,
+           const nixl_blob_t &tag,
+           nixl_notif_match_t match,
+           std::vector<nixl_blob_t> &msgs);
+
+    // Move all messages into notif_map, in arrival order per agent
+    void
+    drain(nixl_notifs_t &notif_map);
+
+    [[nodiscard]] bool
+    empty() const {
+        return notifs_.empty();
+    }
+
+private:
+    // Message and arrival sequence
+    using entry_t = std::pair<nixl_blob_t, uint64_t>;
+    using entry_set_t = std::set<entry_t>;
+
+    // Entries of the agent matching the tag, ordered by arrival
+    static std::vector<entry_set_t::iterator>
+    findMatches(entry_set_t &entries, const nixl_blob_t &tag, nixl_notif_match_t match);
+
+    // Earliest entry of the agent matching the tag, or end() if there is none
+    static entry_set_t::iterator
+    findFirst(entry_set_t &entries, const nixl_blob_t &tag, nixl_notif_match_t match);
+
+    std::unordered_map<std::string, entry_set_t> notifs_;
+    uint64_t nextSeq_ = 0;
+};
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "staging_pool.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <sys/mman.h>
+#include <linux/mman.h>
+
+#include "common/nixl_log.h"
+
+namespace {
+constexpr size_t k2MiB = size_t(2) << 20;
+constexpr size_t k1GiB = size_t(1) << 30;
+
+size_t
+roundUp(size_t size, size_t align) {
+    return (size + align - 1) / align * align;
+}
+
+void *
+mapHuge(size_t size, int page_flag) {
+    void *addr = mmap(nullptr,
+                      size,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_flag | MAP_POPULATE,
+                      -1,
+                      0);
+    return addr == MAP_FAILED ? nullptr : addr;
+}
+} // namespace
+
+nixlStagingPoolH::nixlStagingPoolH(size_t pool_size, size_t buffer_size)
+    : bufferSize_(buffer_size) {
+    if (buffer_size == 0 || pool_size < buffer_size) {
+        throw std::invalid_argument("staging buffer size must be in (0, pool size]");
+    }
+
+    // Largest huge pages first, reserved 1 GiB pages are only worth it for large pools
+    void *addr = nullptr;
+    if (pool_size >= k1GiB) {
+        mapSize_ = roundUp(pool_size, k1GiB);
+        addr = mapHuge(mapSize_, MAP_HUGE_1GB);
+        pageSize_ = k1GiB;
+    }
+    if (!addr) {
+        mapSize_ = roundUp(pool_size, k2MiB);
+        addr = mapHuge(mapSize_, MAP_HUGE_2MB);
+        pageSize_ = k2MiB;
+    }
+    if (!addr) {
+        // No huge pages reserved, ask for transparent huge pages. Faulting the pages in before
+        // registration keeps backends that pin memory from pinning the zero page.
+        addr = mmap(nullptr,
+                    mapSize_,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS,
+                    -1,
+                    0);
+        if (addr == MAP_FAILED) {
+            throw std::runtime_error("failed to map " + std::to_string(mapSize_) +
+                                     " bytes for the staging pool: " + strerror(errno));
+        }
+        madvise(addr, mapSize_, MADV_HUGEPAGE);
+        std::memset(addr, 0, mapSize_);
+        pageSize_ = 0;
+    }
+
+    base_ = static_cast<char *>(addr);
+    numBuffers_ = std::min<size_t>(mapSize_ / bufferSize_, kEmpty);
+    next_ = std::make_unique<std::atomic<uint32_t>[]>(numBuffers_);
+    for (size_t i = 0; i < numBuffers_; ++i) {
+        next_[i].store(i + 1 < numBuffers_ ? i + 1 : kEmpty, std::memory_order_relaxed);
+    }
+    head_.store(0, std::memory_order_release);
+
+    NIXL_INFO << "Staging pool of " << numBuffers_ << " buffers of " << bufferSize_
+              << " bytes mapped on "
+              << (pageSize_ ? std::to_string(pageSize_ >> 20) + " MiB huge pages" :
+                              std::string("transparent huge pages"));
+}
+
+nixlStagingPoolH::~nixlStagingPoolH() {
+    munmap(base_, mapSize_);
+}
+
+char *
+nixlStagingPoolH::alloc() noexcept {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    for (;;) {
+        const uint32_t index = static_cast<uint32_t>(head);
+        if (index == kEmpty) {
+            return nullptr;
+        }
+        // next_ of a popped index may be rewritten concurrently, the tag then fails the exchange
+        const uint64_t next = next_[index].load(std::memory_order_relaxed);
+        const uint64_t new_head = ((head >> 32) + 1) << 32 | next;
+        if (head_.compare_exchange_weak(
+                head, new_head, std::memory_order_acquire, std::memory_order_acquire)) {
+            inUse_.fetch_add(1, std::memory_order_relaxed);
+            return base_ + index * bufferSize_;
+        }
+    }
+}
+
+void
+nixlStagingPoolH::free(char *buffer) noexcept {
+    const auto index = static_cast<uint32_t>((buffer - base_) / bufferSize_);
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    uint64_t new_head;
+    do {
+        next_[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        new_head = ((head >> 32) + 1) << 32 | index;
+    } while (!head_.compare_exchange_weak(
+        head, new_head, std::memory_order_release, std::memory_order_relaxed));
+    inUse_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+char *
+nixlStagingPoolH::bufferOf(uintptr_t addr) const noexcept {
+    const uintptr_t base = reinterpret_cast<uintptr_t>(base_);
+    if (addr < base || addr >= base + numBuffers_ * bufferSize_) {
+        return nullptr;
+    }
+    return base_ + (addr - base) / bufferSize_ * bufferSize_;
+}
+
+nixl_reg_dlist_t
+nixlStagingPoolH::getRegDescs() const {
+    nixl_reg_dlist_t descs(DRAM_SEG);
+    descs.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(base_), mapSize_, 0));
+    return descs;
+}
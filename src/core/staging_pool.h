@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_STAGING_POOL_H
+#define NIXL_SRC_CORE_STAGING_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "nixl_descriptors.h"
+#include "nixl_types.h"
+
+// DRAM pool cut into fixed size staging buffers. The pool is mapped once, preferably on huge
+// pages, and registered once with the backends by the agent, so buffers are handed out without
+// locking or registering anything. Free buffers are kept on a lock-free stack of indices.
+class nixlStagingPoolH {
+public:
+    // Throws std::runtime_error if no memory could be mapped
+    nixlStagingPoolH(size_t pool_size, size_t buffer_size);
+    ~nixlStagingPoolH();
+
+    nixlStagingPoolH(const nixlStagingPoolH &) = delete;
+    void
+    operator=(const nixlStagingPoolH &) = delete;
+
+    // Returns nullptr when all the buffers are in use
+    [[nodiscard]] char *
+    alloc() noexcept;
+
+    void
+    free(char *buffer) noexcept;
+
+    // Start of the buffer holding addr, nullptr if addr is outside the pool
+    [[nodiscard]] char *
+    bufferOf(uintptr_t addr) const noexcept;
+
+    // Single descriptor covering the pool, to register it
+    [[nodiscard]] nixl_reg_dlist_t
+    getRegDescs() const;
+
+    [[nodiscard]] size_t
+    getBufferSize() const noexcept {
+        return bufferSize_;
+    }
+
+    [[nodiscard]] size_t
+    getNumBuffers() const noexcept {
+        return numBuffers_;
+    }
+
+    // Size of the pages backing the pool, 0 for regular pages with transparent huge pages
+    // requested
+    [[nodiscard]] size_t
+    getPageSize() const noexcept {
+        return pageSize_;
+    }
+
+    [[nodiscard]] size_t
+    getNumInUse() const noexcept {
+        return inUse_.load(std::memory_order_relaxed);
+    }
+
+    // Arguments of the registration, kept to deregister from the same backends
+    nixl_opt_args_t regArgs;
+
+private:
+    static constexpr uint32_t kEmpty = UINT32_MAX;
+
+    char *base_ = nullptr;
+    size_t mapSize_ = 0;
+    size_t pageSize_ = 0;
+    const size_t bufferSize_;
+    size_t numBuffers_ = 0;
+
+    // Top of the stack in the low 32 bits, and a tag in the high 32 bits bumped on every change
+    // so a pop racing with a pop and push of the same index fails its exchange
+    std::atomic<uint64_t> head_;
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+    std::atomic<size_t> inUse_{0};
+};
+
+#endif
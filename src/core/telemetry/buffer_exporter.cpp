@@ -31,7 +31,12 @@ nixlTelemetryBufferExporter::nixlTelemetryBufferExporter(
     const nixlTelemetryExporterInitParams &init_params)
     : nixlTelemetryExporter(init_params),
       filePath_(getFilePath(init_params)),
-      buffer_(filePath_.string(), true, TELEMETRY_VERSION, getMaxEventsBuffered()) {
+      buffer_(filePath_.string(), true, TELEMETRY_VERSION, getMaxEventsBuffered()),
+      labels_(filePath_.string() + telemetryLabelsSuffix, std::ios::trunc) {
+    if (!labels_) {
+        NIXL_WARN << "Failed to create telemetry labels file " << filePath_.string()
+                  << telemetryLabelsSuffix << ", events keep only label ids";
+    }
     NIXL_INFO << "Telemetry enabled, using buffer path: " << filePath_.string()
               << " with size: " << getMaxEventsBuffered();
 }
@@ -44,3 +49,11 @@ nixlTelemetryBufferExporter::exportEvent(const nixlTelemetryEvent &event) {
 
     return NIXL_SUCCESS;
 }
+
+void
+nixlTelemetryBufferExporter::registerLabel(nixl_telemetry_label_t kind,
+                                           uint16_t id,
+                                           const std::string &name) {
+    // Flushed right away, the label must be readable before the events carrying it
+    labels_ << static_cast<int>(kind) << '\t' << id << '\t' << name << std::endl;
+}
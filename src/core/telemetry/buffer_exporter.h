@@ -23,15 +23,21 @@
 #include "nixl_types.h"
 
 #include <filesystem>
+#include <fstream>
 
 constexpr const char telemetryDirVar[] = "NIXL_TELEMETRY_DIR";
 
+// Suffix of the file, next to the buffer, that maps label ids of events to names
+constexpr const char telemetryLabelsSuffix[] = ".labels";
+
 /**
  * @class nixlTelemetryBufferExporter
  * @brief Shared memory buffer based telemetry exporter implementation
  *
  * This class implements the telemetry exporter interface to export
- * telemetry events to a shared memory buffer.
+ * telemetry events to a shared memory buffer. Registered labels are appended
+ * to a text file next to the buffer, one "<kind>\t<id>\t<name>" line each, so
+ * that readers can resolve the label ids carried by the events.
  */
 class nixlTelemetryBufferExporter : public nixlTelemetryExporter {
 public:
@@ -44,9 +50,13 @@ public:
     nixl_status_t
     exportEvent(const nixlTelemetryEvent &event) override;
 
+    void
+    registerLabel(nixl_telemetry_label_t kind, uint16_t id, const std::string &name) override;
+
 private:
     std::filesystem::path filePath_;
     sharedRingBuffer<nixlTelemetryEvent> buffer_;
+    std::ofstream labels_;
 };
 
 #endif // _TELEMETRY_BUFFER_EXPORTER_H
@@ -25,5 +25,5 @@ using buffer_exporter_plugin_t = nixlTelemetryPluginCreator<nixlTelemetryBufferE
 nixlTelemetryPlugin *
 createStaticBUFFERPlugin() {
     return buffer_exporter_plugin_t::create(
-        nixl_telemetry_plugin_api_version::V2, "buffer", "1.0.0");
+        nixl_telemetry_plugin_api_version::V3, "buffer", "1.0.0");
 }
@@ -71,6 +71,7 @@ nixlTelemetryEventTypeForStatus(nixl_status_t s) {
 
 constexpr std::chrono::milliseconds DEFAULT_TELEMETRY_RUN_INTERVAL = 100ms;
 constexpr size_t DEFAULT_TELEMETRY_BUFFER_SIZE = 4096;
+constexpr size_t DEFAULT_TELEMETRY_MAX_LABEL_VALUES = 64;
 constexpr const char *defaultTelemetryPlugin = "BUFFER";
 
 nixlTelemetry::nixlTelemetry(const std::string &agent_name)
@@ -133,6 +134,12 @@ nixlTelemetry::initializeTelemetry() {
         throw std::invalid_argument("Telemetry buffer size cannot be 0");
     }
 
+    // Label ids are 16 bits wide, with 0 and UINT16_MAX reserved
+    maxLabelValues_ = std::min<size_t>(
+        nixl::config::getValueDefaulted<size_t>(TELEMETRY_MAX_LABEL_VALUES_VAR,
+                                                DEFAULT_TELEMETRY_MAX_LABEL_VALUES),
+        TELEMETRY_LABEL_OTHER - 1);
+
     const std::optional<std::string> exporter_name = getExporterName();
 
     if (!exporter_name) {
@@ -169,10 +176,16 @@ nixlTelemetry::initializeTelemetry() {
 bool
 nixlTelemetry::writeEventHelper() {
     std::vector<nixlTelemetryEvent> next_queue;
+    std::vector<labelRegistration> next_labels;
     next_queue.reserve(maxBufferedEvents_);
     {
         std::lock_guard<std::mutex> lock(mutex_);
         events_.swap(next_queue);
+        newLabels_.swap(next_labels);
+    }
+
+    for (const auto &label : next_labels) {
+        exporter_->registerLabel(label.kind, label.id, label.name);
     }
 
     for (auto &event : next_queue) {
@@ -264,28 +277,121 @@ nixlTelemetry::updateMemoryDeregistered(uint64_t memory_deregistered) {
 }
 
 void
-nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time, bool is_write, uint64_t bytes) {
+nixlTelemetry::updateRegCacheHits(uint64_t hits) {
+    updateData(nixl_telemetry_event_type_t::AGENT_REG_CACHE_HITS,
+               nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY,
+               hits);
+}
+
+void
+nixlTelemetry::updateRegCacheMisses(uint64_t misses) {
+    updateData(nixl_telemetry_event_type_t::AGENT_REG_CACHE_MISSES,
+               nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY,
+               misses);
+}
+
+void
+nixlTelemetry::updateThrottledRequests(uint64_t num) {
+    updateData(nixl_telemetry_event_type_t::AGENT_THROTTLED_REQUESTS,
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               num);
+}
+
+uint16_t
+nixlTelemetry::labelId(nixl_telemetry_label_t kind, std::string_view name) {
+    if (name.empty() || !exporter_) {
+        return TELEMETRY_LABEL_NONE;
+    }
+
+    auto &ids = labelIds_[static_cast<size_t>(kind)];
+    const auto it = ids.find(std::string(name));
+    if (it != ids.end()) {
+        return it->second;
+    }
+
+    // Values beyond the limit share one id, so a job with many peers keeps the number
+    // of exported series bounded
+    if (ids.size() >= maxLabelValues_) {
+        if (!labelOverflow_[static_cast<size_t>(kind)]) {
+            labelOverflow_[static_cast<size_t>(kind)] = true;
+            NIXL_WARN << "Telemetry label kind " << static_cast<int>(kind) << " reached "
+                      << maxLabelValues_ << " values, further values are reported as other";
+            newLabels_.push_back({kind, TELEMETRY_LABEL_OTHER, "other"});
+        }
+        return TELEMETRY_LABEL_OTHER;
+    }
+
+    const uint16_t id = static_cast<uint16_t>(ids.size() + 1);
+    ids.emplace(std::string(name), id);
+    newLabels_.push_back({kind, id, std::string(name)});
+    return id;
+}
+
+void
+nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time,
+                           bool is_write,
+                           uint64_t bytes,
+                           const nixlTelemetryLabels &labels) {
     const auto bytes_type = is_write ? nixl_telemetry_event_type_t::AGENT_TX_BYTES :
                                        nixl_telemetry_event_type_t::AGENT_RX_BYTES;
     const auto requests_type = is_write ? nixl_telemetry_event_type_t::AGENT_TX_REQUESTS_NUM :
                                           nixl_telemetry_event_type_t::AGENT_RX_REQUESTS_NUM;
+    const auto op = is_write ? nixl_telemetry_op_t::WRITE : nixl_telemetry_op_t::READ;
 
     const std::lock_guard lock(mutex_);
     if (events_.size() + 3 > maxBufferedEvents_) {
         return;
     }
+    const uint16_t backend_id = labelId(nixl_telemetry_label_t::BACKEND, labels.backend);
+    const uint16_t peer_id = labelId(nixl_telemetry_label_t::PEER, labels.remoteAgent);
     events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
                          nixl_telemetry_event_type_t::AGENT_XFER_TIME,
-                         static_cast<uint64_t>(xfer_time.count()));
-    events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, bytes_type, bytes);
-    events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, requests_type, 1);
+                         static_cast<uint64_t>(xfer_time.count()),
+                         backend_id,
+                         peer_id,
+                         op);
+    events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                         bytes_type,
+                         bytes,
+                         backend_id,
+                         peer_id,
+                         op);
+    events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                         requests_type,
+                         1,
+                         backend_id,
+                         peer_id,
+                         op);
+}
+
+void
+nixlTelemetry::addPostTime(std::chrono::microseconds post_time,
+                           bool is_write,
+                           const nixlTelemetryLabels &labels) {
+    const std::lock_guard lock(mutex_);
+    if (events_.size() >= maxBufferedEvents_) {
+        return;
+    }
+    events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                         nixl_telemetry_event_type_t::AGENT_XFER_POST_TIME,
+                         static_cast<uint64_t>(post_time.count()),
+                         labelId(nixl_telemetry_label_t::BACKEND, labels.backend),
+                         labelId(nixl_telemetry_label_t::PEER, labels.remoteAgent),
+                         is_write ? nixl_telemetry_op_t::WRITE : nixl_telemetry_op_t::READ);
 }
 
 void
-nixlTelemetry::addPostTime(std::chrono::microseconds post_time) {
-    updateData(nixl_telemetry_event_type_t::AGENT_XFER_POST_TIME,
-               nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
-               static_cast<uint64_t>(post_time.count()));
+nixlTelemetry::addThrottleTime(std::chrono::microseconds throttle_time,
+                               const nixlTelemetryLabels &labels) {
+    const std::lock_guard lock(mutex_);
+    if (events_.size() >= maxBufferedEvents_) {
+        return;
+    }
+    events_.emplace_back(nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                         nixl_telemetry_event_type_t::AGENT_THROTTLE_TIME,
+                         static_cast<uint64_t>(throttle_time.count()),
+                         labelId(nixl_telemetry_label_t::BACKEND, labels.backend),
+                         labelId(nixl_telemetry_label_t::PEER, labels.remoteAgent));
 }
 
 std::string
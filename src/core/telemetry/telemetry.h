@@ -30,6 +30,8 @@
 #include <chrono>
 #include <functional>
 #include <atomic>
+#include <string_view>
+#include <unordered_map>
 
 #include <asio.hpp>
 
@@ -48,6 +50,12 @@ struct periodicTask {
           enabled_(enabled) {}
 };
 
+// Labels attached to per-request transfer events; empty names are left unlabelled
+struct nixlTelemetryLabels {
+    std::string_view backend;
+    std::string_view remoteAgent;
+};
+
 class nixlTelemetry {
 public:
     explicit nixlTelemetry(const std::string &agent_name);
@@ -69,9 +77,22 @@ public:
     void
     updateMemoryDeregistered(uint64_t memory_deregistered);
     void
-    addXferTime(std::chrono::microseconds transaction_time, bool is_write, uint64_t bytes);
+    updateRegCacheHits(uint64_t hits);
+    void
+    updateRegCacheMisses(uint64_t misses);
+    void
+    updateThrottledRequests(uint64_t num);
     void
-    addPostTime(std::chrono::microseconds post_time);
+    addXferTime(std::chrono::microseconds transaction_time,
+                bool is_write,
+                uint64_t bytes,
+                const nixlTelemetryLabels &labels = {});
+    void
+    addPostTime(std::chrono::microseconds post_time,
+                bool is_write,
+                const nixlTelemetryLabels &labels = {});
+    void
+    addThrottleTime(std::chrono::microseconds throttle_time, const nixlTelemetryLabels &labels);
 
 private:
     void
@@ -84,9 +105,24 @@ private:
                uint64_t value);
     bool
     writeEventHelper();
+    // Must be called with mutex_ held
+    [[nodiscard]] uint16_t
+    labelId(nixl_telemetry_label_t kind, std::string_view name);
+
+    struct labelRegistration {
+        nixl_telemetry_label_t kind;
+        uint16_t id;
+        std::string name;
+    };
+
     std::unique_ptr<nixlTelemetryExporter> exporter_;
     std::unique_ptr<sharedRingBuffer<nixlTelemetryEvent>> buffer_;
     std::vector<nixlTelemetryEvent> events_;
+    // Label names are announced to the exporter ahead of the events that carry their ids
+    std::vector<labelRegistration> newLabels_;
+    std::unordered_map<std::string, uint16_t> labelIds_[2];
+    bool labelOverflow_[2] = {false, false};
+    size_t maxLabelValues_;
     size_t maxBufferedEvents_;
     std::mutex mutex_;
     asio::thread_pool pool_;
@@ -25,8 +25,9 @@
 
 constexpr char TELEMETRY_BUFFER_SIZE_VAR[] = "NIXL_TELEMETRY_BUFFER_SIZE";
 constexpr char TELEMETRY_RUN_INTERVAL_VAR[] = "NIXL_TELEMETRY_RUN_INTERVAL";
+constexpr char TELEMETRY_MAX_LABEL_VALUES_VAR[] = "NIXL_TELEMETRY_MAX_LABEL_VALUES";
 
-constexpr inline int TELEMETRY_VERSION = 2;
+constexpr inline int TELEMETRY_VERSION = 3;
 
 /**
  * @enum nixl_telemetry_category_t
@@ -68,8 +69,37 @@ enum class nixl_telemetry_event_type_t : uint32_t {
     AGENT_ERR_REMOTE_DISCONNECT = 17,
     AGENT_ERR_CANCELED = 18,
     AGENT_ERR_NO_TELEMETRY = 19,
+    AGENT_REG_CACHE_HITS = 20,
+    AGENT_REG_CACHE_MISSES = 21,
+    AGENT_THROTTLED_REQUESTS = 22,
+    AGENT_THROTTLE_TIME = 23,
 };
 
+/**
+ * @enum nixl_telemetry_label_t
+ * @brief Kinds of labels that an event can carry as a compact id, resolved to names through
+ *        nixlTelemetryExporter::registerLabel
+ */
+enum class nixl_telemetry_label_t : uint8_t {
+    BACKEND = 0, // Backend type, e.g. UCX
+    PEER = 1, // Remote agent name
+};
+
+/**
+ * @enum nixl_telemetry_op_t
+ * @brief Transfer operation an event refers to, if any
+ */
+enum class nixl_telemetry_op_t : uint8_t {
+    NONE = 0,
+    READ = 1,
+    WRITE = 2,
+};
+
+// Label id of events that carry no such label
+constexpr inline uint16_t TELEMETRY_LABEL_NONE = 0;
+// Label id shared by all values beyond the cardinality limit of their kind
+constexpr inline uint16_t TELEMETRY_LABEL_OTHER = UINT16_MAX;
+
 [[nodiscard]] nixl_telemetry_event_type_t
 nixlTelemetryEventTypeForStatus(nixl_status_t s);
 
@@ -120,6 +150,14 @@ telemetryEventTypeStr(const nixl_telemetry_event_type_t type) noexcept {
         return "agent_err_canceled";
     case nixl_telemetry_event_type_t::AGENT_ERR_NO_TELEMETRY:
         return "agent_err_no_telemetry";
+    case nixl_telemetry_event_type_t::AGENT_REG_CACHE_HITS:
+        return "agent_reg_cache_hits";
+    case nixl_telemetry_event_type_t::AGENT_REG_CACHE_MISSES:
+        return "agent_reg_cache_misses";
+    case nixl_telemetry_event_type_t::AGENT_THROTTLED_REQUESTS:
+        return "agent_throttled_requests";
+    case nixl_telemetry_event_type_t::AGENT_THROTTLE_TIME:
+        return "agent_throttle_time";
     }
     return "unknown_event";
 }
@@ -133,15 +171,24 @@ struct nixlTelemetryEvent {
     nixl_telemetry_category_t category_; // Main event category for filtering
     nixl_telemetry_event_type_t eventType_; // Detailed event type/identifier
     uint64_t value_; // Numeric value associated with the event
+    uint16_t backendId_; // nixl_telemetry_label_t::BACKEND id, or TELEMETRY_LABEL_NONE
+    uint16_t peerId_; // nixl_telemetry_label_t::PEER id, or TELEMETRY_LABEL_NONE
+    nixl_telemetry_op_t op_;
 
     nixlTelemetryEvent() noexcept = default;
 
     nixlTelemetryEvent(nixl_telemetry_category_t category,
                        nixl_telemetry_event_type_t event_type,
-                       uint64_t value) noexcept
+                       uint64_t value,
+                       uint16_t backend_id = TELEMETRY_LABEL_NONE,
+                       uint16_t peer_id = TELEMETRY_LABEL_NONE,
+                       nixl_telemetry_op_t op = nixl_telemetry_op_t::NONE) noexcept
         : category_(category),
           eventType_(event_type),
-          value_(value) {}
+          value_(value),
+          backendId_(backend_id),
+          peerId_(peer_id),
+          op_(op) {}
 };
 
 #endif
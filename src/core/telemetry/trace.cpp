@@ -0,0 +1,310 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trace.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <set>
+#include <sys/syscall.h>
+#include <unordered_map>
+#include <unistd.h>
+
+#include "common/configuration.h"
+#include "common/nixl_log.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t DEFAULT_TRACE_BUFFER_SIZE = 65536;
+
+std::atomic<uint64_t> nextTracerId{1};
+
+// Live tracers by id, so that a thread exiting after a tracer was destroyed does not touch it
+struct tracerRegistry {
+    std::mutex mutex;
+    std::unordered_map<uint64_t, nixlTracer *> tracers;
+};
+
+tracerRegistry &
+registry() {
+    // Never destroyed, threads may still exit during static destruction
+    static auto *instance = new tracerRegistry();
+    return *instance;
+}
+
+// Last buffer used by this thread, keyed by tracer id so that a destroyed tracer is never
+// matched again, even if a new one is allocated at the same address. The buffers the thread
+// created are released when it exits.
+struct threadRingCache {
+    uint64_t tracerId = 0;
+    void *ring = nullptr;
+    std::vector<uint64_t> ownerIds;
+
+    ~threadRingCache() {
+        if (ownerIds.empty()) {
+            return;
+        }
+
+        auto &reg = registry();
+        const std::lock_guard lock(reg.mutex);
+        for (const uint64_t id : ownerIds) {
+            const auto it = reg.tracers.find(id);
+            if (it != reg.tracers.end()) {
+                it->second->releaseThreadRing(std::this_thread::get_id());
+            }
+        }
+    }
+};
+
+thread_local threadRingCache ringCache;
+
+[[nodiscard]] uint32_t
+currentTid() noexcept {
+    return static_cast<uint32_t>(syscall(SYS_gettid));
+}
+
+void
+writeJsonString(std::ostream &out, const std::string &str) {
+    out << '"';
+    for (const char c : str) {
+        if ((c == '"') || (c == '\\')) {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) >= 0x20) {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+// Trace files are named <agent>.<pid>.<tid>.trace
+[[nodiscard]] std::string
+agentFromFileName(const fs::path &file) {
+    std::string stem = file.stem().string();
+    for (int i = 0; i < 2; ++i) {
+        const auto pos = stem.rfind('.');
+        if (pos == std::string::npos) {
+            return stem;
+        }
+        stem.resize(pos);
+    }
+    return stem;
+}
+
+} // namespace
+
+std::string
+nixlEnumStrings::traceStageStr(const nixl_trace_stage_t &stage) {
+    static const std::array<std::string, 8> trace_stage_str = {"create",
+                                                               "populate",
+                                                               "backend_prep",
+                                                               "post",
+                                                               "first_progress",
+                                                               "completion",
+                                                               "notif_delivery",
+                                                               "notif_receive"};
+    const size_t stage_int = static_cast<size_t>(stage);
+    if (stage_int >= trace_stage_str.size()) return "BAD_STAGE";
+    return trace_stage_str[stage_int];
+}
+
+nixlTracer::nixlTracer(const std::string &agent_name, fs::path dir, size_t buffer_size)
+    : id_(nextTracerId.fetch_add(1, std::memory_order_relaxed)),
+      agentName_(agent_name),
+      dir_(std::move(dir)),
+      bufferSize_(buffer_size) {
+    if ((buffer_size < 2) || ((buffer_size & (buffer_size - 1)) != 0)) {
+        throw std::invalid_argument("Trace buffer size must be a power of 2");
+    }
+    fs::create_directories(dir_);
+
+    auto &reg = registry();
+    const std::lock_guard lock(reg.mutex);
+    reg.tracers.emplace(id_, this);
+}
+
+nixlTracer::~nixlTracer() {
+    {
+        auto &reg = registry();
+        const std::lock_guard lock(reg.mutex);
+        reg.tracers.erase(id_);
+    }
+
+    if (dropped() > 0) {
+        NIXL_WARN << "NIXL tracer of agent '" << agentName_ << "' dropped " << dropped()
+                  << " events, consider draining more often or increasing "
+                  << TRACE_BUFFER_SIZE_VAR;
+    }
+}
+
+std::unique_ptr<nixlTracer>
+nixlTracer::createFromEnv(const std::string &agent_name) {
+    const auto dir = nixl::config::getValueOptional<std::string>(TRACE_DIR_VAR);
+    if (!dir || dir->empty()) {
+        return nullptr;
+    }
+
+    const auto buffer_size =
+        nixl::config::getValueDefaulted<size_t>(TRACE_BUFFER_SIZE_VAR, DEFAULT_TRACE_BUFFER_SIZE);
+    NIXL_INFO << "NIXL request tracing is enabled, writing to " << *dir;
+    return std::make_unique<nixlTracer>(agent_name, *dir, buffer_size);
+}
+
+uint64_t
+nixlTracer::now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+nixlTracer::ring_t *
+nixlTracer::threadRing() {
+    if (ringCache.tracerId == id_) {
+        return static_cast<ring_t *>(ringCache.ring);
+    }
+
+    // First event of this thread for this tracer, or the thread alternates between agents
+    const std::lock_guard lock(mutex_);
+    auto [it, inserted] = rings_.try_emplace(std::this_thread::get_id());
+    if (inserted) {
+        std::string name = agentName_;
+        std::replace(name.begin(), name.end(), '/', '_');
+        const fs::path path = dir_ /
+            (name + "." + std::to_string(getpid()) + "." + std::to_string(currentTid()) +
+             TRACE_FILE_EXT);
+        try {
+            it->second = std::make_unique<ring_t>(path.string(), true, TRACE_VERSION, bufferSize_);
+        }
+        catch (const std::exception &e) {
+            // Kept as null, so the thread drops its events instead of retrying
+            NIXL_ERROR << "Failed to create trace buffer " << path << ": " << e.what();
+        }
+        ringCache.ownerIds.push_back(id_);
+    }
+
+    ringCache.tracerId = id_;
+    ringCache.ring = it->second.get();
+    return it->second.get();
+}
+
+void
+nixlTracer::releaseThreadRing(std::thread::id thread_id) noexcept {
+    // The buffer file stays in the directory until it is drained
+    const std::lock_guard lock(mutex_);
+    rings_.erase(thread_id);
+}
+
+void
+nixlTracer::record(nixl_trace_stage_t stage,
+                   uint64_t req_id,
+                   uint64_t start_ns,
+                   uint64_t end_ns,
+                   int64_t value,
+                   const std::string &backend) noexcept {
+    ring_t *ring;
+    try {
+        ring = threadRing();
+    }
+    catch (const std::exception &) {
+        ring = nullptr;
+    }
+
+    nixlTraceEvent event{};
+    event.reqId_ = req_id;
+    event.startNs_ = start_ns;
+    event.durationNs_ = (end_ns > start_ns) ? end_ns - start_ns : 0;
+    event.value_ = value;
+    event.pid_ = static_cast<uint32_t>(getpid());
+    event.tid_ = currentTid();
+    event.stage_ = stage;
+    std::strncpy(event.backend_, backend.c_str(), sizeof(event.backend_) - 1);
+
+    if (!ring || !ring->push(event)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+int64_t
+nixlTraceWriteChrome(const fs::path &dir, std::ostream &out) {
+    std::error_code ec;
+    fs::directory_iterator dir_it(dir, ec);
+    if (ec) {
+        NIXL_ERROR << "Failed to open trace directory " << dir << ": " << ec.message();
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    int64_t count = 0;
+    bool first = true;
+    std::set<uint32_t> named_pids;
+    auto separator = [&]() -> std::ostream & {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        return out;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (const auto &entry : dir_it) {
+        if (!entry.is_regular_file() || (entry.path().extension() != TRACE_FILE_EXT)) {
+            continue;
+        }
+
+        std::unique_ptr<sharedRingBuffer<nixlTraceEvent>> ring;
+        try {
+            ring = std::make_unique<sharedRingBuffer<nixlTraceEvent>>(
+                entry.path().string(), false, TRACE_VERSION);
+        }
+        catch (const std::exception &e) {
+            NIXL_WARN << "Skipping trace file " << entry.path() << ": " << e.what();
+            continue;
+        }
+
+        const std::string agent = agentFromFileName(entry.path());
+        nixlTraceEvent event;
+        while (ring->pop(event)) {
+            if (named_pids.insert(event.pid_).second) {
+                separator() << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << event.pid_
+                            << ",\"args\":{\"name\":";
+                writeJsonString(out, agent);
+                out << "}}";
+            }
+
+            event.backend_[sizeof(event.backend_) - 1] = '\0';
+            separator() << "{\"name\":\"" << nixlEnumStrings::traceStageStr(event.stage_)
+                        << "\",\"cat\":\"nixl\",\"pid\":" << event.pid_
+                        << ",\"tid\":" << event.tid_ << ",\"ts\":" << event.startNs_ / 1000 << '.'
+                        << std::setfill('0') << std::setw(3) << event.startNs_ % 1000;
+            if (event.durationNs_ > 0) {
+                out << ",\"ph\":\"X\",\"dur\":" << event.durationNs_ / 1000 << '.'
+                    << std::setw(3) << event.durationNs_ % 1000;
+            } else {
+                out << ",\"ph\":\"i\",\"s\":\"t\"";
+            }
+            out << std::setfill(' ') << ",\"args\":{\"req\":" << event.reqId_
+                << ",\"value\":" << event.value_ << ",\"backend\":";
+            writeJsonString(out, event.backend_);
+            out << "}}";
+            ++count;
+        }
+    }
+    out << "\n]}\n";
+
+    return count;
+}
@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_TELEMETRY_TRACE_H
+#define NIXL_SRC_CORE_TELEMETRY_TRACE_H
+
+#include "common/cyclic_buffer.h"
+#include "nixl_types.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+constexpr char TRACE_DIR_VAR[] = "NIXL_TRACE_DIR";
+constexpr char TRACE_BUFFER_SIZE_VAR[] = "NIXL_TRACE_BUFFER_SIZE";
+constexpr char TRACE_FILE_EXT[] = ".trace";
+
+constexpr inline int TRACE_VERSION = 1;
+
+/**
+ * @enum nixl_trace_stage_t
+ * @brief Stages of a transfer request lifecycle recorded by the tracer
+ */
+enum class nixl_trace_stage_t : uint8_t {
+    CREATE = 0, // Whole createXferReq / makeXferReq call
+    POPULATE = 1, // Resolving descriptors against the registered memory
+    BACKEND_PREP = 2, // Backend prepXfer
+    POST = 3, // Backend postXfer
+    FIRST_PROGRESS = 4, // First status check after a post, value is the status
+    COMPLETION = 5, // From post until the transfer was seen completed, value is the status
+    NOTIF_DELIVERY = 6, // Request carrying a notification completed, value is its size
+    NOTIF_RECEIVE = 7, // Notifications returned by a backend, not tied to a request, value is
+                       // their count
+};
+
+namespace nixlEnumStrings {
+std::string
+traceStageStr(const nixl_trace_stage_t &stage);
+}
+
+/**
+ * @struct nixlTraceEvent
+ * @brief A timestamped span of a transfer request, stored in the per-thread trace buffers.
+ *        Instant events have a zero duration.
+ */
+struct nixlTraceEvent {
+    uint64_t reqId_; // Request the span belongs to, 0 if not tied to a request
+    uint64_t startNs_; // Steady clock, comparable across processes of the same node
+    uint64_t durationNs_;
+    int64_t value_; // Stage dependent, e.g. bytes or status
+    uint32_t pid_;
+    uint32_t tid_;
+    nixl_trace_stage_t stage_;
+    char backend_[23]; // Backend type, truncated and null terminated
+};
+
+/**
+ * @class nixlTracer
+ * @brief Opt-in per-request lifecycle tracer, enabled by setting NIXL_TRACE_DIR.
+ *
+ * Each recording thread writes to its own file-backed sharedRingBuffer in the trace
+ * directory, so recording takes no lock and readers can drain the buffers from another
+ * process. Events are dropped when a buffer is full. Call sites hold a null tracer when
+ * tracing is disabled, so the disabled cost is a single pointer check.
+ */
+class nixlTracer {
+public:
+    nixlTracer(const std::string &agent_name, std::filesystem::path dir, size_t buffer_size);
+    ~nixlTracer();
+
+    nixlTracer(const nixlTracer &) = delete;
+    void
+    operator=(const nixlTracer &) = delete;
+
+    // Returns null if tracing is not enabled in the environment
+    [[nodiscard]] static std::unique_ptr<nixlTracer>
+    createFromEnv(const std::string &agent_name);
+
+    [[nodiscard]] static uint64_t
+    now() noexcept;
+
+    [[nodiscard]] uint64_t
+    nextReqId() noexcept {
+        return nextReqId_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void
+    record(nixl_trace_stage_t stage,
+           uint64_t req_id,
+           uint64_t start_ns,
+           uint64_t end_ns,
+           int64_t value,
+           const std::string &backend) noexcept;
+
+    // Events dropped because a thread buffer was full or could not be created
+    [[nodiscard]] uint64_t
+    dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::filesystem::path &
+    getDir() const noexcept {
+        return dir_;
+    }
+
+    // Unmap the buffer of a thread, called when the thread exits
+    void
+    releaseThreadRing(std::thread::id thread_id) noexcept;
+
+private:
+    using ring_t = sharedRingBuffer<nixlTraceEvent>;
+
+    [[nodiscard]] ring_t *
+    threadRing();
+
+    const uint64_t id_;
+    const std::string agentName_;
+    const std::filesystem::path dir_;
+    const size_t bufferSize_;
+    std::atomic<uint64_t> nextReqId_{1};
+    std::atomic<uint64_t> dropped_{0};
+    std::mutex mutex_;
+    std::unordered_map<std::thread::id, std::unique_ptr<ring_t>> rings_;
+};
+
+/**
+ * @brief Drains the trace buffers found in dir and writes them as a Chrome trace event
+ *        JSON document, which can also be opened by the Perfetto UI.
+ * @return Number of events written, or a negative nixl_status_t on failure
+ */
+[[nodiscard]] int64_t
+nixlTraceWriteChrome(const std::filesystem::path &dir, std::ostream &out);
+
+#endif
@@ -17,14 +17,21 @@
 #ifndef NIXL_SRC_CORE_TRANSFER_REQUEST_H
 #define NIXL_SRC_CORE_TRANSFER_REQUEST_H
 
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "nixl_types.h"
 #include "backend_engine.h"
 #include "telemetry.h"
+#include "mem_section.h"
+#include "staging_pool.h"
 
 enum nixl_telemetry_stat_status_t {
     NIXL_TELEMETRY_POST = 0,
@@ -54,16 +61,29 @@ public:
         if ((backendHandle != nullptr) && (engine != nullptr)) {
             engine->releaseReqH(backendHandle);
         }
+        for (char *buffer : stagingBuffers) {
+            stagingPool->free(buffer);
+        }
     }
 
     void
     updateRequestStats(nixlTelemetry *telemetry, nixl_telemetry_stat_status_t stat_status);
 
+    // Copy the user data of a staged request into the staging buffers, and back
+    void
+    stageIn() const;
+    void
+    stageOut() const;
+
+    friend class nixlAgentData;
     friend class nixlAgent;
+    friend class nixlXferScheduler;
 
 private:
     nixlBackendEngine *engine = nullptr;
     nixlBackendReqH *backendHandle = nullptr;
+    // Backend selected for the transfer, when the agent's local copy engine replaced it
+    nixlBackendEngine *selectedBackend = nullptr;
 
     nixl_meta_dlist_t initiatorDescs;
     nixl_meta_dlist_t targetDescs;
@@ -74,17 +94,130 @@ private:
 
     const nixl_xfer_op_t backendOp;
     nixl_status_t status = NIXL_ERR_NOT_POSTED;
+    std::optional<chrono_point_t> deadline;
+    // The backend was asked to abort the current post
+    bool cancelRequested = false;
+    nixl_traffic_class_t trafficClass = nixl_traffic_class_t::DEFAULT;
+    // Held back by its rate limits, guarded by the scheduler lock
+    bool queued = false;
+    nixl_backend_choice_t backendChoice = nixl_backend_choice_t::SINGLE_CANDIDATE;
+    // Only set when the backend was chosen among several, start of the last backend post
+    chrono_point_t costPostTime;
 
     nixl_xfer_telem_t telemetry;
+
+    // Only set when request tracing is enabled
+    uint64_t traceId = 0;
+    uint64_t tracePostNs = 0;
+    bool traceProgressed = false;
+
+    // Only set for requests created with a staging pool
+    struct stagedCopy {
+        char *user;
+        char *staging;
+        size_t len;
+    };
+
+    nixlStagingPoolH *stagingPool = nullptr;
+    std::vector<char *> stagingBuffers;
+    std::vector<stagedCopy> stagedCopies;
+
+    // Only set for requests made from a transfer plan
+    nixlXferPlanH *plan = nullptr;
 };
 
-struct nixlDlistH {
-    using descs_t = std::unordered_map<nixlBackendEngine *, std::unique_ptr<nixl_meta_dlist_t>>;
+// Transfer template compiled by compileXferPlan. Backend selection, metadata resolution and
+// descriptor merging are done once, requests made from the plan only shift its descriptors
+// and check that they stay in the registered regions resolved at compile time.
+class nixlXferPlanH {
+public:
+    nixlXferPlanH(const std::string &remote_agent,
+                  const nixl_xfer_op_t backend_op,
+                  const nixl_mem_t local_type,
+                  const nixl_mem_t remote_type);
+    ~nixlXferPlanH();
+
+    nixlXferPlanH(const nixlXferPlanH &) = delete;
+    void
+    operator=(const nixlXferPlanH &) = delete;
+
+    // Prepared backend handle kept for desc_count descriptors, or nullptr
+    [[nodiscard]] nixlBackendReqH *
+    takeHandle(int desc_count);
 
-    nixlDlistH(const std::string &remote_agent, descs_t &&descs);
+    // Keeps a prepared handle of a released request, false if enough are already kept
+    [[nodiscard]] bool
+    keepHandle(int desc_count, nixlBackendReqH *handle);
+
+    friend class nixlAgent;
+
+private:
+    static constexpr size_t maxKeptHandles = 64;
+
+    nixlBackendEngine *engine = nullptr;
+    nixlBackendEngine *selectedBackend = nullptr;
+    nixl_backend_choice_t backendChoice = nixl_backend_choice_t::SINGLE_CANDIDATE;
+
+    const std::string remoteAgent;
+    const nixl_xfer_op_t backendOp;
+    nixl_opt_b_args_t optArgs;
+    bool skipDescMerge = false;
+
+    nixl_meta_dlist_t initiatorDescs;
+    nixl_meta_dlist_t targetDescs;
+    // Offsets by which all descriptors of a copy can be shifted and stay in their registered
+    // regions, so copies are validated without a lookup per descriptor
+    int64_t minLocalOffset = std::numeric_limits<int64_t>::min();
+    int64_t maxLocalOffset = std::numeric_limits<int64_t>::max();
+    int64_t minRemoteOffset = std::numeric_limits<int64_t>::min();
+    int64_t maxRemoteOffset = std::numeric_limits<int64_t>::max();
+    size_t totalBytes = 0;
+
+    // Requests made from the plan and not released yet
+    std::atomic<size_t> numReqs{0};
+
+    std::mutex handlesMutex_;
+    std::vector<std::pair<int, nixlBackendReqH *>> handles_;
+};
+
+// Prepared descriptor list. Only the first candidate backend that can resolve the descriptors
+// is populated by prepXferDlist, the others are populated on first use by makeXferReq, so
+// backends that are never selected cost neither memory nor preparation time.
+class nixlDlistH {
+public:
+    using backends_t = std::vector<nixlBackendEngine *>;
+
+    nixlDlistH(const std::string &remote_agent,
+               backends_t &&backends,
+               std::unique_ptr<nixl_meta_dlist_t> first_descs);
+
+    nixlDlistH(const nixlDlistH &) = delete;
+    void
+    operator=(const nixlDlistH &) = delete;
+
+    // Candidate backends in preference order, starting with the populated one
+    [[nodiscard]] const backends_t &
+    getBackends() const noexcept {
+        return backends_;
+    }
+
+    // Descriptors resolved for backend, populated from section on first use. Null if the
+    // backend is not a candidate or lacks the required registrations.
+    [[nodiscard]] const nixl_meta_dlist_t *
+    getDescs(nixlBackendEngine *backend, const nixlMemSection &section) const;
 
     const std::string remoteAgent; // Empty means "local".
-    const descs_t descs;
+
+private:
+    struct lazyDescs {
+        std::once_flag once;
+        std::unique_ptr<nixl_meta_dlist_t> descs;
+    };
+
+    const backends_t backends_;
+    const std::unique_ptr<nixl_meta_dlist_t> firstDescs_;
+    // Parallel to backends_[1:]
+    const std::unique_ptr<lazyDescs[]> lazyDescs_;
 };
 
 #endif
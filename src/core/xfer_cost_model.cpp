@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "xfer_cost_model.h"
+
+#include <algorithm>
+
+#include "backend/backend_engine.h"
+
+void
+nixlXferCostModel::record(const nixlBackendEngine *engine,
+                          size_t bytes,
+                          chrono_period_us_t duration) {
+    // The duration of a backend that is never selected by cost says nothing about transports
+    if (engine->explicitSelectionOnly()) {
+        return;
+    }
+
+    const double x = static_cast<double>(bytes);
+    const double y = static_cast<double>(duration.count());
+
+    const std::lock_guard lock(lock_);
+    fit &f = fits_[engine];
+    f.weight = f.weight * kDecay + 1;
+    f.sumX = f.sumX * kDecay + x;
+    f.sumY = f.sumY * kDecay + y;
+    f.sumXX = f.sumXX * kDecay + x * x;
+    f.sumXY = f.sumXY * kDecay + x * y;
+    f.samples++;
+    f.lastRecord = ++records_;
+}
+
+std::optional<double>
+nixlXferCostModel::predict(const nixlBackendEngine *engine, size_t bytes) const {
+    const std::lock_guard lock(lock_);
+    const auto it = fits_.find(engine);
+    if ((it == fits_.end()) || (it->second.samples < kMinSamples)) {
+        return std::nullopt;
+    }
+
+    const fit &f = it->second;
+    const double mean_x = f.sumX / f.weight;
+    const double mean_y = f.sumY / f.weight;
+    const double var_x = f.sumXX / f.weight - mean_x * mean_x;
+
+    // Without enough spread in the sizes the slope is noise, so fall back to a pure
+    // bandwidth model through the origin. Same if the fit yields a negative slope.
+    double slope = (mean_x > 0) ? (mean_y / mean_x) : 0;
+    double latency = (mean_x > 0) ? 0 : mean_y;
+    if (var_x > 1e-6 * mean_x * mean_x) {
+        const double fit_slope = (f.sumXY / f.weight - mean_x * mean_y) / var_x;
+        if (fit_slope >= 0) {
+            slope = fit_slope;
+            latency = std::max(mean_y - fit_slope * mean_x, 0.0);
+        }
+    }
+
+    return latency + slope * static_cast<double>(bytes);
+}
+
+std::optional<size_t>
+nixlXferCostModel::explore(const std::vector<const nixlBackendEngine *> &engines) {
+    const std::lock_guard lock(lock_);
+    std::optional<size_t> oldest;
+    uint64_t oldest_record = UINT64_MAX;
+    bool all_fitted = true;
+    for (size_t i = 0; i < engines.size(); ++i) {
+        if (engines[i]->explicitSelectionOnly()) {
+            continue;
+        }
+        const auto it = fits_.find(engines[i]);
+        const uint64_t last_record = (it == fits_.end()) ? 0 : it->second.lastRecord;
+        if ((it == fits_.end()) || (it->second.samples < kMinSamples)) {
+            all_fitted = false;
+        }
+        if (last_record < oldest_record) {
+            oldest = i;
+            oldest_record = last_record;
+        }
+    }
+
+    if (!all_fitted) {
+        exploreInterval_ = kExploreInterval;
+    }
+    if (++selections_ < exploreInterval_) {
+        return std::nullopt;
+    }
+
+    selections_ = 0;
+    if (all_fitted) {
+        exploreInterval_ = std::min(exploreInterval_ * 2, kMaxExploreInterval);
+    }
+    return oldest;
+}
@@ -0,0 +1,81 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_XFER_COST_MODEL_H
+#define NIXL_SRC_CORE_XFER_COST_MODEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "nixl_types.h"
+
+class nixlBackendEngine;
+
+// Learned per-backend cost table, fed from completed transfers. Each backend keeps an
+// exponentially decayed least squares fit of duration = latency + bytes / bandwidth, so recent
+// transfers dominate and the estimate follows changes in load or topology. Only the selected
+// backend gets samples, so a share of the selections is spent on the backend sampled least
+// recently: backends without a fit get one, and the fits of losing backends do not go stale.
+// That share shrinks once every candidate has a fit, and is restored when one lacks it.
+// Backends only used when named get neither samples nor explored selections.
+class nixlXferCostModel {
+public:
+    // Samples needed before a backend's fit is used for selection
+    static constexpr size_t kMinSamples = 4;
+    // Weight kept by the history on every new sample
+    static constexpr double kDecay = 0.95;
+    // One selection in this many goes to the backend sampled least recently, while a candidate
+    // has no fit. Once all have one, the interval doubles after each exploration up to the max.
+    static constexpr size_t kExploreInterval = 8;
+    static constexpr size_t kMaxExploreInterval = 1024;
+
+    void
+    record(const nixlBackendEngine *engine, size_t bytes, chrono_period_us_t duration);
+
+    // Predicted duration in microseconds, if the backend has enough samples
+    [[nodiscard]] std::optional<double>
+    predict(const nixlBackendEngine *engine, size_t bytes) const;
+
+    // Counts a selection among engines, and once the explore interval is reached returns the
+    // index of the engine sampled least recently, to be selected instead of the predicted best
+    [[nodiscard]] std::optional<size_t>
+    explore(const std::vector<const nixlBackendEngine *> &engines);
+
+private:
+    struct fit {
+        double weight = 0;
+        double sumX = 0;
+        double sumY = 0;
+        double sumXX = 0;
+        double sumXY = 0;
+        size_t samples = 0;
+        // Value of records_ at the last sample
+        uint64_t lastRecord = 0;
+    };
+
+    mutable std::mutex lock_;
+    std::unordered_map<const nixlBackendEngine *, fit> fits_;
+    uint64_t records_ = 0;
+    size_t exploreInterval_ = kExploreInterval;
+    // Selections since the last exploration
+    size_t selections_ = 0;
+};
+
+#endif
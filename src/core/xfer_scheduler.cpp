@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "xfer_scheduler.h"
+
+#include <algorithm>
+
+#include "common/nixl_log.h"
+#include "telemetry.h"
+#include "transfer_request.h"
+
+namespace {
+// Bucket depth when a limit does not set one, in the amount posted over this period
+constexpr double kDefaultBurstSec = 0.01;
+
+[[nodiscard]] size_t
+classIndex(nixl_traffic_class_t traffic_class) {
+    return static_cast<size_t>(traffic_class);
+}
+
+[[nodiscard]] std::string
+limitStr(const nixlRateLimit &limit) {
+    std::string str;
+    if (limit.bytesPerSec > 0) {
+        str = std::to_string(limit.bytesPerSec) + " B/s";
+    }
+    if (limit.opsPerSec > 0) {
+        str += (str.empty() ? "" : " and ") + std::to_string(limit.opsPerSec) + " op/s";
+    }
+    return str;
+}
+
+[[nodiscard]] bool
+isBlocked(const std::vector<const nixlRateLimiter *> &blocked, const nixlRateLimiter *limiter) {
+    return std::find(blocked.begin(), blocked.end(), limiter) != blocked.end();
+}
+} // namespace
+
+nixlTokenBucket::nixlTokenBucket(uint64_t rate, uint64_t depth, chrono_point_t now)
+    : rate_(static_cast<double>(rate)),
+      depth_(depth ? static_cast<double>(depth) :
+                     std::max(static_cast<double>(rate) * kDefaultBurstSec, 1.0)),
+      tokens_(depth_),
+      last_(now) {}
+
+void
+nixlTokenBucket::refill(chrono_point_t now) {
+    if (now <= last_) {
+        return;
+    }
+    const std::chrono::duration<double> elapsed = now - last_;
+    tokens_ = std::min(tokens_ + elapsed.count() * rate_, depth_);
+    last_ = now;
+}
+
+bool
+nixlTokenBucket::admits(uint64_t amount, chrono_point_t now) {
+    refill(now);
+    return tokens_ >= std::min(static_cast<double>(amount), depth_);
+}
+
+void
+nixlTokenBucket::take(uint64_t amount) {
+    tokens_ -= static_cast<double>(amount);
+}
+
+nixlRateLimiter::nixlRateLimiter(const nixlRateLimit &limit, chrono_point_t now) {
+    if (limit.bytesPerSec > 0) {
+        bytes_.emplace(limit.bytesPerSec, limit.burstBytes, now);
+    }
+    if (limit.opsPerSec > 0) {
+        ops_.emplace(limit.opsPerSec, limit.burstOps, now);
+    }
+}
+
+bool
+nixlRateLimiter::admits(uint64_t bytes, uint64_t ops, chrono_point_t now) {
+    return (!bytes_ || bytes_->admits(bytes, now)) && (!ops_ || ops_->admits(ops, now));
+}
+
+void
+nixlRateLimiter::take(uint64_t bytes, uint64_t ops) {
+    if (bytes_) {
+        bytes_->take(bytes);
+    }
+    if (ops_) {
+        ops_->take(ops);
+    }
+}
+
+nixlXferScheduler::nixlXferScheduler(const nixlAgentConfig &config, nixlTelemetry *telemetry)
+    : telemetry_(telemetry) {
+    const chrono_point_t now = std::chrono::steady_clock::now();
+    for (const auto &[traffic_class, limit] : config.trafficClassLimits) {
+        if (!nixlRateLimiter::isLimited(limit)) {
+            continue;
+        }
+        classLimiters_[classIndex(traffic_class)].emplace(limit, now);
+        NIXL_DEBUG << "Pacing traffic class " << nixlEnumStrings::trafficClassStr(traffic_class)
+                   << " to " << limitStr(limit);
+    }
+    for (const auto &[backend, limit] : config.backendLimits) {
+        if (!nixlRateLimiter::isLimited(limit)) {
+            continue;
+        }
+        backendLimiters_.try_emplace(backend, limit, now);
+        NIXL_DEBUG << "Pacing backend " << backend << " to " << limitStr(limit);
+    }
+    for (const auto &[agent, limit] : config.remoteAgentLimits) {
+        if (!nixlRateLimiter::isLimited(limit)) {
+            continue;
+        }
+        agentLimiters_.try_emplace(agent, limit, now);
+        NIXL_DEBUG << "Pacing transfers to agent " << agent << " to " << limitStr(limit);
+    }
+}
+
+bool
+nixlXferScheduler::hasLimits(const nixlAgentConfig &config) {
+    const auto any_limited = [](const auto &limits) {
+        return std::any_of(limits.begin(), limits.end(), [](const auto &entry) {
+            return nixlRateLimiter::isLimited(entry.second);
+        });
+    };
+    return any_limited(config.trafficClassLimits) || any_limited(config.backendLimits) ||
+        any_limited(config.remoteAgentLimits);
+}
+
+nixlXferScheduler::limiters_t
+nixlXferScheduler::resolve(const nixlXferReqH *req) {
+    limiters_t limiters{};
+    auto &class_limiter = classLimiters_[classIndex(req->trafficClass)];
+    if (class_limiter) {
+        limiters[0] = &*class_limiter;
+    }
+    const auto backend_it = backendLimiters_.find(req->engine->getType());
+    if (backend_it != backendLimiters_.end()) {
+        limiters[1] = &backend_it->second;
+    }
+    const auto agent_it = agentLimiters_.find(req->remoteAgent);
+    if (agent_it != agentLimiters_.end()) {
+        limiters[2] = &agent_it->second;
+    }
+    return limiters;
+}
+
+bool
+nixlXferScheduler::tryAdmit(const queuedReq &entry,
+                            std::vector<const nixlRateLimiter *> &blocked,
+                            chrono_point_t now) {
+    // A request past its deadline is shed by post, it does not take tokens
+    if (entry.req->deadline && (now >= *entry.req->deadline)) {
+        return true;
+    }
+
+    // The limits that refuse the request hold back the requests behind it in this pass, so
+    // each limit admits its requests in order. The other limits stay open to them.
+    bool admitted = true;
+    for (nixlRateLimiter *limiter : entry.limiters) {
+        if (!limiter) {
+            continue;
+        }
+        if (isBlocked(blocked, limiter)) {
+            admitted = false;
+        } else if (!limiter->admits(entry.bytes, entry.ops, now)) {
+            blocked.push_back(limiter);
+            admitted = false;
+        }
+    }
+    if (!admitted) {
+        return false;
+    }
+
+    for (nixlRateLimiter *limiter : entry.limiters) {
+        if (limiter) {
+            limiter->take(entry.bytes, entry.ops);
+        }
+    }
+    return true;
+}
+
+void
+nixlXferScheduler::drain(const post_fn_t &post, const nixlXferReqH *submitted) {
+    const chrono_point_t now = std::chrono::steady_clock::now();
+    std::vector<const nixlRateLimiter *> blocked;
+    for (auto &queue : queues_) {
+        for (auto it = queue.begin(); it != queue.end();) {
+            if (!tryAdmit(*it, blocked, now)) {
+                // Every request of the queue shares its class limit
+                if (it->limiters[0] && isBlocked(blocked, it->limiters[0])) {
+                    break;
+                }
+                ++it;
+                continue;
+            }
+
+            const queuedReq entry = *it;
+            it = queue.erase(it);
+            entry.req->queued = false;
+            if (telemetry_ && (entry.req != submitted)) {
+                telemetry_->addThrottleTime(
+                    std::chrono::duration_cast<std::chrono::microseconds>(now - entry.queuedAt),
+                    {entry.req->engine->getType(), entry.req->remoteAgent});
+            }
+            post(entry.req);
+            numQueued_--;
+        }
+    }
+    reportQueued();
+}
+
+void
+nixlXferScheduler::reportQueued() {
+    if (telemetry_ && (numQueued_ != reportedQueued_)) {
+        reportedQueued_ = numQueued_;
+        telemetry_->updateThrottledRequests(reportedQueued_);
+    }
+}
+
+bool
+nixlXferScheduler::submit(nixlXferReqH *req, const post_fn_t &post) {
+    const limiters_t limiters = resolve(req);
+    if (std::all_of(limiters.begin(), limiters.end(), [](const nixlRateLimiter *limiter) {
+            return limiter == nullptr;
+        })) {
+        post(req);
+        return true;
+    }
+
+    uint64_t bytes = 0;
+    for (const auto &desc : req->initiatorDescs) {
+        bytes += desc.len;
+    }
+    const uint64_t ops = req->initiatorDescs.descCount();
+
+    const std::lock_guard lock(lock_);
+    queues_[classIndex(req->trafficClass)].push_back(
+        {req, bytes, ops, limiters, std::chrono::steady_clock::now()});
+    req->queued = true;
+    numQueued_++;
+    drain(post, req);
+    return !req->queued;
+}
+
+bool
+nixlXferScheduler::progress(const nixlXferReqH *req, const post_fn_t &post) {
+    if (numQueued_ == 0) {
+        return false;
+    }
+
+    const std::lock_guard lock(lock_);
+    drain(post, nullptr);
+    return req->queued;
+}
+
+bool
+nixlXferScheduler::isQueued(const nixlXferReqH *req) {
+    if (numQueued_ == 0) {
+        return false;
+    }
+
+    const std::lock_guard lock(lock_);
+    return req->queued;
+}
+
+bool
+nixlXferScheduler::remove(nixlXferReqH *req) {
+    if (numQueued_ == 0) {
+        return false;
+    }
+
+    const std::lock_guard lock(lock_);
+    if (!req->queued) {
+        return false;
+    }
+
+    auto &queue = queues_[classIndex(req->trafficClass)];
+    queue.erase(std::find_if(queue.begin(), queue.end(), [req](const queuedReq &entry) {
+        return entry.req == req;
+    }));
+    req->queued = false;
+    numQueued_--;
+    reportQueued();
+    return true;
+}
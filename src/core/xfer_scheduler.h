@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_CORE_XFER_SCHEDULER_H
+#define NIXL_SRC_CORE_XFER_SCHEDULER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "nixl_params.h"
+#include "nixl_types.h"
+
+class nixlTelemetry;
+
+// Bucket refilled at a constant rate up to its depth. A take larger than the depth is admitted
+// once the bucket is full and leaves it in debt, so the average rate holds for any size.
+class nixlTokenBucket {
+public:
+    nixlTokenBucket(uint64_t rate, uint64_t depth, chrono_point_t now);
+
+    [[nodiscard]] bool
+    admits(uint64_t amount, chrono_point_t now);
+
+    void
+    take(uint64_t amount);
+
+private:
+    void
+    refill(chrono_point_t now);
+
+    const double rate_;
+    const double depth_;
+    double tokens_;
+    chrono_point_t last_;
+};
+
+// Byte and operation buckets of one rate limit
+class nixlRateLimiter {
+public:
+    nixlRateLimiter(const nixlRateLimit &limit, chrono_point_t now);
+
+    [[nodiscard]] static bool
+    isLimited(const nixlRateLimit &limit) {
+        return (limit.bytesPerSec > 0) || (limit.opsPerSec > 0);
+    }
+
+    [[nodiscard]] bool
+    admits(uint64_t bytes, uint64_t ops, chrono_point_t now);
+
+    void
+    take(uint64_t bytes, uint64_t ops);
+
+private:
+    std::optional<nixlTokenBucket> bytes_;
+    std::optional<nixlTokenBucket> ops_;
+};
+
+// Paces the posts of transfer requests by the rate limits of their traffic class, backend and
+// remote agent. A request is posted once all of its limits admit it, requests without limits
+// bypass the scheduler. Requests held back are queued and posted by later calls, in class
+// priority order and in order per limit.
+class nixlXferScheduler {
+public:
+    using post_fn_t = std::function<void(nixlXferReqH *)>;
+
+    // Telemetry is optional, when given the throttle state is reported to it
+    nixlXferScheduler(const nixlAgentConfig &config, nixlTelemetry *telemetry);
+
+    [[nodiscard]] static bool
+    hasLimits(const nixlAgentConfig &config);
+
+    // Posts req through post if its limits admit it now, otherwise queues it and returns false
+    [[nodiscard]] bool
+    submit(nixlXferReqH *req, const post_fn_t &post);
+
+    // Posts the queued requests admitted by now and tells whether req is still queued
+    [[nodiscard]] bool
+    progress(const nixlXferReqH *req, const post_fn_t &post);
+
+    [[nodiscard]] bool
+    isQueued(const nixlXferReqH *req);
+
+    // Takes req out of its queue, false if it was not queued
+    [[nodiscard]] bool
+    remove(nixlXferReqH *req);
+
+private:
+    static constexpr size_t kNumClasses = 3;
+
+    // Limiters of the class, backend and remote agent of a request, null when not limited
+    using limiters_t = std::array<nixlRateLimiter *, 3>;
+
+    struct queuedReq {
+        nixlXferReqH *req;
+        uint64_t bytes;
+        uint64_t ops;
+        limiters_t limiters;
+        chrono_point_t queuedAt;
+    };
+
+    [[nodiscard]] limiters_t
+    resolve(const nixlXferReqH *req);
+
+    [[nodiscard]] static bool
+    tryAdmit(const queuedReq &entry,
+             std::vector<const nixlRateLimiter *> &blocked,
+             chrono_point_t now);
+
+    void
+    drain(const post_fn_t &post, const nixlXferReqH *submitted);
+
+    void
+    reportQueued();
+
+    // Only filled by the constructor, so lookups need no lock. Buckets are used under lock_.
+    std::array<std::optional<nixlRateLimiter>, kNumClasses> classLimiters_;
+    std::unordered_map<nixl_backend_t, nixlRateLimiter> backendLimiters_;
+    std::unordered_map<std::string, nixlRateLimiter> agentLimiters_;
+    nixlTelemetry *const telemetry_;
+
+    std::mutex lock_;
+    std::array<std::deque<queuedReq>, kNumClasses> queues_;
+    size_t reportedQueued_ = 0;
+    // Read without the lock so that polls skip it while nothing is queued, only decreased
+    // once a dequeued request is posted
+    std::atomic<size_t> numQueued_{0};
+};
+
+#endif
@@ -137,9 +137,17 @@ class nixlMemSection {
         const backend_set_t *
         queryBackends(nixl_mem_t mem) const noexcept;
 
+        // When regions is given, it receives the registered region covering each descriptor
         nixl_status_t populate (const nixl_xfer_dlist_t &query,
                                 nixlBackendEngine* backend,
-                                nixl_meta_dlist_t &resp) const;
+                                nixl_meta_dlist_t &resp,
+                                std::vector<nixlBasicDesc> *regions = nullptr) const;
+
+        // Same as above, re-resolving a list already populated for another backend
+        nixl_status_t
+        populate(const nixl_meta_dlist_t &query,
+                 nixlBackendEngine *backend,
+                 nixl_meta_dlist_t &resp) const;
 
         [[nodiscard]] nixl_status_t
         addElement(const nixlRemoteDesc &query,
@@ -148,12 +156,75 @@ class nixlMemSection {
 };
 
 
+/**
+ * @brief Backend registrations of a local section, reused for later regions they cover
+ *
+ * A registration is refcounted by the regions using it, and should only be deregistered
+ * from the backend once its last region is removed. Lookups walk back from the query
+ * address, bounded by the longest registration of the device.
+ */
+class nixlRegCache {
+public:
+    struct entry {
+        nixlBasicDesc region;
+        nixlBackendMD *metadataP = nullptr;
+        nixl_blob_t metaBlob;
+        nixl_blob_t metaInfo;
+        size_t refs = 0;
+    };
+
+    // Registration covering the region with the same metaInfo, or nullptr
+    [[nodiscard]] entry *
+    findCovering(const nixlBlobDesc &region);
+
+    // Adds a backend registration of the region, without any region using it yet
+    entry &
+    insert(const nixlBlobDesc &region, nixlBackendMD *metadata, nixl_blob_t meta_blob);
+
+    void
+    acquire(const nixlBasicDesc &region, entry &reg);
+
+    // Drops the reference of a region to the registration with the given metadata, false if
+    // the region does not use any. unused is set when it was the last reference, to
+    // deregister it from the backend before erasing it, and to nullptr otherwise.
+    [[nodiscard]] bool
+    release(const nixlBasicDesc &region, const nixlBackendMD *metadata, const entry *&unused);
+
+    void
+    erase(const entry &reg);
+
+    template<typename Func>
+    void
+    forEach(Func &&func) const {
+        for (const auto &[region, reg] : entries_) {
+            func(reg);
+        }
+    }
+
+    [[nodiscard]] bool
+    isEmpty() const noexcept {
+        return entries_.empty();
+    }
+
+private:
+    std::multimap<nixlBasicDesc, entry> entries_;
+    // Regions using each registration, a region registered twice appears twice
+    std::multimap<nixlBasicDesc, entry *> users_;
+    std::unordered_map<uint64_t, size_t> maxLen_;
+};
+
 class nixlLocalSection : public nixlMemSection {
+    private:
+        std::map<section_key_t, nixlRegCache> regCache_;
+
     public:
+        // Regions covered by an existing registration of the same backend reuse it, when
+        // cache_hits is given it is increased by their number
         nixl_status_t
         addDescList(const nixl_reg_dlist_t &mem_elms,
                     nixlBackendEngine *backend,
-                    nixlSecDescList &remote_self);
+                    nixlSecDescList &remote_self,
+                    size_t *cache_hits = nullptr);
 
         // Each nixlBasicDesc should be same as original registration region
         nixl_status_t remDescList (const nixl_reg_dlist_t &mem_elms,
@@ -179,8 +250,12 @@ class nixlRemoteSection : public nixlMemSection {
     public:
         explicit nixlRemoteSection(std::string agent_name) noexcept;
 
-        nixl_status_t loadRemoteData (nixlSerDes* deserializer,
-                                      backend_map_t &backendToEngineMap);
+        // Sections of backends without an entry in connInfos, the backends that loaded the
+        // connection info of the remote agent, are skipped
+        nixl_status_t
+        loadRemoteData(nixlSerDes *deserializer,
+                       backend_map_t &backendToEngineMap,
+                       const std::unordered_map<nixl_backend_t, nixl_blob_t> &connInfos);
 
         // When adding self as a remote agent for local operations
         nixl_status_t
@@ -173,6 +173,7 @@ nixlDescList<T>::nixlDescList(nixlSerDes* deserializer) {
     } else if (std::is_same<nixlBlobDesc, T>::value) {
         if (str!="nixlSDList")
             return;
+        descs.reserve(n_desc);
         for (size_t i=0; i<n_desc; ++i) {
             str = deserializer->getStr("");
             // If size is proper, deserializer cannot fail
@@ -181,8 +182,7 @@ nixlDescList<T>::nixlDescList(nixlSerDes* deserializer) {
                 descs.clear();
                 return;
             }
-            T elm(str);
-            descs.push_back(elm);
+            descs.emplace_back(str);
         }
     } else {
         return; // Unknown type, error
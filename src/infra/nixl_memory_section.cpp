@@ -17,12 +17,14 @@
 #include <map>
 #include <algorithm>
 #include <iostream>
+#include <thread>
 #include "nixl.h"
 #include "nixl_descriptors.h"
 #include "mem_section.h"
 #include "backend/backend_engine.h"
 #include "nixl_types.h"
 #include "serdes/serdes.h"
+#include "common/nixl_log.h"
 
 /*** Class nixlMemSection implementation ***/
 
@@ -52,22 +54,20 @@ nixlMemSection::queryBackends(const nixl_mem_t mem) const noexcept {
     return &memToBackend[mem];
 }
 
-nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
-                                        nixlBackendEngine* backend,
-                                        nixl_meta_dlist_t &resp) const {
-
-    if ((query.getType() != resp.getType()) || (query.isEmpty())) {
-        return NIXL_ERR_INVALID_PARAM;
-    }
-
-    const section_key_t sec_key(query.getType(), backend);
-    const auto it = sectionMap.find(sec_key);
-    if (it == sectionMap.end()) {
-        return NIXL_ERR_NOT_FOUND;
-    }
+namespace {
 
-    const nixlSecDescList &base = it->second;
+// Query can be any desc list whose elements are nixlBasicDesc, e.g. a transfer list, or a list
+// already populated for another backend whose metadata is replaced.
+template<typename queryT>
+nixl_status_t
+populateFromBase(const queryT &query,
+                 const nixlSecDescList &base,
+                 nixl_meta_dlist_t &resp,
+                 std::vector<nixlBasicDesc> *regions = nullptr) {
     resp.resize(query.descCount());
+    if (regions) {
+        regions->resize(query.descCount());
+    }
 
     int size = base.descCount();
     int s_index = 0;
@@ -80,6 +80,9 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
     }
     static_cast<nixlBasicDesc &>(resp[0]) = query[0];
     resp[0].metadataP = base[s_index].metadataP;
+    if (regions) {
+        (*regions)[0] = base[s_index];
+    }
 
     // Walk forward for non-decreasing elements; logN search on temporal disorder
     for (int i = 1; i < query.descCount(); ++i) {
@@ -101,10 +104,51 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
 
         static_cast<nixlBasicDesc &>(resp[i]) = query[i];
         resp[i].metadataP = base[s_index].metadataP;
+        if (regions) {
+            (*regions)[i] = base[s_index];
+        }
     }
     return NIXL_SUCCESS;
 }
 
+} // namespace
+
+nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
+                                        nixlBackendEngine* backend,
+                                        nixl_meta_dlist_t &resp,
+                                        std::vector<nixlBasicDesc> *regions) const {
+
+    if ((query.getType() != resp.getType()) || (query.isEmpty())) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    const section_key_t sec_key(query.getType(), backend);
+    const auto it = sectionMap.find(sec_key);
+    if (it == sectionMap.end()) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    return populateFromBase(query, it->second, resp, regions);
+}
+
+nixl_status_t
+nixlMemSection::populate(const nixl_meta_dlist_t &query,
+                         nixlBackendEngine *backend,
+                         nixl_meta_dlist_t &resp) const {
+
+    if ((query.getType() != resp.getType()) || (query.isEmpty())) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    const section_key_t sec_key(query.getType(), backend);
+    const auto it = sectionMap.find(sec_key);
+    if (it == sectionMap.end()) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    return populateFromBase(query, it->second, resp);
+}
+
 nixl_status_t
 nixlMemSection::addElement(const nixlRemoteDesc &query,
                            nixlBackendEngine *backend,
@@ -126,13 +170,89 @@ nixlMemSection::addElement(const nixlRemoteDesc &query,
     return NIXL_SUCCESS;
 }
 
+/*** Class nixlRegCache implementation ***/
+
+nixlRegCache::entry *
+nixlRegCache::findCovering(const nixlBlobDesc &region) {
+    const auto max_len = maxLen_.find(region.devId);
+    if ((max_len == maxLen_.end()) || (region.len > max_len->second)) {
+        return nullptr;
+    }
+
+    // Walk back from the last registration starting at or before the region, the ones
+    // starting further than the longest registration can't reach its end
+    auto it = entries_.upper_bound(nixlBasicDesc(region.addr, SIZE_MAX, region.devId));
+    while (it != entries_.begin()) {
+        --it;
+        const nixlBasicDesc &reg = it->first;
+        if ((reg.devId != region.devId) || (region.addr - reg.addr > max_len->second - region.len))
+            break;
+        if (reg.covers(region) && (it->second.metaInfo == region.metaInfo)) {
+            return &it->second;
+        }
+    }
+    return nullptr;
+}
+
+nixlRegCache::entry &
+nixlRegCache::insert(const nixlBlobDesc &region, nixlBackendMD *metadata, nixl_blob_t meta_blob) {
+    // Not lowered on erase, a stale bound only makes lookups walk further
+    size_t &max_len = maxLen_[region.devId];
+    max_len = std::max(max_len, region.len);
+
+    const nixlBasicDesc &key = region;
+    const auto it = entries_.emplace(
+        key, entry{key, metadata, std::move(meta_blob), region.metaInfo, 0});
+    return it->second;
+}
+
+void
+nixlRegCache::acquire(const nixlBasicDesc &region, entry &reg) {
+    ++reg.refs;
+    users_.emplace(region, &reg);
+}
+
+bool
+nixlRegCache::release(const nixlBasicDesc &region,
+                      const nixlBackendMD *metadata,
+                      const entry *&unused) {
+    const auto [begin, end] = users_.equal_range(region);
+    if (begin == end) {
+        return false;
+    }
+
+    // A region registered twice might use two different registrations
+    auto it = std::find_if(
+        begin, end, [metadata](const auto &user) { return user.second->metadataP == metadata; });
+    if (it == end) {
+        it = begin;
+    }
+
+    entry *reg = it->second;
+    users_.erase(it);
+    unused = (--reg->refs == 0) ? reg : nullptr;
+    return true;
+}
+
+void
+nixlRegCache::erase(const entry &reg) {
+    const auto [begin, end] = entries_.equal_range(reg.region);
+    for (auto it = begin; it != end; ++it) {
+        if (&it->second == &reg) {
+            entries_.erase(it);
+            return;
+        }
+    }
+}
+
 /*** Class nixlLocalSection implementation ***/
 
 // Calls into backend engine to register the memories in the desc list
 nixl_status_t
 nixlLocalSection::addDescList(const nixl_reg_dlist_t &mem_elms,
                               nixlBackendEngine *backend,
-                              nixlSecDescList &remote_self) {
+                              nixlSecDescList &remote_self,
+                              size_t *cache_hits) {
 
     if (!backend) {
         return NIXL_ERR_INVALID_PARAM;
@@ -141,11 +261,47 @@ nixlLocalSection::addDescList(const nixl_reg_dlist_t &mem_elms,
     const nixl_mem_t nixl_mem = mem_elms.getType();
 
     nixlSecDescList &target = emplace(nixl_mem, backend);
+    nixlRegCache &cache = regCache_[section_key_t(nixl_mem, backend)];
+
+    // Storage registrations might hold per registration state, only memory is reused.
+    // Partial overlaps are registered again, as splitting them would change the metadata
+    // of regions that are already shared with remote agents.
+    const bool reuse = (nixl_mem == DRAM_SEG) || (nixl_mem == VRAM_SEG);
+    std::vector<nixlRegCache::entry *> hits(mem_elms.descCount(), nullptr);
+    size_t num_hits = 0;
+    if (reuse) {
+        for (int i = 0; i < mem_elms.descCount(); ++i) {
+            hits[i] = cache.findCovering(mem_elms[i]);
+            num_hits += (hits[i] != nullptr);
+        }
+    }
 
-    nixlSectionDesc local_sec, self_sec;
-    nixlBasicDesc *lp = &local_sec;
-    nixlBasicDesc *rp = &self_sec;
+    nixl_reg_dlist_t misses(nixl_mem);
+    if (num_hits > 0) {
+        for (int i = 0; i < mem_elms.descCount(); ++i) {
+            if (!hits[i]) {
+                misses.addDesc(mem_elms[i]);
+            }
+        }
+    }
+    const nixl_reg_dlist_t &to_register = (num_hits > 0) ? misses : mem_elms;
+
+    std::vector<nixlBackendMD *> registered;
     nixl_status_t ret = NIXL_SUCCESS;
+    if (!to_register.isEmpty()) {
+        ret = backend->registerMems(to_register, registered);
+        if (ret != NIXL_SUCCESS) {
+            return ret;
+        }
+    }
+    if (registered.size() != static_cast<size_t>(to_register.descCount())) {
+        NIXL_ERROR << "Backend " << backend->getType() << " registered " << registered.size()
+                   << " out of " << to_register.descCount() << " memories";
+        for (nixlBackendMD *meta : registered) {
+            backend->deregisterMem(meta);
+        }
+        return NIXL_ERR_BACKEND;
+    }
 
     // Accumulate entries into batches, then merge on success
     std::vector<nixlSectionDesc> local_batch;
@@ -155,33 +311,38 @@ nixlLocalSection::addDescList(const nixl_reg_dlist_t &mem_elms,
         self_batch.reserve(mem_elms.descCount());
     }
 
-    for (const auto &mem : mem_elms) {
-        // TODO: For now trusting the user, but there can be a more checks mode
-        //       where we find overlaps and split the memories or warn the user
-        ret = backend->registerMem(mem, nixl_mem, local_sec.metadataP);
-        if (ret != NIXL_SUCCESS)
-            break;
+    nixlSectionDesc local_sec, self_sec;
+    nixlBasicDesc *lp = &local_sec;
+    nixlBasicDesc *rp = &self_sec;
+    size_t next_reg = 0;
+
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
+        if (hits[i]) {
+            local_sec.metadataP = hits[i]->metadataP;
+            local_sec.metaBlob = hits[i]->metaBlob;
+        } else {
+            local_sec.metadataP = registered[next_reg++];
+            local_sec.metaBlob.clear();
+        }
 
         if (backend->supportsLocal()) {
             ret = backend->loadLocalMD(local_sec.metadataP, self_sec.metadataP);
             if (ret != NIXL_SUCCESS) {
-                backend->deregisterMem(local_sec.metadataP);
                 break;
             }
         }
-        if (backend->supportsRemote()) {
+        if (!hits[i] && backend->supportsRemote()) {
             ret = backend->getPublicData(local_sec.metadataP, local_sec.metaBlob);
             if (ret != NIXL_SUCCESS) {
                 // A backend might use the same object for both initiator/target
                 // side of a transfer, so no need for unloadMD in that case.
                 if (backend->supportsLocal() && self_sec.metadataP != local_sec.metadataP)
                     backend->unloadMD(self_sec.metadataP);
-                backend->deregisterMem(local_sec.metadataP);
                 break;
             }
         }
 
-        *lp = mem; // Copy the basic desc part
+        *lp = mem_elms[i]; // Copy the basic desc part
         if (((nixl_mem == BLK_SEG) || (nixl_mem == OBJ_SEG) ||
              (nixl_mem == FILE_SEG)) && (lp->len==0))
             lp->len = SIZE_MAX; // File has no range limit
@@ -194,21 +355,32 @@ nixlLocalSection::addDescList(const nixl_reg_dlist_t &mem_elms,
         }
     }
 
-    if (ret == NIXL_SUCCESS) {
-        target.addDescs(std::move(local_batch));
-        if (backend->supportsLocal()) {
-            remote_self.addDescs(std::move(self_batch));
+    if (ret != NIXL_SUCCESS) {
+        for (size_t j = 0; j < self_batch.size(); ++j) {
+            if (self_batch[j].metadataP != local_batch[j].metadataP)
+                backend->unloadMD(self_batch[j].metadataP);
         }
-    } else {
-        for (size_t j = 0; j < local_batch.size(); ++j) {
-            if (backend->supportsLocal()) {
-                if (self_batch[j].metadataP != local_batch[j].metadataP)
-                    backend->unloadMD(self_batch[j].metadataP);
-            }
-            backend->deregisterMem(local_batch[j].metadataP);
+        for (nixlBackendMD *meta : registered) {
+            backend->deregisterMem(meta);
         }
+        return ret;
     }
-    return ret;
+
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
+        nixlRegCache::entry &reg = hits[i] ?
+            *hits[i] :
+            cache.insert(mem_elms[i], local_batch[i].metadataP, local_batch[i].metaBlob);
+        cache.acquire(mem_elms[i], reg);
+    }
+    if (cache_hits) {
+        *cache_hits += num_hits;
+    }
+
+    target.addDescs(std::move(local_batch));
+    if (backend->supportsLocal()) {
+        remote_self.addDescs(std::move(self_batch));
+    }
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
@@ -233,15 +405,25 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
             return NIXL_ERR_NOT_FOUND;
     }
 
+    nixlRegCache &cache = regCache_[sec_key];
     for (auto & elm : mem_elms) {
         int index = target.getIndex(elm);
         // Already checked, elm should always be found. Can add a check in debug mode.
-        backend->deregisterMem(target[index].metadataP);
+        // The backend registration is only released with the last region using it.
+        const nixlRegCache::entry *unused = nullptr;
+        if (!cache.release(elm, target[index].metadataP, unused)) {
+            NIXL_ERROR << "No registration found for a registered region of backend "
+                       << backend->getType();
+        } else if (unused) {
+            backend->deregisterMem(unused->metadataP);
+            cache.erase(*unused);
+        }
         target.remDesc(index);
     }
 
     if (target.isEmpty()) {
         sectionMap.erase(sec_key); // Invalidates target.
+        regCache_.erase(sec_key);
         // Note that sectionMap contains one entry per memory type and backend pair,
         // wherefore each backend can only have been inserted once into a memory type
         // specific memToBackend and we can now erase it when the sectionMap entry
@@ -337,11 +519,10 @@ nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
 }
 
 nixlLocalSection::~nixlLocalSection() {
-    for (auto &[sec_key, dlist] : sectionMap) {
+    // Every registered region uses one of the cached registrations, deregistered once here
+    for (auto &[sec_key, cache] : regCache_) {
         nixlBackendEngine* eng = sec_key.second;
-        for (auto &elm : dlist) {
-            eng->deregisterMem(elm.metadataP);
-        }
+        cache.forEach([eng](const nixlRegCache::entry &reg) { eng->deregisterMem(reg.metadataP); });
     }
 }
 
@@ -350,6 +531,35 @@ nixlLocalSection::~nixlLocalSection() {
 nixlRemoteSection::nixlRemoteSection(std::string agent_name) noexcept
     : agentName(std::move(agent_name)) {}
 
+namespace {
+
+// Below this many descriptors per thread, starting the threads costs more than they save
+constexpr size_t kMinDescsPerLoadThread = 4096;
+
+size_t
+loadThreadCount(size_t num_descs) {
+    const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::clamp(num_descs / kMinDescsPerLoadThread, size_t(1), max_threads);
+}
+
+// Calls func(begin, end, chunk) for equal chunks of [0, count), the first one inline
+template<typename Func>
+void
+forEachChunk(size_t count, size_t num_chunks, size_t chunk_size, Func &&func) {
+    std::vector<std::thread> workers;
+    workers.reserve(num_chunks - 1);
+    for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+        const size_t begin = chunk * chunk_size;
+        workers.emplace_back(func, begin, std::min(begin + chunk_size, count), chunk);
+    }
+    func(0, std::min(chunk_size, count), 0);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace
+
 nixl_status_t nixlRemoteSection::addDescList (
                                  const nixl_reg_dlist_t& mem_elms,
                                  nixlBackendEngine* backend) {
@@ -364,34 +574,106 @@ nixl_status_t nixlRemoteSection::addDescList (
 
     nixlSecDescList &target = emplace(nixl_mem, backend);
 
-    // Add entries to the target list.
-    nixlSectionDesc out;
-    nixlBasicDesc *p = &out;
-    nixl_status_t ret;
-    for (int i=0; i<mem_elms.descCount(); ++i) {
+    // Entries already loaded are only checked, the new ones are loaded into a separate
+    // batch that is merged into the target list at once
+    std::vector<int> new_elms;
+    new_elms.reserve(mem_elms.descCount());
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
         // TODO: Can add overlap checks (erroneous)
-        int idx = target.getIndex(mem_elms[i]);
+        const int idx = target.getIndex(mem_elms[i]);
         if (idx < 0) {
-            ret = backend->loadRemoteMD(mem_elms[i], nixl_mem, agentName, out.metadataP);
-            // In case of errors, no need to remove the previous entries
-            // Agent will delete the full object.
-            if (ret<0)
-                return ret;
-            *p = mem_elms[i]; // Copy the basic desc part
-            out.metaBlob = mem_elms[i].metaInfo;
-            target.addDesc(out);
-        } else {
-            const nixl_blob_t &prev_meta_info = target[idx].metaBlob;
+            new_elms.push_back(i);
+        } else if (target[idx].metaBlob != mem_elms[i].metaInfo) {
             // TODO: Support metadata updates
-            if (prev_meta_info != mem_elms[i].metaInfo)
+            return NIXL_ERR_NOT_ALLOWED;
+        }
+    }
+    if (new_elms.empty()) {
+        return NIXL_SUCCESS;
+    }
+
+    // Backends that allow it load large lists on several threads, each sorting its chunk
+    const size_t count = new_elms.size();
+    const size_t num_chunks =
+        backend->supportsConcurrentLoadMD() ? loadThreadCount(count) : 1;
+    const size_t chunk_size = (count + num_chunks - 1) / num_chunks;
+    std::vector<nixlSectionDesc> batch(count);
+    std::vector<nixl_status_t> chunk_ret(num_chunks, NIXL_SUCCESS);
+
+    forEachChunk(count, num_chunks, chunk_size, [&](size_t begin, size_t end, size_t chunk) {
+        for (size_t k = begin; k < end; ++k) {
+            const nixlBlobDesc &elm = mem_elms[new_elms[k]];
+            nixlBackendMD *md = nullptr;
+            const nixl_status_t ret = backend->loadRemoteMD(elm, nixl_mem, agentName, md);
+            if (ret < 0) {
+                chunk_ret[chunk] = ret;
+                return;
+            }
+            static_cast<nixlBasicDesc &>(batch[k]) = elm;
+            batch[k].metadataP = md;
+            batch[k].metaBlob = elm.metaInfo;
+        }
+        // Lists serialized from a local section are already sorted
+        if (!std::is_sorted(batch.begin() + begin, batch.begin() + end)) {
+            std::sort(batch.begin() + begin, batch.begin() + end);
+        }
+    });
+
+    const auto unload_batch = [&]() {
+        for (auto &elm : batch) {
+            if (elm.metadataP) {
+                backend->unloadMD(elm.metadataP);
+            }
+        }
+    };
+
+    for (const nixl_status_t ret : chunk_ret) {
+        if (ret != NIXL_SUCCESS) {
+            unload_batch();
+            return ret;
+        }
+    }
+
+    // Merge the sorted chunks pairwise
+    for (size_t width = chunk_size; width < count; width *= 2) {
+        for (size_t lo = 0; lo + width < count; lo += 2 * width) {
+            std::inplace_merge(batch.begin() + lo,
+                               batch.begin() + lo + width,
+                               batch.begin() + std::min(lo + 2 * width, count));
+        }
+    }
+
+    // A descriptor repeated in the list is loaded once, as long as its metadata matches
+    size_t kept = 0;
+    for (size_t k = 0; k < count; ++k) {
+        if ((kept > 0) &&
+            (static_cast<const nixlBasicDesc &>(batch[kept - 1]) ==
+             static_cast<const nixlBasicDesc &>(batch[k]))) {
+            if (batch[kept - 1].metaBlob != batch[k].metaBlob) {
+                unload_batch();
                 return NIXL_ERR_NOT_ALLOWED;
+            }
+            backend->unloadMD(batch[k].metadataP);
+            batch[k].metadataP = nullptr;
+            continue;
         }
+        if (kept != k) {
+            batch[kept] = std::move(batch[k]);
+            batch[k].metadataP = nullptr;
+        }
+        ++kept;
     }
+    batch.resize(kept);
+
+    target.addDescs(std::move(batch), nixlSecDescList::order::SORTED);
     return NIXL_SUCCESS;
 }
 
 nixl_status_t
-nixlRemoteSection::loadRemoteData(nixlSerDes *deserializer, backend_map_t &backendToEngineMap) {
+nixlRemoteSection::loadRemoteData(
+    nixlSerDes *deserializer,
+    backend_map_t &backendToEngineMap,
+    const std::unordered_map<nixl_backend_t, nixl_blob_t> &connInfos) {
     nixl_status_t ret;
     size_t seg_count;
 
@@ -413,8 +695,9 @@ nixlRemoteSection::loadRemoteData(nixlSerDes *deserializer, backend_map_t &backe
             return NIXL_ERR_NOT_FOUND;
         }
 
+        // A backend that cannot reach the remote agent must not be selected for it
         const auto it = backendToEngineMap.find(nixl_backend);
-        if (it != backendToEngineMap.end()) {
+        if ((it != backendToEngineMap.end()) && (connInfos.count(nixl_backend) != 0)) {
             ret = addDescList(s_desc, it->second.get());
             if (ret != NIXL_SUCCESS) {
                 return ret;
@@ -26,17 +26,45 @@
 #include "common/nixl_log.h"
 #include "file/file_utils.h"
 
-#define NUM_CQES 1024
 #define HF3FS_DEFAULT_IOPOOL_SIZE 64
 #define HF3FS_MAX_IOPOOL_SIZE (1 << 20)
+#define HF3FS_DEFAULT_REACTOR_THREADS 1
+#define HF3FS_MAX_REACTOR_THREADS 64
+#define HF3FS_DEFAULT_IOR_POOL_SIZE 16
+#define HF3FS_DEFAULT_IOR_ENTRIES 1024
+#define HF3FS_DEFAULT_IOV_POOL_SIZE_MB 256
 
 long nixlHf3fsEngine::page_size = sysconf(_SC_PAGESIZE);
 
+namespace {
+// Read a positive integer custom parameter, keeping the default when absent or invalid
+unsigned int
+getPositiveParam(const nixlBackendInitParams *init_params,
+                 const std::string &key,
+                 unsigned int def_val) {
+    if (!init_params || !init_params->customParams ||
+        init_params->customParams->count(key) == 0) {
+        return def_val;
+    }
+    int value = atoi(init_params->customParams->at(key).c_str());
+    return value > 0 ? value : def_val;
+}
+} // namespace
+
 nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
+    : nixlHf3fsEngine(init_params, hf3fsNativeUsrbio()) {}
+
+nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params,
+                                 std::shared_ptr<hf3fsUsrbio> usrbio)
     : nixlBackendEngine(init_params),
       mem_config(NIXL_HF3FS_MEM_CONFIG_AUTO),
-      iopool_size(HF3FS_DEFAULT_IOPOOL_SIZE) {
-    hf3fs_utils = new hf3fsUtil();
+      iopool_size(HF3FS_DEFAULT_IOPOOL_SIZE),
+      ior_pool_size(getPositiveParam(init_params, "ior_pool_size", HF3FS_DEFAULT_IOR_POOL_SIZE)),
+      ior_entries(getPositiveParam(init_params, "ior_entries", HF3FS_DEFAULT_IOR_ENTRIES)),
+      iov_pool_max_bytes(size_t(getPositiveParam(
+                             init_params, "iov_pool_size_mb", HF3FS_DEFAULT_IOV_POOL_SIZE_MB))
+                         << 20) {
+    hf3fs_utils = new hf3fsUtil(std::move(usrbio));
 
     this->initErr = false;
     if (hf3fs_utils->openHf3fsDriver() == NIXL_ERR_BACKEND) {
@@ -77,15 +105,11 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
         }
     }
 
-    char mount_point_cstr[256];
-    auto ret = hf3fs_extract_mount_point(mount_point_cstr, 256, mount_point.c_str());
-    if (ret < 0) {
+    if (hf3fs_utils->extractMountPoint(mount_point) != NIXL_SUCCESS) {
         this->initErr = true;
         return;
     }
 
-    hf3fs_utils->mount_point = mount_point_cstr;
-
     for (unsigned int i = 0; i < iopool_size; i++) {
         auto io = new nixlHf3fsIO();
         if (io == NULL) {
@@ -96,7 +120,18 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
         iopool.push_back(io);
     }
 
-    NIXL_DEBUG << "HF3FS: page size " << page_size << " iopool_size " << iopool_size;
+    unsigned int reactor_threads =
+        getPositiveParam(init_params, "reactor_threads", HF3FS_DEFAULT_REACTOR_THREADS);
+    if (reactor_threads > HF3FS_MAX_REACTOR_THREADS) {
+        NIXL_WARN << reactor_threads << " exceeded max reactor threads "
+                  << HF3FS_MAX_REACTOR_THREADS << ", set it to max";
+        reactor_threads = HF3FS_MAX_REACTOR_THREADS;
+    }
+    reactor = std::make_unique<nixlHf3fsReactor>(*hf3fs_utils, reactor_threads);
+
+    NIXL_DEBUG << "HF3FS: page size " << page_size << " iopool_size " << iopool_size
+               << " ior_pool_size " << ior_pool_size << " ior_entries " << ior_entries
+               << " iov_pool_max_bytes " << iov_pool_max_bytes;
 }
 
 nixlHf3fsIO *
@@ -145,6 +180,107 @@ nixlHf3fsEngine::putIOObj(nixlHf3fsIO *io) const {
     delete io;
 }
 
+nixlHf3fsIOR *
+nixlHf3fsEngine::getIOR(int num_ios, bool is_read) const {
+    if (num_ios <= ior_entries) {
+        const std::lock_guard<std::mutex> lock(ior_pool_lock);
+        auto &pool = ior_pool[is_read];
+        if (!pool.empty()) {
+            auto ior = pool.back();
+            pool.pop_back();
+            return ior;
+        }
+    }
+
+    auto ior = new nixlHf3fsIOR();
+    ior->entries = std::max(num_ios, ior_entries);
+    ior->is_read = is_read;
+    if (hf3fs_utils->createIOR(&ior->ior, ior->entries, is_read) != NIXL_SUCCESS) {
+        delete ior;
+        return nullptr;
+    }
+    return ior;
+}
+
+void
+nixlHf3fsEngine::putIOR(nixlHf3fsIOR *ior, bool reusable) const {
+    // An IOR with IOs possibly still in flight must not be handed to another request
+    if (reusable && ior->entries == ior_entries) {
+        const std::lock_guard<std::mutex> lock(ior_pool_lock);
+        auto &pool = ior_pool[ior->is_read];
+        if (pool.size() < ior_pool_size) {
+            pool.push_back(ior);
+            return;
+        }
+    }
+    hf3fs_utils->destroyIOR(&ior->ior);
+    delete ior;
+}
+
+void
+nixlHf3fsEngine::destroyIORPool() {
+    for (auto &pool : ior_pool) {
+        for (auto ior : pool) {
+            hf3fs_utils->destroyIOR(&ior->ior);
+            delete ior;
+        }
+        pool.clear();
+    }
+}
+
+nixl_status_t
+nixlHf3fsEngine::getIOV(size_t size, nixlHf3fsIO *io) const {
+    size_t capacity = std::max<size_t>(page_size, 1);
+    while (capacity < size) {
+        capacity <<= 1;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(iov_pool_lock);
+        auto it = iov_pool.find(capacity);
+        if (it != iov_pool.end() && !it->second.empty()) {
+            io->iov = it->second.back();
+            io->iov_capacity = capacity;
+            it->second.pop_back();
+            iov_pool_bytes -= capacity;
+            return NIXL_SUCCESS;
+        }
+    }
+
+    auto status = hf3fs_utils->createIOV(&io->iov, capacity, capacity);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+    io->iov_capacity = capacity;
+    return NIXL_SUCCESS;
+}
+
+void
+nixlHf3fsEngine::putIOV(nixlHf3fsIO *io, bool reusable) const {
+    if (reusable) {
+        const std::lock_guard<std::mutex> lock(iov_pool_lock);
+        if (iov_pool_bytes + io->iov_capacity <= iov_pool_max_bytes) {
+            iov_pool[io->iov_capacity].push_back(io->iov);
+            iov_pool_bytes += io->iov_capacity;
+            io->iov_capacity = 0;
+            return;
+        }
+    }
+    hf3fs_utils->destroyIOV(&io->iov);
+    io->iov_capacity = 0;
+}
+
+void
+nixlHf3fsEngine::destroyIOVPool() {
+    for (auto &[capacity, iovs] : iov_pool) {
+        for (auto &iov : iovs) {
+            hf3fs_utils->destroyIOV(&iov);
+        }
+    }
+    iov_pool.clear();
+    iov_pool_bytes = 0;
+}
+
 nixl_status_t nixlHf3fsEngine::registerMem (const nixlBlobDesc &mem,
                                             const nixl_mem_t &nixl_mem,
                                             nixlBackendMD* &out)
@@ -227,11 +363,11 @@ nixl_status_t nixlHf3fsEngine::deregisterMem (nixlBackendMD* meta)
     return NIXL_SUCCESS;
 }
 
-void nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle) const
-{
+void
+nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle, bool reusable) const {
     for (auto prev_io : handle->io_list) {
         if (prev_io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
-            hf3fs_utils->destroyIOV(&prev_io->iov);
+            putIOV(prev_io, reusable);
         }
         putIOObj(prev_io);
     }
@@ -239,20 +375,6 @@ void nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle) const
     handle->io_list.clear();
 }
 
-void nixlHf3fsEngine::cleanupIOThread(nixlHf3fsBackendReqH *handle) const
-{
-    if (handle->io_status.thread != nullptr) {
-        handle->io_status.stop_thread = true;
-        handle->io_status.thread->join();
-
-        delete handle->io_status.thread;
-        handle->io_status.thread = nullptr;
-        handle->io_status.error_status = NIXL_SUCCESS;
-        handle->io_status.error_message = "";
-        handle->io_status.stop_thread = false;
-    }
-}
-
 nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
                                          const nixl_meta_dlist_t &local,
                                          const nixl_meta_dlist_t &remote,
@@ -292,12 +414,14 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
 
     bool is_read = (operation == NIXL_READ);
 
-    auto status = hf3fs_utils->createIOR(&hf3fs_handle->ior, file_cnt, is_read);
-    if (status != NIXL_SUCCESS) {
+    hf3fs_handle->ior = getIOR(file_cnt, is_read);
+    if (hf3fs_handle->ior == nullptr) {
         delete hf3fs_handle;
-        HF3FS_LOG_RETURN(status, "Error: Failed to create IOR");
+        HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error: Failed to create IOR");
     }
 
+    nixl_status_t status;
+
     for (int i = 0; i < file_cnt; i++) {
         // Get file descriptor from the proper list
         int file_descriptor = (*file_list)[i].devId;
@@ -327,7 +451,7 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
                 goto cleanup_handle;
             }
         } else {
-            status = hf3fs_utils->createIOV(&io->iov, size, size);
+            status = getIOV(size, io);
             if (status != NIXL_SUCCESS) {
                 putIOObj(io);
                 nixl_err = status;
@@ -359,7 +483,8 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
 
 cleanup_handle:
     // Clean up previously created IOs in the list
-    cleanupIOList(hf3fs_handle);
+    cleanupIOList(hf3fs_handle, true);
+    putIOR(hf3fs_handle->ior, true);
     delete hf3fs_handle;
     HF3FS_LOG_RETURN(nixl_err, nixl_mesg);
 }
@@ -378,95 +503,41 @@ nixl_status_t nixlHf3fsEngine::postXfer (const nixl_xfer_op_t &operation,
         HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM, "Error: empty io list");
     }
 
-    if (UINT_MAX - hf3fs_handle->num_ios < hf3fs_handle->io_list.size()) {
+    if (UINT_MAX - hf3fs_handle->num_ios.load() < hf3fs_handle->io_list.size()) {
         HF3FS_LOG_RETURN(NIXL_ERR_NOT_ALLOWED, "Error: more than UINT_MAX ios");
     }
     for (auto it = hf3fs_handle->io_list.begin(); it != hf3fs_handle->io_list.end(); ++it) {
         nixlHf3fsIO* io = *it;
         void *addr = (io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) ? io->iov.base : io->addr;
 
-        status = hf3fs_utils->prepIO(
-            &hf3fs_handle->ior, &io->iov, addr, io->offset, io->size, io->fd, io->is_read, io);
+        status = hf3fs_utils->prepIO(&hf3fs_handle->ior->ior,
+                                     &io->iov,
+                                     addr,
+                                     io->offset,
+                                     io->size,
+                                     io->fd,
+                                     io->is_read,
+                                     io);
         if (status != NIXL_SUCCESS) {
             HF3FS_LOG_RETURN(status, "Error: Failed to prepare IO");
         }
     }
 
-    status = hf3fs_utils->postIOR(&hf3fs_handle->ior);
+    // Account for the IOs before submitting so the reactor never sees more completions than ios
+    const uint32_t num_ios = hf3fs_handle->io_list.size();
+    hf3fs_handle->num_ios.fetch_add(num_ios, std::memory_order_release);
+
+    status = hf3fs_utils->postIOR(&hf3fs_handle->ior->ior);
     if (status != NIXL_SUCCESS) {
+        hf3fs_handle->num_ios.fetch_sub(num_ios, std::memory_order_release);
         HF3FS_LOG_RETURN(status, "Error: Failed to post IOR");
     }
 
-    // postXfer may be called multiple times, so we need to check if the thread is already running
-    if (hf3fs_handle->io_status.thread == nullptr) {
-        hf3fs_handle->io_status.thread = new std::thread(waitForIOsThread, hf3fs_handle,
-                                                         hf3fs_utils);
-        if (hf3fs_handle->io_status.thread == nullptr) {
-            HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error: Failed to create io thread");
-        }
-    }
-
-    hf3fs_handle->num_ios += hf3fs_handle->io_list.size();
+    reactor->watch(hf3fs_handle);
 
     return NIXL_IN_PROG;
 }
 
-void nixlHf3fsEngine::waitForIOsThread(void* handle, void *utils)
-{
-    nixlHf3fsBackendReqH* hf3fs_handle = (nixlHf3fsBackendReqH*)handle;
-    hf3fsUtil* hf3fs_utils = (hf3fsUtil*)utils;
-    nixlH3fsThreadStatus* io_status = &hf3fs_handle->io_status;
-    hf3fs_cqe* cqes = new hf3fs_cqe[NUM_CQES];
-
-    while (!io_status->stop_thread && io_status->error_status == NIXL_SUCCESS) {
-        // Check if we've processed all IOs
-        if (hf3fs_handle->completed_ios >= hf3fs_handle->num_ios) {
-            // User may call postXfer multiple times, so we could not exit yet,
-            // so we must wait for stop condition
-            sched_yield();
-            continue;
-        }
-
-        // Use a short timeout to allow thread to check stop condition
-        struct timespec ts;
-        clock_gettime(CLOCK_MONOTONIC, &ts);
-        ts.tv_nsec += 10 * 1000 * 1000; // 10 milliseconds
-        if (ts.tv_nsec >= 1000000000) {
-            ts.tv_sec += 1;
-            ts.tv_nsec -= 1000000000;
-        }
-
-        int num_completed = 0;
-        nixl_status_t status = hf3fs_utils->waitForIOs(&hf3fs_handle->ior, cqes, NUM_CQES, 1, &ts,
-                                                       &num_completed);
-        if (status != NIXL_SUCCESS) {
-            io_status->error_status = status;
-            io_status->error_message = "Error: Failed to wait for IOs";
-            break;
-        }
-
-        if (num_completed > 0) {
-            for (int i = 0; i < num_completed; i++) {
-                if (cqes[i].result < 0) {
-                    io_status->error_status = NIXL_ERR_BACKEND;
-                    io_status->error_message = absl::StrFormat(
-                        "Error: I/O operation completed with error: %d", cqes[i].result);
-                    break;
-                }
-
-                nixlHf3fsIO* io = (nixlHf3fsIO*)cqes[i].userdata;
-                if (io->is_read && io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
-                    memcpy(io->addr, io->iov.base, io->size);
-                }
-
-                hf3fs_handle->completed_ios++;
-            }
-        }
-    }
-
-    delete[] cqes;
-}
-
 nixl_status_t nixlHf3fsEngine::checkXfer(nixlBackendReqH* handle) const
 {
     if (handle == nullptr) {
@@ -476,28 +547,29 @@ nixl_status_t nixlHf3fsEngine::checkXfer(nixlBackendReqH* handle) const
     nixlHf3fsBackendReqH *hf3fs_handle = (nixlHf3fsBackendReqH *) handle;
 
     // Check if IOR is initialized
-    if (&hf3fs_handle->ior == nullptr) {
+    if (hf3fs_handle->ior == nullptr) {
         HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
             "Error: IOR is not initialized in checkXfer");
     }
 
-    if (hf3fs_handle->io_status.thread == nullptr) {
+    if (hf3fs_handle->num_ios.load(std::memory_order_acquire) == 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
-            "Error: io thread is not initialized in checkXfer");
+            "Error: no IOs were posted in checkXfer");
     }
 
-    if (hf3fs_handle->io_status.error_status != NIXL_SUCCESS) {
-        nixl_status_t error_status = hf3fs_handle->io_status.error_status;
-        std::string error_message = hf3fs_handle->io_status.error_message;
-        cleanupIOThread(hf3fs_handle);
+    nixl_status_t error_status = hf3fs_handle->error_status.load(std::memory_order_acquire);
+    if (error_status != NIXL_SUCCESS) {
+        reactor->unwatch(hf3fs_handle);
+        std::string error_message = std::move(hf3fs_handle->error_message);
+        hf3fs_handle->error_status.store(NIXL_SUCCESS, std::memory_order_relaxed);
         HF3FS_LOG_RETURN(error_status, error_message);
     }
 
-    if (hf3fs_handle->completed_ios < hf3fs_handle->num_ios) {
+    if (hf3fs_handle->completed_ios.load(std::memory_order_acquire) <
+        hf3fs_handle->num_ios.load(std::memory_order_relaxed)) {
         return NIXL_IN_PROG;
     }
 
-    cleanupIOThread(hf3fs_handle);
     return NIXL_SUCCESS;
 }
 
@@ -505,14 +577,23 @@ nixl_status_t nixlHf3fsEngine::releaseReqH(nixlBackendReqH* handle) const
 {
     nixlHf3fsBackendReqH *hf3fs_handle = (nixlHf3fsBackendReqH *) handle;
 
-    cleanupIOThread(hf3fs_handle);
-    cleanupIOList(hf3fs_handle);
-    hf3fs_utils->destroyIOR(&hf3fs_handle->ior);
+    reactor->unwatch(hf3fs_handle);
+
+    // Buffers of a request that failed or was released early may still be referenced by 3FS
+    const bool reusable =
+        hf3fs_handle->error_status.load(std::memory_order_acquire) == NIXL_SUCCESS &&
+        hf3fs_handle->completed_ios.load(std::memory_order_acquire) ==
+            hf3fs_handle->num_ios.load(std::memory_order_relaxed);
+    cleanupIOList(hf3fs_handle, reusable);
+    putIOR(hf3fs_handle->ior, reusable);
     delete hf3fs_handle;
     return NIXL_SUCCESS;
 }
 
 nixlHf3fsEngine::~nixlHf3fsEngine() {
+    reactor.reset();
+    destroyIORPool();
+    destroyIOVPool();
     destroyIOPool();
     hf3fs_utils->closeHf3fsDriver();
     delete hf3fs_utils;
@@ -23,10 +23,14 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include "common/uuid_v4.h"
+#include <atomic>
 #include <list>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
-#include <thread>
+#include <vector>
 #include "hf3fs_utils.h"
+#include "hf3fs_reactor.h"
 #include "backend/backend_engine.h"
 
 class nixlHf3fsShmException : public std::runtime_error {
@@ -80,6 +84,7 @@ public:
 class nixlHf3fsIO {
     public:
         hf3fs_iov iov;
+        size_t iov_capacity = 0; // Capacity of a pooled IOV, 0 if the IOV wraps user memory
         int fd = -1;
         void *addr = nullptr; // Start address to read from/write to
         size_t size = 0; // Size of the buffer
@@ -90,23 +95,25 @@ class nixlHf3fsIO {
         nixlHf3fsIO() = default;
 };
 
-class nixlH3fsThreadStatus {
+class nixlHf3fsIOR {
     public:
-        std::thread *thread = nullptr;
-        nixl_status_t error_status = NIXL_SUCCESS;
-        std::string error_message = "";
-        bool stop_thread = false;
-
-        nixlH3fsThreadStatus() = default;
+        hf3fs_ior ior;
+        int entries = 0;
+        bool is_read = false;
 };
 
 class nixlHf3fsBackendReqH : public nixlBackendReqH {
     public:
         std::list<nixlHf3fsIO *> io_list;
-        hf3fs_ior ior;
-        uint32_t completed_ios = 0; // Number of completed IOs
-        uint32_t num_ios = 0; // Number of submitted IOs
-        nixlH3fsThreadStatus io_status;
+        nixlHf3fsIOR *ior = nullptr;
+        std::atomic<uint32_t> completed_ios{0}; // Number of completed IOs, set by the reactor
+        std::atomic<uint32_t> num_ios{0}; // Number of submitted IOs
+        std::atomic<nixl_status_t> error_status{NIXL_SUCCESS};
+        std::string error_message; // Valid once error_status is set
+
+        // Reactor bookkeeping, protected by the reactor shard lock
+        int reactor_shard = -1;
+        bool in_reactor = false;
 
         nixlHf3fsBackendReqH() = default;
 };
@@ -123,6 +130,20 @@ class nixlHf3fsEngine : public nixlBackendEngine {
         mutable std::list<nixlHf3fsIO *> iopool;
         unsigned int iopool_size;
 
+        // IORs with ior_entries capacity are pooled per direction and reused across requests
+        mutable std::mutex ior_pool_lock;
+        mutable std::vector<nixlHf3fsIOR *> ior_pool[2];
+        unsigned int ior_pool_size;
+        int ior_entries;
+
+        // Bounce-buffer IOVs for non-shared DRAM, keyed by power-of-two capacity
+        mutable std::mutex iov_pool_lock;
+        mutable std::unordered_map<size_t, std::vector<hf3fs_iov>> iov_pool;
+        mutable size_t iov_pool_bytes = 0;
+        size_t iov_pool_max_bytes;
+
+        std::unique_ptr<nixlHf3fsReactor> reactor;
+
         nixlHf3fsIO *
         getFromIOPool() const;
         bool
@@ -134,11 +155,27 @@ class nixlHf3fsEngine : public nixlBackendEngine {
         void
         putIOObj(nixlHf3fsIO *io) const;
 
-        void cleanupIOList(nixlHf3fsBackendReqH *handle) const;
-        void cleanupIOThread(nixlHf3fsBackendReqH *handle) const;
-        static void waitForIOsThread(void* handle, void *utils);
+        nixlHf3fsIOR *
+        getIOR(int num_ios, bool is_read) const;
+        void
+        putIOR(nixlHf3fsIOR *ior, bool reusable) const;
+        void
+        destroyIORPool();
+        nixl_status_t
+        getIOV(size_t size, nixlHf3fsIO *io) const;
+        void
+        putIOV(nixlHf3fsIO *io, bool reusable) const;
+        void
+        destroyIOVPool();
+
+        void
+        cleanupIOList(nixlHf3fsBackendReqH *handle, bool reusable) const;
+
     public:
         nixlHf3fsEngine(const nixlBackendInitParams* init_params);
+        // Build the engine on top of a caller-provided usrbio implementation, e.g. a mock
+        nixlHf3fsEngine(const nixlBackendInitParams *init_params,
+                        std::shared_ptr<hf3fsUsrbio> usrbio);
         ~nixlHf3fsEngine();
 
         // File operations - target is the distributed FS
@@ -0,0 +1,193 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hf3fs_reactor.h"
+#include <algorithm>
+#include <cstring>
+#include <time.h>
+#include "hf3fs_backend.h"
+#include "hf3fs_log.h"
+#include "common/nixl_log.h"
+
+#define NUM_CQES 1024
+// Bounded wait when a reactor thread has a single request to watch
+#define HF3FS_REACTOR_WAIT_NS (1000 * 1000)
+// First wait per request after a pass over several requests made no progress; it doubles on
+// every idle pass, up to a pass of HF3FS_REACTOR_WAIT_NS in total
+#define HF3FS_REACTOR_MIN_WAIT_NS (10 * 1000)
+
+nixlHf3fsReactor::nixlHf3fsReactor(hf3fsUtil &utils, unsigned num_threads) : utils(utils) {
+    num_threads = std::max(num_threads, 1u);
+    for (unsigned i = 0; i < num_threads; i++) {
+        shards.push_back(std::make_unique<shard>());
+    }
+    for (auto &s : shards) {
+        s->thread = std::thread(&nixlHf3fsReactor::run, this, std::ref(*s));
+    }
+    NIXL_DEBUG << "HF3FS: started completion reactor with " << num_threads << " threads";
+}
+
+nixlHf3fsReactor::~nixlHf3fsReactor() {
+    for (auto &s : shards) {
+        {
+            const std::lock_guard<std::mutex> lock(s->lock);
+            s->stop = true;
+        }
+        s->work_cv.notify_all();
+    }
+    for (auto &s : shards) {
+        s->thread.join();
+    }
+}
+
+void
+nixlHf3fsReactor::watch(nixlHf3fsBackendReqH *handle) {
+    if (handle->reactor_shard < 0) {
+        handle->reactor_shard = next_shard.fetch_add(1, std::memory_order_relaxed) % shards.size();
+    }
+    shard &s = *shards[handle->reactor_shard];
+    {
+        const std::lock_guard<std::mutex> lock(s.lock);
+        if (handle->in_reactor) {
+            return;
+        }
+        handle->in_reactor = true;
+        s.active.push_back(handle);
+    }
+    s.work_cv.notify_one();
+}
+
+void
+nixlHf3fsReactor::unwatch(nixlHf3fsBackendReqH *handle) {
+    if (handle->reactor_shard < 0) {
+        return;
+    }
+    shard &s = *shards[handle->reactor_shard];
+    std::unique_lock<std::mutex> lock(s.lock);
+    remove(s, handle);
+    s.idle_cv.wait(lock, [&] { return s.current != handle; });
+}
+
+void
+nixlHf3fsReactor::remove(shard &s, nixlHf3fsBackendReqH *handle) {
+    if (!handle->in_reactor) {
+        return;
+    }
+    auto it = std::find(s.active.begin(), s.active.end(), handle);
+    *it = s.active.back();
+    s.active.pop_back();
+    handle->in_reactor = false;
+}
+
+void
+nixlHf3fsReactor::run(shard &s) {
+    std::vector<hf3fs_cqe> cqes(NUM_CQES);
+    std::unique_lock<std::mutex> lock(s.lock);
+    bool round_progress = false;
+    long idle_wait_ns = 0;
+
+    while (true) {
+        s.work_cv.wait(lock, [&] { return s.stop || !s.active.empty(); });
+        if (s.stop) {
+            break;
+        }
+
+        if (s.next >= s.active.size()) {
+            // Completed a pass over every active request; if none made progress, the next
+            // pass blocks on each request for a while instead of polling
+            s.next = 0;
+            if (round_progress) {
+                idle_wait_ns = 0;
+            } else {
+                const long max_wait_ns = std::max<long>(
+                    HF3FS_REACTOR_WAIT_NS / s.active.size(), HF3FS_REACTOR_MIN_WAIT_NS);
+                idle_wait_ns =
+                    std::min(std::max(idle_wait_ns * 2, (long)HF3FS_REACTOR_MIN_WAIT_NS),
+                             max_wait_ns);
+            }
+            round_progress = false;
+        }
+
+        nixlHf3fsBackendReqH *handle = s.active[s.next++];
+        const long wait_ns = s.active.size() == 1 ? HF3FS_REACTOR_WAIT_NS : idle_wait_ns;
+        s.current = handle;
+        lock.unlock();
+
+        const bool progressed = drain(handle, cqes, wait_ns);
+
+        lock.lock();
+        round_progress |= progressed;
+        s.current = nullptr;
+        // Re-check under the lock so a concurrent repost cannot be dropped
+        if (handle->in_reactor &&
+            (handle->error_status.load(std::memory_order_acquire) != NIXL_SUCCESS ||
+             handle->completed_ios.load(std::memory_order_relaxed) >=
+                 handle->num_ios.load(std::memory_order_acquire))) {
+            remove(s, handle);
+        }
+        s.idle_cv.notify_all();
+    }
+}
+
+bool
+nixlHf3fsReactor::drain(nixlHf3fsBackendReqH *handle,
+                        std::vector<hf3fs_cqe> &cqes,
+                        long wait_ns) {
+    if (handle->error_status.load(std::memory_order_acquire) != NIXL_SUCCESS) {
+        return false;
+    }
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const bool block = wait_ns > 0;
+    if (block) {
+        ts.tv_nsec += wait_ns;
+        if (ts.tv_nsec >= 1000000000) {
+            ts.tv_sec += 1;
+            ts.tv_nsec -= 1000000000;
+        }
+    }
+
+    int num_completed = 0;
+    nixl_status_t status = utils.waitForIOs(
+        &handle->ior->ior, cqes.data(), cqes.size(), block ? 1 : 0, &ts, &num_completed);
+    if (status != NIXL_SUCCESS) {
+        handle->error_message = "Error: Failed to wait for IOs";
+        handle->error_status.store(status, std::memory_order_release);
+        return true;
+    }
+
+    if (num_completed <= 0) {
+        return false;
+    }
+
+    for (int i = 0; i < num_completed; i++) {
+        if (cqes[i].result < 0) {
+            handle->error_message = absl::StrFormat(
+                "Error: I/O operation completed with error: %d", cqes[i].result);
+            handle->error_status.store(NIXL_ERR_BACKEND, std::memory_order_release);
+            return true;
+        }
+
+        nixlHf3fsIO *io = (nixlHf3fsIO *)cqes[i].userdata;
+        if (io->is_read && io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
+            memcpy(io->addr, io->iov.base, io->size);
+        }
+    }
+    handle->completed_ios.fetch_add(num_completed, std::memory_order_release);
+
+    return true;
+}
@@ -0,0 +1,80 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __HF3FS_REACTOR_H
+#define __HF3FS_REACTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "hf3fs_utils.h"
+
+class nixlHf3fsBackendReqH;
+
+/**
+ * @brief Completion reactor shared by all requests of an HF3FS engine.
+ *
+ * A small fixed set of threads waits on the IORs of every request with
+ * outstanding IOs and records completions on the request handles. Requests
+ * are assigned to threads round-robin on first use and stay there. A request
+ * leaves its thread once all submitted IOs have completed or an IO failed,
+ * and must be unwatched before the handle is destroyed.
+ */
+class nixlHf3fsReactor {
+public:
+    nixlHf3fsReactor(hf3fsUtil &utils, unsigned num_threads);
+    ~nixlHf3fsReactor();
+
+    nixlHf3fsReactor(const nixlHf3fsReactor &) = delete;
+    nixlHf3fsReactor &
+    operator=(const nixlHf3fsReactor &) = delete;
+
+    // Start waiting on the IOR of a handle whose IOs were just submitted
+    void
+    watch(nixlHf3fsBackendReqH *handle);
+
+    // Stop waiting on a handle; returns once no reactor thread references it
+    void
+    unwatch(nixlHf3fsBackendReqH *handle);
+
+private:
+    struct shard {
+        std::mutex lock;
+        std::condition_variable work_cv;
+        std::condition_variable idle_cv;
+        std::vector<nixlHf3fsBackendReqH *> active;
+        nixlHf3fsBackendReqH *current = nullptr;
+        size_t next = 0;
+        bool stop = false;
+        std::thread thread;
+    };
+
+    void
+    run(shard &s);
+    bool
+    drain(nixlHf3fsBackendReqH *handle, std::vector<hf3fs_cqe> &cqes, long wait_ns);
+    static void
+    remove(shard &s, nixlHf3fsBackendReqH *handle);
+
+    hf3fsUtil &utils;
+    std::vector<std::unique_ptr<shard>> shards;
+    std::atomic<unsigned> next_shard{0};
+};
+
+#endif
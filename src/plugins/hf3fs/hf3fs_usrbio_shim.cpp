@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "hf3fs_usrbio_shim.h"
+
+namespace {
+
+class hf3fsNativeUsrbioImpl : public hf3fsUsrbio {
+public:
+    int
+    extractMountPoint(char *hf3fs_mount_point, int size, const char *path) override {
+        return hf3fs_extract_mount_point(hf3fs_mount_point, size, path);
+    }
+
+    int
+    regFd(int fd, uint64_t flags) override {
+        return hf3fs_reg_fd(fd, flags);
+    }
+
+    void
+    deregFd(int fd) override {
+        hf3fs_dereg_fd(fd);
+    }
+
+    int
+    iorCreate(hf3fs_ior *ior, const char *mount_point, int entries, bool for_read, int io_depth,
+              int numa) override {
+        return hf3fs_iorcreate(ior, mount_point, entries, for_read, io_depth, numa);
+    }
+
+    void
+    iorDestroy(hf3fs_ior *ior) override {
+        hf3fs_iordestroy(ior);
+    }
+
+    int
+    iovCreate(hf3fs_iov *iov, const char *mount_point, size_t size, size_t block_size,
+              int numa) override {
+        return hf3fs_iovcreate(iov, mount_point, size, block_size, numa);
+    }
+
+    int
+    iovWrap(hf3fs_iov *iov, void *buf, const uint8_t id[16], const char *mount_point, size_t size,
+            size_t block_size, int numa) override {
+        return hf3fs_iovwrap(iov, buf, id, mount_point, size, block_size, numa);
+    }
+
+    void
+    iovDestroy(hf3fs_iov *iov) override {
+        hf3fs_iovdestroy(iov);
+    }
+
+    int
+    prepIo(const hf3fs_ior *ior, const hf3fs_iov *iov, bool read, void *ptr, int fd, size_t off,
+           uint64_t len, const void *userdata) override {
+        return hf3fs_prep_io(ior, iov, read, ptr, fd, off, len, userdata);
+    }
+
+    int
+    submitIos(const hf3fs_ior *ior) override {
+        return hf3fs_submit_ios(ior);
+    }
+
+    int
+    waitForIos(const hf3fs_ior *ior, hf3fs_cqe *cqes, int cqec, int min_results,
+               const struct timespec *abs_timeout) override {
+        return hf3fs_wait_for_ios(ior, cqes, cqec, min_results, abs_timeout);
+    }
+};
+
+} // namespace
+
+std::shared_ptr<hf3fsUsrbio>
+hf3fsNativeUsrbio() {
+    static const auto native = std::make_shared<hf3fsNativeUsrbioImpl>();
+    return native;
+}
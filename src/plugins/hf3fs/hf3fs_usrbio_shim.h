@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __HF3FS_USRBIO_SHIM_H
+#define __HF3FS_USRBIO_SHIM_H
+
+#include <cstdint>
+#include <memory>
+#include "hf3fs_usrbio.h"
+
+/**
+ * @brief Thin virtual shim over the usrbio C API.
+ *
+ * Every usrbio call made by the plugin goes through this interface so the
+ * backend can be exercised against a mock without a 3FS cluster.
+ * Methods mirror the usrbio functions one-to-one, including return conventions.
+ */
+class hf3fsUsrbio {
+public:
+    virtual ~hf3fsUsrbio() = default;
+
+    virtual int
+    extractMountPoint(char *hf3fs_mount_point, int size, const char *path) = 0;
+    virtual int
+    regFd(int fd, uint64_t flags) = 0;
+    virtual void
+    deregFd(int fd) = 0;
+    virtual int
+    iorCreate(hf3fs_ior *ior, const char *mount_point, int entries, bool for_read, int io_depth,
+              int numa) = 0;
+    virtual void
+    iorDestroy(hf3fs_ior *ior) = 0;
+    virtual int
+    iovCreate(hf3fs_iov *iov, const char *mount_point, size_t size, size_t block_size,
+              int numa) = 0;
+    virtual int
+    iovWrap(hf3fs_iov *iov, void *buf, const uint8_t id[16], const char *mount_point, size_t size,
+            size_t block_size, int numa) = 0;
+    virtual void
+    iovDestroy(hf3fs_iov *iov) = 0;
+    virtual int
+    prepIo(const hf3fs_ior *ior, const hf3fs_iov *iov, bool read, void *ptr, int fd, size_t off,
+           uint64_t len, const void *userdata) = 0;
+    virtual int
+    submitIos(const hf3fs_ior *ior) = 0;
+    virtual int
+    waitForIos(const hf3fs_ior *ior, hf3fs_cqe *cqes, int cqec, int min_results,
+               const struct timespec *abs_timeout) = 0;
+};
+
+/** @brief Return the shim that forwards to the real usrbio library. */
+std::shared_ptr<hf3fsUsrbio>
+hf3fsNativeUsrbio();
+
+#endif
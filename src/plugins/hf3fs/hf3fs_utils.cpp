@@ -24,7 +24,7 @@
 
 nixl_status_t hf3fsUtil::registerFileHandle(int fd, int *ret)
 {
-	int ret_val = hf3fs_reg_fd(fd, 0);
+	int ret_val = usrbio->regFd(fd, 0);
 	if (ret_val > 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
             absl::StrFormat("Error registering file descriptor %d, error: %d (errno: %d - %s)",
@@ -34,6 +34,21 @@ nixl_status_t hf3fsUtil::registerFileHandle(int fd, int *ret)
 	return NIXL_SUCCESS;
 }
 
+nixl_status_t
+hf3fsUtil::extractMountPoint(const std::string &path) {
+    char mount_point_cstr[256];
+    auto ret = usrbio->extractMountPoint(mount_point_cstr, sizeof(mount_point_cstr), path.c_str());
+    if (ret < 0) {
+        HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
+                         absl::StrFormat("Error extracting 3FS mount point from %s, error: %d",
+                                         path,
+                                         ret));
+    }
+
+    this->mount_point = mount_point_cstr;
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t hf3fsUtil::openHf3fsDriver()
 {
     return NIXL_SUCCESS;
@@ -46,7 +61,7 @@ void hf3fsUtil::closeHf3fsDriver()
 
 void hf3fsUtil::deregisterFileHandle(int fd)
 {
-    hf3fs_dereg_fd(fd);
+    usrbio->deregFd(fd);
 }
 
 nixl_status_t
@@ -55,7 +70,7 @@ hf3fsUtil::wrapIOV(struct hf3fs_iov *iov,
                    size_t size,
                    size_t block_size,
                    const uint8_t *id) {
-    auto ret = hf3fs_iovwrap(iov, addr, id, this->mount_point.c_str(), size, block_size, -1);
+    auto ret = usrbio->iovWrap(iov, addr, id, this->mount_point.c_str(), size, block_size, -1);
 
     if (ret < 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
@@ -68,7 +83,7 @@ hf3fsUtil::wrapIOV(struct hf3fs_iov *iov,
 
 nixl_status_t hf3fsUtil::createIOR(struct hf3fs_ior *ior, int num_ios, bool is_read)
 {
-    auto ret = hf3fs_iorcreate(ior, this->mount_point.c_str(), num_ios, is_read, 0, -1);
+    auto ret = usrbio->iorCreate(ior, this->mount_point.c_str(), num_ios, is_read, 0, -1);
     if (ret < 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
             absl::StrFormat("Error creating IOR, error: %d (errno: %d - %s)",
@@ -80,7 +95,7 @@ nixl_status_t hf3fsUtil::createIOR(struct hf3fs_ior *ior, int num_ios, bool is_r
 
 nixl_status_t
 hf3fsUtil::createIOV(struct hf3fs_iov *iov, size_t size, size_t block_size) {
-    auto ret = hf3fs_iovcreate(iov, this->mount_point.c_str(), size, block_size, -1);
+    auto ret = usrbio->iovCreate(iov, this->mount_point.c_str(), size, block_size, -1);
     if (ret < 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
             absl::StrFormat("Error creating IOV, error: %d (errno: %d - %s)",
@@ -92,7 +107,7 @@ hf3fsUtil::createIOV(struct hf3fs_iov *iov, size_t size, size_t block_size) {
 
 void hf3fsUtil::destroyIOV(struct hf3fs_iov *iov)
 {
-    hf3fs_iovdestroy(iov);
+    usrbio->iovDestroy(iov);
 }
 
 nixl_status_t validateIO(struct hf3fs_ior *ior, struct hf3fs_iov *iov, void *addr, size_t fd_offset,
@@ -136,7 +151,7 @@ nixl_status_t hf3fsUtil::prepIO(struct hf3fs_ior *ior, struct hf3fs_iov *iov, vo
         HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM, "Error: Invalid IO parameters");
     }
     // Now call the prep_io function
-    auto ret = hf3fs_prep_io(ior, iov, is_read, addr, fd, fd_offset, size, user_data);
+    auto ret = usrbio->prepIo(ior, iov, is_read, addr, fd, fd_offset, size, user_data);
     if (ret < 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
             absl::StrFormat("Error: hf3fs prep io error: %d (errno: %d - %s)",
@@ -149,7 +164,7 @@ nixl_status_t hf3fsUtil::prepIO(struct hf3fs_ior *ior, struct hf3fs_iov *iov, vo
 
 nixl_status_t hf3fsUtil::postIOR(struct hf3fs_ior *ior)
 {
-    auto ret = hf3fs_submit_ios(ior);
+    auto ret = usrbio->submitIos(ior);
     if (ret < 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
             absl::StrFormat("hf3fs submit ios error: %d (errno: %d - %s)",
@@ -161,14 +176,14 @@ nixl_status_t hf3fsUtil::postIOR(struct hf3fs_ior *ior)
 
 nixl_status_t hf3fsUtil::destroyIOR(struct hf3fs_ior *ior)
 {
-    hf3fs_iordestroy(ior);
+    usrbio->iorDestroy(ior);
     return NIXL_SUCCESS;
 }
 
 nixl_status_t hf3fsUtil::waitForIOs(struct hf3fs_ior *ior, struct hf3fs_cqe *cqes, int num_cqes,
                                     int min_cqes, struct timespec *ts, int *num_completed)
 {
-    auto ret = hf3fs_wait_for_ios(ior, cqes, num_cqes, min_cqes, ts);
+    auto ret = usrbio->waitForIos(ior, cqes, num_cqes, min_cqes, ts);
     if (ret < 0 && ret != -ETIMEDOUT && ret != -EAGAIN) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
             absl::StrFormat("Error waiting for IOs: %d (errno: %d - %s)",
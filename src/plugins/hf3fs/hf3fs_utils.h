@@ -19,8 +19,9 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <memory>
 #include <nixl.h>
-#include "hf3fs_usrbio.h"
+#include "hf3fs_usrbio_shim.h"
 
 
 
@@ -35,8 +36,11 @@ public:
 
 class hf3fsUtil {
 public:
-    hf3fsUtil() {}
+    explicit hf3fsUtil(std::shared_ptr<hf3fsUsrbio> usrbio = hf3fsNativeUsrbio())
+        : usrbio(std::move(usrbio)) {}
     ~hf3fsUtil() {}
+    nixl_status_t
+    extractMountPoint(const std::string &path);
     nixl_status_t registerFileHandle(int fd, int *ret);
     void deregisterFileHandle(int fd);
     nixl_status_t openHf3fsDriver();
@@ -54,6 +58,9 @@ public:
     nixl_status_t waitForIOs(struct hf3fs_ior *ior, struct hf3fs_cqe *cqes, int num_cqes,
                              int min_cqes, struct timespec *ts, int *num_completed);
     std::string mount_point;
+
+private:
+    std::shared_ptr<hf3fsUsrbio> usrbio;
 };
 
 #endif
@@ -959,7 +959,8 @@ nixlLibfabricEngine::estimateXferCost(const nixl_xfer_op_t &operation,
                                       std::chrono::microseconds &err_margin,
                                       nixl_cost_t &method,
                                       const nixl_opt_args_t *opt_args) const {
-    return NIXL_SUCCESS;
+    // No cost model yet. Reporting success would leave the outputs unset.
+    return NIXL_ERR_NOT_SUPPORTED;
 }
 
 nixl_status_t
@@ -0,0 +1,262 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "loopback_backend.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+
+#include <unistd.h>
+
+#include "common/nixl_log.h"
+
+namespace {
+// Engines of this process by agent name, notifications are handed over through it
+std::mutex registry_mutex;
+std::unordered_map<std::string, nixlLoopbackEngine *> registry;
+
+[[nodiscard]] std::string
+getParam(const nixl_b_params_t *params, const std::string &key) {
+    if (!params) {
+        return {};
+    }
+    const auto it = params->find(key);
+    return it == params->end() ? std::string() : it->second;
+}
+} // namespace
+
+class nixlLoopbackReqH : public nixlBackendReqH {
+public:
+    std::string remoteAgent;
+    std::chrono::steady_clock::time_point deadline;
+    bool notifPending = false;
+    nixl_blob_t notifMsg;
+};
+
+nixlLoopbackEngine::nixlLoopbackEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params) {
+    const nixl_b_params_t *params = init_params->customParams;
+
+    try {
+        const std::string latency = getParam(params, "latency_us");
+        const std::string bandwidth = getParam(params, "bandwidth_gbps");
+        latency_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::duration<double, std::micro>(latency.empty() ? 0 : std::stod(latency)));
+        bandwidthGbps_ = bandwidth.empty() ? 0 : std::stod(bandwidth);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "Invalid LOOPBACK backend parameter: " << e.what();
+        initErr = true;
+        return;
+    }
+    if (latency_.count() < 0 || bandwidthGbps_ < 0) {
+        NIXL_ERROR << "LOOPBACK backend latency and bandwidth cannot be negative";
+        initErr = true;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    if (!registry.emplace(localAgent, this).second) {
+        NIXL_WARN << "Another agent named " << localAgent
+                  << " has a LOOPBACK backend, it keeps receiving the notifications";
+    }
+}
+
+nixlLoopbackEngine::~nixlLoopbackEngine() {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    const auto it = registry.find(localAgent);
+    if (it != registry.end() && it->second == this) {
+        registry.erase(it);
+    }
+}
+
+nixl_status_t
+nixlLoopbackEngine::registerMem(const nixlBlobDesc &mem,
+                                const nixl_mem_t &nixl_mem,
+                                nixlBackendMD *&out) {
+    out = &localMD_;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::deregisterMem(nixlBackendMD *meta) {
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::getPublicData(const nixlBackendMD *meta, std::string &str) const {
+    str.clear();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::getConnInfo(std::string &str) const {
+    str = std::to_string(getpid());
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                       const std::string &remote_conn_info) {
+    // Only agents of this process can be reached, others are left to other backends
+    if (remote_conn_info != std::to_string(getpid())) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::connect(const std::string &remote_agent) {
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::disconnect(const std::string &remote_agent) {
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) {
+    output = input;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::loadRemoteMD(const nixlBlobDesc &input,
+                                 const nixl_mem_t &nixl_mem,
+                                 const std::string &remote_agent,
+                                 nixlBackendMD *&output) {
+    output = &remoteMD_;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::unloadMD(nixlBackendMD *input) {
+    return NIXL_SUCCESS;
+}
+
+std::chrono::nanoseconds
+nixlLoopbackEngine::wireTime(size_t bytes) const noexcept {
+    if (bandwidthGbps_ == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    // 1 Gbps moves one bit per nanosecond
+    return std::chrono::nanoseconds(static_cast<int64_t>(bytes * 8 / bandwidthGbps_));
+}
+
+nixl_status_t
+nixlLoopbackEngine::prepXfer(const nixl_xfer_op_t &operation,
+                             const nixl_meta_dlist_t &local,
+                             const nixl_meta_dlist_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
+    if (local.descCount() != remote.descCount()) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    for (int i = 0; i < local.descCount(); ++i) {
+        if (local[i].len != remote[i].len) {
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    auto req = std::make_unique<nixlLoopbackReqH>();
+    req->remoteAgent = remote_agent;
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::postXfer(const nixl_xfer_op_t &operation,
+                             const nixl_meta_dlist_t &local,
+                             const nixl_meta_dlist_t &remote,
+                             const std::string &remote_agent,
+                             nixlBackendReqH *&handle,
+                             const nixl_opt_b_args_t *opt_args) const {
+    auto &req = static_cast<nixlLoopbackReqH &>(*handle);
+    const bool has_notif = opt_args && opt_args->hasNotif;
+
+    if (latency_.count() == 0 && bandwidthGbps_ == 0) {
+        return has_notif ? deliver(req.remoteAgent, opt_args->notifMsg) : NIXL_SUCCESS;
+    }
+
+    size_t bytes = 0;
+    for (const auto &desc : local) {
+        bytes += desc.len;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(linkMutex_);
+        linkBusyUntil_ = std::max(now, linkBusyUntil_) + wireTime(bytes);
+        req.deadline = linkBusyUntil_ + latency_;
+    }
+    req.notifPending = has_notif;
+    req.notifMsg = has_notif ? opt_args->notifMsg : nixl_blob_t();
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlLoopbackEngine::checkXfer(nixlBackendReqH *handle) const {
+    auto &req = static_cast<nixlLoopbackReqH &>(*handle);
+    if (std::chrono::steady_clock::now() < req.deadline) {
+        return NIXL_IN_PROG;
+    }
+    if (req.notifPending) {
+        req.notifPending = false;
+        return deliver(req.remoteAgent, req.notifMsg);
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::releaseReqH(nixlBackendReqH *handle) const {
+    delete static_cast<nixlLoopbackReqH *>(handle);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::deliver(const std::string &remote_agent, const nixl_blob_t &msg) const {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    const auto it = registry.find(remote_agent);
+    if (it == registry.end()) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+    nixlLoopbackEngine &target = *it->second;
+    std::lock_guard<std::mutex> notif_lock(target.notifMutex_);
+    target.notifs_.emplace_back(localAgent, msg);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::getNotifs(notif_list_t &notif_list) {
+    std::lock_guard<std::mutex> lock(notifMutex_);
+    if (notif_list.empty()) {
+        notif_list.swap(notifs_);
+    } else {
+        std::move(notifs_.begin(), notifs_.end(), std::back_inserter(notif_list));
+        notifs_.clear();
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlLoopbackEngine::genNotif(const std::string &remote_agent, const std::string &msg) const {
+    return deliver(remote_agent, msg);
+}
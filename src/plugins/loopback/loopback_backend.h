@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_LOOPBACK_LOOPBACK_BACKEND_H
+#define NIXL_SRC_PLUGINS_LOOPBACK_LOOPBACK_BACKEND_H
+
+#include <chrono>
+#include <mutex>
+#include <string>
+
+#include "backend/backend_engine.h"
+
+// Backend that moves no data. Transfers complete instantly, or after a synthetic latency and
+// the time the bytes take on a link of the configured bandwidth, and notifications are handed
+// to the target agent's engine when it lives in the same process. It isolates the cost of the
+// agent itself (locking, populate, handles, telemetry, notification maps) from any transport.
+class nixlLoopbackEngine : public nixlBackendEngine {
+public:
+    explicit nixlLoopbackEngine(const nixlBackendInitParams *init_params);
+    ~nixlLoopbackEngine() override;
+
+    bool
+    supportsRemote() const override {
+        return true;
+    }
+
+    bool
+    supportsLocal() const override {
+        return true;
+    }
+
+    bool
+    supportsNotif() const override {
+        return true;
+    }
+
+    // Handles only hold the remote agent, the transfer size is taken at post time
+    bool
+    supportsPrepReuse() const override {
+        return true;
+    }
+
+    // Transfers report success without moving data, so they must be asked for
+    bool
+    explicitSelectionOnly() const override {
+        return true;
+    }
+
+    nixl_mem_list_t
+    getSupportedMems() const override {
+        return {DRAM_SEG, VRAM_SEG};
+    }
+
+    nixl_status_t
+    registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override;
+    nixl_status_t
+    deregisterMem(nixlBackendMD *meta) override;
+
+    nixl_status_t
+    getPublicData(const nixlBackendMD *meta, std::string &str) const override;
+    nixl_status_t
+    getConnInfo(std::string &str) const override;
+    nixl_status_t
+    loadRemoteConnInfo(const std::string &remote_agent,
+                       const std::string &remote_conn_info) override;
+
+    nixl_status_t
+    connect(const std::string &remote_agent) override;
+    nixl_status_t
+    disconnect(const std::string &remote_agent) override;
+
+    nixl_status_t
+    loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override;
+    nixl_status_t
+    loadRemoteMD(const nixlBlobDesc &input,
+                 const nixl_mem_t &nixl_mem,
+                 const std::string &remote_agent,
+                 nixlBackendMD *&output) override;
+    nixl_status_t
+    unloadMD(nixlBackendMD *input) override;
+
+    nixl_status_t
+    prepXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    nixl_status_t
+    postXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    nixl_status_t
+    checkXfer(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    releaseReqH(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    getNotifs(notif_list_t &notif_list) override;
+    nixl_status_t
+    genNotif(const std::string &remote_agent, const std::string &msg) const override;
+
+private:
+    [[nodiscard]] std::chrono::nanoseconds
+    wireTime(size_t bytes) const noexcept;
+
+    nixl_status_t
+    deliver(const std::string &remote_agent, const nixl_blob_t &msg) const;
+
+    std::chrono::nanoseconds latency_{0};
+    // Gigabits per second, 0 for an infinitely fast link
+    double bandwidthGbps_ = 0;
+
+    // All registrations share one metadata object, there is nothing to keep per region
+    nixlBackendMD localMD_{true};
+    nixlBackendMD remoteMD_{false};
+
+    // Transfers are serialized on one synthetic link
+    mutable std::mutex linkMutex_;
+    mutable std::chrono::steady_clock::time_point linkBusyUntil_;
+
+    mutable std::mutex notifMutex_;
+    notif_list_t notifs_;
+};
+
+#endif
@@ -143,3 +143,8 @@ nixl_status_t
 nixlObjEngine::releaseReqH(nixlBackendReqH *handle) const {
     return impl_->releaseReqH(handle);
 }
+
+nixl_status_t
+nixlObjEngine::cancelXfer(nixlBackendReqH *handle) const {
+    return impl_->cancelXfer(handle);
+}
@@ -19,6 +19,7 @@
 #define OBJ_BACKEND_H
 
 #include "obj_executor.h"
+#include <atomic>
 #include <optional>
 #include <string>
 #include <memory>
@@ -29,6 +30,8 @@ using put_object_callback_t = std::function<void(bool success)>;
 using get_object_callback_t = std::function<void(bool success)>;
 // std::optional<bool>: true = exists, false = not found, std::nullopt = request error
 using check_object_callback_t = std::function<void(std::optional<bool> exists)>;
+// Set to true to abort the requests it was given to, which then complete unsuccessfully
+using obj_cancel_token_t = std::shared_ptr<std::atomic<bool>>;
 
 /**
  * Abstract interface for S3 client operations.
@@ -52,13 +55,15 @@ public:
      * @param data_len Length of the data in bytes
      * @param offset Offset within the object
      * @param callback Callback function to handle the result
+     * @param cancel_token Optional token aborting the request once set
      */
     virtual void
     putObjectAsync(std::string_view key,
                    uintptr_t data_ptr,
                    size_t data_len,
                    size_t offset,
-                   put_object_callback_t callback) = 0;
+                   put_object_callback_t callback,
+                   const obj_cancel_token_t &cancel_token) = 0;
 
     /**
      * Asynchronously get an object from S3.
@@ -67,13 +72,15 @@ public:
      * @param data_len Maximum length of data to read
      * @param offset Offset within the object to start reading from
      * @param callback Callback function to handle the result
+     * @param cancel_token Optional token aborting the request once set
      */
     virtual void
     getObjectAsync(std::string_view key,
                    uintptr_t data_ptr,
                    size_t data_len,
                    size_t offset,
-                   get_object_callback_t callback) = 0;
+                   get_object_callback_t callback,
+                   const obj_cancel_token_t &cancel_token) = 0;
 
     /**
      * Asynchronously check if an object exists in S3.
@@ -123,6 +130,11 @@ public:
     checkXfer(nixlBackendReqH *handle) const = 0;
     virtual nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const = 0;
+
+    virtual nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
 };
 
 class nixlObjEngine : public nixlBackendEngine {
@@ -195,6 +207,8 @@ public:
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override;
 
     nixl_status_t
     loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override {
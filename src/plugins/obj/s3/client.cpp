@@ -64,7 +64,8 @@ awsS3Client::putObjectAsync(std::string_view key,
                             uintptr_t data_ptr,
                             size_t data_len,
                             size_t offset,
-                            put_object_callback_t callback) {
+                            put_object_callback_t callback,
+                            const obj_cancel_token_t &cancel_token) {
     if (offset != 0) {
         callback(false);
         return;
@@ -78,6 +79,7 @@ awsS3Client::putObjectAsync(std::string_view key,
     auto data_stream =
         Aws::MakeShared<Aws::IOStream>("PutObjectInputStream", preallocated_stream_buf.get());
     request.SetBody(data_stream);
+    nixl_s3_utils::setCancelHandler(request, cancel_token);
 
     s3Client_->PutObjectAsync(
         request,
@@ -96,7 +98,8 @@ awsS3Client::getObjectAsync(std::string_view key,
                             uintptr_t data_ptr,
                             size_t data_len,
                             size_t offset,
-                            get_object_callback_t callback) {
+                            get_object_callback_t callback,
+                            const obj_cancel_token_t &cancel_token) {
     auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
         "GetObjectStreamBuf", reinterpret_cast<unsigned char *>(data_ptr), data_len);
     auto stream_factory = Aws::MakeShared<Aws::IOStreamFactory>(
@@ -109,6 +112,7 @@ awsS3Client::getObjectAsync(std::string_view key,
         .WithKey(Aws::String(key))
         .WithRange(absl::StrFormat("bytes=%d-%d", offset, offset + data_len - 1));
     request.SetResponseStreamFactory(*stream_factory.get());
+    nixl_s3_utils::setCancelHandler(request, cancel_token);
 
     s3Client_->GetObjectAsync(
         request,
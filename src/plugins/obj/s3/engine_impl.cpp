@@ -55,6 +55,8 @@ public:
     ~nixlObjBackendReqH() = default;
 
     std::vector<std::future<nixl_status_t>> statusFutures_;
+    obj_cancel_token_t cancelToken_;
+    bool canceled_ = false;
 
     nixl_status_t
     getOverallStatus() {
@@ -76,6 +78,25 @@ public:
         }
         return NIXL_SUCCESS;
     }
+
+    // Aborted requests complete unsuccessfully, so wait for all of them instead of
+    // returning the first failure while others still access the buffers
+    nixl_status_t
+    getCanceledStatus() {
+        nixl_status_t status = NIXL_SUCCESS;
+        for (auto &future : statusFutures_) {
+            if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                return NIXL_IN_PROG;
+            }
+        }
+        for (auto &future : statusFutures_) {
+            if (future.get() != NIXL_SUCCESS) {
+                status = NIXL_ERR_CANCELED;
+            }
+        }
+        statusFutures_.clear();
+        return status;
+    }
 };
 
 class nixlObjMetadata : public nixlBackendMD {
@@ -284,6 +305,8 @@ DefaultObjEngineImpl::postXfer(const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
+    req_h->cancelToken_ = std::make_shared<std::atomic<bool>>(false);
+    req_h->canceled_ = false;
 
     for (int i = 0; i < local.descCount(); ++i) {
         const auto &local_desc = local[i];
@@ -316,11 +339,19 @@ DefaultObjEngineImpl::postXfer(const nixl_xfer_op_t &operation,
         };
 
         if (operation == NIXL_WRITE)
-            client->putObjectAsync(
-                obj_key_search->second, data_ptr, data_len, offset, status_callback);
+            client->putObjectAsync(obj_key_search->second,
+                                   data_ptr,
+                                   data_len,
+                                   offset,
+                                   status_callback,
+                                   req_h->cancelToken_);
         else
-            client->getObjectAsync(
-                obj_key_search->second, data_ptr, data_len, offset, status_callback);
+            client->getObjectAsync(obj_key_search->second,
+                                   data_ptr,
+                                   data_len,
+                                   offset,
+                                   status_callback,
+                                   req_h->cancelToken_);
     }
 
     return NIXL_IN_PROG;
@@ -333,9 +364,26 @@ DefaultObjEngineImpl::checkXfer(nixlBackendReqH *handle) const {
         return NIXL_ERR_INVALID_PARAM;
     }
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
+    if (req_h->canceled_) {
+        return req_h->getCanceledStatus();
+    }
     return req_h->getOverallStatus();
 }
 
+nixl_status_t
+DefaultObjEngineImpl::cancelXfer(nixlBackendReqH *handle) const {
+    if (!handle) {
+        NIXL_ERROR << "transfer request handle is null";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
+    if (req_h->cancelToken_) {
+        req_h->cancelToken_->store(true);
+    }
+    req_h->canceled_ = true;
+    return req_h->getCanceledStatus();
+}
+
 nixl_status_t
 DefaultObjEngineImpl::releaseReqH(nixlBackendReqH *handle) const {
     if (!handle) {
@@ -46,6 +46,8 @@ public:
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override;
 
 protected:
     virtual iS3Client *
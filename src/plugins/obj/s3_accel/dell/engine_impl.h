@@ -125,6 +125,18 @@ public:
     nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
 
+    /**
+     * Canceling a transfer is not supported. Overridden since the handles differ
+     * from the ones the inherited implementation expects.
+     *
+     * @param handle Transfer request handle to cancel
+     * @return NIXL_ERR_NOT_SUPPORTED
+     */
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
     /**
      * Get the list of supported memory types.
      *
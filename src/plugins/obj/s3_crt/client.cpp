@@ -68,7 +68,8 @@ awsS3CrtClient::putObjectAsync(std::string_view key,
                                uintptr_t data_ptr,
                                size_t data_len,
                                size_t offset,
-                               put_object_callback_t callback) {
+                               put_object_callback_t callback,
+                               const obj_cancel_token_t &cancel_token) {
     if (offset != 0) {
         callback(false);
         return;
@@ -85,6 +86,7 @@ awsS3CrtClient::putObjectAsync(std::string_view key,
     auto data_stream =
         Aws::MakeShared<Aws::IOStream>("PutObjectInputStream", preallocated_stream_buf.get());
     request->SetBody(data_stream);
+    nixl_s3_utils::setCancelHandler(*request, cancel_token);
 
     s3CrtClient_->PutObjectAsync(
         *request,
@@ -107,7 +109,8 @@ awsS3CrtClient::getObjectAsync(std::string_view key,
                                uintptr_t data_ptr,
                                size_t data_len,
                                size_t offset,
-                               get_object_callback_t callback) {
+                               get_object_callback_t callback,
+                               const obj_cancel_token_t &cancel_token) {
     auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
         "GetObjectStreamBuf", reinterpret_cast<unsigned char *>(data_ptr), data_len);
     auto stream_factory = Aws::MakeShared<Aws::IOStreamFactory>(
@@ -123,6 +126,7 @@ awsS3CrtClient::getObjectAsync(std::string_view key,
         .WithKey(Aws::String(key))
         .WithRange(absl::StrFormat("bytes=%d-%d", offset, offset + data_len - 1));
     request->SetResponseStreamFactory(*stream_factory.get());
+    nixl_s3_utils::setCancelHandler(*request, cancel_token);
 
     s3CrtClient_->GetObjectAsync(
         *request,
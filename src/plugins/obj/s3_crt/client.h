@@ -42,14 +42,16 @@ public:
                    uintptr_t data_ptr,
                    size_t data_len,
                    size_t offset,
-                   put_object_callback_t callback) override;
+                   put_object_callback_t callback,
+                   const obj_cancel_token_t &cancel_token) override;
 
     void
     getObjectAsync(std::string_view key,
                    uintptr_t data_ptr,
                    size_t data_len,
                    size_t offset,
-                   get_object_callback_t callback) override;
+                   get_object_callback_t callback,
+                   const obj_cancel_token_t &cancel_token) override;
 
     void
     checkObjectExistsAsync(std::string_view key, check_object_callback_t callback) override;
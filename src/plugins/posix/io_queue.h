@@ -19,6 +19,7 @@
 #define POSIX_IO_QUEUE_H
 
 #include <stdint.h>
+#include <cerrno>
 #include <list>
 #include <memory>
 #include <vector>
@@ -51,6 +52,10 @@ public:
     post(void) = 0;
     virtual nixl_status_t
     poll(void) = 0;
+    // Aborts the IOs enqueued with ctx. The ones not submitted yet are dropped and their
+    // callback gets ECANCELED, the submitted ones still complete through poll.
+    virtual nixl_status_t
+    cancel(void *ctx) = 0;
 
     static std::unique_ptr<nixlPosixIOQueue>
     instantiate(std::string_view io_queue_type, uint32_t ios_pool_size, uint32_t kernel_queue_size);
@@ -89,6 +94,22 @@ public:
     }
 
 protected:
+    void
+    dropUnsubmitted(void *ctx) {
+        for (auto it = ios_to_submit_.begin(); it != ios_to_submit_.end();) {
+            Entry *io = *it;
+            if (io->ctx_ != ctx) {
+                ++it;
+                continue;
+            }
+            it = ios_to_submit_.erase(it);
+            if (io->clb_) {
+                io->clb_(io->ctx_, 0, ECANCELED);
+            }
+            free_ios_.push_back(io);
+        }
+    }
+
     std::vector<Entry> ios_;
     std::list<Entry *> free_ios_;
     std::list<Entry *> ios_to_submit_;
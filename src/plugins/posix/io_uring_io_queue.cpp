@@ -33,6 +33,7 @@ public:
     nixlPosixIOQueueDoneCb clb_;
     void *ctx_;
     struct io_uring_sqe *sqe_;
+    bool in_flight_ = false;
 };
 
 class nixlPosixIOQueueUring : public nixlPosixIOQueueImpl<nixlPosixIoUringIO> {
@@ -51,6 +52,8 @@ public:
             void *ctx) override;
     virtual nixl_status_t
     poll(void) override;
+    virtual nixl_status_t
+    cancel(void *ctx) override;
     virtual ~nixlPosixIOQueueUring() override;
 
 protected:
@@ -97,6 +100,7 @@ nixlPosixIOQueueUring::post(void) {
         }
 
         io_uring_sqe_set_data(sqe, io);
+        io->in_flight_ = true;
     }
 
     int ret = io_uring_submit(&uring);
@@ -116,15 +120,21 @@ nixlPosixIOQueueUring::doCheckCompleted(void) {
     io_uring_for_each_cqe(&uring, head, cqe) {
         int res = cqe->res;
         nixlPosixIoUringIO *io = reinterpret_cast<nixlPosixIoUringIO *>(io_uring_cqe_get_data(cqe));
-        if (io->clb_) {
-            io->clb_(io->ctx_, res, 0);
-        }
-        free_ios_.push_back(io);
-        if (res < 0) {
-            NIXL_ERROR << absl::StrFormat("IO operation failed: %s", nixl_strerror(-res));
-            return NIXL_ERR_BACKEND;
-        }
         count++;
+        // Completions of IORING_OP_ASYNC_CANCEL requests carry no IO, the aborted IOs
+        // complete on their own with -ECANCELED or -EINTR
+        if (io) {
+            io->in_flight_ = false;
+            const bool canceled = (res == -ECANCELED) || (res == -EINTR);
+            if (io->clb_) {
+                io->clb_(io->ctx_, canceled ? 0 : res, canceled ? ECANCELED : 0);
+            }
+            free_ios_.push_back(io);
+            if (res < 0 && !canceled) {
+                NIXL_ERROR << absl::StrFormat("IO operation failed: %s", nixl_strerror(-res));
+                return NIXL_ERR_BACKEND;
+            }
+        }
         if (count == MAX_IO_CHECK_COMPLETED_BATCH_SIZE) {
             break;
         }
@@ -178,6 +188,41 @@ nixlPosixIOQueueUring::poll(void) {
     return doCheckCompleted();
 }
 
+nixl_status_t
+nixlPosixIOQueueUring::cancel(void *ctx) {
+    dropUnsubmitted(ctx);
+
+    int num_cancels = 0;
+    for (auto &io : ios_) {
+        if (!io.in_flight_ || io.ctx_ != ctx) {
+            continue;
+        }
+
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&uring);
+        if (!sqe) {
+            // The remaining IOs are not aborted and complete normally
+            NIXL_WARN << "No io_uring submission queue entry left to cancel IOs";
+            break;
+        }
+
+        io_uring_prep_cancel(sqe, &io, 0);
+        io_uring_sqe_set_data(sqe, nullptr);
+        num_cancels++;
+    }
+
+    if (num_cancels == 0) {
+        return NIXL_SUCCESS;
+    }
+
+    int ret = io_uring_submit(&uring);
+    if (ret < 0) {
+        NIXL_ERROR << "io_uring_submit of cancel requests failed: " << nixl_strerror(-ret);
+        return NIXL_ERR_BACKEND;
+    }
+
+    return NIXL_SUCCESS;
+}
+
 nixlPosixIOQueueUring::~nixlPosixIOQueueUring() {
     io_uring_queue_exit(&uring);
 }
@@ -29,6 +29,7 @@ public:
     nixlPosixIOQueueDoneCb clb_;
     void *ctx_;
     struct iocb io_;
+    bool in_flight_ = false;
 };
 
 class nixlPosixIOQueueLinuxAIO : public nixlPosixIOQueueImpl<nixlPosixLinuxAioIO> {
@@ -47,6 +48,8 @@ public:
             void *ctx) override;
     virtual nixl_status_t
     poll(void) override;
+    virtual nixl_status_t
+    cancel(void *ctx) override;
     virtual ~nixlPosixIOQueueLinuxAIO() override;
 
 protected:
@@ -130,6 +133,10 @@ nixlPosixIOQueueLinuxAIO::post(void) {
         }
     }
 
+    for (int i = 0; i < ret; i++) {
+        to_submit[i]->in_flight_ = true;
+    }
+
     for (int i = num_ios - 1; i >= ret; i--) {
         // If not submitted, push back to the front of the list
         nixlPosixLinuxAioIO *io = to_submit[i];
@@ -165,6 +172,7 @@ nixlPosixIOQueueLinuxAIO::doCheckCompleted(void) {
             return NIXL_ERR_BACKEND;
         }
 
+        io->in_flight_ = false;
         if (io->clb_) {
             io->clb_(io->ctx_, events[i].res, 0);
         }
@@ -193,6 +201,31 @@ nixlPosixIOQueueLinuxAIO::poll(void) {
     return doCheckCompleted();
 }
 
+nixl_status_t
+nixlPosixIOQueueLinuxAIO::cancel(void *ctx) {
+    dropUnsubmitted(ctx);
+
+    for (auto &io : ios_) {
+        if (!io.in_flight_ || io.ctx_ != ctx) {
+            continue;
+        }
+
+        // Most file systems do not support io_cancel, such IOs complete normally
+        struct io_event event;
+        if (io_cancel(io_ctx_, &io.io_, &event) != 0) {
+            continue;
+        }
+
+        io.in_flight_ = false;
+        if (io.clb_) {
+            io.clb_(io.ctx_, 0, ECANCELED);
+        }
+        free_ios_.push_back(&io);
+    }
+
+    return NIXL_SUCCESS;
+}
+
 std::unique_ptr<nixlPosixIOQueue>
 nixlPosixIOQueueLinuxAIOCreate(uint32_t ios_pool_size, uint32_t kernel_queue_size) {
     return std::make_unique<nixlPosixIOQueueLinuxAIO>(ios_pool_size, kernel_queue_size);
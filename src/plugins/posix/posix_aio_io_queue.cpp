@@ -47,6 +47,8 @@ public:
             void *ctx) override;
     virtual nixl_status_t
     poll(void) override;
+    virtual nixl_status_t
+    cancel(void *ctx) override;
     virtual ~nixlPosixIOQueueAIO() override;
 
 protected:
@@ -146,6 +148,13 @@ nixlPosixIOQueueAIO::doCheckCompleted(void) {
             }
             it = ios_in_flight_.erase(it);
             free_ios_.push_back(io);
+        } else if (status == ECANCELED) {
+            aio_return(&io->aio_);
+            if (io->clb_) {
+                io->clb_(io->ctx_, 0, ECANCELED);
+            }
+            it = ios_in_flight_.erase(it);
+            free_ios_.push_back(io);
         } else if (status == EINPROGRESS) {
             return NIXL_IN_PROG;
         } else {
@@ -154,8 +163,6 @@ nixlPosixIOQueueAIO::doCheckCompleted(void) {
             return NIXL_ERR_BACKEND;
         }
 
-        it++;
-
         num_ios--;
         if (num_ios == 0) {
             break;
@@ -175,6 +182,20 @@ nixlPosixIOQueueAIO::poll(void) {
     return doCheckCompleted();
 }
 
+nixl_status_t
+nixlPosixIOQueueAIO::cancel(void *ctx) {
+    dropUnsubmitted(ctx);
+
+    // Canceled IOs report ECANCELED through aio_error, the others complete normally
+    for (nixlPosixAioIO *io : ios_in_flight_) {
+        if (io->ctx_ == ctx) {
+            aio_cancel(io->aio_.aio_fildes, &io->aio_);
+        }
+    }
+
+    return NIXL_SUCCESS;
+}
+
 std::unique_ptr<nixlPosixIOQueue>
 nixlPosixIOQueueAIOCreate(uint32_t ios_pool_size, uint32_t kernel_queue_size) {
     return std::make_unique<nixlPosixIOQueueAIO>(ios_pool_size, kernel_queue_size);
@@ -188,7 +188,7 @@ nixlPosixBackendReqH::prepXfer() {
 nixl_status_t
 nixlPosixBackendReqH::checkXfer() {
     if (num_confirmed_ios_ == queue_depth_) {
-        return NIXL_SUCCESS;
+        return canceled_ ? NIXL_ERR_CANCELED : NIXL_SUCCESS;
     }
 
     nixl_status_t status = io_queue_->poll();
@@ -199,9 +199,25 @@ nixlPosixBackendReqH::checkXfer() {
     return NIXL_IN_PROG;
 }
 
+nixl_status_t
+nixlPosixBackendReqH::cancelXfer() {
+    if (num_confirmed_ios_ == queue_depth_) {
+        return checkXfer();
+    }
+
+    canceled_ = true;
+    nixl_status_t status = io_queue_->cancel(this);
+    if (status < 0) {
+        return status;
+    }
+
+    return checkXfer();
+}
+
 nixl_status_t
 nixlPosixBackendReqH::postXfer() {
     num_confirmed_ios_ = 0;
+    canceled_ = false;
 
     for (auto [local_it, remote_it] = std::make_pair(local.begin(), remote.begin());
          local_it != local.end() && remote_it != remote.end();
@@ -330,6 +346,20 @@ nixlPosixEngine::checkXfer(nixlBackendReqH *handle) const {
     return NIXL_ERR_BACKEND;
 }
 
+nixl_status_t
+nixlPosixEngine::cancelXfer(nixlBackendReqH *handle) const {
+    try {
+        auto &posix_handle = castPosixHandle(handle);
+        NIXL_LOCK_GUARD(io_queue_lock_);
+        return posix_handle.cancelXfer();
+    }
+    catch (const nixlPosixBackendReqH::exception &e) {
+        NIXL_ERROR << e.what();
+        return e.code();
+    }
+    return NIXL_ERR_BACKEND;
+}
+
 nixl_status_t
 nixlPosixEngine::releaseReqH(nixlBackendReqH *handle) const {
     try {
@@ -35,6 +35,7 @@ private:
     const nixl_meta_dlist_t &remote; // Remote memory descriptor list
     const int queue_depth_; // Queue depth for async I/O
     int num_confirmed_ios_; // Number of confirmed IOs
+    bool canceled_ = false; // Set by cancelXfer until the next post
     std::unique_ptr<nixlPosixIOQueue> &io_queue_; // Async I/O queue instance
 
     void
@@ -55,6 +56,8 @@ public:
     prepXfer();
     nixl_status_t
     checkXfer();
+    nixl_status_t
+    cancelXfer();
 
     // Exception classes
     class exception : public std::exception {
@@ -142,6 +145,8 @@ public:
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override;
 
     nixl_status_t
     queryMem(const nixl_reg_dlist_t &descs, std::vector<nixl_query_resp_t> &resp) const override;
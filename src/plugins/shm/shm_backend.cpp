@@ -0,0 +1,624 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "shm_backend.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include <limits.h>
+#include <sys/prctl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "common/nixl_log.h"
+#include "serdes/serdes.h"
+
+namespace {
+constexpr size_t default_num_threads = 4;
+constexpr size_t default_min_chunk = 1 << 20;
+constexpr uint32_t default_notif_slots = 1024;
+constexpr uint32_t default_notif_slot_size = 4096;
+constexpr auto notif_push_timeout = std::chrono::seconds(1);
+// Bounds of the sleep between attempts to push to a full notification ring
+constexpr auto notif_push_min_sleep = std::chrono::microseconds(1);
+constexpr auto notif_push_max_sleep = std::chrono::microseconds(100);
+
+struct segment {
+    uintptr_t local;
+    uintptr_t remote;
+    size_t len;
+};
+
+// Registered region as exported through getPublicData
+struct region {
+    uint64_t addr;
+    uint64_t len;
+};
+
+[[nodiscard]] size_t
+getSizeParam(const nixl_b_params_t *params, const std::string &key, size_t fallback) {
+    if (!params) {
+        return fallback;
+    }
+    const auto it = params->find(key);
+    if (it == params->end() || it->second.empty()) {
+        return fallback;
+    }
+    return std::stoul(it->second);
+}
+
+[[nodiscard]] uint32_t
+getUint32Param(const nixl_b_params_t *params, const std::string &key, uint32_t fallback) {
+    const size_t value = getSizeParam(params, key, fallback);
+    if (value > std::numeric_limits<uint32_t>::max()) {
+        throw std::out_of_range(key + " must fit in 32 bits");
+    }
+    return static_cast<uint32_t>(value);
+}
+
+[[nodiscard]] std::string
+getStrParam(const nixl_b_params_t *params, const std::string &key, const std::string &fallback) {
+    if (!params) {
+        return fallback;
+    }
+    const auto it = params->find(key);
+    return (it == params->end() || it->second.empty()) ? fallback : it->second;
+}
+
+[[nodiscard]] std::string
+readBootId() {
+    std::ifstream file("/proc/sys/kernel/random/boot_id");
+    std::string id;
+    std::getline(file, id);
+    return id;
+}
+
+[[nodiscard]] std::string
+readPidNamespace() {
+    char buf[PATH_MAX];
+    const ssize_t len = readlink("/proc/self/ns/pid", buf, sizeof(buf));
+    return len > 0 ? std::string(buf, len) : std::string();
+}
+
+[[nodiscard]] nixl_status_t
+errnoToStatus(int err) {
+    switch (err) {
+    case ESRCH:
+        return NIXL_ERR_REMOTE_DISCONNECT;
+    case EPERM:
+        NIXL_ERROR << "Cross-memory attach not permitted, the peer may need set_ptracer=1 "
+                   << "when ptrace is restricted (kernel.yama.ptrace_scope)";
+        return NIXL_ERR_NOT_ALLOWED;
+    case EFAULT:
+        return NIXL_ERR_INVALID_PARAM;
+    default:
+        return NIXL_ERR_BACKEND;
+    }
+}
+
+// Copy the segments between this process and pid, at most IOV_MAX of them per system call.
+// A partial copy resumes from the first byte not transferred.
+[[nodiscard]] nixl_status_t
+cmaCopy(pid_t pid, nixl_xfer_op_t op, const segment *segs, size_t count) {
+    std::vector<iovec> local_iov(std::min<size_t>(count, IOV_MAX));
+    std::vector<iovec> remote_iov(local_iov.size());
+    size_t index = 0;
+    size_t offset = 0;
+
+    while (index < count) {
+        const size_t n = std::min<size_t>(count - index, IOV_MAX);
+        for (size_t i = 0; i < n; ++i) {
+            const segment &seg = segs[index + i];
+            const size_t skip = i ? 0 : offset;
+            local_iov[i] = {reinterpret_cast<void *>(seg.local + skip), seg.len - skip};
+            remote_iov[i] = {reinterpret_cast<void *>(seg.remote + skip), seg.len - skip};
+        }
+
+        const ssize_t ret = (op == NIXL_WRITE) ?
+            process_vm_writev(pid, local_iov.data(), n, remote_iov.data(), n, 0) :
+            process_vm_readv(pid, local_iov.data(), n, remote_iov.data(), n, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            const int err = errno;
+            NIXL_ERROR << "Cross-memory attach with pid " << pid
+                       << " failed: " << std::strerror(err);
+            return errnoToStatus(err);
+        }
+        if (ret == 0) {
+            return NIXL_ERR_BACKEND;
+        }
+
+        size_t copied = ret;
+        while (copied > 0) {
+            const size_t left = segs[index].len - offset;
+            if (copied < left) {
+                offset += copied;
+                break;
+            }
+            copied -= left;
+            offset = 0;
+            ++index;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+} // namespace
+
+class nixlShmMD : public nixlBackendMD {
+public:
+    nixlShmMD(bool is_private, uintptr_t addr, size_t len)
+        : nixlBackendMD(is_private),
+          addr_(addr),
+          len_(len) {}
+
+    [[nodiscard]] bool
+    isPrivate() const noexcept {
+        return isPrivateMD;
+    }
+
+    [[nodiscard]] region
+    getRegion() const noexcept {
+        return {addr_, len_};
+    }
+
+private:
+    const uintptr_t addr_;
+    const size_t len_;
+};
+
+class nixlShmReqH : public nixlBackendReqH {
+public:
+    nixl_xfer_op_t op;
+    std::shared_ptr<nixlShmEngine::peer> target;
+    std::vector<segment> segments;
+    // Boundaries of the batches in segments, batch i is [bounds[i], bounds[i + 1])
+    std::vector<size_t> bounds;
+
+    // Copy with cross-memory attach, set for other processes and with force_cma
+    bool cma = false;
+
+    bool hasNotif = false;
+    nixl_blob_t notifMsg;
+
+    std::atomic<size_t> pending{0};
+    std::atomic<nixl_status_t> status{NIXL_SUCCESS};
+    // Set while copy threads may still touch the request
+    std::atomic<bool> active{false};
+
+    [[nodiscard]] size_t
+    batchCount() const noexcept {
+        return bounds.size() - 1;
+    }
+
+    [[nodiscard]] nixl_status_t
+    runBatch(size_t batch) const {
+        const segment *segs = segments.data() + bounds[batch];
+        const size_t count = bounds[batch + 1] - bounds[batch];
+
+        if (cma) {
+            return cmaCopy(target->pid, op, segs, count);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            void *local = reinterpret_cast<void *>(segs[i].local);
+            void *remote = reinterpret_cast<void *>(segs[i].remote);
+            if (op == NIXL_WRITE) {
+                std::memcpy(remote, local, segs[i].len);
+            } else {
+                std::memcpy(local, remote, segs[i].len);
+            }
+        }
+        return NIXL_SUCCESS;
+    }
+};
+
+nixlShmEngine::nixlShmEngine(const nixlBackendInitParams *init_params)
+    : nixlBackendEngine(init_params) {
+    const nixl_b_params_t *params = init_params->customParams;
+    static std::atomic<uint64_t> ring_counter{0};
+
+    try {
+        numThreads_ = getSizeParam(params, "num_threads", default_num_threads);
+        minChunk_ = std::max<size_t>(getSizeParam(params, "min_chunk_size", default_min_chunk), 1);
+        const uint32_t slots = getUint32Param(params, "notif_slots", default_notif_slots);
+        const uint32_t slot_size =
+            getUint32Param(params, "notif_slot_size", default_notif_slot_size);
+        const std::string dir = getStrParam(params, "shm_dir", "/dev/shm");
+        forceCma_ = getStrParam(params, "force_cma", "0") == "1";
+
+        const std::string path = dir + "/nixl_shm_" + std::to_string(getpid()) + "_" +
+            std::to_string(ring_counter++) + "_" +
+            std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        ring_ = std::make_shared<nixlShmNotifRing>(path, slots, slot_size);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "Failed to initialize SHM backend: " << e.what();
+        initErr = true;
+        return;
+    }
+
+    bootId_ = readBootId();
+    pidNamespace_ = readPidNamespace();
+    peers_[localAgent] = std::make_shared<peer>(peer{getpid(), ring_});
+
+    if (getStrParam(params, "set_ptracer", "0") == "1") {
+        // Yama restricts cross-memory attach to descendants unless a ptracer is declared
+        if (prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0) != 0) {
+            NIXL_PDEBUG << "PR_SET_PTRACER failed, Yama is likely not enabled";
+        }
+    }
+
+    for (size_t i = 0; i < numThreads_; ++i) {
+        workers_.emplace_back([this]() { workerLoop(); });
+    }
+    NIXL_INFO << "SHM backend initialized with " << numThreads_ << " copy threads, ring "
+              << ring_->getPath();
+}
+
+nixlShmEngine::~nixlShmEngine() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stop_ = true;
+    }
+    queueCv_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+nixl_status_t
+nixlShmEngine::registerMem(const nixlBlobDesc &mem,
+                           const nixl_mem_t &nixl_mem,
+                           nixlBackendMD *&out) {
+    if (nixl_mem != DRAM_SEG) {
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+    out = new nixlShmMD(true, mem.addr, mem.len);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::deregisterMem(nixlBackendMD *meta) {
+    delete static_cast<nixlShmMD *>(meta);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::getPublicData(const nixlBackendMD *meta, std::string &str) const {
+    const region reg = static_cast<const nixlShmMD *>(meta)->getRegion();
+    str.assign(reinterpret_cast<const char *>(&reg), sizeof(reg));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::getConnInfo(std::string &str) const {
+    nixlSerDes sd;
+    const pid_t pid = getpid();
+    sd.addStr("boot", bootId_);
+    sd.addStr("pidns", pidNamespace_);
+    sd.addBuf("pid", &pid, sizeof(pid));
+    sd.addStr("ring", ring_->getPath());
+    str = sd.exportStr();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                  const std::string &remote_conn_info) {
+    nixlSerDes sd;
+    if (sd.importStr(remote_conn_info) != NIXL_SUCCESS) {
+        return NIXL_ERR_MISMATCH;
+    }
+
+    // Agents on other hosts or in other PID namespaces are left to other backends
+    if (sd.getStr("boot") != bootId_ || sd.getStr("pidns") != pidNamespace_) {
+        NIXL_DEBUG << "SHM backend skipping agent " << remote_agent << " on another host";
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    pid_t pid;
+    if (sd.getBuf("pid", &pid, sizeof(pid)) != NIXL_SUCCESS) {
+        return NIXL_ERR_MISMATCH;
+    }
+    const std::string path = sd.getStr("ring");
+
+    if (remote_agent == localAgent) {
+        return NIXL_SUCCESS;
+    }
+
+    std::shared_ptr<nixlShmNotifRing> ring;
+    try {
+        ring = std::make_shared<nixlShmNotifRing>(path);
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << "Failed to load agent " << remote_agent << ": " << e.what();
+        return NIXL_ERR_BACKEND;
+    }
+
+    std::lock_guard<std::mutex> lock(peersMutex_);
+    peers_[remote_agent] = std::make_shared<peer>(peer{pid, std::move(ring)});
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::connect(const std::string &remote_agent) {
+    return findPeer(remote_agent) ? NIXL_SUCCESS : NIXL_ERR_NOT_FOUND;
+}
+
+nixl_status_t
+nixlShmEngine::disconnect(const std::string &remote_agent) {
+    if (remote_agent == localAgent) {
+        return NIXL_SUCCESS;
+    }
+    // Requests in flight keep their peer alive
+    std::lock_guard<std::mutex> lock(peersMutex_);
+    peers_.erase(remote_agent);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) {
+    output = input;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::loadRemoteMD(const nixlBlobDesc &input,
+                            const nixl_mem_t &nixl_mem,
+                            const std::string &remote_agent,
+                            nixlBackendMD *&output) {
+    if (nixl_mem != DRAM_SEG || input.metaInfo.size() != sizeof(region)) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    region reg;
+    std::memcpy(&reg, input.metaInfo.data(), sizeof(reg));
+    output = new nixlShmMD(false, reg.addr, reg.len);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::unloadMD(nixlBackendMD *input) {
+    auto *md = static_cast<nixlShmMD *>(input);
+    // Local loads alias the registration, which deregisterMem releases
+    if (md && !md->isPrivate()) {
+        delete md;
+    }
+    return NIXL_SUCCESS;
+}
+
+std::shared_ptr<nixlShmEngine::peer>
+nixlShmEngine::findPeer(const std::string &remote_agent) const {
+    std::lock_guard<std::mutex> lock(peersMutex_);
+    const auto it = peers_.find(remote_agent);
+    return it == peers_.end() ? nullptr : it->second;
+}
+
+nixl_status_t
+nixlShmEngine::prepXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    if (operation != NIXL_READ && operation != NIXL_WRITE) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    if (local.getType() != DRAM_SEG || remote.getType() != DRAM_SEG ||
+        local.descCount() != remote.descCount()) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto target = findPeer(remote_agent);
+    if (!target) {
+        NIXL_ERROR << "SHM backend has no connection info for agent " << remote_agent;
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    size_t total = 0;
+    for (int i = 0; i < local.descCount(); ++i) {
+        if (local[i].len != remote[i].len) {
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        total += local[i].len;
+    }
+
+    auto req = std::make_unique<nixlShmReqH>();
+    req->op = operation;
+    req->target = std::move(target);
+    req->cma = forceCma_ || (req->target->pid != getpid());
+    req->segments.reserve(local.descCount());
+
+    // Split the bytes evenly over the copy threads, without going below min_chunk_size
+    const size_t max_batches = std::max<size_t>(numThreads_, 1);
+    const size_t batches = std::clamp<size_t>(total / minChunk_, 1, max_batches);
+    const size_t batch_bytes = (total + batches - 1) / batches;
+    size_t filled = 0;
+
+    req->bounds.push_back(0);
+    for (int i = 0; i < local.descCount(); ++i) {
+        size_t offset = 0;
+        while (offset < local[i].len) {
+            const size_t take = std::min(local[i].len - offset, batch_bytes - filled);
+            req->segments.push_back({local[i].addr + offset, remote[i].addr + offset, take});
+            offset += take;
+            filled += take;
+            if (filled == batch_bytes && req->bounds.size() < batches) {
+                req->bounds.push_back(req->segments.size());
+                filled = 0;
+            }
+        }
+    }
+    if (req->bounds.back() != req->segments.size() || req->bounds.size() == 1) {
+        req->bounds.push_back(req->segments.size());
+    }
+
+    handle = req.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::postXfer(const nixl_xfer_op_t &operation,
+                        const nixl_meta_dlist_t &local,
+                        const nixl_meta_dlist_t &remote,
+                        const std::string &remote_agent,
+                        nixlBackendReqH *&handle,
+                        const nixl_opt_b_args_t *opt_args) const {
+    auto &req = static_cast<nixlShmReqH &>(*handle);
+    if (req.active.load(std::memory_order_acquire)) {
+        return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    req.hasNotif = opt_args && opt_args->hasNotif;
+    req.notifMsg = req.hasNotif ? opt_args->notifMsg : nixl_blob_t();
+    if (req.hasNotif &&
+        localAgent.size() + req.notifMsg.size() > req.target->ring->getSlotSize()) {
+        NIXL_ERROR << "Notification of " << req.notifMsg.size()
+                   << " bytes does not fit in the peer's notification ring";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    req.status.store(NIXL_SUCCESS, std::memory_order_relaxed);
+
+    // Small transfers are copied inline, the thread handoff would cost more than the copy
+    if (req.batchCount() == 1 || workers_.empty()) {
+        for (size_t batch = 0; batch < req.batchCount(); ++batch) {
+            const nixl_status_t ret = req.runBatch(batch);
+            if (ret != NIXL_SUCCESS) {
+                return ret;
+            }
+        }
+        return req.hasNotif ? pushNotif(*req.target->ring, req.notifMsg) : NIXL_SUCCESS;
+    }
+
+    req.pending.store(req.batchCount(), std::memory_order_relaxed);
+    req.active.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        for (size_t batch = 0; batch < req.batchCount(); ++batch) {
+            queue_.push_back({&req, batch});
+        }
+    }
+    queueCv_.notify_all();
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlShmEngine::checkXfer(nixlBackendReqH *handle) const {
+    const auto &req = static_cast<const nixlShmReqH &>(*handle);
+    if (req.active.load(std::memory_order_acquire)) {
+        return NIXL_IN_PROG;
+    }
+    return req.status.load(std::memory_order_relaxed);
+}
+
+nixl_status_t
+nixlShmEngine::releaseReqH(nixlBackendReqH *handle) const {
+    auto *req = static_cast<nixlShmReqH *>(handle);
+    // Copies cannot be interrupted, wait for the threads to let go of the request
+    if (req->active.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(doneMutex_);
+        doneCv_.wait(lock, [req]() { return !req->active.load(std::memory_order_acquire); });
+    }
+    delete req;
+    return NIXL_SUCCESS;
+}
+
+void
+nixlShmEngine::workerLoop() const {
+    for (;;) {
+        task next;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueCv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            next = queue_.front();
+            queue_.pop_front();
+        }
+
+        nixlShmReqH &req = *next.req;
+        const nixl_status_t ret = req.runBatch(next.batch);
+        if (ret != NIXL_SUCCESS) {
+            nixl_status_t expected = NIXL_SUCCESS;
+            req.status.compare_exchange_strong(expected, ret);
+        }
+        if (req.pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            complete(req);
+        }
+    }
+}
+
+void
+nixlShmEngine::complete(nixlShmReqH &req) const {
+    // The notification goes out only once all the data is in place
+    if (req.hasNotif && req.status.load(std::memory_order_relaxed) == NIXL_SUCCESS) {
+        req.status.store(pushNotif(*req.target->ring, req.notifMsg), std::memory_order_relaxed);
+    }
+    {
+        // Under the lock, so a waiting releaseReqH cannot miss the wakeup
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        req.active.store(false, std::memory_order_release);
+    }
+    doneCv_.notify_all();
+}
+
+nixl_status_t
+nixlShmEngine::pushNotif(nixlShmNotifRing &ring, const std::string &msg) const {
+    const auto deadline = std::chrono::steady_clock::now() + notif_push_timeout;
+    std::chrono::microseconds backoff = notif_push_min_sleep;
+    for (;;) {
+        const nixl_status_t ret = ring.push(localAgent, msg);
+        if (ret != NIXL_IN_PROG) {
+            return ret;
+        }
+        if (std::chrono::steady_clock::now() > deadline) {
+            NIXL_ERROR << "Notification ring " << ring.getPath() << " stayed full";
+            return NIXL_ERR_BACKEND;
+        }
+        // The peer drains the ring from another process, there is nothing to block on
+        std::this_thread::sleep_for(backoff);
+        backoff = std::min(backoff * 2, notif_push_max_sleep);
+    }
+}
+
+nixl_status_t
+nixlShmEngine::getNotifs(notif_list_t &notif_list) {
+    std::lock_guard<std::mutex> lock(popMutex_);
+    std::string agent_name;
+    nixl_blob_t msg;
+    while (ring_->pop(agent_name, msg)) {
+        notif_list.emplace_back(std::move(agent_name), std::move(msg));
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlShmEngine::genNotif(const std::string &remote_agent, const std::string &msg) const {
+    const auto target = findPeer(remote_agent);
+    if (!target) {
+        return NIXL_ERR_NOT_FOUND;
+    }
+    return pushNotif(*target->ring, msg);
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_SHM_SHM_BACKEND_H
+#define NIXL_SRC_PLUGINS_SHM_SHM_BACKEND_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/types.h>
+
+#include "backend/backend_engine.h"
+#include "shm_notif_ring.h"
+
+class nixlShmReqH;
+
+// Intra-node backend for DRAM transfers between agents on the same host. Data moves with
+// cross-memory attach (process_vm_readv/writev) straight between the two address spaces, or
+// memcpy when both sides are in the same process, and notifications go through a shared
+// memory ring per agent. Large transfers are split over a pool of copy threads.
+class nixlShmEngine : public nixlBackendEngine {
+public:
+    explicit nixlShmEngine(const nixlBackendInitParams *init_params);
+    ~nixlShmEngine() override;
+
+    bool
+    supportsRemote() const override {
+        return true;
+    }
+
+    bool
+    supportsLocal() const override {
+        return true;
+    }
+
+    bool
+    supportsNotif() const override {
+        return true;
+    }
+
+    nixl_mem_list_t
+    getSupportedMems() const override {
+        return {DRAM_SEG};
+    }
+
+    nixl_status_t
+    registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override;
+    nixl_status_t
+    deregisterMem(nixlBackendMD *meta) override;
+
+    nixl_status_t
+    getPublicData(const nixlBackendMD *meta, std::string &str) const override;
+    nixl_status_t
+    getConnInfo(std::string &str) const override;
+    nixl_status_t
+    loadRemoteConnInfo(const std::string &remote_agent,
+                       const std::string &remote_conn_info) override;
+
+    nixl_status_t
+    connect(const std::string &remote_agent) override;
+    nixl_status_t
+    disconnect(const std::string &remote_agent) override;
+
+    nixl_status_t
+    loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override;
+    nixl_status_t
+    loadRemoteMD(const nixlBlobDesc &input,
+                 const nixl_mem_t &nixl_mem,
+                 const std::string &remote_agent,
+                 nixlBackendMD *&output) override;
+    nixl_status_t
+    unloadMD(nixlBackendMD *input) override;
+
+    nixl_status_t
+    prepXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    nixl_status_t
+    postXfer(const nixl_xfer_op_t &operation,
+             const nixl_meta_dlist_t &local,
+             const nixl_meta_dlist_t &remote,
+             const std::string &remote_agent,
+             nixlBackendReqH *&handle,
+             const nixl_opt_b_args_t *opt_args = nullptr) const override;
+    nixl_status_t
+    checkXfer(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    releaseReqH(nixlBackendReqH *handle) const override;
+
+    nixl_status_t
+    getNotifs(notif_list_t &notif_list) override;
+    nixl_status_t
+    genNotif(const std::string &remote_agent, const std::string &msg) const override;
+
+    // A peer agent on this host, shared with the requests that target it
+    struct peer {
+        pid_t pid;
+        std::shared_ptr<nixlShmNotifRing> ring;
+    };
+
+private:
+    struct task {
+        nixlShmReqH *req;
+        size_t batch;
+    };
+
+    [[nodiscard]] std::shared_ptr<peer>
+    findPeer(const std::string &remote_agent) const;
+
+    nixl_status_t
+    pushNotif(nixlShmNotifRing &ring, const std::string &msg) const;
+
+    void
+    complete(nixlShmReqH &req) const;
+
+    void
+    workerLoop() const;
+
+    size_t numThreads_ = 0;
+    size_t minChunk_ = 0;
+    // Agents of this process are copied with cross-memory attach too, for tests
+    bool forceCma_ = false;
+    std::string bootId_;
+    std::string pidNamespace_;
+    std::shared_ptr<nixlShmNotifRing> ring_;
+    std::mutex popMutex_;
+
+    mutable std::mutex peersMutex_;
+    std::unordered_map<std::string, std::shared_ptr<peer>> peers_;
+
+    mutable std::mutex queueMutex_;
+    mutable std::condition_variable queueCv_;
+    mutable std::deque<task> queue_;
+    // Signalled whenever a request posted to the copy threads completes
+    mutable std::mutex doneMutex_;
+    mutable std::condition_variable doneCv_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+
+#endif
@@ -0,0 +1,219 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "shm_notif_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/nixl_log.h"
+
+namespace {
+constexpr uint32_t ring_magic = 0x4e534852; // "NSHR"
+constexpr uint32_t ring_version = 1;
+constexpr size_t cache_line = 64;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared memory ring needs address-free 64-bit atomics");
+
+[[nodiscard]] constexpr size_t
+alignUp(size_t value, size_t align) {
+    return (value + align - 1) / align * align;
+}
+} // namespace
+
+struct nixlShmNotifRing::header {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t slotSize;
+    size_t slotStride;
+    alignas(cache_line) std::atomic<uint64_t> tail;
+    alignas(cache_line) std::atomic<uint64_t> head;
+};
+
+struct nixlShmNotifRing::slot {
+    // Equals the position when free, the position + 1 once written
+    std::atomic<uint64_t> seq;
+    uint32_t nameLen;
+    uint32_t msgLen;
+
+    [[nodiscard]] char *
+    payload() {
+        return reinterpret_cast<char *>(this + 1);
+    }
+};
+
+nixlShmNotifRing::nixlShmNotifRing(const std::string &path,
+                                   uint32_t slot_count,
+                                   uint32_t slot_size)
+    : path_(path),
+      owner_(true) {
+    if (slot_count == 0 || (slot_count & (slot_count - 1)) != 0) {
+        throw std::invalid_argument("Notification ring slot count must be a power of 2");
+    }
+
+    const size_t stride = alignUp(sizeof(slot) + slot_size, cache_line);
+    const size_t length = alignUp(sizeof(header), cache_line) + stride * slot_count;
+
+    const int fd = open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        NIXL_PERROR << "Failed to create notification ring " << path;
+        throw std::runtime_error("Failed to create notification ring");
+    }
+
+    if (ftruncate(fd, length) != 0) {
+        NIXL_PERROR << "Failed to size notification ring " << path;
+        close(fd);
+        unlink(path.c_str());
+        throw std::runtime_error("Failed to size notification ring");
+    }
+
+    try {
+        map(fd, length);
+    }
+    catch (...) {
+        unlink(path.c_str());
+        throw;
+    }
+
+    header_->slotCount = slot_count;
+    header_->slotSize = slot_size;
+    header_->slotStride = stride;
+    new (&header_->tail) std::atomic<uint64_t>(0);
+    new (&header_->head) std::atomic<uint64_t>(0);
+    for (uint64_t pos = 0; pos < slot_count; ++pos) {
+        new (&getSlot(pos).seq) std::atomic<uint64_t>(pos);
+    }
+    header_->version = ring_version;
+    // Peers check the magic first, so it is published after the layout is complete
+    header_->magic.store(ring_magic, std::memory_order_release);
+}
+
+nixlShmNotifRing::nixlShmNotifRing(const std::string &path) : path_(path), owner_(false) {
+    const int fd = open(path.c_str(), O_RDWR);
+    if (fd < 0) {
+        NIXL_PERROR << "Failed to open notification ring " << path;
+        throw std::runtime_error("Failed to open notification ring");
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(header)) {
+        NIXL_ERROR << "Notification ring " << path << " is truncated";
+        close(fd);
+        throw std::runtime_error("Notification ring is truncated");
+    }
+
+    map(fd, st.st_size);
+
+    const bool ready = header_->magic.load(std::memory_order_acquire) == ring_magic;
+    const size_t expected = alignUp(sizeof(header), cache_line) +
+        header_->slotStride * static_cast<size_t>(header_->slotCount);
+    if (!ready || header_->version != ring_version || expected > length_) {
+        NIXL_ERROR << "Notification ring " << path << " has an unknown layout";
+        munmap(header_, length_);
+        header_ = nullptr;
+        throw std::runtime_error("Notification ring has an unknown layout");
+    }
+}
+
+nixlShmNotifRing::~nixlShmNotifRing() {
+    if (header_) {
+        munmap(header_, length_);
+    }
+    if (owner_) {
+        unlink(path_.c_str());
+    }
+}
+
+void
+nixlShmNotifRing::map(int fd, size_t length) {
+    void *addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        NIXL_PERROR << "Failed to map notification ring " << path_;
+        throw std::runtime_error("Failed to map notification ring");
+    }
+    header_ = static_cast<header *>(addr);
+    length_ = length;
+}
+
+nixlShmNotifRing::slot &
+nixlShmNotifRing::getSlot(uint64_t pos) const {
+    char *base = reinterpret_cast<char *>(header_) + alignUp(sizeof(header), cache_line);
+    const uint64_t index = pos & (header_->slotCount - 1);
+    return *reinterpret_cast<slot *>(base + index * header_->slotStride);
+}
+
+uint32_t
+nixlShmNotifRing::getSlotSize() const noexcept {
+    return header_->slotSize;
+}
+
+nixl_status_t
+nixlShmNotifRing::push(const std::string &agent_name, const nixl_blob_t &msg) {
+    if (agent_name.size() + msg.size() > header_->slotSize) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    uint64_t pos = header_->tail.load(std::memory_order_relaxed);
+    for (;;) {
+        slot &s = getSlot(pos);
+        const uint64_t seq = s.seq.load(std::memory_order_acquire);
+        const int64_t diff = static_cast<int64_t>(seq - pos);
+        if (diff == 0) {
+            if (header_->tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                s.nameLen = agent_name.size();
+                s.msgLen = msg.size();
+                std::memcpy(s.payload(), agent_name.data(), agent_name.size());
+                std::memcpy(s.payload() + agent_name.size(), msg.data(), msg.size());
+                s.seq.store(pos + 1, std::memory_order_release);
+                return NIXL_SUCCESS;
+            }
+        } else if (diff < 0) {
+            return NIXL_IN_PROG;
+        } else {
+            pos = header_->tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool
+nixlShmNotifRing::pop(std::string &agent_name, nixl_blob_t &msg) {
+    const uint64_t pos = header_->head.load(std::memory_order_relaxed);
+    slot &s = getSlot(pos);
+    if (s.seq.load(std::memory_order_acquire) != pos + 1) {
+        return false;
+    }
+
+    // Lengths come from peers, never trust them beyond the slot
+    const size_t name_len = std::min<size_t>(s.nameLen, header_->slotSize);
+    const size_t msg_len = std::min<size_t>(s.msgLen, header_->slotSize - name_len);
+    agent_name.assign(s.payload(), name_len);
+    msg.assign(s.payload() + name_len, msg_len);
+
+    s.seq.store(pos + header_->slotCount, std::memory_order_release);
+    header_->head.store(pos + 1, std::memory_order_relaxed);
+    return true;
+}
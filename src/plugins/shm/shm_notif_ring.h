@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_SHM_SHM_NOTIF_RING_H
+#define NIXL_SRC_PLUGINS_SHM_SHM_NOTIF_RING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "nixl_types.h"
+
+// Multi-producer single-consumer ring of notifications in file-backed shared memory, e.g.
+// under /dev/shm. The owner creates the file and is the only consumer, peer agents on the same
+// host map it and push (agent name, message) pairs into fixed-size slots. Each slot carries a
+// sequence number, so producers only contend on the tail counter and never block the owner.
+class nixlShmNotifRing {
+public:
+    // Create and own a ring at path, the file is removed again by the destructor
+    nixlShmNotifRing(const std::string &path, uint32_t slot_count, uint32_t slot_size);
+    // Map the ring a peer created at path
+    explicit nixlShmNotifRing(const std::string &path);
+    ~nixlShmNotifRing();
+
+    nixlShmNotifRing(const nixlShmNotifRing &) = delete;
+    nixlShmNotifRing &
+    operator=(const nixlShmNotifRing &) = delete;
+
+    // NIXL_ERR_INVALID_PARAM if the pair does not fit in a slot, NIXL_IN_PROG if the ring is full
+    [[nodiscard]] nixl_status_t
+    push(const std::string &agent_name, const nixl_blob_t &msg);
+
+    // Single consumer only, returns false when the ring is empty
+    [[nodiscard]] bool
+    pop(std::string &agent_name, nixl_blob_t &msg);
+
+    [[nodiscard]] const std::string &
+    getPath() const noexcept {
+        return path_;
+    }
+
+    [[nodiscard]] uint32_t
+    getSlotSize() const noexcept;
+
+private:
+    struct header;
+    struct slot;
+
+    void
+    map(int fd, size_t length);
+
+    [[nodiscard]] slot &
+    getSlot(uint64_t pos) const;
+
+    const std::string path_;
+    const bool owner_;
+    header *header_ = nullptr;
+    size_t length_ = 0;
+};
+
+#endif
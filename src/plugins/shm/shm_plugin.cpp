@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/backend_plugin.h"
+#include "shm_backend.h"
+
+namespace {
+nixl_b_params_t
+get_shm_options() {
+    nixl_b_params_t params;
+    params["num_threads"] = "4";
+    params["min_chunk_size"] = "1048576";
+    params["notif_slots"] = "1024";
+    params["notif_slot_size"] = "4096";
+    params["shm_dir"] = "/dev/shm";
+    params["set_ptracer"] = "0";
+    params["force_cma"] = "0";
+    return params;
+}
+} // namespace
+
+// Plugin type alias for convenience
+using shm_plugin_t = nixlBackendPluginCreator<nixlShmEngine>;
+
+#ifdef STATIC_PLUGIN_SHM
+nixlBackendPlugin *
+createStaticSHMPlugin() {
+    return shm_plugin_t::create(
+        NIXL_PLUGIN_API_VERSION, "SHM", "0.1.0", get_shm_options(), {DRAM_SEG});
+}
+#else
+extern "C" NIXL_PLUGIN_EXPORT nixlBackendPlugin *
+nixl_plugin_init() {
+    return shm_plugin_t::create(
+        NIXL_PLUGIN_API_VERSION, "SHM", "0.1.0", get_shm_options(), {DRAM_SEG});
+}
+
+extern "C" NIXL_PLUGIN_EXPORT void
+nixl_plugin_fini() {}
+#endif
@@ -37,6 +37,7 @@ const char prometheusLocalVar[] = "NIXL_TELEMETRY_PROMETHEUS_LOCAL";
 const std::string prometheusExporterTransferCategory = "NIXL_TELEMETRY_TRANSFER";
 const std::string prometheusExporterPerformanceCategory = "NIXL_TELEMETRY_PERFORMANCE";
 const std::string prometheusExporterMemoryCategory = "NIXL_TELEMETRY_MEMORY";
+const std::string prometheusExporterOtherLabel = "other";
 const std::string prometheusExporterLocalAddress = "127.0.0.1";
 const std::string prometheusExporterPublicAddress = "0.0.0.0";
 
@@ -50,6 +51,37 @@ getHostname() {
     return "unknown";
 }
 
+// Boundaries growing by 4x from start, the last finite one being start * 4^(count-1)
+prometheus::Histogram::BucketBoundaries
+exponentialBuckets(double start, size_t count) {
+    prometheus::Histogram::BucketBoundaries buckets(count);
+    for (size_t i = 0; i < count; ++i) {
+        buckets[i] = start;
+        start *= 4;
+    }
+    return buckets;
+}
+
+// Series key of an event, zero for events without any label
+uint64_t
+seriesKey(const nixlTelemetryEvent &event) {
+    return (uint64_t(event.backendId_) << 32) | (uint64_t(event.peerId_) << 8) |
+        static_cast<uint64_t>(event.op_);
+}
+
+const char *
+opLabel(nixl_telemetry_op_t op) {
+    switch (op) {
+    case nixl_telemetry_op_t::READ:
+        return "READ";
+    case nixl_telemetry_op_t::WRITE:
+        return "WRITE";
+    case nixl_telemetry_op_t::NONE:
+        break;
+    }
+    return "";
+}
+
 std::mutex s_mutex;
 std::weak_ptr<prometheus::Exposer> s_exposer_weak;
 std::weak_ptr<prometheus::Registry> s_registry_weak;
@@ -100,8 +132,7 @@ nixlTelemetryPrometheusExporter::nixlTelemetryPrometheusExporter(
         initializeMetrics();
     }
     catch (...) {
-        counters_.clear();
-        gauges_.clear();
+        clearMetrics();
         s_agent_names.erase(agent_name_);
         throw;
     }
@@ -109,8 +140,7 @@ nixlTelemetryPrometheusExporter::nixlTelemetryPrometheusExporter(
 
 nixlTelemetryPrometheusExporter::~nixlTelemetryPrometheusExporter() {
     const std::lock_guard lock(s_mutex);
-    counters_.clear();
-    gauges_.clear();
+    clearMetrics();
     s_agent_names.erase(agent_name_);
     exposer_.reset();
     registry_.reset();
@@ -137,16 +167,55 @@ nixlTelemetryPrometheusExporter::initializeMetrics() {
     registerCounter("agent_memory_deregistered",
                     "Cumulative memory deregistered",
                     prometheusExporterMemoryCategory);
+    registerCounter("agent_reg_cache_hits",
+                    "Registered regions that reused an existing registration",
+                    prometheusExporterMemoryCategory);
+    registerCounter("agent_reg_cache_misses",
+                    "Registered regions that needed a new backend registration",
+                    prometheusExporterMemoryCategory);
     registerCounter("agent_xfer_time",
                     "Start to Complete (per request)",
                     prometheusExporterPerformanceCategory);
     registerCounter("agent_xfer_post_time",
                     "Start to posting to Back-End (per request)",
                     prometheusExporterPerformanceCategory);
+    registerCounter("agent_throttle_time",
+                    "Time held back by rate limits (per request)",
+                    prometheusExporterPerformanceCategory);
 
     registerGauge("agent_memory_registered", "Memory registered", prometheusExporterMemoryCategory);
     registerGauge(
         "agent_memory_deregistered", "Memory deregistered", prometheusExporterMemoryCategory);
+    registerGauge("agent_throttled_requests",
+                  "Requests held back by rate limits",
+                  prometheusExporterTransferCategory);
+
+    // 1us to ~4s, and 256B to 1GiB
+    registerHistogram("agent_xfer_time_us",
+                      "Start to Complete (per request) in microseconds",
+                      prometheusExporterPerformanceCategory,
+                      exponentialBuckets(1, 12));
+    registerHistogram("agent_xfer_post_time_us",
+                      "Start to posting to Back-End (per request) in microseconds",
+                      prometheusExporterPerformanceCategory,
+                      exponentialBuckets(1, 12));
+    registerHistogram("agent_throttle_time_us",
+                      "Time held back by rate limits (per request) in microseconds",
+                      prometheusExporterPerformanceCategory,
+                      exponentialBuckets(1, 12));
+    registerHistogram("agent_xfer_size_bytes",
+                      "Bytes transferred (per request)",
+                      prometheusExporterTransferCategory,
+                      exponentialBuckets(256, 12));
+}
+
+void
+nixlTelemetryPrometheusExporter::clearMetrics() {
+    // Entries remove their metrics from the shared families on destruction
+    series_.clear();
+    histograms_.clear();
+    counters_.clear();
+    gauges_.clear();
 }
 
 void
@@ -161,6 +230,98 @@ nixlTelemetryPrometheusExporter::registerCounter(const std::string &name,
         family.Remove(&metric);
     }
     NIXL_ASSERT(inserted);
+    counter_categories_[name] = category;
+}
+
+void
+nixlTelemetryPrometheusExporter::registerHistogram(
+    const std::string &name,
+    const std::string &help,
+    const std::string &category,
+    prometheus::Histogram::BucketBoundaries buckets) {
+    auto &family = prometheus::BuildHistogram().Name(name).Help(help).Register(*registry_);
+    auto &metric = family.Add(
+        {{"category", category}, {"hostname", hostname_}, {"agent_name", agent_name_}}, buckets);
+    const auto inserted = histograms_.try_emplace(name, &family, &metric).second;
+    if (!inserted) {
+        family.Remove(&metric);
+    }
+    NIXL_ASSERT(inserted);
+    HistogramFamily info{&family, category, std::move(buckets)};
+    histogram_families_.try_emplace(name, std::move(info));
+}
+
+void
+nixlTelemetryPrometheusExporter::registerLabel(nixl_telemetry_label_t kind,
+                                               uint16_t id,
+                                               const std::string &name) {
+    label_names_[static_cast<size_t>(kind)][id] = name;
+}
+
+prometheus::Labels
+nixlTelemetryPrometheusExporter::seriesLabels(const nixlTelemetryEvent &event,
+                                              const std::string &category) const {
+    auto label_name = [this](nixl_telemetry_label_t kind, uint16_t id) -> const std::string & {
+        static const std::string none;
+        if (id == TELEMETRY_LABEL_NONE) {
+            return none;
+        }
+        const auto &names = label_names_[static_cast<size_t>(kind)];
+        const auto it = names.find(id);
+        return (it != names.end()) ? it->second : prometheusExporterOtherLabel;
+    };
+
+    return {{"category", category},
+            {"hostname", hostname_},
+            {"agent_name", agent_name_},
+            {"backend", label_name(nixl_telemetry_label_t::BACKEND, event.backendId_)},
+            {"remote_agent", label_name(nixl_telemetry_label_t::PEER, event.peerId_)},
+            {"op", opLabel(event.op_)}};
+}
+
+void
+nixlTelemetryPrometheusExporter::incrementCounter(const std::string &name,
+                                                  const nixlTelemetryEvent &event) {
+    const auto base_it = counters_.find(name);
+    if (base_it == counters_.end()) {
+        return;
+    }
+    base_it->second.metric->Increment(event.value_);
+
+    const uint64_t key = seriesKey(event);
+    if (key == 0) {
+        return;
+    }
+
+    auto &counters = series_[key].counters;
+    auto it = counters.find(name);
+    if (it == counters.end()) {
+        auto *family = base_it->second.family;
+        auto &metric = family->Add(seriesLabels(event, counter_categories_.at(name)));
+        it = counters.try_emplace(name, family, &metric).first;
+    }
+    it->second.metric->Increment(event.value_);
+}
+
+void
+nixlTelemetryPrometheusExporter::observeHistogram(const std::string &name,
+                                                  const nixlTelemetryEvent &event) {
+    const double value = static_cast<double>(event.value_);
+    histograms_.at(name).metric->Observe(value);
+
+    const uint64_t key = seriesKey(event);
+    if (key == 0) {
+        return;
+    }
+
+    auto &histograms = series_[key].histograms;
+    auto it = histograms.find(name);
+    if (it == histograms.end()) {
+        const auto &info = histogram_families_.at(name);
+        auto &metric = info.family->Add(seriesLabels(event, info.category), info.buckets);
+        it = histograms.try_emplace(name, info.family, &metric).first;
+    }
+    it->second.metric->Observe(value);
 }
 
 void
@@ -187,9 +348,37 @@ nixlTelemetryPrometheusExporter::exportEvent(const nixlTelemetryEvent &event) {
         switch (event.category_) {
         case nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER:
         case nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE: {
-            const auto it = counters_.find(event_name);
-            if (it != counters_.end()) {
-                it->second.metric->Increment(event.value_);
+            incrementCounter(event_name, event);
+
+            const auto it_gauge = gauges_.find(event_name);
+            if (it_gauge != gauges_.end()) {
+                it_gauge->second.metric->Set(static_cast<double>(event.value_));
+            }
+
+            const char *histogram_name = nullptr;
+            switch (event.eventType_) {
+            case nixl_telemetry_event_type_t::AGENT_XFER_TIME:
+                histogram_name = "agent_xfer_time_us";
+                break;
+            case nixl_telemetry_event_type_t::AGENT_XFER_POST_TIME:
+                histogram_name = "agent_xfer_post_time_us";
+                break;
+            case nixl_telemetry_event_type_t::AGENT_THROTTLE_TIME:
+                histogram_name = "agent_throttle_time_us";
+                break;
+            case nixl_telemetry_event_type_t::AGENT_TX_BYTES:
+            case nixl_telemetry_event_type_t::AGENT_RX_BYTES:
+                // Only per-request byte events describe a single transfer size
+                if (event.op_ != nixl_telemetry_op_t::NONE) {
+                    histogram_name = "agent_xfer_size_bytes";
+                }
+                break;
+            default:
+                break;
+            }
+
+            if (histogram_name) {
+                observeHistogram(histogram_name, event);
             }
             break;
         }
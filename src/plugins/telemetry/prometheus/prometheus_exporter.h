@@ -24,6 +24,7 @@
 #include <string>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <prometheus/registry.h>
 #include <prometheus/exposer.h>
@@ -43,6 +44,12 @@
  * Registry. Each agent adds its own metric instances distinguished by the
  * agent_name label. The shared resources are created by the first agent
  * and destroyed when the last agent's exporter is released.
+ *
+ * Per-request transfer events carry backend, remote agent and operation ids.
+ * They update the unlabelled metrics, which keep the totals of the agent, and
+ * the series of their combination of labels, created on first use. The number
+ * of distinct names per label is bounded by the agent
+ * (NIXL_TELEMETRY_MAX_LABEL_VALUES), so the number of series stays bounded.
  */
 class nixlTelemetryPrometheusExporter : public nixlTelemetryExporter {
 public:
@@ -52,6 +59,9 @@ public:
     nixl_status_t
     exportEvent(const nixlTelemetryEvent &event) override;
 
+    void
+    registerLabel(nixl_telemetry_label_t kind, uint16_t id, const std::string &name) override;
+
 private:
     struct CounterEntry {
         CounterEntry(prometheus::Family<prometheus::Counter> *family, prometheus::Counter *metric)
@@ -93,6 +103,39 @@ private:
         prometheus::Gauge *metric = nullptr;
     };
 
+    struct HistogramEntry {
+        HistogramEntry(prometheus::Family<prometheus::Histogram> *family,
+                       prometheus::Histogram *metric)
+            : family(family),
+              metric(metric) {}
+
+        HistogramEntry(const HistogramEntry &) = delete;
+        HistogramEntry &
+        operator=(const HistogramEntry &) = delete;
+        HistogramEntry(HistogramEntry &&) = delete;
+        HistogramEntry &
+        operator=(HistogramEntry &&) = delete;
+
+        ~HistogramEntry() {
+            if (family && metric) family->Remove(metric);
+        }
+
+        prometheus::Family<prometheus::Histogram> *family = nullptr;
+        prometheus::Histogram *metric = nullptr;
+    };
+
+    // Metrics of one backend, remote agent and operation combination
+    struct LabelledSeries {
+        std::unordered_map<std::string, CounterEntry> counters;
+        std::unordered_map<std::string, HistogramEntry> histograms;
+    };
+
+    struct HistogramFamily {
+        prometheus::Family<prometheus::Histogram> *family;
+        std::string category;
+        prometheus::Histogram::BucketBoundaries buckets;
+    };
+
     const std::string agent_name_;
     const std::string hostname_;
     std::shared_ptr<prometheus::Exposer> exposer_;
@@ -100,10 +143,34 @@ private:
 
     std::unordered_map<std::string, CounterEntry> counters_;
     std::unordered_map<std::string, GaugeEntry> gauges_;
+    std::unordered_map<std::string, std::string> counter_categories_;
+    std::unordered_map<std::string, HistogramFamily> histogram_families_;
+    std::unordered_map<std::string, HistogramEntry> histograms_;
+    std::unordered_map<uint64_t, LabelledSeries> series_;
+    std::unordered_map<uint16_t, std::string> label_names_[2];
 
     void
     initializeMetrics();
 
+    void
+    clearMetrics();
+
+    void
+    registerHistogram(const std::string &name,
+                      const std::string &help,
+                      const std::string &category,
+                      prometheus::Histogram::BucketBoundaries buckets);
+
+    [[nodiscard]] prometheus::Labels
+    seriesLabels(const nixlTelemetryEvent &event, const std::string &category) const;
+
+    // Updates the unlabelled metric and, for events with labels, the series of their labels
+    void
+    incrementCounter(const std::string &name, const nixlTelemetryEvent &event);
+
+    void
+    observeHistogram(const std::string &name, const nixlTelemetryEvent &event);
+
     void
     registerCounter(const std::string &name, const std::string &help, const std::string &category);
 
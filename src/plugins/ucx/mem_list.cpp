@@ -98,9 +98,14 @@ memListElement::create(const nixlRemoteMetaDesc &desc, size_t worker_id) {
         throw std::runtime_error("No connection found in public metadata");
     }
 
+    const auto rkey = md->getRkey(worker_id);
+    if (!rkey) {
+        throw std::runtime_error("Failed to unpack remote key of remote descriptor");
+    }
+
     element.field_mask = UCP_DEVICE_MEM_LIST_ELEM_FIELD_RKEY |
         UCP_DEVICE_MEM_LIST_ELEM_FIELD_REMOTE_ADDR | UCP_DEVICE_MEM_LIST_ELEM_FIELD_EP;
-    element.rkey = md->getRkey(worker_id).get();
+    element.rkey = rkey->get();
     element.remote_addr = static_cast<uint64_t>(desc.addr);
     element.ep = md->conn->getEp(worker_id)->getEp();
     return element;
@@ -19,7 +19,9 @@
 #include "common/nixl_log.h"
 #include "serdes/serdes.h"
 #include "common/nixl_log.h"
+#include "common/cpu_affinity.h"
 
+#include <algorithm>
 #include <optional>
 #include <limits>
 #include <future>
@@ -41,6 +43,7 @@ private:
     std::vector<nixlUcxReq> requests_;
     nixlUcxWorker *worker_;
     size_t workerId_;
+    bool canceled_ = false;
 
     [[nodiscard]] nixl_status_t
     checkConnection(const nixl_status_t status = NIXL_SUCCESS) const {
@@ -129,6 +132,35 @@ public:
         connections_.clear();
     }
 
+    // Requests in progress complete with an error once UCX aborted them
+    virtual void
+    cancel() {
+        canceled_ = true;
+        for (nixlUcxReq req : requests_) {
+            if (ucp_request_check_status(req) == UCS_INPROGRESS) {
+                worker_->reqCancel(req);
+            }
+        }
+    }
+
+    [[nodiscard]] bool
+    isCanceled() const noexcept {
+        return canceled_;
+    }
+
+    // UCX may still access the buffers of a request in progress, even an aborted one
+    [[nodiscard]] bool
+    hasInProgress() const {
+        return std::any_of(requests_.begin(), requests_.end(), [](nixlUcxReq req) {
+            return ucp_request_check_status(req) == UCS_INPROGRESS;
+        });
+    }
+
+    void
+    resetCanceled() noexcept {
+        canceled_ = false;
+    }
+
     [[nodiscard]] virtual nixl_status_t
     status() {
         if (requests_.empty()) {
@@ -190,6 +222,45 @@ public:
  * Progress thread management
 *****************************************/
 
+namespace {
+
+/*
+ * Progress thread tuning parameters common to all engine flavors
+ */
+struct nixlUcxProgressParams {
+    nixlTime::us_t spinBudget = 0;
+    std::vector<unsigned> cpus;
+};
+
+nixlUcxProgressParams
+getProgressParams(const nixlBackendInitParams &init_params) {
+    nixlUcxProgressParams params;
+    const nixl_b_params_t *custom_params = init_params.customParams;
+
+    params.spinBudget = std::max(nixl_b_params_get(custom_params, "progress_spin_us", 0), 0);
+
+    const std::string cpu_list = (custom_params && custom_params->count("progress_cpus")) ?
+        custom_params->at("progress_cpus") :
+        "";
+    if (!cpu_list.empty()) {
+        // Throws std::invalid_argument on malformed lists, failing engine creation
+        params.cpus = nixl::parseCpuList(cpu_list);
+    } else {
+        const int numa_node = nixl_b_params_get(custom_params, "progress_numa_node", -1);
+        if (numa_node >= 0) {
+            params.cpus = nixl::getNumaNodeCpus(numa_node);
+            if (params.cpus.empty()) {
+                NIXL_WARN << "No CPUs found for NUMA node " << numa_node
+                          << ", progress threads will not be pinned";
+            }
+        }
+    }
+
+    return params;
+}
+
+} // namespace
+
 /*
  * This class encapsulates a thread that polls one or multiple UCX workers
  */
@@ -221,6 +292,12 @@ public:
         thread_->join();
     }
 
+    void
+    setAffinity(std::vector<unsigned> cpus) {
+        NIXL_ASSERT(!threadActive_);
+        cpus_ = std::move(cpus);
+    }
+
     virtual void
     addWorker(nixlUcxWorker *worker, size_t worker_id) {
         NIXL_ASSERT(workers_.size() < workers_.capacity());
@@ -240,6 +317,9 @@ public:
 
     void
     operator()() {
+        if (!nixl::setThreadAffinity(cpus_)) {
+            NIXL_WARN << *this << " is not pinned to the requested CPUs";
+        }
         tlsThread() = this;
         threadActive_->set_value();
         run();
@@ -271,14 +351,19 @@ private:
     const nixlUcxEngine *engine_;
     std::vector<nixlUcxWorker *> workers_;
     std::vector<size_t> workerIds_;
+    std::vector<unsigned> cpus_;
     std::unique_ptr<std::thread> thread_;
     std::unique_ptr<std::promise<void>> threadActive_;
 };
 
 class nixlUcxSharedThread : public nixlUcxThread {
 public:
-    nixlUcxSharedThread(const nixlUcxEngine *engine, size_t num_workers, nixlTime::us_t delay)
-        : nixlUcxThread(engine, num_workers) {
+    nixlUcxSharedThread(const nixlUcxEngine *engine,
+                        size_t num_workers,
+                        nixlTime::us_t delay,
+                        const nixlUcxProgressParams &params)
+        : nixlUcxThread(engine, num_workers),
+          spinBudget_(params.spinBudget) {
         if (pipe(controlPipe_) < 0) {
             throw std::runtime_error("Couldn't create progress thread control pipe");
         }
@@ -293,6 +378,7 @@ public:
 
         pollFds_.resize(num_workers + 1);
         pollFds_.back() = {controlPipe_[0], POLLIN, 0};
+        setAffinity(params.cpus);
     }
 
     ~nixlUcxSharedThread() {
@@ -302,6 +388,7 @@ public:
 
     void
     join() override {
+        stopping_.store(true, std::memory_order_relaxed);
         const char signal = 'X';
         int ret = write(controlPipe_[1], &signal, sizeof(signal));
         if (ret < 0) NIXL_PERROR << "write to progress thread control pipe failed";
@@ -314,16 +401,45 @@ public:
         nixlUcxThread::addWorker(worker, worker_id);
     }
 
+    [[nodiscard]] nixlUcxProgressStats
+    getStats() const noexcept {
+        nixlUcxProgressStats stats;
+        stats.spinPolls = spinPolls_.load(std::memory_order_relaxed);
+        stats.spinHits = spinHits_.load(std::memory_order_relaxed);
+        stats.blockingWaits = blockingWaits_.load(std::memory_order_relaxed);
+        stats.eventWakeups = eventWakeups_.load(std::memory_order_relaxed);
+        stats.timeoutWakeups = timeoutWakeups_.load(std::memory_order_relaxed);
+        stats.eventDrainSum = eventDrainSum_.load(std::memory_order_relaxed);
+        stats.eventDrainMax = eventDrainMax_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
 protected:
     void
     run() override {
-        NIXL_DEBUG << "shared " << *this << " running";
+        NIXL_DEBUG << "shared " << *this << " running, spin budget " << spinBudget_ << "us";
         // Set timeout event so that the main loop would progress all workers on first iteration
         bool timeout = true;
         bool pthr_stop = false;
         while (!pthr_stop) {
+            const nixlTime::us_t drain_start = nixlTime::getUs();
+            bool active = false;
             for (size_t i = 0; i < pollFds_.size() - 1; i++) {
                 if (!(pollFds_[i].revents & POLLIN) && !timeout) continue;
+                active |= drainWorker(getWorkers()[i]);
+            }
+
+            // Measured from the return of poll(), the time before it is not observable here
+            if (!timeout) {
+                recordEventDrain(nixlTime::getUs() - drain_start);
+            }
+
+            // Traffic usually comes in bursts: keep polling for a while instead of paying the
+            // cost of arm() + poll() + wakeup for every small message
+            const bool spun = active && spinBudget_ > 0 && spin();
+
+            for (size_t i = 0; i < pollFds_.size() - 1; i++) {
+                if (!(pollFds_[i].revents & POLLIN) && !timeout && !spun) continue;
                 pollFds_[i].revents = 0;
                 nixlUcxWorker *worker = getWorkers()[i];
                 do {
@@ -332,13 +448,17 @@ protected:
             }
             timeout = false;
 
+            blockingWaits_.fetch_add(1, std::memory_order_relaxed);
             int ret;
             while ((ret = poll(pollFds_.data(), pollFds_.size(), delay_.count())) < 0)
                 NIXL_PTRACE << "Call to poll() was interrupted, retrying";
 
             if (!ret) {
                 timeout = true;
-            } else if (pollFds_.back().revents & POLLIN) {
+                timeoutWakeups_.fetch_add(1, std::memory_order_relaxed);
+            } else if (!(pollFds_.back().revents & POLLIN)) {
+                eventWakeups_.fetch_add(1, std::memory_order_relaxed);
+            } else {
                 pollFds_.back().revents = 0;
 
                 char signal;
@@ -353,9 +473,62 @@ protected:
     }
 
 private:
+    [[nodiscard]] static bool
+    drainWorker(nixlUcxWorker *worker) {
+        if (worker->progress() == 0) {
+            return false;
+        }
+        worker->progressLoop();
+        return true;
+    }
+
+    /*
+     * Busy-poll all workers until none of them made progress for the whole spin budget.
+     * Returns true if the workers were polled and hence need to be re-armed.
+     */
+    bool
+    spin() {
+        nixlTime::us_t deadline = nixlTime::getUs() + spinBudget_;
+        while (!stopping_.load(std::memory_order_relaxed)) {
+            bool active = false;
+            for (nixlUcxWorker *worker : getWorkers()) {
+                active |= drainWorker(worker);
+            }
+
+            spinPolls_.fetch_add(1, std::memory_order_relaxed);
+            const nixlTime::us_t now = nixlTime::getUs();
+            if (active) {
+                spinHits_.fetch_add(1, std::memory_order_relaxed);
+                deadline = now + spinBudget_;
+            } else if (now >= deadline) {
+                break;
+            }
+        }
+        return true;
+    }
+
+    void
+    recordEventDrain(nixlTime::us_t duration) noexcept {
+        eventDrainSum_.fetch_add(duration, std::memory_order_relaxed);
+        // Only the progress thread writes the maximum, no need for a CAS loop
+        if (duration > eventDrainMax_.load(std::memory_order_relaxed)) {
+            eventDrainMax_.store(duration, std::memory_order_relaxed);
+        }
+    }
+
     std::chrono::milliseconds delay_;
+    const nixlTime::us_t spinBudget_;
     int controlPipe_[2];
     std::vector<pollfd> pollFds_;
+    std::atomic<bool> stopping_{false};
+
+    std::atomic<uint64_t> spinPolls_{0};
+    std::atomic<uint64_t> spinHits_{0};
+    std::atomic<uint64_t> blockingWaits_{0};
+    std::atomic<uint64_t> eventWakeups_{0};
+    std::atomic<uint64_t> timeoutWakeups_{0};
+    std::atomic<nixlTime::us_t> eventDrainSum_{0};
+    std::atomic<nixlTime::us_t> eventDrainMax_{0};
 };
 
 nixlUcxThreadEngine::nixlUcxThreadEngine(const nixlBackendInitParams &init_params)
@@ -365,7 +538,8 @@ nixlUcxThreadEngine::nixlUcxThreadEngine(const nixlBackendInitParams &init_param
     }
 
     size_t num_workers = getWorkers().size();
-    thread_ = std::make_unique<nixlUcxSharedThread>(this, num_workers, init_params.pthrDelay);
+    thread_ = std::make_unique<nixlUcxSharedThread>(
+        this, num_workers, init_params.pthrDelay, getProgressParams(init_params));
     for (size_t i = 0; i < num_workers; i++) {
         thread_->addWorker(getWorkers()[i].get(), i);
     }
@@ -376,6 +550,11 @@ nixlUcxThreadEngine::~nixlUcxThreadEngine() {
     thread_->join();
 }
 
+std::optional<nixlUcxProgressStats>
+nixlUcxThreadEngine::getProgressStats() const {
+    return static_cast<const nixlUcxSharedThread &>(*thread_).getStats();
+}
+
 void
 nixlUcxThreadEngine::appendNotif(std::string &&remote_name, std::string &&msg) {
     const std::lock_guard lock(notifMutex_);
@@ -458,6 +637,7 @@ nixlUcxChunkBackendReqH::complete(const nixl_status_t status) {
     NIXL_ASSERT(sharedState_.get() != nullptr);
     if (status != NIXL_SUCCESS) {
         nixlUcxBackendReqH::release();
+        resetCanceled();
         sharedState_->status.store(status);
     }
     sharedState_->pendingReqs.fetch_sub(1);
@@ -468,10 +648,15 @@ nixlUcxChunkBackendReqH::complete(const nixl_status_t status) {
 
 nixl_status_t
 nixlUcxChunkBackendReqH::status() {
-    // First check if entire request was cancelled or failed
+    // First check if entire request was cancelled or failed. The chunk then aborts its
+    // requests, and completes once UCX no longer accesses their buffers.
     const nixl_status_t status = sharedState_->status.load();
     if (status != NIXL_SUCCESS) {
-        return status;
+        if (!isCanceled()) {
+            cancel();
+        }
+        getWorker()->progressLoop();
+        return hasInProgress() ? NIXL_IN_PROG : status;
     }
     return nixlUcxBackendReqH::status();
 }
@@ -536,6 +721,13 @@ public:
         }
     }
 
+    void
+    cancel() override {
+        nixlUcxBackendReqH::cancel();
+        // Chunks see the failed status and cancel their requests on their own workers
+        sharedState_->status.store(NIXL_ERR_CANCELED);
+    }
+
     [[nodiscard]] nixl_status_t
     status() override {
         getWorker()->progressLoop();
@@ -641,9 +833,10 @@ nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &in
 
     splitBatchSize_ = nixl_b_params_get(init_params.customParams, "split_batch_size", 1024);
 
+    const nixlUcxProgressParams progress_params = getProgressParams(init_params);
     if (init_params.enableProgTh) {
-        sharedThread_ =
-            std::make_unique<nixlUcxSharedThread>(this, numSharedWorkers_, init_params.pthrDelay);
+        sharedThread_ = std::make_unique<nixlUcxSharedThread>(
+            this, numSharedWorkers_, init_params.pthrDelay, progress_params);
         for (size_t i = 0; i < numSharedWorkers_; i++) {
             sharedThread_->addWorker(getWorkers()[i].get(), i);
         }
@@ -657,6 +850,7 @@ nixlUcxThreadPoolEngine::nixlUcxThreadPoolEngine(const nixlBackendInitParams &in
             size_t worker_id = numSharedWorkers_ + i;
             dedicatedThreads_.emplace_back(std::make_unique<nixlUcxDedicatedThread>(this, *io_));
             dedicatedThreads_.back()->addWorker(getWorker(worker_id).get(), worker_id);
+            dedicatedThreads_.back()->setAffinity(progress_params.cpus);
             dedicatedThreads_.back()->start();
         }
     }
@@ -754,6 +948,14 @@ nixlUcxThreadPoolEngine::sendXferRange(const nixl_xfer_op_t &operation,
     return status.load();
 }
 
+std::optional<nixlUcxProgressStats>
+nixlUcxThreadPoolEngine::getProgressStats() const {
+    if (!sharedThread_) {
+        return std::nullopt;
+    }
+    return static_cast<const nixlUcxSharedThread &>(*sharedThread_).getStats();
+}
+
 void
 nixlUcxThreadPoolEngine::appendNotif(std::string &&remote_name, std::string &&msg) {
     const std::lock_guard lock(notifMutex_);
@@ -957,26 +1159,44 @@ nixl_status_t nixlUcxEngine::getPublicData (const nixlBackendMD* meta,
     return NIXL_SUCCESS;
 }
 
-namespace {
-
-[[nodiscard]] std::vector<nixl::ucx::rkey>
-makePublicMetadataRkeys(const ucx_connection_ptr_t &conn, const size_t count, const void *buffer) {
-    std::vector<nixl::ucx::rkey> result;
-    result.reserve(count);
+nixlUcxPublicMetadata::nixlUcxPublicMetadata(const ucx_connection_ptr_t &conn,
+                                             size_t num_workers,
+                                             const nixl_blob_t &rkey_buffer)
+    : nixlBackendMD(false),
+      conn(conn),
+      rkeyBuffer_(rkey_buffer),
+      numWorkers_(num_workers),
+      rkeys_(std::make_unique<std::atomic<nixl::ucx::rkey *>[]>(num_workers)) {
+    for (size_t i = 0; i < numWorkers_; ++i) {
+        rkeys_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
 
-    for (size_t i = 0; i < count; ++i) {
-        result.emplace_back(*conn->getEp(i), buffer);
+nixlUcxPublicMetadata::~nixlUcxPublicMetadata() {
+    for (size_t i = 0; i < numWorkers_; ++i) {
+        delete rkeys_[i].load(std::memory_order_relaxed);
     }
-    return result;
 }
 
-} // namespace
+const nixl::ucx::rkey *
+nixlUcxPublicMetadata::unpackRkey(size_t id) const noexcept {
+    std::unique_ptr<nixl::ucx::rkey> unpacked;
+    try {
+        unpacked = std::make_unique<nixl::ucx::rkey>(*conn->getEp(id), rkeyBuffer_.data());
+    }
+    catch (const std::exception &e) {
+        NIXL_ERROR << e.what();
+        return nullptr;
+    }
 
-nixlUcxPublicMetadata::nixlUcxPublicMetadata(const ucx_connection_ptr_t &conn,
-                                             std::vector<nixl::ucx::rkey> &&rkeys)
-    : nixlBackendMD(false),
-      conn(conn),
-      rkeys_(std::move(rkeys)) {}
+    // Threads racing on the same worker each unpack, the first to publish wins
+    nixl::ucx::rkey *expected = nullptr;
+    if (rkeys_[id].compare_exchange_strong(
+            expected, unpacked.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return unpacked.release();
+    }
+    return expected;
+}
 
 nixl_status_t
 nixlUcxEngine::internalMDHelper (const nixl_blob_t &blob,
@@ -989,9 +1209,8 @@ nixlUcxEngine::internalMDHelper (const nixl_blob_t &blob,
             // TODO: err: remote connection not found
             return NIXL_ERR_NOT_FOUND;
         }
-        // nixlSerDes::_stringToBytes() was used to "unpack" blob here.
-        output = new nixlUcxPublicMetadata(
-            it->second, makePublicMetadataRkeys(it->second, uws.size(), blob.data()));
+        // Only the packed rkey is kept, it is unpacked per worker on first use
+        output = new nixlUcxPublicMetadata(it->second, uws.size(), blob);
         return NIXL_SUCCESS;
     }
     catch (const std::runtime_error &e) {
@@ -1102,8 +1321,9 @@ nixl_status_t nixlUcxEngine::estimateXferCost (const nixl_xfer_op_t &operation,
                                                nixl_cost_t &method,
                                                const nixl_opt_args_t* opt_args) const
 {
+    // The agent may estimate before prepXfer, when choosing between backends
     const auto int_handle = static_cast<nixlUcxBackendReqH *>(handle);
-    const size_t worker_id = int_handle->getWorkerId();
+    const size_t worker_id = int_handle ? int_handle->getWorkerId() : getWorkerId();
 
     if (local.descCount() != remote.descCount()) {
         NIXL_ERROR << "Local (" << local.descCount() << ") and remote (" << remote.descCount()
@@ -1173,10 +1393,20 @@ nixlUcxEngine::sendXferRangeBatch(nixlUcxEp &ep,
         }
 
         ++result.size;
+        const nixl::ucx::rkey *rkey = rmd->getRkey(worker_id);
+        if (__builtin_expect(rkey == nullptr, 0)) {
+            result.status = NIXL_ERR_BACKEND;
+            if (result.req != nullptr) {
+                ucp_request_free(result.req);
+                result.req = nullptr;
+            }
+            break;
+        }
+
         nixlUcxReq req;
         const nixl_status_t ret = operation == NIXL_READ ?
-            ep.read(raddr, rmd->getRkey(worker_id), laddr, lmd->mem, lsize, req) :
-            ep.write(laddr, lmd->mem, raddr, rmd->getRkey(worker_id), lsize, req);
+            ep.read(raddr, *rkey, laddr, lmd->mem, lsize, req) :
+            ep.write(laddr, lmd->mem, raddr, *rkey, lsize, req);
 
         if (ret == NIXL_IN_PROG) {
             if (__builtin_expect(result.req != nullptr, 1)) {
@@ -1270,6 +1500,11 @@ nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
     }
 
     // TODO: assert that handle is empty/completed, as we can't post request before completion
+    if (int_handle->isCanceled()) {
+        // Drop what is left of the canceled post, so that its requests are not seen again
+        int_handle->nixlUcxBackendReqH::release();
+        int_handle->resetCanceled();
+    }
 
     ret = sendXferRange(operation, local, remote, remote_agent, handle, 0, lcnt);
     if (ret != NIXL_SUCCESS) {
@@ -1301,7 +1536,19 @@ nixlUcxEngine::postXfer(const nixl_xfer_op_t &operation,
 nixl_status_t nixlUcxEngine::checkXfer (nixlBackendReqH* handle) const
 {
     const auto int_handle = static_cast<nixlUcxBackendReqH *>(handle);
-    const nixl_status_t handle_status = int_handle->status();
+    nixl_status_t handle_status = int_handle->status();
+
+    // Aborted requests complete with UCS_ERR_CANCELED, reported as a disconnect. The status
+    // of the last request is returned first, so the cancellation is only reported, and the
+    // requests released, once none of them is in progress. The composite state is kept for a
+    // repost.
+    if (__builtin_expect(int_handle->isCanceled(), 0) && (handle_status < 0)) {
+        if (int_handle->hasInProgress()) {
+            return NIXL_IN_PROG;
+        }
+        int_handle->nixlUcxBackendReqH::release();
+        handle_status = NIXL_ERR_CANCELED;
+    }
 
     if ((handle_status == NIXL_IN_PROG) || !int_handle->notif) {
         return handle_status;
@@ -1330,6 +1577,15 @@ nixl_status_t nixlUcxEngine::checkXfer (nixlBackendReqH* handle) const
     return int_handle->status();
 }
 
+nixl_status_t
+nixlUcxEngine::cancelXfer(nixlBackendReqH *handle) const {
+    const auto int_handle = static_cast<nixlUcxBackendReqH *>(handle);
+    // RMA operations already in flight are not aborted by UCX and may still complete. The
+    // notification is then sent by checkXfer as usual, and dropped if the transfer failed.
+    int_handle->cancel();
+    return checkXfer(handle);
+}
+
 nixl_status_t nixlUcxEngine::releaseReqH(nixlBackendReqH* handle) const
 {
     const auto int_handle = static_cast<nixlUcxBackendReqH *>(handle);
@@ -76,20 +76,46 @@ class nixlUcxPrivateMetadata : public nixlBackendMD {
 };
 
 // A public metadata has to implement put, and only has the remote metadata
+// The packed rkey is unpacked on first use for each worker, most remote regions of a large
+// peer are never accessed from every worker
 class nixlUcxPublicMetadata : public nixlBackendMD {
 public:
     nixlUcxPublicMetadata() = delete;
-    nixlUcxPublicMetadata(const ucx_connection_ptr_t &conn, std::vector<nixl::ucx::rkey> &&rkeys);
-
-    [[nodiscard]] const nixl::ucx::rkey &
-    getRkey(const size_t id) const {
-        return rkeys_[id];
+    nixlUcxPublicMetadata(const ucx_connection_ptr_t &conn,
+                          size_t num_workers,
+                          const nixl_blob_t &rkey_buffer);
+    ~nixlUcxPublicMetadata();
+
+    // Returns nullptr if the rkey could not be unpacked
+    [[nodiscard]] const nixl::ucx::rkey *
+    getRkey(const size_t id) const noexcept {
+        const nixl::ucx::rkey *rkey = rkeys_[id].load(std::memory_order_acquire);
+        return __builtin_expect(rkey != nullptr, 1) ? rkey : unpackRkey(id);
     }
 
     const ucx_connection_ptr_t conn;
 
 private:
-    const std::vector<nixl::ucx::rkey> rkeys_;
+    [[nodiscard]] const nixl::ucx::rkey *
+    unpackRkey(size_t id) const noexcept;
+
+    const nixl_blob_t rkeyBuffer_;
+    const size_t numWorkers_;
+    const std::unique_ptr<std::atomic<nixl::ucx::rkey *>[]> rkeys_;
+};
+
+/**
+ * Snapshot of the shared progress thread counters. The progress thread busy-polls its workers
+ * for "progress_spin_us" after any activity and only then arms them and blocks in poll().
+ */
+struct nixlUcxProgressStats {
+    uint64_t spinPolls = 0; ///< Busy-poll iterations over all workers
+    uint64_t spinHits = 0; ///< Busy-poll iterations that progressed at least one worker
+    uint64_t blockingWaits = 0; ///< Times the thread armed its workers and blocked in poll()
+    uint64_t eventWakeups = 0; ///< poll() returns caused by worker events
+    uint64_t timeoutWakeups = 0; ///< poll() returns caused by the periodic timeout
+    nixlTime::us_t eventDrainSum = 0; ///< Total time to drain signalled workers after event wakeups
+    nixlTime::us_t eventDrainMax = 0; ///< Longest time to drain signalled workers after a wakeup
 };
 
 class nixlUcxEngine : public nixlBackendEngine {
@@ -114,6 +140,18 @@ public:
         return true;
     }
 
+    // Remote metadata is only copied at load time, rkeys are unpacked on first use
+    bool
+    supportsConcurrentLoadMD() const override {
+        return true;
+    }
+
+    // Handles only depend on the worker and the descriptor count
+    bool
+    supportsPrepReuse() const override {
+        return true;
+    }
+
     nixl_mem_list_t
     getSupportedMems() const override;
 
@@ -139,6 +177,15 @@ public:
     nixl_status_t
     loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override;
 
+    /**
+     * Get the counters of the shared progress thread.
+     * Returns std::nullopt if the engine runs without a progress thread.
+     */
+    [[nodiscard]] virtual std::optional<nixlUcxProgressStats>
+    getProgressStats() const {
+        return std::nullopt;
+    }
+
     nixl_status_t
     loadRemoteMD(const nixlBlobDesc &input,
                  const nixl_mem_t &nixl_mem,
@@ -179,6 +226,8 @@ public:
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override;
 
     unsigned
     progress();
@@ -310,6 +359,9 @@ public:
     nixl_status_t
     getNotifs(notif_list_t &notif_list) override;
 
+    [[nodiscard]] std::optional<nixlUcxProgressStats>
+    getProgressStats() const override;
+
 protected:
     void
     appendNotif(std::string &&remote_name, std::string &&msg) override;
@@ -344,6 +396,9 @@ public:
     nixl_status_t
     getNotifs(notif_list_t &notif_list) override;
 
+    [[nodiscard]] std::optional<nixlUcxProgressStats>
+    getProgressStats() const override;
+
 protected:
     void
     appendNotif(std::string &&remote_name, std::string &&msg) override;
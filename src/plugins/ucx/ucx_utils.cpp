@@ -33,7 +33,11 @@
 
 [[nodiscard]] nixl_b_params_t
 get_ucx_backend_common_options() {
-    nixl_b_params_t params = {{"ucx_devices", ""}, {"num_workers", "1"}};
+    nixl_b_params_t params = {{"ucx_devices", ""},
+                              {"num_workers", "1"},
+                              {"progress_spin_us", "0"},
+                              {"progress_cpus", ""},
+                              {"progress_numa_node", "-1"}};
 
     params.emplace(nixl_ucx_err_handling_param_name,
                    ucx_err_mode_to_string(UCP_ERR_HANDLING_MODE_PEER));
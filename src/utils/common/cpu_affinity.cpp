@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cpu_affinity.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "nixl_log.h"
+
+namespace nixl {
+
+namespace {
+
+    [[nodiscard]] unsigned
+    parseCpuId(std::string_view token, std::string_view cpu_list) {
+        if (token.empty() ||
+            !std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+            throw std::invalid_argument("Invalid CPU list '" + std::string(cpu_list) + "'");
+        }
+
+        try {
+            return static_cast<unsigned>(std::stoul(std::string(token)));
+        }
+        catch (const std::out_of_range &) {
+            throw std::invalid_argument("CPU id out of range in '" + std::string(cpu_list) + "'");
+        }
+    }
+
+    [[nodiscard]] std::string_view
+    trim(std::string_view str) noexcept {
+        const auto first = str.find_first_not_of(" \t\n");
+        if (first == std::string_view::npos) {
+            return {};
+        }
+        const auto last = str.find_last_not_of(" \t\n");
+        return str.substr(first, last - first + 1);
+    }
+
+} // namespace
+
+std::vector<unsigned>
+parseCpuList(std::string_view cpu_list) {
+    std::vector<unsigned> cpus;
+    std::string_view remaining = trim(cpu_list);
+
+    while (!remaining.empty()) {
+        const auto comma = remaining.find(',');
+        const std::string_view item = trim(remaining.substr(0, comma));
+        remaining = (comma == std::string_view::npos) ? std::string_view{} :
+                                                        remaining.substr(comma + 1);
+
+        const auto dash = item.find('-');
+        if (dash == std::string_view::npos) {
+            cpus.push_back(parseCpuId(item, cpu_list));
+            continue;
+        }
+
+        const unsigned first = parseCpuId(trim(item.substr(0, dash)), cpu_list);
+        const unsigned last = parseCpuId(trim(item.substr(dash + 1)), cpu_list);
+        if (first > last) {
+            throw std::invalid_argument("Invalid CPU range in '" + std::string(cpu_list) + "'");
+        }
+        for (unsigned cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::vector<unsigned>
+getNumaNodeCpus(unsigned numa_node) {
+    const std::string path =
+        "/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist";
+    std::ifstream file(path);
+    std::string cpu_list;
+    if (!file.is_open() || !std::getline(file, cpu_list)) {
+        NIXL_DEBUG << "Failed to read " << path;
+        return {};
+    }
+
+    try {
+        return parseCpuList(cpu_list);
+    }
+    catch (const std::invalid_argument &e) {
+        NIXL_WARN << "Failed to parse " << path << ": " << e.what();
+        return {};
+    }
+}
+
+bool
+setThreadAffinity(const std::vector<unsigned> &cpus) {
+    if (cpus.empty()) {
+        return true;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const unsigned cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            NIXL_WARN << "Ignoring CPU " << cpu << " beyond CPU_SETSIZE";
+            continue;
+        }
+        CPU_SET(cpu, &set);
+    }
+
+    const int ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (ret != 0) {
+        NIXL_WARN << "Failed to set thread affinity: " << strerror(ret);
+        return false;
+    }
+    return true;
+}
+
+} // namespace nixl
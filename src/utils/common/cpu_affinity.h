@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_UTILS_COMMON_CPU_AFFINITY_H
+#define NIXL_SRC_UTILS_COMMON_CPU_AFFINITY_H
+
+#include <string_view>
+#include <vector>
+
+namespace nixl {
+
+/**
+ * @brief Parse a Linux style CPU list, e.g. "0-3,8,10-11".
+ *
+ * @param cpu_list Comma separated list of CPU ids and inclusive ranges
+ * @return Sorted list of unique CPU ids, empty if @a cpu_list is empty
+ * @throws std::invalid_argument on malformed input
+ */
+[[nodiscard]] std::vector<unsigned>
+parseCpuList(std::string_view cpu_list);
+
+/**
+ * @brief Get the CPUs local to a NUMA node, as reported by sysfs.
+ *
+ * @param numa_node NUMA node id
+ * @return CPU ids of the node, empty if the node does not exist
+ */
+[[nodiscard]] std::vector<unsigned>
+getNumaNodeCpus(unsigned numa_node);
+
+/**
+ * @brief Bind the calling thread to a set of CPUs.
+ *
+ * @param cpus CPU ids to run on, no-op if empty
+ * @return true on success or if @a cpus is empty
+ */
+[[nodiscard]] bool
+setThreadAffinity(const std::vector<unsigned> &cpus);
+
+} // namespace nixl
+
+#endif // NIXL_SRC_UTILS_COMMON_CPU_AFFINITY_H
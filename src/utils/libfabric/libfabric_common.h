@@ -48,6 +48,10 @@
 #define NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE 8192 // For SEND/RECV notifications
 #define NIXL_LIBFABRIC_RECV_POOL_SIZE 1024 // Number of recv requests to pre-post per rail
 
+// Rail load balancing constants
+#define NIXL_LIBFABRIC_BW_SAMPLE_MIN_BYTES (64 * 1024) // Smaller transfers are latency-bound
+#define NIXL_LIBFABRIC_BW_EWMA_WEIGHT 0.125 // Weight of a new bandwidth sample
+
 // Retry configuration constants
 #define NIXL_LIBFABRIC_LOG_INTERVAL_ATTEMPTS 100 // Log every N attempts to avoid spam
 
@@ -18,36 +18,110 @@
 
 #include "libfabric_rail.h"
 #include "common/nixl_log.h"
+#include "common/nixl_time.h"
 #include "serdes/serdes.h"
 #include "libfabric_common.h"
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
-#include <stack>
+#include <utility>
 
 // RequestPool Base Class Implementation
 
+namespace {
+
+constexpr uint64_t FREE_TAG_SHIFT = 32;
+constexpr uint64_t FREE_LINK_MASK = (1ULL << FREE_TAG_SHIFT) - 1;
+
+} // namespace
+
 RequestPool::RequestPool(size_t pool_size, size_t rail_id)
     : rail_id_(rail_id),
       initial_pool_size_(pool_size) {
-    initializeBasePool(pool_size);
+    if (pool_size == 0 || pool_size * MAX_BLOCKS >= FREE_LINK_MASK) {
+        throw std::invalid_argument("Invalid request pool size " + std::to_string(pool_size));
+    }
+    addBlock();
+    publishBlock();
+}
+
+nixlLibfabricReq *
+RequestPool::addBlock() {
+    const size_t first_idx = total_requests_.load(std::memory_order_relaxed);
+    const size_t block_idx = first_idx / initial_pool_size_;
+    if (block_idx >= MAX_BLOCKS) {
+        NIXL_ERROR << "AddBlock on Rail " << rail_id_ << " reached the maximum of " << MAX_BLOCKS
+                   << " blocks (" << first_idx << " requests)";
+        return nullptr;
+    }
+
+    blocks_[block_idx] = std::make_unique<nixlLibfabricReq[]>(initial_pool_size_);
+    for (size_t i = 0; i < initial_pool_size_; ++i) {
+        blocks_[block_idx][i].rail_id = rail_id_;
+        blocks_[block_idx][i].pool_index = first_idx + i;
+    }
+    return blocks_[block_idx].get();
 }
 
 void
-RequestPool::initializeBasePool(size_t pool_size) {
-    size_t current_size = requests_.size();
-    requests_.resize(current_size + pool_size);
+RequestPool::publishBlock() {
+    const size_t first_idx = total_requests_.load(std::memory_order_relaxed);
+    const size_t block_idx = first_idx / initial_pool_size_;
+    NIXL_ASSERT(block_idx < MAX_BLOCKS && blocks_[block_idx]);
 
-    for (size_t i = current_size; i < requests_.size(); ++i) {
-        requests_[i].rail_id = rail_id_;
-        requests_[i].pool_index = i; // Set the pool index for deque compatibility
-        requests_[i].in_use = false;
-        free_indices_.push(i);
+    total_requests_.store(first_idx + initial_pool_size_, std::memory_order_release);
+    // Push in reverse order so that allocation starts from the lowest index
+    for (size_t i = initial_pool_size_; i > 0; --i) {
+        pushFree(&blocks_[block_idx][i - 1]);
     }
 
-    NIXL_DEBUG << "InitializeBasePool - Rail " << rail_id_
-               << " completed. Total requests: " << requests_.size()
-               << " Free requests: " << free_indices_.size();
+    NIXL_DEBUG << "PublishBlock - Rail " << rail_id_
+               << " completed. Total requests: " << getTotalRequestCount()
+               << " Free requests: " << free_count_.load(std::memory_order_relaxed);
+}
+
+nixlLibfabricReq &
+RequestPool::requestAt(size_t idx) const {
+    return blocks_[idx / initial_pool_size_][idx % initial_pool_size_];
+}
+
+nixlLibfabricReq *
+RequestPool::popFree() const {
+    uint64_t head = free_head_.load(std::memory_order_acquire);
+    while (true) {
+        const uint64_t link = head & FREE_LINK_MASK;
+        if (link == 0) {
+            return nullptr;
+        }
+
+        // The request may be popped and reused concurrently, in which case the tag of the head
+        // changes and the CAS below fails; the stale next link is never used
+        nixlLibfabricReq *req = &requestAt(link - 1);
+        const uint64_t next = req->next_free.load(std::memory_order_relaxed);
+        const uint64_t new_head = ((head >> FREE_TAG_SHIFT) + 1) << FREE_TAG_SHIFT | next;
+        if (free_head_.compare_exchange_weak(
+                head, new_head, std::memory_order_acquire, std::memory_order_acquire)) {
+            free_count_.fetch_sub(1, std::memory_order_relaxed);
+            return req;
+        }
+    }
+}
+
+void
+RequestPool::pushFree(nixlLibfabricReq *req) const {
+    const uint64_t link = req->pool_index + 1;
+    uint64_t head = free_head_.load(std::memory_order_relaxed);
+    while (true) {
+        req->next_free.store(static_cast<uint32_t>(head & FREE_LINK_MASK),
+                             std::memory_order_relaxed);
+        const uint64_t new_head = ((head >> FREE_TAG_SHIFT) + 1) << FREE_TAG_SHIFT | link;
+        if (free_head_.compare_exchange_weak(
+                head, new_head, std::memory_order_release, std::memory_order_relaxed)) {
+            free_count_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
 }
 
 void
@@ -57,47 +131,40 @@ RequestPool::release(nixlLibfabricReq *req) const {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(pool_mutex_);
+    // Validate the index is within bounds
+    if (req->pool_index >= getTotalRequestCount() || &requestAt(req->pool_index) != req) {
+        NIXL_ERROR << "Release Req on Rail " << rail_id_ << " invalid pool index "
+                   << req->pool_index << " for request release (pool size="
+                   << getTotalRequestCount() << ")";
+        return;
+    }
+
+    NIXL_TRACE << "ReleaseReq on Rail " << rail_id_ << " releasing request XFER_ID=" << req->xfer_id
+               << " pool_index=" << req->pool_index;
 
     // GUARD: Check if already released
-    if (!req->in_use) {
+    if (!req->in_use.exchange(false, std::memory_order_acq_rel)) {
         NIXL_WARN << "Attempt to double-release request XFER_ID=" << req->xfer_id << " on rail "
                   << rail_id_ << " - ignoring to prevent corruption";
         return;
     }
 
-    NIXL_TRACE << "ReleaseReq on Rail " << rail_id_ << " releasing request XFER_ID=" << req->xfer_id
-               << " pool_index=" << req->pool_index;
-
-    req->in_use = false;
     req->xfer_id = 0;
     req->chunk_offset = 0;
     req->chunk_size = 0;
     req->completion_callback = nullptr;
     memset(&req->ctx, 0, sizeof(fi_context));
 
-    // Use pool_index instead of pointer arithmetic for deque compatibility
-    size_t idx = req->pool_index;
-
-    // Validate the index is within bounds
-    if (idx >= requests_.size()) {
-        NIXL_ERROR << "Release Req on Rail " << rail_id_ << " invalid pool index " << idx
-                   << " for request release (pool size=" << requests_.size() << ")";
-        return;
-    }
-
-    free_indices_.push(idx);
+    pushFree(req);
 }
 
 nixlLibfabricReq *
-RequestPool::findByContext(void *context) const {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-
+RequestPool::findByContext(void *context) noexcept {
     if (!context) {
         return nullptr;
     }
 
-    // Since fi_context2 ctx is the first member of nixlLibfabricReq,
+    // Since fi_context ctx is the first member of nixlLibfabricReq,
     // we can directly cast the context pointer to the request pointer
     nixlLibfabricReq *req = reinterpret_cast<nixlLibfabricReq *>(context);
 
@@ -105,49 +172,56 @@ RequestPool::findByContext(void *context) const {
     return req;
 }
 
+size_t
+RequestPool::getTotalRequestCount() const {
+    return total_requests_.load(std::memory_order_acquire);
+}
+
 size_t
 RequestPool::getActiveRequestCount() const {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-    return requests_.size() - free_indices_.size();
+    const size_t total = getTotalRequestCount();
+    const size_t free_count = free_count_.load(std::memory_order_relaxed);
+    return (total > free_count) ? total - free_count : 0;
 }
 
 size_t
 RequestPool::getPoolUtilization() const {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-    return ((requests_.size() - free_indices_.size()) * 100) / requests_.size();
+    return (getActiveRequestCount() * 100) / getTotalRequestCount();
 }
 
 nixlLibfabricReq *
 RequestPool::allocateReq(uint32_t req_id) {
-    std::lock_guard<std::mutex> lock(pool_mutex_);
-
-    if (free_indices_.empty()) {
-        size_t old_size = requests_.size();
+    nixlLibfabricReq *req = popFree();
+    if (!req) {
+        const std::lock_guard<std::mutex> lock(expand_mutex_);
+
+        // Another thread may have expanded the pool or released requests meanwhile
+        req = popFree();
+        if (!req) {
+            size_t old_size = getTotalRequestCount();
+
+            // Try to expand the pool using the derived class implementation
+            nixl_status_t expand_status = expandPool();
+            if (expand_status != NIXL_SUCCESS) {
+                NIXL_ERROR << "AllocateReq on Rail " << rail_id_
+                           << " failed to expand pool, status=" << expand_status;
+                return nullptr;
+            }
 
-        // Try to expand the pool using the derived class implementation
-        nixl_status_t expand_status = expandPool();
-        if (expand_status != NIXL_SUCCESS) {
-            NIXL_ERROR << "AllocateReq on Rail " << rail_id_
-                       << " failed to expand pool, status=" << expand_status;
-            return nullptr;
-        }
+            // Check if expansion provided new requests
+            req = popFree();
+            if (!req) {
+                NIXL_ERROR << "AllocateReq on Rail " << rail_id_
+                           << " pool still exhausted after expansion";
+                return nullptr;
+            }
 
-        // Check if expansion provided new requests
-        if (free_indices_.empty()) {
-            NIXL_ERROR << "AllocateReq on Rail " << rail_id_
-                       << " pool still exhausted after expansion";
-            return nullptr;
+            NIXL_DEBUG << "AllocateReq on Rail " << rail_id_ << " successfully expanded pool from "
+                       << old_size << " to " << getTotalRequestCount() << " requests";
         }
-
-        NIXL_DEBUG << "AllocateReq on Rail " << rail_id_ << " successfully expanded pool from "
-                   << old_size << " to " << requests_.size() << " requests";
     }
 
-    size_t idx = free_indices_.top();
-    free_indices_.pop();
-
-    nixlLibfabricReq *req = &requests_[idx];
-    req->in_use = true;
+    req->in_use.store(true, std::memory_order_relaxed);
     req->xfer_id = req_id;
 
     return req;
@@ -232,13 +306,14 @@ ControlRequestPool::initialize(struct fid_domain *domain) {
     buffer_chunks_.push_back(initial_chunk);
 
     // Pre-assign buffers to requests
-    for (size_t i = 0; i < requests_.size(); ++i) {
+    for (size_t i = 0; i < getTotalRequestCount(); ++i) {
+        nixlLibfabricReq &req = requestAt(i);
         void *buffer_addr =
             static_cast<char *>(initial_chunk.buffer) + (i * NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE);
-        requests_[i].buffer = buffer_addr;
-        requests_[i].mr = initial_chunk.mr;
-        requests_[i].buffer_size = NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE;
-        requests_[i].operation_type = nixlLibfabricReq::SEND; // Default for control
+        req.buffer = buffer_addr;
+        req.mr = initial_chunk.mr;
+        req.buffer_size = NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE;
+        req.operation_type = nixlLibfabricReq::SEND; // Default for control
     }
 
     NIXL_DEBUG << "InitializeWithBuffers on Rail " << rail_id_ << " successfully initialized with "
@@ -249,11 +324,9 @@ ControlRequestPool::initialize(struct fid_domain *domain) {
 
 nixl_status_t
 ControlRequestPool::expandPool() {
+    const size_t current_size = getTotalRequestCount();
     NIXL_DEBUG << "Expanding control request pool on rail " << rail_id_ << " from "
-               << requests_.size() << " to " << (requests_.size() * 2) << " requests";
-
-    size_t current_size = requests_.size();
-    size_t expansion_size = initial_pool_size_; // Add same amount as initial size
+               << current_size << " to " << (current_size + initial_pool_size_) << " requests";
 
     // Create new buffer chunk for the expansion
     BufferChunk new_chunk;
@@ -266,12 +339,15 @@ ControlRequestPool::expandPool() {
 
     buffer_chunks_.push_back(new_chunk);
 
-    // Expand the base pool (adds new requests to requests_ vector and free_indices_)
-    initializeBasePool(expansion_size);
+    // Add a block of requests, they become allocatable once their buffers are assigned
+    nixlLibfabricReq *new_requests = addBlock();
+    if (!new_requests) {
+        return NIXL_ERR_BACKEND;
+    }
 
     // Assign buffers to new requests
-    for (size_t i = current_size; i < requests_.size(); ++i) {
-        size_t local_idx = i - current_size;
+    for (size_t local_idx = 0; local_idx < initial_pool_size_; ++local_idx) {
+        const size_t i = current_size + local_idx;
         void *buffer_addr = static_cast<char *>(new_chunk.buffer) +
             (local_idx * NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE);
 
@@ -286,14 +362,16 @@ ControlRequestPool::expandPool() {
             return NIXL_ERR_BACKEND;
         }
 
-        requests_[i].buffer = buffer_addr;
-        requests_[i].mr = new_chunk.mr;
-        requests_[i].buffer_size = NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE;
-        requests_[i].operation_type = nixlLibfabricReq::SEND;
+        new_requests[local_idx].buffer = buffer_addr;
+        new_requests[local_idx].mr = new_chunk.mr;
+        new_requests[local_idx].buffer_size = NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE;
+        new_requests[local_idx].operation_type = nixlLibfabricReq::SEND;
     }
 
+    publishBlock();
+
     NIXL_DEBUG << "Successfully expanded control request pool on rail " << rail_id_ << " to "
-               << requests_.size() << " requests with " << buffer_chunks_.size()
+               << getTotalRequestCount() << " requests with " << buffer_chunks_.size()
                << " buffer chunks";
 
     return NIXL_SUCCESS;
@@ -336,36 +414,40 @@ DataRequestPool::DataRequestPool(size_t pool_size, size_t rail_id)
 nixl_status_t
 DataRequestPool::initialize() {
     // Initialize data requests
-    for (size_t i = 0; i < requests_.size(); ++i) {
-        requests_[i].buffer = nullptr; // No buffers for data requests
-        requests_[i].mr = nullptr;
-        requests_[i].buffer_size = 0;
-        requests_[i].operation_type = nixlLibfabricReq::WRITE; // Default for data
+    for (size_t i = 0; i < getTotalRequestCount(); ++i) {
+        nixlLibfabricReq &req = requestAt(i);
+        req.buffer = nullptr; // No buffers for data requests
+        req.mr = nullptr;
+        req.buffer_size = 0;
+        req.operation_type = nixlLibfabricReq::WRITE; // Default for data
     }
     return NIXL_SUCCESS;
 }
 
 nixl_status_t
 DataRequestPool::expandPool() {
-    NIXL_DEBUG << "Expanding data request pool on rail " << rail_id_ << " from " << requests_.size()
-               << " to " << (requests_.size() * 2) << " requests";
-
-    size_t current_size = requests_.size();
-    size_t expansion_size = initial_pool_size_; // Add same amount as initial size
+    const size_t current_size = getTotalRequestCount();
+    NIXL_DEBUG << "Expanding data request pool on rail " << rail_id_ << " from " << current_size
+               << " to " << (current_size + initial_pool_size_) << " requests";
 
-    // Expand the base pool (adds new requests to requests_ vector and free_indices_)
-    initializeBasePool(expansion_size);
+    // Add a block of requests, they become allocatable once initialized
+    nixlLibfabricReq *new_requests = addBlock();
+    if (!new_requests) {
+        return NIXL_ERR_BACKEND;
+    }
 
     // Initialize new requests
-    for (size_t i = current_size; i < requests_.size(); ++i) {
-        requests_[i].buffer = nullptr; // No buffers for data requests
-        requests_[i].mr = nullptr;
-        requests_[i].buffer_size = 0;
-        requests_[i].operation_type = nixlLibfabricReq::WRITE; // Default for data
+    for (size_t i = 0; i < initial_pool_size_; ++i) {
+        new_requests[i].buffer = nullptr; // No buffers for data requests
+        new_requests[i].mr = nullptr;
+        new_requests[i].buffer_size = 0;
+        new_requests[i].operation_type = nixlLibfabricReq::WRITE; // Default for data
     }
 
+    publishBlock();
+
     NIXL_DEBUG << "Successfully expanded data request pool on rail " << rail_id_ << " to "
-               << requests_.size() << " requests";
+               << getTotalRequestCount() << " requests";
 
     return NIXL_SUCCESS;
 }
@@ -738,6 +820,13 @@ nixlLibfabricRail::progressCompletionQueue() const {
                 NIXL_ERROR << "CQ read failed on rail " << rail_id
                            << " with error: " << fi_strerror(err_entry.err)
                            << " prov_errno: " << err_entry.prov_errno << " len: " << err_entry.len;
+                // The failed transfer no longer loads the rail
+                if (err_entry.op_context) {
+                    nixlLibfabricReq *req = findRequestFromContext(err_entry.op_context);
+                    if (req && req->in_use) {
+                        settleRequest(req);
+                    }
+                }
             } else {
                 NIXL_ERROR << "fi_cq_readerr failed with " << err_ret;
             }
@@ -869,6 +958,9 @@ nixlLibfabricRail::processLocalTransferCompletion(struct fi_cq_data_entry *comp,
     // Find the request from context to access the completion callback
     nixlLibfabricReq *req = findRequestFromContext(comp->op_context);
     if (req && req->in_use) { // Only process if request is still valid and in use
+        recordCompletion(std::exchange(req->outstanding_bytes, 0),
+                         nixlTime::getNs() - req->submit_ns);
+
         // Call completion callback if it exists
         if (req->completion_callback) {
             NIXL_TRACE << "Calling completion callback for " << operation_type << " request "
@@ -1119,6 +1211,10 @@ nixlLibfabricRail::postWrite(const void *local_buffer,
                << " dest_addr=" << dest_addr << " remote_addr=" << (void *)remote_addr
                << " remote_key=" << remote_key << " context=" << &req->ctx;
 
+    // Account before posting, the completion may be processed before fi_writedata returns
+    req->outstanding_bytes = length;
+    recordSubmit(length);
+
     // Retry indefinitely until writedata succeeds or fails for all providers
     int ret = -FI_EAGAIN;
     int attempt = 0;
@@ -1127,6 +1223,8 @@ nixlLibfabricRail::postWrite(const void *local_buffer,
         // Libfabric fi_writedata call
         {
             const std::lock_guard<std::mutex> ep_lock(ep_mutex_);
+            // Sampled from the attempt that is accepted, retries are not transfer time
+            req->submit_ns = nixlTime::getNs();
             ret = fi_writedata(endpoint,
                                local_buffer,
                                length,
@@ -1165,6 +1263,7 @@ nixlLibfabricRail::postWrite(const void *local_buffer,
                 if (progress_status != NIXL_SUCCESS && progress_status != NIXL_IN_PROG) {
                     NIXL_ERROR << "progressCompletionQueue failed on rail " << rail_id
                                << " during fi_writedata retry";
+                    settleRequest(req);
                     return progress_status;
                 }
                 if (progress_status == NIXL_SUCCESS) {
@@ -1180,6 +1279,7 @@ nixlLibfabricRail::postWrite(const void *local_buffer,
     }
 
     NIXL_ERROR << "fi_writedata failed on rail " << rail_id << ": " << fi_strerror(-ret);
+    settleRequest(req);
     return NIXL_ERR_BACKEND;
 }
 
@@ -1202,6 +1302,10 @@ nixlLibfabricRail::postRead(void *local_buffer,
                << " dest_addr=" << dest_addr << " remote_addr=" << (void *)remote_addr
                << " remote_key=" << remote_key << " context=" << &req->ctx;
 
+    // Account before posting, the completion may be processed before fi_read returns
+    req->outstanding_bytes = length;
+    recordSubmit(length);
+
     // Retry indefinitely until readdata succeeds or fails for all providers
     int ret = -FI_EAGAIN;
     int attempt = 0;
@@ -1210,6 +1314,8 @@ nixlLibfabricRail::postRead(void *local_buffer,
         // Libfabric fi_read call
         {
             const std::lock_guard<std::mutex> ep_lock(ep_mutex_);
+            // Sampled from the attempt that is accepted, retries are not transfer time
+            req->submit_ns = nixlTime::getNs();
             ret = fi_read(endpoint,
                           local_buffer,
                           length,
@@ -1247,6 +1353,7 @@ nixlLibfabricRail::postRead(void *local_buffer,
                 if (progress_status != NIXL_SUCCESS && progress_status != NIXL_IN_PROG) {
                     NIXL_ERROR << "progressCompletionQueue failed on rail " << rail_id
                                << " during fi_read retry";
+                    settleRequest(req);
                     return progress_status;
                 }
                 if (progress_status == NIXL_SUCCESS) {
@@ -1262,6 +1369,7 @@ nixlLibfabricRail::postRead(void *local_buffer,
     }
 
     NIXL_ERROR << "fi_read failed on rail " << rail_id << ": " << fi_strerror(-ret);
+    settleRequest(req);
     return NIXL_ERR_BACKEND;
 }
 
@@ -1497,6 +1605,9 @@ nixlLibfabricRail::releaseRequest(nixlLibfabricReq *req) const {
         return;
     }
 
+    // A request released before its completion, e.g. after a failed post, is not outstanding
+    settleRequest(req);
+
     // Determine which pool to release to based on operation type
     if (req->operation_type == nixlLibfabricReq::SEND ||
         req->operation_type == nixlLibfabricReq::RECV) {
@@ -1512,21 +1623,55 @@ nixlLibfabricRail::findRequestFromContext(void *context) const {
         NIXL_ERROR << "Null context provided to findRequestFromContext on rail " << rail_id;
         return nullptr;
     }
-    // Try control pool first
-    nixlLibfabricReq *req = control_request_pool_.findByContext(context);
-    if (req) {
-        return req;
-    }
-    // Try data pool
-    req = data_request_pool_.findByContext(context);
-    if (req) {
-        return req;
-    }
-    NIXL_ERROR << "No request found for context " << context << " on rail " << rail_id;
-    return nullptr;
+    // The context is embedded in the request, whichever pool it comes from
+    return RequestPool::findByContext(context);
 }
 
 fi_info *
 nixlLibfabricRail::getRailInfo() const {
     return info;
 }
+
+// Load Tracking Methods
+
+nixlLibfabricRailLoad
+nixlLibfabricRail::getLoad() const {
+    return {outstanding_bytes_.load(std::memory_order_relaxed),
+            bandwidth_.load(std::memory_order_relaxed)};
+}
+
+void
+nixlLibfabricRail::recordSubmit(size_t bytes) const {
+    outstanding_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void
+nixlLibfabricRail::recordCompletion(size_t bytes, uint64_t latency_ns) const {
+    size_t outstanding = outstanding_bytes_.load(std::memory_order_relaxed);
+    while (!outstanding_bytes_.compare_exchange_weak(outstanding,
+                                                     outstanding - std::min(outstanding, bytes),
+                                                     std::memory_order_relaxed)) {
+    }
+
+    if (latency_ns == 0 || bytes < NIXL_LIBFABRIC_BW_SAMPLE_MIN_BYTES) {
+        return;
+    }
+
+    // Completions may be processed concurrently, a lost update only delays convergence
+    const double sample = static_cast<double>(bytes) / latency_ns;
+    const double current = bandwidth_.load(std::memory_order_relaxed);
+    const double updated = (current == 0.0) ?
+        sample :
+        current + NIXL_LIBFABRIC_BW_EWMA_WEIGHT * (sample - current);
+    bandwidth_.store(updated, std::memory_order_relaxed);
+    NIXL_TRACE << "Rail " << rail_id << " bandwidth sample " << sample << " B/ns, estimate "
+               << updated << " B/ns";
+}
+
+void
+nixlLibfabricRail::settleRequest(nixlLibfabricReq *req) const {
+    const size_t bytes = std::exchange(req->outstanding_bytes, 0);
+    if (bytes != 0) {
+        recordCompletion(bytes, 0);
+    }
+}
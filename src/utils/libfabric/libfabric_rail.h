@@ -18,13 +18,14 @@
 #ifndef NIXL_SRC_UTILS_LIBFABRIC_LIBFABRIC_RAIL_H
 #define NIXL_SRC_UTILS_LIBFABRIC_LIBFABRIC_RAIL_H
 
+#include <array>
+#include <atomic>
 #include <vector>
-#include <deque>
 #include <string>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <ostream>
-#include <stack>
 
 #include "nixl.h"
 #include "backend/backend_aux.h"
@@ -36,11 +37,13 @@ class nixlLibfabricConnection;
 /**
  * @brief Request structure for libfabric operations
  *
+ * The libfabric context is the first member so that the op_context reported in a completion
+ * can be converted back to its request without any lookup.
  */
 struct nixlLibfabricReq {
     fi_context ctx; ///< Libfabric context for operation tracking
     size_t rail_id; ///< Rail ID that owns this request
-    size_t pool_index; ///< Index in the pool for deque compatibility
+    size_t pool_index; ///< Index of the request in its pool
     uint32_t xfer_id; ///< Pre-assigned globally unique transfer ID
     void *buffer; ///< Pre-assigned buffer for CONTROL operations, nullptr for DATA
     struct fid_mr *mr; ///< Pre-assigned memory registration for CONTROL, nullptr for DATA
@@ -48,7 +51,7 @@ struct nixlLibfabricReq {
 
     enum OpType { WRITE, READ, SEND, RECV } operation_type; ///< Operation type (pre-assigned)
 
-    bool in_use; ///< Pool management flag
+    std::atomic<bool> in_use; ///< Pool management flag
     size_t chunk_offset; ///< Chunk offset for DATA requests
     size_t chunk_size; ///< Chunk size for DATA requests
     std::function<void()> completion_callback; ///< Completion callback function
@@ -56,6 +59,9 @@ struct nixlLibfabricReq {
     uint64_t remote_addr; ///< Remote memory address for transfers
     struct fid_mr *local_mr; ///< Local memory registration for transfers
     uint64_t remote_key; ///< Remote access key for transfers
+    uint64_t submit_ns; ///< Post time of DATA requests, for bandwidth estimation
+    size_t outstanding_bytes; ///< Bytes counted in the rail's outstanding bytes until settled
+    std::atomic<uint32_t> next_free; ///< Free list link (pool_index + 1, 0 terminates the list)
 
     /** Default constructor initializing all fields */
     nixlLibfabricReq()
@@ -72,14 +78,27 @@ struct nixlLibfabricReq {
           local_addr(nullptr),
           remote_addr(0),
           local_mr(nullptr),
-          remote_key(0) {
+          remote_key(0),
+          submit_ns(0),
+          outstanding_bytes(0),
+          next_free(0) {
         memset(&ctx, 0, sizeof(fi_context));
     }
 };
 
-/** Thread-safe request pool with O(1) allocation/release */
+/**
+ * Thread-safe request pool with lock-free O(1) allocation/release
+ *
+ * Requests live in fixed-size blocks that are never moved or freed before the pool is destroyed,
+ * so expansion does not invalidate pointers to in-flight requests. Free requests are linked in
+ * an intrusive Treiber stack whose head carries a generation tag to avoid ABA. Only expansion
+ * is serialized with a mutex.
+ */
 class RequestPool {
 public:
+    /** Maximum number of blocks, i.e. the pool can grow up to this many times its initial size */
+    static constexpr size_t MAX_BLOCKS = 256;
+
     /** Initialize request pool with specified size */
     RequestPool(size_t pool_size, size_t rail_id);
 
@@ -90,9 +109,13 @@ public:
     virtual void
     release(nixlLibfabricReq *req) const;
 
-    /** Find request by libfabric context pointer */
-    nixlLibfabricReq *
-    findByContext(void *context) const;
+    /** Get the request owning a libfabric context pointer (no lookup, no locking) */
+    static nixlLibfabricReq *
+    findByContext(void *context) noexcept;
+
+    /** Get total number of requests in the pool */
+    size_t
+    getTotalRequestCount() const;
 
     /** Get count of currently active requests */
     size_t
@@ -111,6 +134,10 @@ protected:
     nixlLibfabricReq *
     allocateReq(uint32_t req_id);
 
+    /** Get request by pool index, index must be below getTotalRequestCount() */
+    nixlLibfabricReq &
+    requestAt(size_t idx) const;
+
 public:
     // Non-copyable and non-movable since we use unique_ptr for management
     RequestPool(const RequestPool &) = delete;
@@ -121,15 +148,35 @@ public:
     operator=(RequestPool &&) = delete;
 
 protected:
-    /** Initialize base pool structure with specified size */
+    /**
+     * Add a block of initial_pool_size_ requests without making them available for allocation.
+     * Returns the first request of the block, nullptr if the pool reached MAX_BLOCKS.
+     */
+    nixlLibfabricReq *
+    addBlock();
+
+    /** Make the block added by the last addBlock() call available for allocation */
     void
-    initializeBasePool(size_t pool_size);
+    publishBlock();
 
-    mutable std::deque<nixlLibfabricReq> requests_; ///< Expandable request pool
-    mutable std::stack<size_t> free_indices_; ///< Stack of available request indices
     size_t rail_id_; ///< Rail ID for this pool
-    size_t initial_pool_size_; ///< Original pool size for expansion calculations
-    mutable std::mutex pool_mutex_; ///< Thread safety protection
+    size_t initial_pool_size_; ///< Original pool size, also the size of each block
+
+private:
+    /** Pop a request from the free list, nullptr if empty */
+    nixlLibfabricReq *
+    popFree() const;
+
+    /** Push a request to the free list */
+    void
+    pushFree(nixlLibfabricReq *req) const;
+
+    std::array<std::unique_ptr<nixlLibfabricReq[]>, MAX_BLOCKS> blocks_; ///< Request storage
+    std::atomic<size_t> total_requests_{0}; ///< Requests in all published blocks
+    mutable std::atomic<size_t> free_count_{0}; ///< Requests currently on the free list
+    /** Free list head: generation tag in the upper 32 bits, pool_index + 1 in the lower ones */
+    mutable std::atomic<uint64_t> free_head_{0};
+    std::mutex expand_mutex_; ///< Serializes pool expansion
 };
 
 /** Buffer chunk structure for control request pool */
@@ -213,6 +260,12 @@ public:
 };
 
 
+/** Transfer load of a rail, used for load-aware rail selection */
+struct nixlLibfabricRailLoad {
+    size_t outstanding_bytes; ///< DATA bytes posted and not completed yet
+    double bandwidth; ///< Smoothed per-request bandwidth in bytes/ns, 0 if not sampled yet
+};
+
 /** Connection state tracking for multi-rail connections */
 enum class ConnectionState {
     DISCONNECTED, ///< No connection attempt made, initial state
@@ -368,6 +421,23 @@ public:
     fi_info *
     getRailInfo() const;
 
+    // Load tracking methods
+    /** Get outstanding bytes and observed bandwidth of this rail */
+    [[nodiscard]] nixlLibfabricRailLoad
+    getLoad() const;
+
+    /** Account a DATA transfer about to be posted on this rail */
+    void
+    recordSubmit(size_t bytes) const;
+
+    /** Account a finished DATA transfer, updating the bandwidth estimate if latency is known */
+    void
+    recordCompletion(size_t bytes, uint64_t latency_ns) const;
+
+    /** Account the bytes of a DATA request still outstanding as finished, without a sample */
+    void
+    settleRequest(nixlLibfabricReq *req) const;
+
 private:
     // Core libfabric resources
     struct fi_info *info; // from rail_infos[rail_id]
@@ -394,6 +464,10 @@ private:
     // Provider capability flags
     bool provider_supports_hmem_;
 
+    // Load tracking for load-aware rail selection
+    mutable std::atomic<size_t> outstanding_bytes_{0};
+    mutable std::atomic<double> bandwidth_{0.0};
+
 
     nixl_status_t
     processCompletionQueueEntry(struct fi_cq_data_entry *comp) const;
@@ -23,6 +23,7 @@
 #include "serdes/serdes.h"
 #include <sstream>
 #include <algorithm>
+#include <limits>
 #include <numaif.h>
 
 #include <numa.h>
@@ -386,11 +387,11 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
     bool use_striping = shouldUseStriping(transfer_size) && selected_rails.size() > 1;
     NIXL_DEBUG << "use_striping=" << use_striping;
     if (!use_striping) {
-        // Round-robin: use one rail for entire transfer
-        const auto counter_value = round_robin_counter.fetch_add(1);
-        const size_t rail_id = selected_rails[counter_value % selected_rails.size()];
+        // Single rail: use the least loaded rail for entire transfer
+        const size_t rail_idx = selectLeastLoadedRail(selected_rails);
+        const size_t rail_id = selected_rails[rail_idx];
         const size_t remote_ep_id =
-            remote_selected_endpoints[counter_value % remote_selected_endpoints.size()];
+            remote_selected_endpoints[rail_idx % remote_selected_endpoints.size()];
         NIXL_DEBUG << "rail " << rail_id << ", remote_ep_id " << remote_ep_id;
         // Allocate request
         nixlLibfabricReq *req = rails_[rail_id]->allocateDataRequest(op_type, xfer_id);
@@ -454,21 +455,22 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
         // Track submitted request
         submitted_count_out = 1;
 
-        NIXL_DEBUG << "Round-robin: submitted single request on rail " << rail_id << " for "
+        NIXL_DEBUG << "Single rail: submitted single request on rail " << rail_id << " for "
                    << transfer_size << " bytes, XFER_ID=" << req->xfer_id;
 
     } else {
-        // Striping: distribute across multiple rails
+        // Striping: distribute across multiple rails, weighted by observed bandwidth
         size_t num_rails = selected_rails.size();
-        size_t chunk_size = transfer_size / num_rails;
-        size_t remainder = transfer_size % num_rails;
-        for (size_t i = 0; i < num_rails; ++i) {
+        std::vector<size_t> stripe_sizes;
+        computeStripeSizes(selected_rails, transfer_size, stripe_sizes);
+        size_t chunk_offset = 0;
+        for (size_t i = 0; i < num_rails; chunk_offset += stripe_sizes[i++]) {
             const size_t rail_id = selected_rails[i];
             const size_t remote_ep_id =
                 remote_selected_endpoints[i % remote_selected_endpoints.size()];
             NIXL_DEBUG << "rail " << rail_id << ", remote_ep_id=" << remote_ep_id;
-            size_t current_chunk_size = chunk_size + (i == num_rails - 1 ? remainder : 0);
-            if (current_chunk_size == 0) break;
+            size_t current_chunk_size = stripe_sizes[i];
+            if (current_chunk_size == 0) continue;
             // Allocate request
             nixlLibfabricReq *req = rails_[rail_id]->allocateDataRequest(op_type, xfer_id);
             if (!req) {
@@ -478,8 +480,7 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
 
             req->completion_callback = completion_callback;
 
-            // Calculate and populate chunk info
-            size_t chunk_offset = i * chunk_size;
+            // Populate chunk info
             req->chunk_offset = chunk_offset;
             req->chunk_size = current_chunk_size;
             req->local_addr = static_cast<char *>(local_addr) + chunk_offset;
@@ -543,6 +544,78 @@ nixlLibfabricRailManager::prepareAndSubmitTransfer(
     return NIXL_SUCCESS;
 }
 
+size_t
+nixlLibfabricRailManager::selectLeastLoadedRail(const std::vector<size_t> &selected_rails) const {
+    // Rails without bandwidth samples are assumed to be as fast as the average sampled rail
+    std::vector<nixlLibfabricRailLoad> loads;
+    loads.reserve(selected_rails.size());
+    double bandwidth_sum = 0.0;
+    size_t sampled = 0;
+    for (const size_t rail_id : selected_rails) {
+        loads.push_back(rails_[rail_id]->getLoad());
+        if (loads.back().bandwidth > 0.0) {
+            bandwidth_sum += loads.back().bandwidth;
+            ++sampled;
+        }
+    }
+    const double default_bandwidth = sampled ? bandwidth_sum / sampled : 1.0;
+
+    // Start from a rotating rail so that equally loaded rails are used round-robin
+    const size_t start = round_robin_counter.fetch_add(1, std::memory_order_relaxed);
+    size_t best_idx = start % selected_rails.size();
+    double best_cost = std::numeric_limits<double>::max();
+    for (size_t n = 0; n < selected_rails.size(); ++n) {
+        const size_t idx = (start + n) % selected_rails.size();
+        const double bandwidth =
+            (loads[idx].bandwidth > 0.0) ? loads[idx].bandwidth : default_bandwidth;
+        const double cost = loads[idx].outstanding_bytes / bandwidth;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_idx = idx;
+        }
+    }
+
+    NIXL_TRACE << "Least loaded rail " << selected_rails[best_idx] << " (outstanding "
+               << loads[best_idx].outstanding_bytes << " bytes)";
+    return best_idx;
+}
+
+void
+nixlLibfabricRailManager::computeStripeSizes(const std::vector<size_t> &selected_rails,
+                                             size_t transfer_size,
+                                             std::vector<size_t> &stripe_sizes_out) const {
+    const size_t num_rails = selected_rails.size();
+    std::vector<double> weights(num_rails, 0.0);
+    double bandwidth_sum = 0.0;
+    size_t sampled = 0;
+    for (size_t i = 0; i < num_rails; ++i) {
+        weights[i] = rails_[selected_rails[i]]->getLoad().bandwidth;
+        if (weights[i] > 0.0) {
+            bandwidth_sum += weights[i];
+            ++sampled;
+        }
+    }
+
+    const double default_weight = sampled ? bandwidth_sum / sampled : 1.0;
+    double weight_sum = 0.0;
+    for (double &weight : weights) {
+        if (weight <= 0.0) {
+            weight = default_weight;
+        }
+        weight_sum += weight;
+    }
+
+    // Last rail takes the rounding remainder, as with even striping
+    stripe_sizes_out.assign(num_rails, 0);
+    size_t assigned = 0;
+    for (size_t i = 0; i + 1 < num_rails; ++i) {
+        stripe_sizes_out[i] = std::min(
+            static_cast<size_t>(transfer_size * weights[i] / weight_sum), transfer_size - assigned);
+        assigned += stripe_sizes_out[i];
+    }
+    stripe_sizes_out[num_rails - 1] = transfer_size - assigned;
+}
+
 bool
 nixlLibfabricRailManager::getDramRailLimit(const nixl_b_params_t &custom_params,
                                            size_t &max_bw,
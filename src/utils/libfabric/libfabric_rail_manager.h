@@ -221,6 +221,26 @@ public:
     bool
     shouldUseStriping(size_t transfer_size) const;
 
+    // Load-aware rail selection APIs
+    /** Select the rail expected to drain its outstanding transfers first
+     * Cost is outstanding bytes over observed bandwidth; ties are broken round-robin.
+     * @param selected_rails Candidate rails (non-empty)
+     * @return Index into selected_rails of the least loaded rail
+     */
+    size_t
+    selectLeastLoadedRail(const std::vector<size_t> &selected_rails) const;
+    /** Split a transfer into per-rail stripes proportional to observed rail bandwidth
+     * Rails without bandwidth samples are weighted with the average of the sampled ones, so
+     * stripes are equal until completions have been observed.
+     * @param selected_rails Rails to stripe across (non-empty)
+     * @param transfer_size Total transfer size
+     * @param stripe_sizes_out Stripe size per selected rail, summing up to transfer_size
+     */
+    void
+    computeStripeSizes(const std::vector<size_t> &selected_rails,
+                       size_t transfer_size,
+                       std::vector<size_t> &stripe_sizes_out) const;
+
     // Control Message APIs
     /** Control message types for rail communication */
     enum class ControlMessageType : int {
@@ -18,9 +18,12 @@
 #ifndef NIXL_S3_UTILS_H
 #define NIXL_S3_UTILS_H
 
+#include <atomic>
+#include <memory>
 #include <optional>
 #include <string>
 #include <cstdlib>
+#include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/Scheme.h>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/client/ClientConfiguration.h>
@@ -120,6 +123,24 @@ configureClientCommon(ConfigType &config, nixl_b_params_t *custom_params) {
     if (ca_bundle_it != custom_params->end()) config.caFile = ca_bundle_it->second;
 }
 
+/**
+ * Template function to abort a request once @p cancel_token is set.
+ * The SDK checks the handler while it sends or receives the body, and
+ * the request then completes with an error.
+ * Works with both Aws::S3 and Aws::S3Crt request models.
+ *
+ * @param request       Request to abort.
+ * @param cancel_token  Abort flag; may be nullptr.
+ */
+template<typename RequestType>
+void
+setCancelHandler(RequestType &request, const std::shared_ptr<std::atomic<bool>> &cancel_token) {
+    if (!cancel_token) return;
+
+    request.SetContinueRequestHandler(
+        [cancel_token](const Aws::Http::HttpRequest *) { return !cancel_token->load(); });
+}
+
 } // namespace nixl_s3_utils
 
 #endif // NIXL_S3_UTILS_H
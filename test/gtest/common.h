@@ -56,6 +56,12 @@ GetMockBackendName() {
     return "MOCK_BACKEND";
 }
 
+// Same mock plugin built under a second name, for agents with two competing backends
+constexpr const char *
+GetMockAltBackendName() {
+    return "MOCK_BACKEND_ALT";
+}
+
 class Logger {
 public:
     Logger(const std::string &title = "INFO");
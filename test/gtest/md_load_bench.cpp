@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Benchmark for loadRemoteMD with large synthetic metadata, using the mock backend.
+ * The mock loads every descriptor with a busy wait standing in for the backend's unpack
+ * cost, once on a single thread and once with concurrent loads enabled.
+ * Usage: NIXL_PLUGIN_DIR=<mock plugin dir> md_load_bench [num_descs] [unpack_ns] [iters]
+ */
+
+#include "nixl.h"
+#include "common.h"
+#include "mocks/gmock_engine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t kDescLen = 4096;
+
+nixlBackendH *
+createMockBackend(nixlAgent &agent, const mocks::GMockBackendEngine &engine) {
+    nixl_b_params_t params;
+    engine.SetToParams(params);
+    nixlBackendH *backend = nullptr;
+    if (agent.createBackend(gtest::GetMockBackendName(), params, backend) != NIXL_SUCCESS) {
+        return nullptr;
+    }
+    return backend;
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    using testing::_;
+
+    const size_t num_descs = (argc > 1) ? std::max(std::atoi(argv[1]), 1) : 100000;
+    const long unpack_ns = (argc > 2) ? std::max(std::atol(argv[2]), 0L) : 500;
+    const size_t iters = (argc > 3) ? std::max(std::atoi(argv[3]), 1) : 5;
+
+    testing::NiceMock<mocks::GMockBackendEngine> engine;
+    ON_CALL(engine, loadRemoteMD(_, _, _, _))
+        .WillByDefault([unpack_ns](const nixlBlobDesc &,
+                                   const nixl_mem_t &,
+                                   const std::string &,
+                                   nixlBackendMD *&output) {
+            const auto end =
+                std::chrono::steady_clock::now() + std::chrono::nanoseconds(unpack_ns);
+            while (std::chrono::steady_clock::now() < end) {
+            }
+            output = nullptr;
+            return NIXL_SUCCESS;
+        });
+
+    nixlAgent target("md_load_bench_target", nixlAgentConfig(false));
+    nixlAgent initiator("md_load_bench_init", nixlAgentConfig(false));
+    nixlBackendH *target_backend = createMockBackend(target, engine);
+    if (!target_backend || !createMockBackend(initiator, engine)) {
+        std::cerr << "failed to create the mock backend, is NIXL_PLUGIN_DIR set?" << std::endl;
+        return 1;
+    }
+
+    // Regions are never accessed, so the addresses need not be backed by memory
+    nixl_reg_dlist_t regions(DRAM_SEG);
+    for (size_t i = 0; i < num_descs; ++i) {
+        regions.addDesc(nixlBlobDesc(0x100000 + i * kDescLen, kDescLen, 0, std::to_string(i)));
+    }
+    nixl_opt_args_t args;
+    args.backends.push_back(target_backend);
+    nixl_blob_t target_md;
+    if ((target.registerMem(regions, &args) != NIXL_SUCCESS) ||
+        (target.getLocalMD(target_md) != NIXL_SUCCESS)) {
+        std::cerr << "failed to build the target metadata" << std::endl;
+        return 1;
+    }
+
+    std::cout << "descs: " << num_descs << ", metadata: " << target_md.size() / 1024
+              << " KiB, unpack: " << unpack_ns << " ns, iterations: " << iters << std::endl;
+
+    for (const bool concurrent : {false, true}) {
+        ON_CALL(engine, supportsConcurrentLoadMD()).WillByDefault(testing::Return(concurrent));
+
+        double total_us = 0;
+        for (size_t it = 0; it < iters; ++it) {
+            std::string name;
+            const auto start = std::chrono::steady_clock::now();
+            if (initiator.loadRemoteMD(target_md, name) != NIXL_SUCCESS) {
+                std::cerr << "loadRemoteMD failed" << std::endl;
+                return 1;
+            }
+            total_us += std::chrono::duration<double, std::micro>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+            initiator.invalidateRemoteMD(name);
+        }
+
+        std::cout << std::left << std::setw(12) << (concurrent ? "concurrent" : "serial")
+                  << std::right << std::fixed << std::setprecision(1) << std::setw(12)
+                  << total_us / iters / 1000 << " ms per load" << std::endl;
+    }
+
+    target.deregisterMem(regions, &args);
+    return 0;
+}
@@ -33,13 +33,20 @@ GMockBackendEngine::GMockBackendEngine() : nixlBackendEngine(&init_params) {
     ON_CALL(*this, getSupportedMems()).WillByDefault(Return(nixl_mem_list_t{DRAM_SEG}));
     ON_CALL(*this, registerMem(_, _, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, deregisterMem(_)).WillByDefault(Return(NIXL_SUCCESS));
+    ON_CALL(*this, registerMems(_, _))
+        .WillByDefault([this](const nixl_reg_dlist_t &mems, std::vector<nixlBackendMD *> &out) {
+            return nixlBackendEngine::registerMems(mems, out);
+        });
     ON_CALL(*this, connect(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, disconnect(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, unloadMD(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, prepXfer(_, _, _, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, postXfer(_, _, _, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
+    ON_CALL(*this, estimateXferCost(_, _, _, _, _, _, _, _, _))
+        .WillByDefault(Return(NIXL_ERR_NOT_SUPPORTED));
     ON_CALL(*this, checkXfer(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, releaseReqH(_)).WillByDefault(Return(NIXL_SUCCESS));
+    ON_CALL(*this, cancelXfer(_)).WillByDefault(Return(NIXL_ERR_CANCELED));
     ON_CALL(*this, getPublicData(_, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, getConnInfo(_)).WillByDefault([&](std::string &str) {
         str = "mock_backend_plugin_conn_info";
@@ -48,6 +55,8 @@ GMockBackendEngine::GMockBackendEngine() : nixlBackendEngine(&init_params) {
     ON_CALL(*this, loadRemoteConnInfo(_, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, loadRemoteMD(_, _, _, _)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, loadLocalMD(_, _)).WillByDefault(Return(NIXL_SUCCESS));
+    ON_CALL(*this, supportsConcurrentLoadMD()).WillByDefault(Return(false));
+    ON_CALL(*this, supportsPrepReuse()).WillByDefault(Return(false));
     ON_CALL(*this, getNotifs(_)).WillByDefault(Return(NIXL_SUCCESS));
     ON_CALL(*this, genNotif(_, _)).WillByDefault(Return(NIXL_SUCCESS));
 }
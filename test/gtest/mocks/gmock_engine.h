@@ -73,6 +73,10 @@ public:
                 (const nixlBlobDesc &desc, const nixl_mem_t &mem, nixlBackendMD *&out),
                 (override));
     MOCK_METHOD(nixl_status_t, deregisterMem, (nixlBackendMD * meta), (override));
+    MOCK_METHOD(nixl_status_t,
+                registerMems,
+                (const nixl_reg_dlist_t &mems, std::vector<nixlBackendMD *> &out),
+                (override));
     MOCK_METHOD(nixl_status_t, connect, (const std::string &remote_agent), (override));
     MOCK_METHOD(nixl_status_t, disconnect, (const std::string &remote_agent), (override));
     MOCK_METHOD(nixl_status_t, unloadMD, (nixlBackendMD * input), (override));
@@ -94,8 +98,21 @@ public:
                  nixlBackendReqH *&req,
                  const nixl_opt_b_args_t *extra_args),
                 (const, override));
+    MOCK_METHOD(nixl_status_t,
+                estimateXferCost,
+                (const nixl_xfer_op_t &op,
+                 const nixl_meta_dlist_t &src,
+                 const nixl_meta_dlist_t &dst,
+                 const std::string &remote_agent,
+                 nixlBackendReqH *const &req,
+                 std::chrono::microseconds &duration,
+                 std::chrono::microseconds &err_margin,
+                 nixl_cost_t &method,
+                 const nixl_opt_args_t *extra_params),
+                (const, override));
     MOCK_METHOD(nixl_status_t, checkXfer, (nixlBackendReqH * req), (const, override));
     MOCK_METHOD(nixl_status_t, releaseReqH, (nixlBackendReqH * req), (const, override));
+    MOCK_METHOD(nixl_status_t, cancelXfer, (nixlBackendReqH * req), (const, override));
     MOCK_METHOD(nixl_status_t,
                 getPublicData,
                 (const nixlBackendMD *input, std::string &str),
@@ -116,6 +133,8 @@ public:
                 loadLocalMD,
                 (nixlBackendMD * input, nixlBackendMD *&output),
                 (override));
+    MOCK_METHOD(bool, supportsConcurrentLoadMD, (), (const, override));
+    MOCK_METHOD(bool, supportsPrepReuse, (), (const, override));
     MOCK_METHOD(nixl_status_t, getNotifs, (notif_list_t & notif_list), (override));
     MOCK_METHOD(nixl_status_t,
                 genNotif,
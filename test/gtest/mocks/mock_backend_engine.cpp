@@ -38,6 +38,12 @@ MockBackendEngine::deregisterMem(nixlBackendMD *meta) {
     return gmock_backend_engine->deregisterMem(meta);
 }
 
+nixl_status_t
+MockBackendEngine::registerMems(const nixl_reg_dlist_t &mems, std::vector<nixlBackendMD *> &out) {
+    sharedState++;
+    return gmock_backend_engine->registerMems(mems, out);
+}
+
 nixl_status_t
 MockBackendEngine::connect(const std::string &remote_agent) {
     sharedState++;
@@ -67,6 +73,28 @@ MockBackendEngine::prepXfer(const nixl_xfer_op_t &operation,
     return gmock_backend_engine->prepXfer(operation, local, remote, remote_agent, handle, opt_args);
 }
 
+nixl_status_t
+MockBackendEngine::estimateXferCost(const nixl_xfer_op_t &operation,
+                                    const nixl_meta_dlist_t &local,
+                                    const nixl_meta_dlist_t &remote,
+                                    const std::string &remote_agent,
+                                    nixlBackendReqH *const &handle,
+                                    std::chrono::microseconds &duration,
+                                    std::chrono::microseconds &err_margin,
+                                    nixl_cost_t &method,
+                                    const nixl_opt_args_t *extra_params) const {
+    assert(sharedState > 0);
+    return gmock_backend_engine->estimateXferCost(operation,
+                                                  local,
+                                                  remote,
+                                                  remote_agent,
+                                                  handle,
+                                                  duration,
+                                                  err_margin,
+                                                  method,
+                                                  extra_params);
+}
+
 nixl_status_t
 MockBackendEngine::postXfer(const nixl_xfer_op_t &operation,
                             const nixl_meta_dlist_t &local,
@@ -102,7 +130,12 @@ MockBackendEngine::loadRemoteMD(const nixlBlobDesc &input,
                                 const nixl_mem_t &nixl_mem,
                                 const std::string &remote_agent,
                                 nixlBackendMD *&output) {
-    sharedState++;
+    // Concurrent loads must only read the shared state, like the const methods
+    if (gmock_backend_engine->supportsConcurrentLoadMD()) {
+        assert(sharedState > 0);
+    } else {
+        sharedState++;
+    }
     return gmock_backend_engine->loadRemoteMD(input, nixl_mem, remote_agent, output);
 }
 
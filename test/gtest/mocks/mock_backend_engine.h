@@ -51,6 +51,8 @@ public:
   nixl_status_t registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem,
                             nixlBackendMD *&out) override;
   nixl_status_t deregisterMem(nixlBackendMD *meta) override;
+  nixl_status_t registerMems(const nixl_reg_dlist_t &mems,
+                             std::vector<nixlBackendMD *> &out) override;
   nixl_status_t connect(const std::string &remote_agent) override;
   nixl_status_t disconnect(const std::string &remote_agent) override;
   nixl_status_t unloadMD(nixlBackendMD *input) override;
@@ -66,8 +68,23 @@ public:
                          const std::string &remote_agent,
                          nixlBackendReqH *&handle,
                          const nixl_opt_b_args_t *opt_args) const override;
+  nixl_status_t
+  estimateXferCost(const nixl_xfer_op_t &operation,
+                   const nixl_meta_dlist_t &local,
+                   const nixl_meta_dlist_t &remote,
+                   const std::string &remote_agent,
+                   nixlBackendReqH *const &handle,
+                   std::chrono::microseconds &duration,
+                   std::chrono::microseconds &err_margin,
+                   nixl_cost_t &method,
+                   const nixl_opt_args_t *extra_params) const override;
   nixl_status_t checkXfer(nixlBackendReqH *handle) const override;
   nixl_status_t releaseReqH(nixlBackendReqH *handle) const override;
+  nixl_status_t
+  cancelXfer(nixlBackendReqH *handle) const override {
+      assert(sharedState > 0);
+      return gmock_backend_engine->cancelXfer(handle);
+  }
   nixl_status_t getPublicData(const nixlBackendMD *meta, std::string &str) const override {
     assert(sharedState > 0);
     return gmock_backend_engine->getPublicData(meta, str);
@@ -83,6 +100,16 @@ public:
                              const std::string &remote_agent,
                              nixlBackendMD *&output) override;
   nixl_status_t loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output);
+  bool
+  supportsConcurrentLoadMD() const override {
+      assert(sharedState > 0);
+      return gmock_backend_engine->supportsConcurrentLoadMD();
+  }
+  bool
+  supportsPrepReuse() const override {
+      assert(sharedState > 0);
+      return gmock_backend_engine->supportsPrepReuse();
+  }
   nixl_status_t getNotifs(notif_list_t &notif_list) override;
   nixl_status_t genNotif(const std::string &remote_agent,
                          const std::string &msg) const override;
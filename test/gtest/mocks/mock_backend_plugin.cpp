@@ -32,7 +32,11 @@ namespace backend_plugin {
 
     static const char *
     get_plugin_name() {
+#ifdef NIXL_MOCK_BACKEND_ALT
+        return gtest::GetMockAltBackendName();
+#else
         return gtest::GetMockBackendName();
+#endif
     }
 
     static const char *
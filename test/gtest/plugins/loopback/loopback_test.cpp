@@ -0,0 +1,213 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common.h"
+#include "nixl.h"
+
+namespace gtest {
+namespace plugins {
+namespace loopback {
+
+    class Agent {
+    public:
+        Agent(const std::string &name, const nixl_b_params_t &overrides) : m_name(name) {
+            m_agent = std::make_unique<nixlAgent>(name, nixlAgentConfig(false));
+
+            nixl_b_params_t params;
+            nixl_mem_list_t mems;
+            EXPECT_EQ(NIXL_SUCCESS, m_agent->getPluginParams("LOOPBACK", mems, params));
+            for (const auto &[key, value] : overrides) {
+                params[key] = value;
+            }
+            m_status = m_agent->createBackend("LOOPBACK", params, m_backend);
+        }
+
+        ~Agent() {
+            if (!m_data.empty()) {
+                m_agent->deregisterMem(regList(), &m_params);
+            }
+        }
+
+        void
+        allocate(size_t len) {
+            m_data.assign(len, 0);
+            m_params.backends = {m_backend};
+            ASSERT_EQ(NIXL_SUCCESS, m_agent->registerMem(regList(), &m_params));
+        }
+
+        nixl_reg_dlist_t
+        regList() const {
+            nixl_reg_dlist_t dlist(DRAM_SEG);
+            dlist.addDesc(
+                nixlBlobDesc(reinterpret_cast<uintptr_t>(m_data.data()), m_data.size(), 0));
+            return dlist;
+        }
+
+        nixl_xfer_dlist_t
+        xferList() const {
+            nixl_xfer_dlist_t dlist(DRAM_SEG);
+            dlist.addDesc(
+                nixlBasicDesc(reinterpret_cast<uintptr_t>(m_data.data()), m_data.size(), 0));
+            return dlist;
+        }
+
+        void
+        loadRemote(const Agent &other) {
+            std::string md;
+            ASSERT_EQ(NIXL_SUCCESS, other.m_agent->getLocalMD(md));
+            std::string name;
+            ASSERT_EQ(NIXL_SUCCESS, m_agent->loadRemoteMD(md, name));
+            EXPECT_EQ(other.m_name, name);
+        }
+
+        nixlXferReqH *
+        createXfer(const Agent &target, const std::string &msg) {
+            nixl_opt_args_t extra_params;
+            extra_params.backends = {m_backend};
+            extra_params.notif = msg;
+
+            nixlXferReqH *req = nullptr;
+            EXPECT_EQ(NIXL_SUCCESS,
+                      m_agent->createXferReq(NIXL_WRITE,
+                                             xferList(),
+                                             target.xferList(),
+                                             target.m_name,
+                                             req,
+                                             &extra_params));
+            return req;
+        }
+
+        std::vector<std::string>
+        notifsFrom(const std::string &from) {
+            nixl_notifs_t notifs;
+            EXPECT_EQ(NIXL_SUCCESS, m_agent->getNotifs(notifs));
+            return notifs[from];
+        }
+
+        nixl_status_t
+        status() const {
+            return m_status;
+        }
+
+        nixlAgent &
+        get() {
+            return *m_agent;
+        }
+
+    private:
+        std::string m_name;
+        std::unique_ptr<nixlAgent> m_agent;
+        nixlBackendH *m_backend = nullptr;
+        nixl_status_t m_status;
+        nixl_opt_args_t m_params;
+        std::vector<char> m_data;
+    };
+
+    class LoopbackBackendTest : public testing::Test {
+    protected:
+        LoopbackBackendTest() {
+            m_env.addVar("NIXL_PLUGIN_DIR", std::string(BUILD_DIR) + "/src/plugins/loopback");
+        }
+
+        ScopedEnv m_env;
+    };
+
+    TEST_F(LoopbackBackendTest, InstantWriteWithNotif) {
+        Agent initiator("initiator", {});
+        Agent target("target", {});
+        initiator.allocate(1 << 20);
+        target.allocate(1 << 20);
+        initiator.loadRemote(target);
+
+        nixlXferReqH *req = initiator.createXfer(target, "done");
+        ASSERT_NE(nullptr, req);
+        EXPECT_EQ(NIXL_SUCCESS, initiator.get().postXferReq(req));
+        EXPECT_EQ(std::vector<std::string>{"done"}, target.notifsFrom("initiator"));
+        EXPECT_EQ(NIXL_SUCCESS, initiator.get().releaseXferReq(req));
+    }
+
+    TEST_F(LoopbackBackendTest, OnlySelectedWhenNamed) {
+        Agent initiator("initiator", {});
+        Agent target("target", {});
+        initiator.allocate(1 << 20);
+        target.allocate(1 << 20);
+        initiator.loadRemote(target);
+
+        nixlXferReqH *req = nullptr;
+        EXPECT_EQ(NIXL_ERR_NOT_FOUND,
+                  initiator.get().createXferReq(
+                      NIXL_WRITE, initiator.xferList(), target.xferList(), "target", req));
+        nixlDlistH *dlist = nullptr;
+        EXPECT_EQ(NIXL_ERR_NOT_FOUND,
+                  initiator.get().prepXferDlist("target", target.xferList(), dlist));
+
+        req = initiator.createXfer(target, "done");
+        ASSERT_NE(nullptr, req);
+        EXPECT_EQ(NIXL_SUCCESS, initiator.get().releaseXferReq(req));
+    }
+
+    TEST_F(LoopbackBackendTest, LatencyAndBandwidth) {
+        // 1 MiB at 1 Gbps takes about 8.4 ms on the wire, plus 2 ms of latency
+        const nixl_b_params_t params = {{"latency_us", "2000"}, {"bandwidth_gbps", "1"}};
+        Agent initiator("initiator", params);
+        Agent target("target", params);
+        initiator.allocate(1 << 20);
+        target.allocate(1 << 20);
+        initiator.loadRemote(target);
+
+        nixlXferReqH *req = initiator.createXfer(target, "done");
+        ASSERT_NE(nullptr, req);
+        const auto start = std::chrono::steady_clock::now();
+        nixl_status_t status = initiator.get().postXferReq(req);
+        EXPECT_EQ(NIXL_IN_PROG, status);
+        EXPECT_TRUE(target.notifsFrom("initiator").empty());
+        while (status == NIXL_IN_PROG) {
+            status = initiator.get().getXferStatus(req);
+        }
+        EXPECT_EQ(NIXL_SUCCESS, status);
+        EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(10388));
+        EXPECT_EQ(std::vector<std::string>{"done"}, target.notifsFrom("initiator"));
+        EXPECT_EQ(NIXL_SUCCESS, initiator.get().releaseXferReq(req));
+    }
+
+    TEST_F(LoopbackBackendTest, GenNotif) {
+        Agent first("first", {});
+        Agent second("second", {});
+        first.loadRemote(second);
+
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_EQ(NIXL_SUCCESS, first.get().genNotif("second", "msg" + std::to_string(i)));
+        }
+        const std::vector<std::string> expected = {"msg0", "msg1", "msg2"};
+        EXPECT_EQ(expected, second.notifsFrom("first"));
+    }
+
+    TEST_F(LoopbackBackendTest, NegativeLatency) {
+        Agent agent("agent", {{"latency_us", "-1"}});
+        EXPECT_NE(NIXL_SUCCESS, agent.status());
+    }
+
+} // namespace loopback
+} // namespace plugins
+} // namespace gtest
@@ -0,0 +1,275 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common.h"
+#include "nixl.h"
+
+namespace gtest {
+namespace plugins {
+namespace shm {
+
+    class Agent {
+    public:
+        Agent(const std::string &name, const nixl_b_params_t &overrides) : m_name(name) {
+            m_agent = std::make_unique<nixlAgent>(name, nixlAgentConfig(false));
+
+            nixl_b_params_t params;
+            nixl_mem_list_t mems;
+            EXPECT_EQ(NIXL_SUCCESS, m_agent->getPluginParams("SHM", mems, params));
+            for (const auto &[key, value] : overrides) {
+                params[key] = value;
+            }
+            EXPECT_EQ(NIXL_SUCCESS, m_agent->createBackend("SHM", params, m_backend));
+        }
+
+        ~Agent() {
+            if (!m_data.empty()) {
+                m_agent->deregisterMem(regList(), &m_params);
+            }
+        }
+
+        void
+        allocate(size_t len, char fill) {
+            m_data.assign(len, fill);
+            m_params.backends = {m_backend};
+            ASSERT_EQ(NIXL_SUCCESS, m_agent->registerMem(regList(), &m_params));
+        }
+
+        nixl_reg_dlist_t
+        regList() const {
+            nixl_reg_dlist_t dlist(DRAM_SEG);
+            const uintptr_t addr = reinterpret_cast<uintptr_t>(m_data.data());
+            dlist.addDesc(nixlBlobDesc(addr, m_data.size(), 0));
+            return dlist;
+        }
+
+        // The buffer cut into count descriptors
+        nixl_xfer_dlist_t
+        xferList(size_t count) const {
+            nixl_xfer_dlist_t dlist(DRAM_SEG);
+            const size_t step = m_data.size() / count;
+            for (size_t i = 0; i < count; ++i) {
+                const size_t len = (i == count - 1) ? m_data.size() - i * step : step;
+                dlist.addDesc(
+                    nixlBasicDesc(reinterpret_cast<uintptr_t>(m_data.data()) + i * step, len, 0));
+            }
+            return dlist;
+        }
+
+        void
+        loadRemote(const Agent &other) {
+            std::string md;
+            ASSERT_EQ(NIXL_SUCCESS, other.m_agent->getLocalMD(md));
+            std::string name;
+            ASSERT_EQ(NIXL_SUCCESS, m_agent->loadRemoteMD(md, name));
+            EXPECT_EQ(other.m_name, name);
+        }
+
+        nixl_status_t
+        transfer(nixl_xfer_op_t op,
+                 const Agent &target,
+                 size_t desc_count,
+                 const std::string &msg) {
+            nixl_opt_args_t extra_params;
+            extra_params.backends = {m_backend};
+            extra_params.notif = msg;
+
+            nixlXferReqH *req = nullptr;
+            nixl_status_t status = m_agent->createXferReq(op,
+                                                          xferList(desc_count),
+                                                          target.xferList(desc_count),
+                                                          target.m_name,
+                                                          req,
+                                                          &extra_params);
+            if (status != NIXL_SUCCESS) {
+                return status;
+            }
+
+            status = m_agent->postXferReq(req);
+            while (status == NIXL_IN_PROG) {
+                status = m_agent->getXferStatus(req);
+            }
+            EXPECT_EQ(NIXL_SUCCESS, m_agent->releaseXferReq(req));
+            return status;
+        }
+
+        std::vector<std::string>
+        waitNotifs(const std::string &from, size_t count) {
+            std::vector<std::string> msgs;
+            while (msgs.size() < count) {
+                nixl_notifs_t notifs;
+                EXPECT_EQ(NIXL_SUCCESS, m_agent->getNotifs(notifs));
+                for (auto &msg : notifs[from]) {
+                    msgs.push_back(std::move(msg));
+                }
+            }
+            return msgs;
+        }
+
+        nixlAgent &
+        get() {
+            return *m_agent;
+        }
+
+        std::vector<char> m_data;
+
+    private:
+        std::string m_name;
+        std::unique_ptr<nixlAgent> m_agent;
+        nixlBackendH *m_backend = nullptr;
+        nixl_opt_args_t m_params;
+    };
+
+    class ShmBackendTest : public testing::TestWithParam<const char *> {
+    protected:
+        ShmBackendTest() {
+            m_env.addVar("NIXL_PLUGIN_DIR", std::string(BUILD_DIR) + "/src/plugins/shm");
+        }
+
+        nixl_b_params_t
+        params() const {
+            return {{"num_threads", GetParam()}, {"min_chunk_size", "65536"}};
+        }
+
+        ScopedEnv m_env;
+    };
+
+    TEST_P(ShmBackendTest, WriteWithNotif) {
+        Agent initiator("initiator", params());
+        Agent target("target", params());
+        initiator.allocate(1 << 20, 'i');
+        target.allocate(1 << 20, 't');
+        initiator.loadRemote(target);
+        target.loadRemote(initiator);
+
+        ASSERT_EQ(NIXL_SUCCESS, initiator.transfer(NIXL_WRITE, target, 7, "written"));
+        EXPECT_EQ(std::vector<std::string>{"written"}, target.waitNotifs("initiator", 1));
+        EXPECT_EQ(initiator.m_data, target.m_data);
+    }
+
+    TEST_P(ShmBackendTest, Read) {
+        Agent initiator("initiator", params());
+        Agent target("target", params());
+        initiator.allocate(1 << 20, 'i');
+        target.allocate(1 << 20, 't');
+        initiator.loadRemote(target);
+        target.loadRemote(initiator);
+
+        ASSERT_EQ(NIXL_SUCCESS, initiator.transfer(NIXL_READ, target, 3, "read"));
+        EXPECT_EQ(std::vector<std::string>{"read"}, target.waitNotifs("initiator", 1));
+        EXPECT_EQ(initiator.m_data, target.m_data);
+    }
+
+    TEST_P(ShmBackendTest, CrossMemoryAttach) {
+        nixl_b_params_t overrides = params();
+        overrides["force_cma"] = "1";
+        Agent initiator("initiator", overrides);
+        Agent target("target", overrides);
+        initiator.allocate(1 << 20, 'i');
+        target.allocate(1 << 20, 't');
+        initiator.loadRemote(target);
+        target.loadRemote(initiator);
+
+        // More descriptors per copy thread than IOV_MAX, so each batch takes several calls
+        constexpr size_t desc_count = 5000;
+        ASSERT_EQ(NIXL_SUCCESS, initiator.transfer(NIXL_WRITE, target, desc_count, "written"));
+        EXPECT_EQ(std::vector<std::string>{"written"}, target.waitNotifs("initiator", 1));
+        EXPECT_EQ(initiator.m_data, target.m_data);
+
+        std::fill(target.m_data.begin(), target.m_data.end(), 'r');
+        ASSERT_EQ(NIXL_SUCCESS, initiator.transfer(NIXL_READ, target, desc_count, "read"));
+        EXPECT_EQ(std::vector<std::string>{"read"}, target.waitNotifs("initiator", 1));
+        EXPECT_EQ(initiator.m_data, target.m_data);
+    }
+
+    TEST_P(ShmBackendTest, GenNotif) {
+        Agent first("first", params());
+        Agent second("second", params());
+        first.loadRemote(second);
+        second.loadRemote(first);
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_EQ(NIXL_SUCCESS, first.get().genNotif("second", "msg" + std::to_string(i)));
+        }
+        const std::vector<std::string> expected = {"msg0", "msg1", "msg2", "msg3"};
+        EXPECT_EQ(expected, second.waitNotifs("first", expected.size()));
+    }
+
+    TEST_P(ShmBackendTest, OversizedNotif) {
+        nixl_b_params_t overrides = params();
+        overrides["notif_slot_size"] = "64";
+        Agent initiator("initiator", overrides);
+        Agent target("target", overrides);
+        initiator.allocate(4096, 'i');
+        target.allocate(4096, 't');
+        initiator.loadRemote(target);
+
+        EXPECT_EQ(NIXL_ERR_INVALID_PARAM,
+                  initiator.transfer(NIXL_WRITE, target, 1, std::string(128, 'x')));
+    }
+
+    TEST_P(ShmBackendTest, OtherHostSkipped) {
+        Agent initiator("initiator", params());
+        Agent target("target", params());
+        initiator.allocate(4096, 'i');
+        target.allocate(4096, 't');
+
+        // The metadata of the target as if published from another boot of the host
+        std::ifstream boot_file("/proc/sys/kernel/random/boot_id");
+        std::string boot_id;
+        std::getline(boot_file, boot_id);
+        ASSERT_FALSE(boot_id.empty());
+        std::string md;
+        ASSERT_EQ(NIXL_SUCCESS, target.get().getLocalMD(md));
+        const size_t pos = md.find(boot_id);
+        ASSERT_NE(std::string::npos, pos);
+        md[pos] = (md[pos] == '0') ? '1' : '0';
+
+        // SHM is the only backend, so no section of the target is loaded and nothing serves it
+        std::string name;
+        EXPECT_EQ(NIXL_ERR_BACKEND, initiator.get().loadRemoteMD(md, name));
+        EXPECT_EQ(NIXL_ERR_NOT_FOUND, initiator.transfer(NIXL_WRITE, target, 1, "skipped"));
+    }
+
+    TEST_P(ShmBackendTest, RingParamsFit32Bits) {
+        nixlAgent agent("agent", nixlAgentConfig(false));
+        nixl_b_params_t params;
+        nixl_mem_list_t mems;
+        ASSERT_EQ(NIXL_SUCCESS, agent.getPluginParams("SHM", mems, params));
+
+        for (const std::string key : {"notif_slots", "notif_slot_size"}) {
+            nixl_b_params_t overrides = params;
+            // 2^32 + 1024, which would wrap around to a valid value
+            overrides[key] = "4294968320";
+            nixlBackendH *backend;
+            EXPECT_NE(NIXL_SUCCESS, agent.createBackend("SHM", overrides, backend)) << key;
+        }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(CopyThreads, ShmBackendTest, testing::Values("0", "4"));
+
+} // namespace shm
+} // namespace plugins
+} // namespace gtest
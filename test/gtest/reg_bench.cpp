@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Startup benchmark for registering many memory regions at once.
+ * MOCK: the mock backend busy waits for every registration, once one region at a time and
+ * once with a batched registerMems spreading the regions over threads.
+ * UCX: registers adjacent slices of one buffer, one mapping per region.
+ * Usage: NIXL_PLUGIN_DIR=<mock or UCX plugin dir>
+ *        reg_bench [MOCK|UCX] [num_regions] [region_len] [reg_ns] [iters]
+ */
+
+#include "nixl.h"
+#include "common.h"
+#include "mocks/gmock_engine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void
+busyWait(long ns) {
+    const auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+// Registers the regions with every thread of the machine, like a backend would with
+// independent registration calls
+nixl_status_t
+registerParallel(mocks::GMockBackendEngine &engine,
+                 const nixl_reg_dlist_t &mems,
+                 std::vector<nixlBackendMD *> &out) {
+    const size_t count = mems.descCount();
+    const size_t num_threads =
+        std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), count));
+    out.assign(count, nullptr);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < count; i += num_threads) {
+                engine.registerMem(mems[i], mems.getType(), out[i]);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return NIXL_SUCCESS;
+}
+
+struct benchResult {
+    double regMs = 0;
+    double deregMs = 0;
+};
+
+bool
+runRegistration(nixlAgent &agent,
+                nixlBackendH *backend,
+                const nixl_reg_dlist_t &regions,
+                size_t iters,
+                benchResult &result) {
+    nixl_opt_args_t args;
+    args.backends.push_back(backend);
+
+    for (size_t it = 0; it < iters; ++it) {
+        auto start = std::chrono::steady_clock::now();
+        if (agent.registerMem(regions, &args) != NIXL_SUCCESS) {
+            std::cerr << "registerMem failed" << std::endl;
+            return false;
+        }
+        result.regMs += std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - start)
+                            .count();
+
+        start = std::chrono::steady_clock::now();
+        if (agent.deregisterMem(regions, &args) != NIXL_SUCCESS) {
+            std::cerr << "deregisterMem failed" << std::endl;
+            return false;
+        }
+        result.deregMs += std::chrono::duration<double, std::milli>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+    }
+    result.regMs /= iters;
+    result.deregMs /= iters;
+    return true;
+}
+
+void
+printResult(const std::string &name, const benchResult &result) {
+    std::cout << std::left << std::setw(16) << name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << result.regMs << " ms register"
+              << std::setw(12) << result.deregMs << " ms deregister" << std::endl;
+}
+
+int
+runMock(const nixl_reg_dlist_t &regions, long reg_ns, size_t iters) {
+    using testing::_;
+
+    testing::NiceMock<mocks::GMockBackendEngine> engine;
+    ON_CALL(engine, registerMem(_, _, _))
+        .WillByDefault([reg_ns](const nixlBlobDesc &, const nixl_mem_t &, nixlBackendMD *&out) {
+            busyWait(reg_ns);
+            out = nullptr;
+            return NIXL_SUCCESS;
+        });
+
+    nixlAgent agent("reg_bench", nixlAgentConfig(false));
+    nixl_b_params_t params;
+    engine.SetToParams(params);
+    nixlBackendH *backend = nullptr;
+    if (agent.createBackend(gtest::GetMockBackendName(), params, backend) != NIXL_SUCCESS) {
+        std::cerr << "failed to create the mock backend, is NIXL_PLUGIN_DIR set?" << std::endl;
+        return 1;
+    }
+
+    for (const bool batched : {false, true}) {
+        if (batched) {
+            ON_CALL(engine, registerMems(_, _))
+                .WillByDefault([&engine](const nixl_reg_dlist_t &mems,
+                                         std::vector<nixlBackendMD *> &out) {
+                    return registerParallel(engine, mems, out);
+                });
+        }
+
+        benchResult result;
+        if (!runRegistration(agent, backend, regions, iters, result)) {
+            return 1;
+        }
+        printResult(batched ? "batched" : "serial", result);
+    }
+    return 0;
+}
+
+int
+runUcx(const nixl_reg_dlist_t &regions, size_t iters) {
+    nixlAgent agent("reg_bench", nixlAgentConfig(false));
+    nixl_b_params_t params;
+    nixl_mem_list_t mems;
+    if (agent.getPluginParams("UCX", mems, params) != NIXL_SUCCESS) {
+        std::cerr << "UCX plugin not found, is NIXL_PLUGIN_DIR set?" << std::endl;
+        return 1;
+    }
+
+    nixlBackendH *backend = nullptr;
+    if (agent.createBackend("UCX", params, backend) != NIXL_SUCCESS) {
+        std::cerr << "failed to create the UCX backend" << std::endl;
+        return 1;
+    }
+
+    benchResult result;
+    if (!runRegistration(agent, backend, regions, iters, result)) {
+        return 1;
+    }
+    printResult("per region", result);
+    return 0;
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const std::string backend = (argc > 1) ? argv[1] : "MOCK";
+    const size_t num_regions = (argc > 2) ? std::max(std::atoi(argv[2]), 1) : 10000;
+    const size_t region_len = (argc > 3) ? std::max(std::atoi(argv[3]), 1) : 4096;
+    const long reg_ns = (argc > 4) ? std::max(std::atol(argv[4]), 0L) : 20000;
+    const size_t iters = (argc > 5) ? std::max(std::atoi(argv[5]), 1) : 3;
+
+    // Adjacent slices of one buffer, like the KV cache blocks of a model
+    std::vector<char> buffer(num_regions * region_len);
+    nixl_reg_dlist_t regions(DRAM_SEG);
+    for (size_t i = 0; i < num_regions; ++i) {
+        regions.addDesc(nixlBlobDesc(
+            reinterpret_cast<uintptr_t>(buffer.data()) + i * region_len, region_len, 0));
+    }
+
+    std::cout << "backend: " << backend << ", regions: " << num_regions
+              << ", region length: " << region_len << ", iterations: " << iters << std::endl;
+
+    if (backend == "MOCK") {
+        return runMock(regions, reg_ns, iters);
+    }
+    if (backend == "UCX") {
+        return runUcx(regions, iters);
+    }
+    std::cerr << "unknown backend " << backend << ", expected MOCK or UCX" << std::endl;
+    return 1;
+}
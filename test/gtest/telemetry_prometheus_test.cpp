@@ -18,6 +18,7 @@
 #include "common.h"
 #include "plugin_manager.h"
 #include "telemetry/telemetry_exporter.h"
+#include "telemetry.h"
 #include "telemetry_event.h"
 
 #include <arpa/inet.h>
@@ -38,6 +39,7 @@
 namespace {
 
 const std::string kTransferCategory = "NIXL_TELEMETRY_TRANSFER";
+const std::string kPerformanceCategory = "NIXL_TELEMETRY_PERFORMANCE";
 
 struct PrometheusSample {
     std::unordered_map<std::string, std::string> labels;
@@ -167,6 +169,11 @@ findAgentMetricSample(const std::string &body,
             continue;
         }
 
+        // Only the unlabelled sample, not the per-backend series of the same metric
+        if (labels.count("backend") != 0) {
+            continue;
+        }
+
         const auto agent_it = labels.find("agent_name");
         const auto category_it = labels.find("category");
         const auto hostname_it = labels.find("hostname");
@@ -181,6 +188,39 @@ findAgentMetricSample(const std::string &body,
     return false;
 }
 
+// Finds the sample of metric_name whose labels include all of required_labels
+bool
+findLabelledMetricSample(const std::string &body,
+                         const std::string &metric_name,
+                         const std::unordered_map<std::string, std::string> &required_labels,
+                         PrometheusSample &sample) {
+    std::istringstream body_lines(body);
+    std::string line;
+    while (std::getline(body_lines, line)) {
+        std::unordered_map<std::string, std::string> labels;
+        double value = 0;
+        if (!parsePrometheusSampleLine(line, metric_name, labels, value)) {
+            continue;
+        }
+
+        bool match = true;
+        for (const auto &[key, expected] : required_labels) {
+            const auto it = labels.find(key);
+            if (it == labels.end() || it->second != expected) {
+                match = false;
+                break;
+            }
+        }
+
+        if (match) {
+            sample.labels = labels;
+            sample.value = value;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool
 hasAnyAgentMetricSample(const std::string &body, const std::string &agent_name) {
     std::istringstream body_lines(body);
@@ -387,3 +427,161 @@ TEST_F(prometheusTelemetryTest, ExportEventIncrementReflectedInScrape) {
     EXPECT_FALSE(hasAnyAgentMetricSample(after_peer_teardown_body, peer_agent_name))
         << "Peer agent metrics remained after peer exporter was destroyed";
 }
+
+TEST_F(prometheusTelemetryTest, LabelledSeriesAndHistograms) {
+    auto handle = nixlPluginManager::getInstance().loadTelemetryPlugin("prometheus");
+    ASSERT_NE(handle, nullptr);
+
+    const std::string agent_name = "prometheus_labels_test_agent";
+    const nixlTelemetryExporterInitParams params{agent_name, 4096};
+    auto exporter = handle->createExporter(params);
+    ASSERT_NE(exporter, nullptr);
+
+    constexpr uint16_t kBackendId = 1;
+    constexpr uint16_t kPeerId = 1;
+    exporter->registerLabel(nixl_telemetry_label_t::BACKEND, kBackendId, "UCX");
+    exporter->registerLabel(nixl_telemetry_label_t::PEER, kPeerId, "peer_a");
+
+    // Two writes of 10us and 100us, and one read of 1000us, with the same backend and peer
+    const std::vector<std::pair<nixl_telemetry_op_t, uint64_t>> xfers = {
+        {nixl_telemetry_op_t::WRITE, 10},
+        {nixl_telemetry_op_t::WRITE, 100},
+        {nixl_telemetry_op_t::READ, 1000},
+    };
+    for (const auto &[op, xfer_time] : xfers) {
+        const auto bytes_type = (op == nixl_telemetry_op_t::WRITE) ?
+            nixl_telemetry_event_type_t::AGENT_TX_BYTES :
+            nixl_telemetry_event_type_t::AGENT_RX_BYTES;
+        EXPECT_EQ(exporter->exportEvent({nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                                         nixl_telemetry_event_type_t::AGENT_XFER_TIME,
+                                         xfer_time,
+                                         kBackendId,
+                                         kPeerId,
+                                         op}),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(exporter->exportEvent({nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                                         bytes_type,
+                                         4096,
+                                         kBackendId,
+                                         kPeerId,
+                                         op}),
+                  NIXL_SUCCESS);
+    }
+
+    // An unlabelled event only goes to the series without backend, peer and op labels
+    EXPECT_EQ(exporter->exportEvent({nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                                     nixl_telemetry_event_type_t::AGENT_XFER_TIME,
+                                     7}),
+              NIXL_SUCCESS);
+
+    const std::string body = waitForMetricsBody(port_);
+    ASSERT_FALSE(body.empty()) << "Got empty /metrics response on port " << port_;
+
+    const std::unordered_map<std::string, std::string> write_labels = {
+        {"agent_name", agent_name},
+        {"category", kPerformanceCategory},
+        {"backend", "UCX"},
+        {"remote_agent", "peer_a"},
+        {"op", "WRITE"}};
+
+    PrometheusSample sample;
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_time_total", write_labels, sample));
+    EXPECT_EQ(sample.value, 110);
+
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_time_us_count", write_labels, sample));
+    EXPECT_EQ(sample.value, 2);
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_time_us_sum", write_labels, sample));
+    EXPECT_EQ(sample.value, 110);
+
+    auto bucket_labels = write_labels;
+    bucket_labels["le"] = "16";
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_time_us_bucket", bucket_labels, sample));
+    EXPECT_EQ(sample.value, 1);
+    bucket_labels["le"] = "256";
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_time_us_bucket", bucket_labels, sample));
+    EXPECT_EQ(sample.value, 2);
+
+    auto read_labels = write_labels;
+    read_labels["op"] = "READ";
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_time_total", read_labels, sample));
+    EXPECT_EQ(sample.value, 1000);
+
+    auto size_labels = write_labels;
+    size_labels["category"] = kTransferCategory;
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_xfer_size_bytes_count", size_labels, sample));
+    EXPECT_EQ(sample.value, 2);
+    ASSERT_TRUE(findLabelledMetricSample(body, "agent_tx_bytes_total", size_labels, sample));
+    EXPECT_EQ(sample.value, 8192);
+
+    // The unlabelled series keep the totals of labelled and unlabelled events
+    ASSERT_TRUE(findAgentMetricSample(
+        body, "agent_xfer_time_total", agent_name, kPerformanceCategory, sample));
+    EXPECT_EQ(sample.value, 1117);
+    ASSERT_TRUE(findAgentMetricSample(
+        body, "agent_xfer_time_us_count", agent_name, kPerformanceCategory, sample));
+    EXPECT_EQ(sample.value, 4);
+    ASSERT_TRUE(findAgentMetricSample(
+        body, "agent_tx_bytes_total", agent_name, kTransferCategory, sample));
+    EXPECT_EQ(sample.value, 8192);
+    ASSERT_TRUE(findAgentMetricSample(
+        body, "agent_xfer_size_bytes_count", agent_name, kTransferCategory, sample));
+    EXPECT_EQ(sample.value, 3);
+}
+
+TEST_F(prometheusTelemetryTest, PeerLabelCardinalityLimit) {
+    const std::string agent_name = "prometheus_cardinality_test_agent";
+    env_.addVar(telemetryExporterVar, "prometheus");
+    env_.addVar(TELEMETRY_RUN_INTERVAL_VAR, "1");
+    env_.addVar(TELEMETRY_MAX_LABEL_VALUES_VAR, "2");
+
+    {
+        nixlTelemetry telemetry(agent_name);
+
+        constexpr int kNumPeers = 5;
+        for (int i = 0; i < kNumPeers; ++i) {
+            telemetry.addXferTime(std::chrono::microseconds(10),
+                                  true,
+                                  1024,
+                                  {"UCX", "peer_" + std::to_string(i)});
+        }
+
+        // The first two peers keep their names, the rest share the overflow series
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        PrometheusSample sample;
+        bool found = false;
+        std::string body;
+        const std::unordered_map<std::string, std::string> overflow_labels = {
+            {"agent_name", agent_name}, {"remote_agent", "other"}};
+        while (!found && (std::chrono::steady_clock::now() < deadline)) {
+            body = waitForMetricsBody(port_);
+            found = findLabelledMetricSample(
+                body, "agent_tx_requests_num_total", overflow_labels, sample);
+            if (!found) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+        ASSERT_TRUE(found) << "Missing overflow series in /metrics body";
+        EXPECT_EQ(sample.value, kNumPeers - 2);
+        EXPECT_EQ(sample.labels["backend"], "UCX");
+        EXPECT_EQ(sample.labels["op"], "WRITE");
+
+        for (const std::string peer : {"peer_0", "peer_1"}) {
+            EXPECT_TRUE(findLabelledMetricSample(
+                body,
+                "agent_tx_requests_num_total",
+                {{"agent_name", agent_name}, {"remote_agent", peer}},
+                sample))
+                << "Missing series for " << peer;
+            EXPECT_EQ(sample.value, 1);
+        }
+        EXPECT_FALSE(findLabelledMetricSample(
+            body,
+            "agent_tx_requests_num_total",
+            {{"agent_name", agent_name}, {"remote_agent", "peer_2"}},
+            sample));
+    }
+
+    env_.popVar();
+    env_.popVar();
+    env_.popVar();
+}
@@ -30,6 +30,7 @@
 
 #include "telemetry.h"
 #include "telemetry_event.h"
+#include "buffer_exporter.h"
 #include "nixl_types.h"
 #include "common.h"
 #include "backend/backend_engine.h"
@@ -355,3 +356,100 @@ TEST_F(telemetryTest, TelemetryAgentEventsTwo) {
 
     envHelper_.popVar();
 }
+
+TEST_F(telemetryTest, RegCacheEvents) {
+    envHelper_.addVar(TELEMETRY_RUN_INTERVAL_VAR, "1");
+
+    nixlTelemetry telemetry(testFile_);
+
+    telemetry.updateRegCacheMisses(4);
+    telemetry.updateRegCacheHits(3);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto path = testDir_.string() + "/" + testFile_;
+    auto buffer =
+        std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(path, false, TELEMETRY_VERSION);
+
+    EXPECT_EQ(buffer->size(), 2);
+
+    nixlTelemetryEvent event;
+    buffer->pop(event);
+    EXPECT_EQ(event.eventType_, nixl_telemetry_event_type_t::AGENT_REG_CACHE_MISSES);
+    EXPECT_EQ(event.category_, nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY);
+    EXPECT_EQ(event.value_, 4);
+
+    buffer->pop(event);
+    EXPECT_EQ(event.eventType_, nixl_telemetry_event_type_t::AGENT_REG_CACHE_HITS);
+    EXPECT_EQ(event.category_, nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY);
+    EXPECT_EQ(event.value_, 3);
+
+    envHelper_.popVar();
+}
+
+TEST_F(telemetryTest, ThrottleEvents) {
+    envHelper_.addVar(TELEMETRY_RUN_INTERVAL_VAR, "1");
+
+    nixlTelemetry telemetry(testFile_);
+
+    telemetry.updateThrottledRequests(2);
+    telemetry.addThrottleTime(std::chrono::microseconds(150), {"POSIX", "peer"});
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto path = testDir_.string() + "/" + testFile_;
+    auto buffer =
+        std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(path, false, TELEMETRY_VERSION);
+
+    EXPECT_EQ(buffer->size(), 2);
+
+    nixlTelemetryEvent event;
+    buffer->pop(event);
+    EXPECT_EQ(event.eventType_, nixl_telemetry_event_type_t::AGENT_THROTTLED_REQUESTS);
+    EXPECT_EQ(event.category_, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER);
+    EXPECT_EQ(event.value_, 2);
+
+    buffer->pop(event);
+    EXPECT_EQ(event.eventType_, nixl_telemetry_event_type_t::AGENT_THROTTLE_TIME);
+    EXPECT_EQ(event.category_, nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE);
+    EXPECT_EQ(event.value_, 150);
+
+    envHelper_.popVar();
+}
+
+TEST_F(telemetryTest, BufferExporterLabelsFile) {
+    const nixlTelemetryExporterInitParams params{testFile_, capacity_};
+    nixlTelemetryBufferExporter exporter(params);
+
+    exporter.registerLabel(nixl_telemetry_label_t::BACKEND, 1, "UCX");
+    exporter.registerLabel(nixl_telemetry_label_t::PEER, 1, "peer a");
+    EXPECT_EQ(exporter.exportEvent({nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                                    nixl_telemetry_event_type_t::AGENT_XFER_POST_TIME,
+                                    5,
+                                    1,
+                                    1,
+                                    nixl_telemetry_op_t::WRITE}),
+              NIXL_SUCCESS);
+    exporter.registerLabel(nixl_telemetry_label_t::BACKEND, TELEMETRY_LABEL_OTHER, "other");
+
+    auto path = testDir_.string() + "/" + testFile_;
+    auto buffer =
+        std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(path, false, TELEMETRY_VERSION);
+    ASSERT_EQ(buffer->size(), 1);
+
+    nixlTelemetryEvent event;
+    buffer->pop(event);
+    EXPECT_EQ(event.eventType_, nixl_telemetry_event_type_t::AGENT_XFER_POST_TIME);
+    EXPECT_EQ(event.backendId_, 1);
+    EXPECT_EQ(event.peerId_, 1);
+    EXPECT_EQ(event.op_, nixl_telemetry_op_t::WRITE);
+
+    // Labels are readable as soon as they are registered
+    std::ifstream labels(path + telemetryLabelsSuffix);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(labels, line);) {
+        lines.push_back(line);
+    }
+    const std::vector<std::string> expected = {"0\t1\tUCX", "1\t1\tpeer a", "0\t65535\tother"};
+    EXPECT_EQ(lines, expected);
+}
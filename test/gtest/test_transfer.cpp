@@ -474,9 +474,6 @@ protected:
     gtest::ScopedEnv env;
     std::vector<nixlBackendH *> backend_handles;
 
-private:
-    static constexpr uint64_t DEV_ID = 0;
-    static const std::string NOTIF_MSG;
     // TODO: with error handling enabled by default we get poor performance with UCX1.18.
     // Before we upgrade to UCX1.19, we need to temporarily increase the retry count,
     // in order to pass threadpool tests.
@@ -484,6 +481,10 @@ private:
     static constexpr int retry_count{10000};
     static constexpr std::chrono::milliseconds retry_timeout{10};
 
+private:
+    static constexpr uint64_t DEV_ID = 0;
+    static const std::string NOTIF_MSG;
+
     std::vector<std::unique_ptr<nixlAgent>> agents;
     std::vector<uint16_t> ports;
 };
@@ -590,6 +591,60 @@ TEST_P(TestTransfer, remoteMDFromSocket)
     deregisterMem(getAgent(1), dst_buffers, mem_type);
 }
 
+TEST_P(TestTransfer, CancelThenRepost) {
+    constexpr size_t size = 1024 * 1024;
+    constexpr size_t count = 16;
+    std::vector<MemBuffer> src_buffers, dst_buffers;
+    createRegisteredMem(getAgent(0), size, count, DRAM_SEG, src_buffers);
+    createRegisteredMem(getAgent(1), size, count, DRAM_SEG, dst_buffers);
+    exchangeMD(0, 1);
+
+    nixl_opt_args_t extra_params;
+    extra_params.notif = "repost";
+    nixlXferReqH *xfer_req = nullptr;
+    ASSERT_EQ(getAgent(0).createXferReq(NIXL_WRITE,
+                                        makeDescList<nixlBasicDesc>(src_buffers, DRAM_SEG),
+                                        makeDescList<nixlBasicDesc>(dst_buffers, DRAM_SEG),
+                                        getAgentName(1),
+                                        xfer_req,
+                                        &extra_params),
+              NIXL_SUCCESS);
+
+    nixl_notifs_t notif_map;
+    auto wait_final = [&](nixl_status_t status) {
+        for (int i = 0; (status == NIXL_IN_PROG) && (i < retry_count); i++) {
+            if (!isProgressThreadEnabled()) {
+                EXPECT_EQ(getAgent(1).getNotifs(notif_map), NIXL_SUCCESS);
+            }
+            std::this_thread::sleep_for(retry_timeout);
+            status = getAgent(0).getXferStatus(xfer_req);
+        }
+        return status;
+    };
+
+    // The transfer may complete before it could be aborted
+    nixl_status_t status = getAgent(0).postXferReq(xfer_req);
+    ASSERT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+    status = wait_final(getAgent(0).cancelXferReq(xfer_req));
+    EXPECT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_ERR_CANCELED)) << status;
+
+    // The repost does not see the requests of the canceled post, nor loses the peer
+    status = getAgent(0).postXferReq(xfer_req);
+    ASSERT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+    EXPECT_EQ(wait_final(status), NIXL_SUCCESS);
+
+    for (int i = 0; (notif_map[getAgentName(0)].empty()) && (i < retry_count); i++) {
+        ASSERT_EQ(getAgent(1).getNotifs(notif_map), NIXL_SUCCESS);
+        std::this_thread::sleep_for(retry_timeout);
+    }
+    EXPECT_FALSE(notif_map[getAgentName(0)].empty());
+
+    EXPECT_EQ(getAgent(0).releaseXferReq(xfer_req), NIXL_SUCCESS);
+    invalidateMD(0, 1);
+    deregisterMem(getAgent(0), src_buffers, DRAM_SEG);
+    deregisterMem(getAgent(1), dst_buffers, DRAM_SEG);
+}
+
 TEST_P(TestTransfer, NotificationOnly) {
     constexpr size_t repeat = 100;
     constexpr size_t num_threads = 4;
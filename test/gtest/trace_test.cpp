@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "common.h"
+#include "telemetry/trace.h"
+
+namespace fs = std::filesystem;
+
+class traceTest : public ::testing::Test {
+protected:
+    void
+    SetUp() override {
+        testDir_ = fs::temp_directory_path() / ("nixl_trace_test_" + std::to_string(getpid()));
+        fs::remove_all(testDir_);
+    }
+
+    void
+    TearDown() override {
+        try {
+            fs::remove_all(testDir_);
+        }
+        catch (const fs::filesystem_error &e) {
+            // ignore can fail due to nsf
+        }
+    }
+
+    [[nodiscard]] size_t
+    countTraceFiles() const {
+        size_t count = 0;
+        for (const auto &entry : fs::directory_iterator(testDir_)) {
+            count += (entry.path().extension() == TRACE_FILE_EXT);
+        }
+        return count;
+    }
+
+    [[nodiscard]] static size_t
+    countOccurrences(const std::string &str, const std::string &pattern) {
+        size_t count = 0;
+        for (size_t pos = str.find(pattern); pos != std::string::npos;
+             pos = str.find(pattern, pos + pattern.size())) {
+            ++count;
+        }
+        return count;
+    }
+
+    fs::path testDir_;
+    gtest::ScopedEnv envHelper_;
+};
+
+TEST_F(traceTest, DisabledWithoutDir) {
+    EXPECT_EQ(nixlTracer::createFromEnv("agent"), nullptr);
+}
+
+TEST_F(traceTest, EnabledFromEnv) {
+    envHelper_.addVar(TRACE_DIR_VAR, testDir_.string());
+    envHelper_.addVar(TRACE_BUFFER_SIZE_VAR, "64");
+    auto tracer = nixlTracer::createFromEnv("agent");
+    envHelper_.popVar();
+    envHelper_.popVar();
+
+    ASSERT_NE(tracer, nullptr);
+    EXPECT_EQ(tracer->getDir(), testDir_);
+    EXPECT_NE(tracer->nextReqId(), tracer->nextReqId());
+}
+
+TEST_F(traceTest, InvalidBufferSize) {
+    EXPECT_THROW(nixlTracer("agent", testDir_, 100), std::invalid_argument);
+}
+
+TEST_F(traceTest, PerThreadBuffersExportChrome) {
+    constexpr size_t num_threads = 4;
+    constexpr size_t reqs_per_thread = 10;
+    nixlTracer tracer("agent", testDir_, 1024);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&tracer]() {
+            for (size_t i = 0; i < reqs_per_thread; ++i) {
+                const uint64_t req_id = tracer.nextReqId();
+                const uint64_t start = nixlTracer::now();
+                tracer.record(nixl_trace_stage_t::POST, req_id, start, start + 1500, 4096, "UCX");
+                tracer.record(nixl_trace_stage_t::FIRST_PROGRESS,
+                              req_id,
+                              start + 2000,
+                              start + 2000,
+                              NIXL_IN_PROG,
+                              "UCX");
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(countTraceFiles(), num_threads);
+    EXPECT_EQ(tracer.dropped(), 0u);
+
+    std::ostringstream out;
+    EXPECT_EQ(nixlTraceWriteChrome(testDir_, out), int64_t(2 * num_threads * reqs_per_thread));
+
+    const std::string json = out.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+    EXPECT_EQ(countOccurrences(json, "\"name\":\"post\""), num_threads * reqs_per_thread);
+    EXPECT_EQ(countOccurrences(json, "\"ph\":\"X\",\"dur\":1.500"), num_threads * reqs_per_thread);
+    EXPECT_EQ(countOccurrences(json, "\"name\":\"first_progress\""), num_threads * reqs_per_thread);
+    EXPECT_EQ(countOccurrences(json, "\"process_name\""), 1u);
+    EXPECT_NE(json.find("\"args\":{\"name\":\"agent\"}"), std::string::npos);
+
+    // Exporting drains the buffers
+    std::ostringstream again;
+    EXPECT_EQ(nixlTraceWriteChrome(testDir_, again), 0);
+}
+
+TEST_F(traceTest, FullBufferDropsEvents) {
+    constexpr size_t buffer_size = 8;
+    nixlTracer tracer("agent", testDir_, buffer_size);
+
+    // One slot is kept free to tell a full buffer from an empty one
+    for (size_t i = 0; i < buffer_size; ++i) {
+        tracer.record(nixl_trace_stage_t::CREATE, i + 1, 0, 10, 0, "POSIX");
+    }
+    EXPECT_EQ(tracer.dropped(), 1u);
+
+    std::ostringstream out;
+    EXPECT_EQ(nixlTraceWriteChrome(testDir_, out), int64_t(buffer_size - 1));
+}
+
+TEST_F(traceTest, AgentsInOneThreadUseSeparateBuffers) {
+    nixlTracer first("first", testDir_, 64);
+    nixlTracer second("second", testDir_, 64);
+
+    for (int i = 0; i < 3; ++i) {
+        first.record(nixl_trace_stage_t::CREATE, 1, 0, 10, 0, "UCX");
+        second.record(nixl_trace_stage_t::CREATE, 1, 0, 10, 0, "UCX");
+    }
+    EXPECT_EQ(countTraceFiles(), 2u);
+
+    std::ostringstream out;
+    EXPECT_EQ(nixlTraceWriteChrome(testDir_, out), 6);
+}
+
+TEST_F(traceTest, ThreadExitKeepsEvents) {
+    auto tracer = std::make_unique<nixlTracer>("agent", testDir_, 64);
+    std::thread([&tracer]() { tracer->record(nixl_trace_stage_t::CREATE, 1, 0, 10, 0, "UCX"); })
+        .join();
+
+    // A thread that outlives the tracer it recorded to
+    std::promise<void> recorded, destroyed;
+    std::thread late([&tracer, &recorded, &destroyed]() {
+        tracer->record(nixl_trace_stage_t::CREATE, 2, 0, 10, 0, "UCX");
+        recorded.set_value();
+        destroyed.get_future().wait();
+    });
+    recorded.get_future().wait();
+    tracer.reset();
+    destroyed.set_value();
+    late.join();
+
+    // The buffers of exited threads are released, their files are still drained
+    std::ostringstream out;
+    EXPECT_EQ(nixlTraceWriteChrome(testDir_, out), 2);
+}
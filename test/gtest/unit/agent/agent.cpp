@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <set>
+#include <thread>
 
 #include "common.h"
 #include "nixl.h"
@@ -67,16 +69,21 @@ namespace agent {
     class agentHelper {
     protected:
         testing::NiceMock<mocks::GMockBackendEngine> gmock_engine_;
+        testing::NiceMock<mocks::GMockBackendEngine> alt_gmock_engine_;
         std::unique_ptr<nixlAgent> agent_;
 
     public:
-        agentHelper(const std::string &name)
-            : agent_([&name]() {
+        agentHelper(const std::string &name, bool capture_telemetry = false)
+            : agent_([&name, capture_telemetry]() {
                   nixlAgentConfig cfg;
                   cfg.useProgThread = true;
+                  cfg.captureTelemetry = capture_telemetry;
                   return std::make_unique<nixlAgent>(name, cfg);
               }()) {}
 
+        agentHelper(const std::string &name, const nixlAgentConfig &cfg)
+            : agent_(std::make_unique<nixlAgent>(name, cfg)) {}
+
         ~agentHelper() {
             /* We must release nixlAgent first (i.e. explicitly in the destructor), as it calls
                cleanup functions in gmock_engine, which must stay alive during the process. */
@@ -93,12 +100,23 @@ namespace agent {
             return gmock_engine_;
         }
 
+        const mocks::GMockBackendEngine &
+        getAltGMockEngine() const {
+            return alt_gmock_engine_;
+        }
+
         nixl_status_t
         createBackendWithGMock(nixl_b_params_t &params, nixlBackendH *&backend) {
             gmock_engine_.SetToParams(params);
             return agent_->createBackend(GetMockBackendName(), params, backend);
         }
 
+        nixl_status_t
+        createAltBackendWithGMock(nixl_b_params_t &params, nixlBackendH *&backend) {
+            alt_gmock_engine_.SetToParams(params);
+            return agent_->createBackend(GetMockAltBackendName(), params, backend);
+        }
+
         nixl_status_t
         getAndLoadRemoteMd(nixlAgent *remote_agent, std::string &remote_agent_name_out) {
             std::string remote_metadata;
@@ -143,6 +161,147 @@ namespace agent {
         }
     };
 
+    // Both agents have the mock backend and its alternate, with one blob registered on each
+    class dualAgentTwoBackendsFixture : public testing::Test {
+    protected:
+        std::unique_ptr<agentHelper> local_agent_helper_, remote_agent_helper_;
+        nixlAgent *local_agent_, *remote_agent_;
+        nixlBackendH *mock_backend_, *alt_backend_;
+        blob local_blob_, remote_blob_;
+        std::string remote_agent_name_out_;
+
+        // Backends are created in the order given, which sets the default preference order
+        void
+        setUpAgents(bool alt_first,
+                    bool capture_telemetry = false,
+                    nixlAgentConfig cfg = nixlAgentConfig()) {
+            cfg.useProgThread = true;
+            cfg.captureTelemetry = capture_telemetry;
+            local_agent_helper_ = std::make_unique<agentHelper>(local_agent_name, cfg);
+            remote_agent_helper_ = std::make_unique<agentHelper>(remote_agent_name);
+            local_agent_ = local_agent_helper_->getAgent();
+            remote_agent_ = remote_agent_helper_->getAgent();
+
+            auto create_backends = [alt_first](agentHelper &helper,
+                                               nixlBackendH *&mock_backend,
+                                               nixlBackendH *&alt_backend) {
+                nixl_b_params_t mock_params, alt_params;
+                if (alt_first) {
+                    EXPECT_EQ(helper.createAltBackendWithGMock(alt_params, alt_backend),
+                              NIXL_SUCCESS);
+                }
+                EXPECT_EQ(helper.createBackendWithGMock(mock_params, mock_backend),
+                          NIXL_SUCCESS);
+                if (!alt_first) {
+                    EXPECT_EQ(helper.createAltBackendWithGMock(alt_params, alt_backend),
+                              NIXL_SUCCESS);
+                }
+            };
+
+            nixlBackendH *remote_mock_backend, *remote_alt_backend;
+            create_backends(*local_agent_helper_, mock_backend_, alt_backend_);
+            create_backends(*remote_agent_helper_, remote_mock_backend, remote_alt_backend);
+
+            nixl_reg_dlist_t local_reg_dlist(DRAM_SEG), remote_reg_dlist(DRAM_SEG);
+            nixl_opt_args_t local_extra_params, remote_extra_params;
+            local_extra_params.backends.push_back(alt_backend_);
+            remote_extra_params.backends.push_back(remote_alt_backend);
+            EXPECT_EQ(local_agent_helper_->initAndRegisterMemory(
+                          local_blob_, local_reg_dlist, local_extra_params, mock_backend_),
+                      NIXL_SUCCESS);
+            EXPECT_EQ(remote_agent_helper_->initAndRegisterMemory(
+                          remote_blob_, remote_reg_dlist, remote_extra_params, remote_mock_backend),
+                      NIXL_SUCCESS);
+
+            EXPECT_EQ(
+                local_agent_helper_->getAndLoadRemoteMd(remote_agent_, remote_agent_name_out_),
+                NIXL_SUCCESS);
+        }
+
+        nixlBackendH *
+        createXferAndQuery(nixl_backend_choice_t &choice,
+                           const std::vector<nixlBackendH *> &hints = {},
+                           bool post = false) {
+            nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+            local_xfer_dlist.addDesc(local_blob_.getDesc());
+            remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+
+            nixl_opt_args_t extra_params;
+            extra_params.backends = hints;
+
+            nixlXferReqH *xfer_req = nullptr;
+            EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                                  local_xfer_dlist,
+                                                  remote_xfer_dlist,
+                                                  remote_agent_name_out_,
+                                                  xfer_req,
+                                                  &extra_params),
+                      NIXL_SUCCESS);
+            if (!xfer_req) {
+                return nullptr;
+            }
+
+            nixlBackendH *backend = nullptr;
+            EXPECT_EQ(local_agent_->queryXferBackend(xfer_req, backend, choice), NIXL_SUCCESS);
+            if (post) {
+                EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_SUCCESS);
+            }
+            EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+            return backend;
+        }
+
+        void
+        TearDown() override {
+            local_agent_helper_.reset();
+            remote_agent_helper_.reset();
+        }
+    };
+
+    // Both agents have the mock backend, with one blob registered on each
+    class dualAgentMockBackendFixture : public testing::Test {
+    protected:
+        std::unique_ptr<agentHelper> local_agent_helper_, remote_agent_helper_;
+        nixlAgent *local_agent_, *remote_agent_;
+        nixlBackendH *local_backend_, *remote_backend_;
+        blob local_blob_, remote_blob_;
+        std::string remote_agent_name_out_;
+
+        // The configuration applies to the local agent
+        void
+        setUpAgents(nixlAgentConfig cfg = nixlAgentConfig()) {
+            cfg.useProgThread = true;
+            local_agent_helper_ = std::make_unique<agentHelper>(local_agent_name, cfg);
+            remote_agent_helper_ = std::make_unique<agentHelper>(remote_agent_name);
+            local_agent_ = local_agent_helper_->getAgent();
+            remote_agent_ = remote_agent_helper_->getAgent();
+
+            nixl_b_params_t local_params, remote_params;
+            EXPECT_EQ(local_agent_helper_->createBackendWithGMock(local_params, local_backend_),
+                      NIXL_SUCCESS);
+            EXPECT_EQ(remote_agent_helper_->createBackendWithGMock(remote_params, remote_backend_),
+                      NIXL_SUCCESS);
+
+            nixl_reg_dlist_t local_reg_dlist(DRAM_SEG), remote_reg_dlist(DRAM_SEG);
+            nixl_opt_args_t local_extra_params, remote_extra_params;
+            EXPECT_EQ(local_agent_helper_->initAndRegisterMemory(
+                          local_blob_, local_reg_dlist, local_extra_params, local_backend_),
+                      NIXL_SUCCESS);
+            EXPECT_EQ(remote_agent_helper_->initAndRegisterMemory(
+                          remote_blob_, remote_reg_dlist, remote_extra_params, remote_backend_),
+                      NIXL_SUCCESS);
+
+            EXPECT_EQ(
+                local_agent_helper_->getAndLoadRemoteMd(remote_agent_, remote_agent_name_out_),
+                NIXL_SUCCESS);
+        }
+
+        void
+        TearDown() override {
+            local_agent_helper_.reset();
+            remote_agent_helper_.reset();
+        }
+    };
+
     class singleAgentWithMemParamFixture : public testing::TestWithParam<nixl_mem_t> {
     protected:
         std::unique_ptr<agentHelper> agent_helper_;
@@ -293,6 +452,82 @@ namespace agent {
                              << timed1_ns << " ns2=" << timed2_ns << " ratio=" << ratio << ")";
     }
 
+    TEST_F(singleAgentSessionFixture, RegisterMemRollbackTest) {
+        constexpr size_t num_descs = 8;
+        constexpr size_t desc_len = 64;
+        constexpr uintptr_t base_addr = 0x100000;
+        constexpr uintptr_t last_addr = base_addr + (num_descs - 1) * desc_len;
+
+        nixl_b_params_t params;
+        nixlBackendH *backend;
+        EXPECT_EQ(agent_helper_->createBackendWithGMock(params, backend), NIXL_SUCCESS);
+
+        // Only registered with the mock, the regions are never accessed
+        nixl_reg_dlist_t reg_dlist(DRAM_SEG);
+        for (size_t i = 0; i < num_descs; ++i) {
+            reg_dlist.addDesc(nixlBlobDesc(base_addr + i * desc_len, desc_len, 0));
+        }
+        nixl_opt_args_t extra_params;
+        extra_params.backends.push_back(backend);
+
+        // The metadata of a region is its address, so the last one can be told apart
+        const auto &engine = agent_helper_->getGMockEngine();
+        EXPECT_CALL(engine, registerMem)
+            .Times(num_descs)
+            .WillRepeatedly([](const nixlBlobDesc &desc, const nixl_mem_t &, nixlBackendMD *&out) {
+                out = reinterpret_cast<nixlBackendMD *>(desc.addr);
+                return NIXL_SUCCESS;
+            });
+        EXPECT_CALL(engine, getPublicData)
+            .Times(num_descs)
+            .WillRepeatedly([](const nixlBackendMD *meta, std::string &) {
+                return (reinterpret_cast<uintptr_t>(meta) == last_addr) ? NIXL_ERR_BACKEND :
+                                                                          NIXL_SUCCESS;
+            });
+        // A failure of any region releases all of them
+        EXPECT_CALL(engine, deregisterMem).Times(num_descs);
+
+        EXPECT_EQ(agent_->registerMem(reg_dlist, &extra_params), NIXL_ERR_BACKEND);
+        EXPECT_NE(agent_->deregisterMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+    }
+
+    TEST_F(singleAgentSessionFixture, RegisterMemCacheTest) {
+        nixl_b_params_t params;
+        nixlBackendH *backend;
+        EXPECT_EQ(agent_helper_->createBackendWithGMock(params, backend), NIXL_SUCCESS);
+
+        blob blob;
+        nixl_opt_args_t extra_params;
+        nixl_reg_dlist_t reg_dlist(DRAM_SEG);
+        reg_dlist.addDesc(blob.getDesc());
+        extra_params.backends.push_back(backend);
+
+        // Part of the same buffer, covered by its registration
+        const nixlBlobDesc whole = blob.getDesc();
+        nixl_reg_dlist_t sub_dlist(DRAM_SEG);
+        sub_dlist.addDesc(nixlBlobDesc(whole.addr + 16, whole.len / 2, whole.devId));
+
+        // A single backend registration, released with the last region using it
+        const auto &engine = agent_helper_->getGMockEngine();
+        testing::MockFunction<void()> last_region;
+        EXPECT_CALL(engine, registerMem).Times(1);
+        {
+            testing::InSequence seq;
+            EXPECT_CALL(last_region, Call());
+            EXPECT_CALL(engine, deregisterMem).Times(1);
+        }
+
+        EXPECT_EQ(agent_->registerMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+        EXPECT_EQ(agent_->registerMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+        EXPECT_EQ(agent_->registerMem(sub_dlist, &extra_params), NIXL_SUCCESS);
+
+        EXPECT_EQ(agent_->deregisterMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+        EXPECT_EQ(agent_->deregisterMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+        last_region.Call();
+        EXPECT_EQ(agent_->deregisterMem(sub_dlist, &extra_params), NIXL_SUCCESS);
+        EXPECT_NE(agent_->deregisterMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+    }
+
     INSTANTIATE_TEST_SUITE_P(DramRegisterMemoryInstantiation,
                              singleAgentWithMemParamFixture,
                              testing::Values(DRAM_SEG));
@@ -338,6 +573,48 @@ namespace agent {
         EXPECT_EQ(local_agent_->invalidateRemoteMD(remote_agent_name_out), NIXL_SUCCESS);
     }
 
+    TEST_F(dualAgentBridgeFixture, LoadLargeRemoteMetadataTest) {
+        constexpr size_t num_descs = 20000;
+        constexpr size_t desc_len = 64;
+        constexpr uintptr_t base_addr = 0x100000;
+
+        nixl_b_params_t local_params, remote_params;
+        nixlBackendH *local_backend, *remote_backend;
+        EXPECT_EQ(local_agent_helper_->createBackendWithGMock(local_params, local_backend),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(remote_agent_helper_->createBackendWithGMock(remote_params, remote_backend),
+                  NIXL_SUCCESS);
+
+        // Only registered with the mock, the regions are never accessed
+        nixl_reg_dlist_t regions(DRAM_SEG);
+        for (size_t i = 0; i < num_descs; ++i) {
+            regions.addDesc(nixlBlobDesc(base_addr + i * desc_len, desc_len, 0));
+        }
+        nixl_opt_args_t extra_params;
+        extra_params.backends.push_back(remote_backend);
+        ASSERT_EQ(remote_agent_->registerMem(regions, &extra_params), NIXL_SUCCESS);
+
+        // Each region is loaded exactly once, spread over threads where available
+        ON_CALL(local_agent_helper_->getGMockEngine(), supportsConcurrentLoadMD())
+            .WillByDefault(testing::Return(true));
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), loadRemoteMD).Times(num_descs);
+
+        std::string remote_agent_name_out;
+        ASSERT_EQ(local_agent_helper_->getAndLoadRemoteMd(remote_agent_, remote_agent_name_out),
+                  NIXL_SUCCESS);
+
+        nixl_xfer_dlist_t descs(DRAM_SEG);
+        descs.addDesc(nixlBasicDesc(base_addr, desc_len, 0));
+        descs.addDesc(nixlBasicDesc(base_addr + (num_descs / 2) * desc_len + 8, 16, 0));
+        descs.addDesc(nixlBasicDesc(base_addr + (num_descs - 1) * desc_len, desc_len, 0));
+        nixlDlistH *handle = nullptr;
+        EXPECT_EQ(local_agent_->prepXferDlist(remote_agent_name_out, descs, handle),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releasedDlistH(handle), NIXL_SUCCESS);
+
+        EXPECT_EQ(remote_agent_->deregisterMem(regions, &extra_params), NIXL_SUCCESS);
+    }
+
     TEST_F(dualAgentBridgeFixture, XferReqTest) {
         const std::string msg = "notification";
         EXPECT_CALL(remote_agent_helper_->getGMockEngine(), getNotifs)
@@ -459,6 +736,823 @@ namespace agent {
         EXPECT_EQ(local_agent_->releasedDlistH(desc_hndl2), NIXL_SUCCESS);
     }
 
+    TEST_F(dualAgentMockBackendFixture, XferReqIndexRunsTest) {
+        setUpAgents();
+
+        // Split each blob into 8 back to back blocks
+        constexpr int num_blocks = 8;
+        const nixlBlobDesc local_desc = local_blob_.getDesc();
+        const nixlBlobDesc remote_desc = remote_blob_.getDesc();
+        const size_t block_len = local_desc.len / num_blocks;
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        for (int i = 0; i < num_blocks; i++) {
+            local_xfer_dlist.addDesc(
+                nixlBasicDesc(local_desc.addr + i * block_len, block_len, local_desc.devId));
+            remote_xfer_dlist.addDesc(
+                nixlBasicDesc(remote_desc.addr + i * block_len, block_len, remote_desc.devId));
+        }
+
+        nixlDlistH *desc_hndl1, *desc_hndl2;
+        EXPECT_EQ(local_agent_->prepXferDlist(local_xfer_dlist, desc_hndl1), NIXL_SUCCESS);
+        EXPECT_EQ(
+            local_agent_->prepXferDlist(remote_agent_name_out_, remote_xfer_dlist, desc_hndl2),
+            NIXL_SUCCESS);
+
+        int prepped_count = 0;
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), prepXfer)
+            .Times(2)
+            .WillRepeatedly([&](const nixl_xfer_op_t &,
+                                const nixl_meta_dlist_t &src,
+                                const nixl_meta_dlist_t &dst,
+                                const std::string &,
+                                nixlBackendReqH *&,
+                                const nixl_opt_b_args_t *) {
+                EXPECT_EQ(src.descCount(), dst.descCount());
+                prepped_count = src.descCount();
+                return NIXL_SUCCESS;
+            });
+
+        // A single contiguous run on both sides merges into one descriptor
+        nixlXferReqH *xfer_req;
+        const nixl_index_runs_t full_run = {{0, num_blocks, 1}};
+        EXPECT_EQ(local_agent_->makeXferReq(
+                      NIXL_WRITE, desc_hndl1, full_run, desc_hndl2, full_run, xfer_req),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(prepped_count, 1);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        // Even then odd blocks locally, contiguous remotely: nothing can be merged
+        const nixl_index_runs_t strided_runs = {{0, num_blocks / 2, 2}, {1, num_blocks / 2, 2}};
+        EXPECT_EQ(local_agent_->makeXferReq(
+                      NIXL_WRITE, desc_hndl1, strided_runs, desc_hndl2, full_run, xfer_req),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(prepped_count, num_blocks);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        // Last index of the strided run is past the end of the list
+        const nixl_index_runs_t out_of_range = {{num_blocks - 2, 2, 2}};
+        EXPECT_EQ(local_agent_->makeXferReq(
+                      NIXL_WRITE, desc_hndl1, out_of_range, desc_hndl2, out_of_range, xfer_req),
+                  NIXL_ERR_INVALID_PARAM);
+
+        const nixl_index_runs_t empty_run = {{0, 0, 1}, {0, 1, 1}};
+        EXPECT_EQ(local_agent_->makeXferReq(
+                      NIXL_WRITE, desc_hndl1, empty_run, desc_hndl2, empty_run, xfer_req),
+                  NIXL_ERR_INVALID_PARAM);
+
+        const nixl_index_runs_t short_run = {{0, num_blocks - 1, 1}};
+        EXPECT_EQ(local_agent_->makeXferReq(
+                      NIXL_WRITE, desc_hndl1, full_run, desc_hndl2, short_run, xfer_req),
+                  NIXL_ERR_INVALID_PARAM);
+
+        EXPECT_EQ(local_agent_->releasedDlistH(desc_hndl1), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releasedDlistH(desc_hndl2), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentBridgeFixture, StagingPoolTest) {
+        nixl_b_params_t local_params;
+        nixlBackendH *local_backend;
+        EXPECT_EQ(local_agent_helper_->createBackendWithGMock(local_params, local_backend),
+                  NIXL_SUCCESS);
+
+        // The whole pool is registered once, buffers are handed out without registering
+        constexpr size_t pool_size = 2 * 1024 * 1024;
+        constexpr size_t buffer_size = 64 * 1024;
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), registerMem).Times(1);
+        nixlStagingPoolH *pool;
+        EXPECT_EQ(local_agent_->createStagingPool(pool_size, buffer_size, pool), NIXL_SUCCESS);
+
+        std::vector<nixlBasicDesc> buffers(pool_size / buffer_size);
+        std::set<uintptr_t> addrs;
+        for (auto &buffer : buffers) {
+            EXPECT_EQ(local_agent_->getStagingBuffer(pool, buffer), NIXL_SUCCESS);
+            EXPECT_EQ(buffer.len, buffer_size);
+            addrs.insert(buffer.addr);
+        }
+        EXPECT_EQ(addrs.size(), buffers.size());
+
+        nixlBasicDesc extra;
+        EXPECT_EQ(local_agent_->getStagingBuffer(pool, extra), NIXL_ERR_NOT_FOUND);
+        EXPECT_EQ(local_agent_->releaseStagingPool(pool), NIXL_ERR_NOT_ALLOWED);
+
+        const nixlBasicDesc inside(buffers[0].addr + 1, 1, 0);
+        EXPECT_EQ(local_agent_->releaseStagingBuffer(pool, inside), NIXL_ERR_INVALID_PARAM);
+
+        for (const auto &buffer : buffers) {
+            EXPECT_EQ(local_agent_->releaseStagingBuffer(pool, buffer), NIXL_SUCCESS);
+        }
+        EXPECT_EQ(local_agent_->getStagingBuffer(pool, extra), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseStagingBuffer(pool, extra), NIXL_SUCCESS);
+
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), deregisterMem).Times(1);
+        EXPECT_EQ(local_agent_->releaseStagingPool(pool), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentBridgeFixture, StagedXferReqTest) {
+        nixl_b_params_t local_params, remote_params;
+        nixlBackendH *local_backend, *remote_backend;
+        EXPECT_EQ(local_agent_helper_->createBackendWithGMock(local_params, local_backend),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(remote_agent_helper_->createBackendWithGMock(remote_params, remote_backend),
+                  NIXL_SUCCESS);
+
+        nixl_reg_dlist_t remote_reg_dlist(DRAM_SEG);
+        nixl_opt_args_t remote_extra_params;
+        blob remote_blob;
+        EXPECT_EQ(remote_agent_helper_->initAndRegisterMemory(
+                      remote_blob, remote_reg_dlist, remote_extra_params, remote_backend),
+                  NIXL_SUCCESS);
+
+        std::string remote_agent_name_out;
+        EXPECT_EQ(local_agent_helper_->getAndLoadRemoteMd(remote_agent_, remote_agent_name_out),
+                  NIXL_SUCCESS);
+
+        // Buffers smaller than the transfer, so it is split over several of them
+        constexpr size_t buffer_size = 100;
+        nixlStagingPoolH *pool;
+        EXPECT_EQ(local_agent_->createStagingPool(2 * 1024 * 1024, buffer_size, pool),
+                  NIXL_SUCCESS);
+
+        // Local memory is never registered
+        const nixlBlobDesc remote_desc = remote_blob.getDesc();
+        std::vector<char> user(remote_desc.len);
+        for (size_t i = 0; i < user.size(); i++) {
+            user[i] = static_cast<char>(i);
+        }
+
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(
+            nixlBasicDesc(reinterpret_cast<uintptr_t>(user.data()), user.size(), 0));
+        remote_xfer_dlist.addDesc(remote_desc);
+
+        nixl_opt_args_t extra_params;
+        extra_params.stagingPool = pool;
+        const int num_pieces = (user.size() + buffer_size - 1) / buffer_size;
+
+        // Data is in the staging buffers when a write is posted
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), postXfer)
+            .WillOnce([&](const nixl_xfer_op_t &,
+                          const nixl_meta_dlist_t &src,
+                          const nixl_meta_dlist_t &dst,
+                          const std::string &,
+                          nixlBackendReqH *&,
+                          const nixl_opt_b_args_t *) {
+                EXPECT_EQ(src.descCount(), num_pieces);
+                EXPECT_EQ(dst.descCount(), num_pieces);
+                size_t offset = 0;
+                for (int i = 0; i < src.descCount(); i++) {
+                    EXPECT_EQ(dst[i].addr, remote_desc.addr + offset);
+                    EXPECT_EQ(memcmp(reinterpret_cast<const void *>(src[i].addr),
+                                     user.data() + offset,
+                                     src[i].len),
+                              0);
+                    offset += src[i].len;
+                }
+                EXPECT_EQ(offset, user.size());
+                return NIXL_SUCCESS;
+            });
+
+        nixlXferReqH *xfer_req;
+        EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                              local_xfer_dlist,
+                                              remote_xfer_dlist,
+                                              remote_agent_name_out,
+                                              xfer_req,
+                                              &extra_params),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseStagingPool(pool), NIXL_ERR_NOT_ALLOWED);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        // Data that arrived in the staging buffers is copied out when a read completes
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), postXfer)
+            .WillOnce([&](const nixl_xfer_op_t &,
+                          const nixl_meta_dlist_t &src,
+                          const nixl_meta_dlist_t &,
+                          const std::string &,
+                          nixlBackendReqH *&,
+                          const nixl_opt_b_args_t *) {
+                for (const auto &desc : src) {
+                    memset(reinterpret_cast<void *>(desc.addr), 0x5a, desc.len);
+                }
+                return NIXL_IN_PROG;
+            });
+
+        EXPECT_EQ(local_agent_->createXferReq(NIXL_READ,
+                                              local_xfer_dlist,
+                                              remote_xfer_dlist,
+                                              remote_agent_name_out,
+                                              xfer_req,
+                                              &extra_params),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(user[1], 1);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(std::count(user.begin(), user.end(), 0x5a), static_cast<long>(user.size()));
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        EXPECT_EQ(local_agent_->releaseStagingPool(pool), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentMockBackendFixture, XferPlanTest) {
+        setUpAgents();
+
+        // Two blocks of 16 bytes with a gap between them, like two layers of one KV block
+        constexpr size_t block_len = 16;
+        const nixlBlobDesc local_desc = local_blob_.getDesc();
+        const nixlBlobDesc remote_desc = remote_blob_.getDesc();
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        for (size_t offset : {size_t(0), 2 * block_len}) {
+            local_xfer_dlist.addDesc(
+                nixlBasicDesc(local_desc.addr + offset, block_len, local_desc.devId));
+            remote_xfer_dlist.addDesc(
+                nixlBasicDesc(remote_desc.addr + offset, block_len, remote_desc.devId));
+        }
+
+        nixlXferPlanH *plan;
+        EXPECT_EQ(local_agent_->compileXferPlan(NIXL_WRITE,
+                                                local_xfer_dlist,
+                                                remote_xfer_dlist,
+                                                remote_agent_name_out_,
+                                                plan),
+                  NIXL_SUCCESS);
+
+        std::vector<nixlBasicDesc> prepped_local, prepped_remote;
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), prepXfer)
+            .WillRepeatedly([&](const nixl_xfer_op_t &,
+                                const nixl_meta_dlist_t &src,
+                                const nixl_meta_dlist_t &dst,
+                                const std::string &,
+                                nixlBackendReqH *&,
+                                const nixl_opt_b_args_t *) {
+                prepped_local.assign(src.begin(), src.end());
+                prepped_remote.assign(dst.begin(), dst.end());
+                return NIXL_SUCCESS;
+            });
+
+        // Two copies of the template at other offsets on each side
+        nixlXferReqH *xfer_req;
+        EXPECT_EQ(local_agent_->makeXferReq(plan, {0, 64}, {128, 16}, xfer_req), NIXL_SUCCESS);
+        ASSERT_EQ(prepped_local.size(), 4u);
+        EXPECT_EQ(prepped_local[2].addr, local_desc.addr + 64);
+        EXPECT_EQ(prepped_local[3].addr, local_desc.addr + 64 + 2 * block_len);
+        EXPECT_EQ(prepped_remote[0].addr, remote_desc.addr + 128);
+        EXPECT_EQ(prepped_remote[3].addr, remote_desc.addr + 16 + 2 * block_len);
+        EXPECT_EQ(local_agent_->releaseXferPlan(plan), NIXL_ERR_NOT_ALLOWED);
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        // A copy starting where the previous one ends on both sides merges with it
+        const int64_t next = 3 * block_len;
+        EXPECT_EQ(local_agent_->makeXferReq(plan, {0, next}, {0, next}, xfer_req), NIXL_SUCCESS);
+        ASSERT_EQ(prepped_local.size(), 3u);
+        EXPECT_EQ(prepped_local[1].len, 2 * block_len);
+        EXPECT_EQ(prepped_remote[1].len, 2 * block_len);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        // The last block would end past the registered blob
+        const int64_t past_end = local_desc.len - 2 * block_len;
+        EXPECT_EQ(local_agent_->makeXferReq(plan, {past_end}, {0}, xfer_req),
+                  NIXL_ERR_INVALID_PARAM);
+        EXPECT_EQ(local_agent_->makeXferReq(plan, {0}, {-1}, xfer_req), NIXL_ERR_INVALID_PARAM);
+        EXPECT_EQ(local_agent_->makeXferReq(plan, {0, 0}, {0}, xfer_req), NIXL_ERR_INVALID_PARAM);
+
+        EXPECT_EQ(local_agent_->releaseXferPlan(plan), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseXferPlan(nullptr), NIXL_ERR_INVALID_PARAM);
+    }
+
+    TEST_F(dualAgentMockBackendFixture, XferPlanPrepReuseTest) {
+        setUpAgents();
+
+        const nixlBlobDesc local_desc = local_blob_.getDesc();
+        const nixlBlobDesc remote_desc = remote_blob_.getDesc();
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(nixlBasicDesc(local_desc.addr, 16, local_desc.devId));
+        remote_xfer_dlist.addDesc(nixlBasicDesc(remote_desc.addr, 16, remote_desc.devId));
+
+        // Prepared handles of one descriptor are prepared once, by the compilation, then
+        // reused. Two copies that do not merge need a handle of their own.
+        nixlBackendReqH backend_handle;
+        const auto &engine = local_agent_helper_->getGMockEngine();
+        ON_CALL(engine, supportsPrepReuse()).WillByDefault(testing::Return(true));
+        EXPECT_CALL(engine, prepXfer)
+            .Times(2)
+            .WillRepeatedly([&](const nixl_xfer_op_t &,
+                                const nixl_meta_dlist_t &,
+                                const nixl_meta_dlist_t &,
+                                const std::string &,
+                                nixlBackendReqH *&handle,
+                                const nixl_opt_b_args_t *) {
+                handle = &backend_handle;
+                return NIXL_SUCCESS;
+            });
+
+        nixlXferPlanH *plan;
+        EXPECT_EQ(local_agent_->compileXferPlan(NIXL_WRITE,
+                                                local_xfer_dlist,
+                                                remote_xfer_dlist,
+                                                remote_agent_name_out_,
+                                                plan),
+                  NIXL_SUCCESS);
+
+        nixlXferReqH *xfer_req;
+        for (int64_t offset : {0, 64, 128}) {
+            EXPECT_EQ(local_agent_->makeXferReq(plan, {offset}, {offset}, xfer_req),
+                      NIXL_SUCCESS);
+            EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_SUCCESS);
+            EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+        }
+
+        EXPECT_EQ(local_agent_->makeXferReq(plan, {0, 64}, {0, 64}, xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+        EXPECT_CALL(engine, releaseReqH(&backend_handle)).Times(2);
+        EXPECT_EQ(local_agent_->releaseXferPlan(plan), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentMockBackendFixture, CancelXferReqTest) {
+        setUpAgents();
+
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(local_blob_.getDesc());
+        remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+        nixl_opt_args_t xfer_params;
+        xfer_params.backends.push_back(local_backend_);
+        nixlXferReqH *xfer_req;
+        EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                              local_xfer_dlist,
+                                              remote_xfer_dlist,
+                                              remote_agent_name_out_,
+                                              xfer_req,
+                                              &xfer_params),
+                  NIXL_SUCCESS);
+
+        // The backend reports check_status, and cancel_status when asked to cancel
+        nixl_status_t check_status = NIXL_IN_PROG;
+        nixl_status_t cancel_status = NIXL_ERR_CANCELED;
+        int cancel_calls = 0;
+        const auto &engine = local_agent_helper_->getGMockEngine();
+        ON_CALL(engine, postXfer).WillByDefault(testing::Return(NIXL_IN_PROG));
+        ON_CALL(engine, checkXfer).WillByDefault([&](nixlBackendReqH *) { return check_status; });
+        ON_CALL(engine, cancelXfer).WillByDefault([&](nixlBackendReqH *) {
+            cancel_calls++;
+            return cancel_status;
+        });
+
+        // Nothing to cancel before the post
+        EXPECT_EQ(local_agent_->cancelXferReq(xfer_req), NIXL_ERR_NOT_POSTED);
+        EXPECT_EQ(cancel_calls, 0);
+
+        // Canceled within the call
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->cancelXferReq(xfer_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(cancel_calls, 1);
+
+        // Canceled in the background, the abort is requested once and then polled
+        cancel_status = NIXL_IN_PROG;
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->cancelXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->cancelXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_IN_PROG);
+        check_status = NIXL_ERR_CANCELED;
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(cancel_calls, 2);
+
+        // A backend that cannot cancel leaves the transfer running
+        cancel_status = NIXL_ERR_NOT_SUPPORTED;
+        check_status = NIXL_IN_PROG;
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->cancelXferReq(xfer_req), NIXL_ERR_NOT_SUPPORTED);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_IN_PROG);
+        check_status = NIXL_SUCCESS;
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(cancel_calls, 3);
+
+        // A completed transfer keeps its status
+        EXPECT_EQ(local_agent_->cancelXferReq(xfer_req), NIXL_SUCCESS);
+        EXPECT_EQ(cancel_calls, 3);
+
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentMockBackendFixture, XferDeadlineTest) {
+        setUpAgents();
+
+        int post_calls = 0;
+        int cancel_calls = 0;
+        const auto &engine = local_agent_helper_->getGMockEngine();
+        ON_CALL(engine, postXfer).WillByDefault([&](const nixl_xfer_op_t &,
+                                                    const nixl_meta_dlist_t &,
+                                                    const nixl_meta_dlist_t &,
+                                                    const std::string &,
+                                                    nixlBackendReqH *&,
+                                                    const nixl_opt_b_args_t *) {
+            post_calls++;
+            return NIXL_IN_PROG;
+        });
+        ON_CALL(engine, checkXfer).WillByDefault(testing::Return(NIXL_IN_PROG));
+        ON_CALL(engine, cancelXfer).WillByDefault([&](nixlBackendReqH *) {
+            cancel_calls++;
+            return NIXL_ERR_CANCELED;
+        });
+
+        // A request created with a past deadline is shed at post
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(local_blob_.getDesc());
+        remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+        nixl_opt_args_t xfer_params;
+        xfer_params.backends.push_back(local_backend_);
+        xfer_params.deadline = std::chrono::steady_clock::now();
+        nixlXferReqH *xfer_req;
+        EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                              local_xfer_dlist,
+                                              remote_xfer_dlist,
+                                              remote_agent_name_out_,
+                                              xfer_req,
+                                              &xfer_params),
+                  NIXL_SUCCESS);
+
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(post_calls, 0);
+
+        // A deadline given at post replaces it, and cancels the transfer once it passes
+        nixl_opt_args_t post_params;
+        post_params.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req, &post_params), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(post_calls, 1);
+        EXPECT_EQ(cancel_calls, 0);
+
+        std::this_thread::sleep_until(*post_params.deadline);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(cancel_calls, 1);
+
+        // A deadline only applies to its post, a repost without one is not canceled
+        EXPECT_EQ(local_agent_->postXferReq(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->getXferStatus(xfer_req), NIXL_IN_PROG);
+        EXPECT_EQ(post_calls, 2);
+        EXPECT_EQ(cancel_calls, 1);
+
+        EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentMockBackendFixture, TrafficClassPacingTest) {
+        // One request of the bulk class, of a 256 B blob, empties its bucket for minutes
+        nixlAgentConfig cfg;
+        cfg.trafficClassLimits[nixl_traffic_class_t::BULK] = {1, 256};
+        setUpAgents(cfg);
+
+        int post_calls = 0;
+        nixl_traffic_class_t posted_class = nixl_traffic_class_t::DEFAULT;
+        nixl_status_t check_status = NIXL_IN_PROG;
+        const auto &engine = local_agent_helper_->getGMockEngine();
+        ON_CALL(engine, postXfer).WillByDefault([&](const nixl_xfer_op_t &,
+                                                    const nixl_meta_dlist_t &,
+                                                    const nixl_meta_dlist_t &,
+                                                    const std::string &,
+                                                    nixlBackendReqH *&,
+                                                    const nixl_opt_b_args_t *opt_args) {
+            post_calls++;
+            posted_class = opt_args->trafficClass;
+            return NIXL_IN_PROG;
+        });
+        ON_CALL(engine, checkXfer).WillByDefault([&](nixlBackendReqH *) { return check_status; });
+
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(local_blob_.getDesc());
+        remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+        nixl_opt_args_t xfer_params;
+        xfer_params.backends.push_back(local_backend_);
+        xfer_params.trafficClass = nixl_traffic_class_t::BULK;
+        nixlXferReqH *first_req, *second_req;
+        for (nixlXferReqH **req : {&first_req, &second_req}) {
+            EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                                  local_xfer_dlist,
+                                                  remote_xfer_dlist,
+                                                  remote_agent_name_out_,
+                                                  *req,
+                                                  &xfer_params),
+                      NIXL_SUCCESS);
+        }
+
+        // The first request takes the burst, the second one waits for tokens
+        EXPECT_EQ(local_agent_->postXferReq(first_req), NIXL_IN_PROG);
+        EXPECT_EQ(post_calls, 1);
+        EXPECT_EQ(posted_class, nixl_traffic_class_t::BULK);
+        EXPECT_EQ(local_agent_->postXferReq(second_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->getXferStatus(second_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->postXferReq(second_req), NIXL_ERR_REPOST_ACTIVE);
+        EXPECT_EQ(post_calls, 1);
+
+        // A queued request is canceled without being posted
+        EXPECT_EQ(local_agent_->cancelXferReq(second_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(local_agent_->getXferStatus(second_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(post_calls, 1);
+
+        // A class given at post replaces the one given at creation, and is not paced
+        nixl_opt_args_t post_params;
+        post_params.trafficClass = nixl_traffic_class_t::LATENCY;
+        EXPECT_EQ(local_agent_->postXferReq(second_req, &post_params), NIXL_IN_PROG);
+        EXPECT_EQ(post_calls, 2);
+        EXPECT_EQ(posted_class, nixl_traffic_class_t::LATENCY);
+
+        check_status = NIXL_SUCCESS;
+        EXPECT_EQ(local_agent_->getXferStatus(first_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->getXferStatus(second_req), NIXL_SUCCESS);
+
+        // A queued request is released without being posted
+        EXPECT_EQ(local_agent_->postXferReq(first_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->releaseXferReq(first_req), NIXL_SUCCESS);
+        EXPECT_EQ(post_calls, 2);
+
+        EXPECT_EQ(local_agent_->releaseXferReq(second_req), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentMockBackendFixture, QueuedXferInvalidatedRemoteTest) {
+        // One request of a 256 B blob empties the bucket for 100 ms
+        nixlAgentConfig cfg;
+        cfg.trafficClassLimits[nixl_traffic_class_t::BULK] = {2560, 256};
+        setUpAgents(cfg);
+
+        int post_calls = 0;
+        const auto &engine = local_agent_helper_->getGMockEngine();
+        ON_CALL(engine, postXfer).WillByDefault([&](const nixl_xfer_op_t &,
+                                                    const nixl_meta_dlist_t &,
+                                                    const nixl_meta_dlist_t &,
+                                                    const std::string &,
+                                                    nixlBackendReqH *&,
+                                                    const nixl_opt_b_args_t *) {
+            post_calls++;
+            return NIXL_IN_PROG;
+        });
+
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(local_blob_.getDesc());
+        remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+        nixl_opt_args_t xfer_params;
+        xfer_params.backends.push_back(local_backend_);
+        xfer_params.trafficClass = nixl_traffic_class_t::BULK;
+        nixlXferReqH *first_req, *second_req;
+        for (nixlXferReqH **req : {&first_req, &second_req}) {
+            EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                                  local_xfer_dlist,
+                                                  remote_xfer_dlist,
+                                                  remote_agent_name_out_,
+                                                  *req,
+                                                  &xfer_params),
+                      NIXL_SUCCESS);
+        }
+
+        EXPECT_EQ(local_agent_->postXferReq(first_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->postXferReq(second_req), NIXL_IN_PROG);
+        EXPECT_EQ(post_calls, 1);
+
+        // Once admitted, the queued request fails instead of being posted to the removed remote
+        EXPECT_EQ(local_agent_->invalidateRemoteMD(remote_agent_name_out_), NIXL_SUCCESS);
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        EXPECT_EQ(local_agent_->getXferStatus(second_req), NIXL_ERR_NOT_FOUND);
+        EXPECT_EQ(post_calls, 1);
+
+        EXPECT_EQ(local_agent_->releaseXferReq(first_req), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releaseXferReq(second_req), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentTwoBackendsFixture, BackendSelectionPreferenceOrderTest) {
+        setUpAgents(true);
+
+        // Without cost information, the first created backend wins
+        nixl_backend_choice_t choice;
+        EXPECT_EQ(createXferAndQuery(choice), alt_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::PREFERENCE_ORDER);
+
+        // A hints list overrides the creation order
+        EXPECT_EQ(createXferAndQuery(choice, {mock_backend_, alt_backend_}), mock_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::PREFERENCE_ORDER);
+
+        EXPECT_EQ(createXferAndQuery(choice, {mock_backend_}), mock_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::SINGLE_CANDIDATE);
+    }
+
+    TEST_F(dualAgentTwoBackendsFixture, BackendSelectionEstimateTest) {
+        setUpAgents(true);
+
+        auto estimate = [](std::chrono::microseconds cost) {
+            return [cost](const nixl_xfer_op_t &,
+                          const nixl_meta_dlist_t &,
+                          const nixl_meta_dlist_t &,
+                          const std::string &,
+                          nixlBackendReqH *const &,
+                          std::chrono::microseconds &duration,
+                          std::chrono::microseconds &err_margin,
+                          nixl_cost_t &method,
+                          const nixl_opt_args_t *) {
+                duration = cost;
+                err_margin = std::chrono::microseconds(0);
+                method = nixl_cost_t::ANALYTICAL_BACKEND;
+                return NIXL_SUCCESS;
+            };
+        };
+        EXPECT_CALL(local_agent_helper_->getAltGMockEngine(), estimateXferCost)
+            .WillRepeatedly(estimate(std::chrono::microseconds(100)));
+        EXPECT_CALL(local_agent_helper_->getGMockEngine(), estimateXferCost)
+            .WillRepeatedly(estimate(std::chrono::microseconds(10)));
+
+        nixl_backend_choice_t choice;
+        EXPECT_EQ(createXferAndQuery(choice), mock_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::BACKEND_ESTIMATE);
+    }
+
+    TEST_F(dualAgentTwoBackendsFixture, BackendSelectionLearnedCostTest) {
+        // Costs are learned without telemetry
+        setUpAgents(true);
+
+        // The preferred backend takes much longer to complete each transfer
+        EXPECT_CALL(local_agent_helper_->getAltGMockEngine(), postXfer)
+            .WillRepeatedly([](const nixl_xfer_op_t &,
+                               const nixl_meta_dlist_t &,
+                               const nixl_meta_dlist_t &,
+                               const std::string &,
+                               nixlBackendReqH *&,
+                               const nixl_opt_b_args_t *) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                return NIXL_SUCCESS;
+            });
+
+        // Not enough samples yet on either backend
+        nixl_backend_choice_t choice;
+        EXPECT_EQ(createXferAndQuery(choice, {}, true), alt_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::PREFERENCE_ORDER);
+
+        // A hints list is never explored away from
+        for (int i = 0; i < 16; i++) {
+            EXPECT_EQ(createXferAndQuery(choice, {alt_backend_, mock_backend_}), alt_backend_);
+            EXPECT_EQ(choice, nixl_backend_choice_t::PREFERENCE_ORDER);
+        }
+
+        // Only the preferred backend is selected by the fallbacks, the other one gets its
+        // samples from periodic exploration
+        int explored = 0;
+        for (int i = 0; (i < 64) && (choice != nixl_backend_choice_t::LEARNED_COST); i++) {
+            nixlBackendH *backend = createXferAndQuery(choice, {}, true);
+            if (choice == nixl_backend_choice_t::EXPLORATION) {
+                EXPECT_EQ(backend, mock_backend_);
+                explored++;
+            }
+        }
+        // As many as the samples needed before a fit is used
+        EXPECT_EQ(explored, 4);
+        EXPECT_EQ(choice, nixl_backend_choice_t::LEARNED_COST);
+
+        EXPECT_EQ(createXferAndQuery(choice), mock_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::LEARNED_COST);
+
+        // With both backends fitted, exploration backs off instead of one selection in eight
+        explored = 0;
+        for (int i = 0; i < 256; i++) {
+            createXferAndQuery(choice, {}, true);
+            explored += (choice == nixl_backend_choice_t::EXPLORATION);
+        }
+        EXPECT_LE(explored, 5);
+    }
+
+    TEST_F(dualAgentTwoBackendsFixture, BackendAndAgentRateLimitTest) {
+        // The mock backend posts one operation, and the remote agent takes two 256 B blobs,
+        // before their buckets are empty for minutes
+        nixlAgentConfig cfg;
+        cfg.backendLimits[GetMockBackendName()].opsPerSec = 1;
+        cfg.backendLimits[GetMockBackendName()].burstOps = 1;
+        cfg.remoteAgentLimits[remote_agent_name] = {1, 512};
+        setUpAgents(true, false, cfg);
+
+        int mock_posts = 0, alt_posts = 0;
+        ON_CALL(local_agent_helper_->getGMockEngine(), postXfer)
+            .WillByDefault([&](const nixl_xfer_op_t &,
+                               const nixl_meta_dlist_t &,
+                               const nixl_meta_dlist_t &,
+                               const std::string &,
+                               nixlBackendReqH *&,
+                               const nixl_opt_b_args_t *) {
+                mock_posts++;
+                return NIXL_IN_PROG;
+            });
+        ON_CALL(local_agent_helper_->getAltGMockEngine(), postXfer)
+            .WillByDefault([&](const nixl_xfer_op_t &,
+                               const nixl_meta_dlist_t &,
+                               const nixl_meta_dlist_t &,
+                               const std::string &,
+                               nixlBackendReqH *&,
+                               const nixl_opt_b_args_t *) {
+                alt_posts++;
+                return NIXL_IN_PROG;
+            });
+
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(local_blob_.getDesc());
+        remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+        auto create_req = [&](nixlBackendH *backend) {
+            nixl_opt_args_t extra_params;
+            extra_params.backends.push_back(backend);
+            nixlXferReqH *xfer_req = nullptr;
+            EXPECT_EQ(local_agent_->createXferReq(NIXL_WRITE,
+                                                  local_xfer_dlist,
+                                                  remote_xfer_dlist,
+                                                  remote_agent_name_out_,
+                                                  xfer_req,
+                                                  &extra_params),
+                      NIXL_SUCCESS);
+            return xfer_req;
+        };
+
+        // The second operation on the mock backend waits for its IOPS limit
+        nixlXferReqH *first_mock_req = create_req(mock_backend_);
+        nixlXferReqH *second_mock_req = create_req(mock_backend_);
+        EXPECT_EQ(local_agent_->postXferReq(first_mock_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->postXferReq(second_mock_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->getXferStatus(second_mock_req), NIXL_IN_PROG);
+        EXPECT_EQ(mock_posts, 1);
+
+        // The other backend is not limited, until the bytes to the remote agent run out
+        nixlXferReqH *first_alt_req = create_req(alt_backend_);
+        nixlXferReqH *second_alt_req = create_req(alt_backend_);
+        EXPECT_EQ(local_agent_->postXferReq(first_alt_req), NIXL_IN_PROG);
+        EXPECT_EQ(alt_posts, 1);
+        EXPECT_EQ(local_agent_->postXferReq(second_alt_req), NIXL_IN_PROG);
+        EXPECT_EQ(local_agent_->postXferReq(second_alt_req), NIXL_ERR_REPOST_ACTIVE);
+        EXPECT_EQ(alt_posts, 1);
+
+        // Queued requests are canceled or released without being posted
+        EXPECT_EQ(local_agent_->cancelXferReq(second_mock_req), NIXL_ERR_CANCELED);
+        EXPECT_EQ(local_agent_->releaseXferReq(second_alt_req), NIXL_SUCCESS);
+        EXPECT_EQ(mock_posts, 1);
+        EXPECT_EQ(alt_posts, 1);
+
+        for (nixlXferReqH *xfer_req : {first_mock_req, second_mock_req, first_alt_req}) {
+            EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+        }
+    }
+
+    TEST_F(dualAgentTwoBackendsFixture, PrepDlistLazyBackendTest) {
+        setUpAgents(true);
+
+        nixl_xfer_dlist_t local_xfer_dlist(DRAM_SEG), remote_xfer_dlist(DRAM_SEG);
+        local_xfer_dlist.addDesc(local_blob_.getDesc());
+        remote_xfer_dlist.addDesc(remote_blob_.getDesc());
+
+        nixlDlistH *local_side, *remote_side;
+        EXPECT_EQ(local_agent_->prepXferDlist(NIXL_INIT_AGENT, local_xfer_dlist, local_side),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(
+            local_agent_->prepXferDlist(remote_agent_name_out_, remote_xfer_dlist, remote_side),
+            NIXL_SUCCESS);
+
+        // Only the preferred backend is populated during prep, the other on first use
+        for (nixlBackendH *expected : {alt_backend_, mock_backend_, mock_backend_}) {
+            nixl_opt_args_t extra_params;
+            if (expected == mock_backend_) {
+                extra_params.backends.push_back(mock_backend_);
+            }
+
+            const std::vector<int> indices = {0};
+            nixlXferReqH *xfer_req;
+            nixlBackendH *backend;
+            EXPECT_EQ(local_agent_->makeXferReq(NIXL_WRITE,
+                                                local_side,
+                                                indices,
+                                                remote_side,
+                                                indices,
+                                                xfer_req,
+                                                &extra_params),
+                      NIXL_SUCCESS);
+            EXPECT_EQ(local_agent_->queryXferBackend(xfer_req, backend), NIXL_SUCCESS);
+            EXPECT_EQ(backend, expected);
+            EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
+        }
+
+        EXPECT_EQ(local_agent_->releasedDlistH(local_side), NIXL_SUCCESS);
+        EXPECT_EQ(local_agent_->releasedDlistH(remote_side), NIXL_SUCCESS);
+    }
+
+    TEST_F(dualAgentTwoBackendsFixture, UnreachableBackendSkippedTest) {
+        setUpAgents(true);
+
+        // The preferred backend cannot reach the remote agent, like SHM for an agent of another
+        // host, so its sections of the remote metadata are not loaded
+        EXPECT_EQ(local_agent_->invalidateRemoteMD(remote_agent_name_out_), NIXL_SUCCESS);
+        ON_CALL(local_agent_helper_->getAltGMockEngine(), loadRemoteConnInfo)
+            .WillByDefault(testing::Return(NIXL_ERR_NOT_SUPPORTED));
+        EXPECT_EQ(local_agent_helper_->getAndLoadRemoteMd(remote_agent_, remote_agent_name_out_),
+                  NIXL_SUCCESS);
+
+        nixl_backend_choice_t choice;
+        EXPECT_EQ(createXferAndQuery(choice), mock_backend_);
+        EXPECT_EQ(choice, nixl_backend_choice_t::SINGLE_CANDIDATE);
+
+        // Naming it first does not make it viable either
+        EXPECT_EQ(createXferAndQuery(choice, {alt_backend_, mock_backend_}), mock_backend_);
+    }
+
     TEST_F(dualAgentBridgeFixture, GenNotifTest) {
         const std::string msg = "notification";
         EXPECT_CALL(remote_agent_helper_->getGMockEngine(), getNotifs)
@@ -486,6 +1580,59 @@ namespace agent {
         EXPECT_EQ(notif_map[local_agent_name].front(), msg);
     }
 
+    TEST_F(dualAgentBridgeFixture, NotifMatchingTest) {
+        const std::vector<std::string> msgs = {
+            "req1:done", "other", "req2:done", "req1:extra", "xfer-req3-done"};
+        EXPECT_CALL(remote_agent_helper_->getGMockEngine(), getNotifs)
+            .WillOnce([&](notif_list_t &notif_list) {
+                for (const auto &msg : msgs) {
+                    notif_list.emplace_back(local_agent_name, msg);
+                }
+                notif_list.emplace_back("third_agent", "req1:done");
+                return NIXL_SUCCESS;
+            })
+            .WillRepeatedly(testing::Return(NIXL_SUCCESS));
+
+        nixl_b_params_t remote_params;
+        nixlBackendH *remote_backend;
+        EXPECT_EQ(remote_agent_helper_->createBackendWithGMock(remote_params, remote_backend),
+                  NIXL_SUCCESS);
+
+        // Earliest match first, other messages stay with the agent
+        nixl_blob_t msg;
+        EXPECT_EQ(remote_agent_->waitNotif(local_agent_name, "req2", msg, chrono_period_us_t(0)),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(msg, "req2:done");
+
+        std::vector<nixl_blob_t> matched;
+        EXPECT_EQ(remote_agent_->popMatchingNotifs(local_agent_name, "req1", matched),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(matched, (std::vector<nixl_blob_t>{"req1:done", "req1:extra"}));
+
+        EXPECT_EQ(remote_agent_->waitNotif(local_agent_name,
+                                           "req3",
+                                           msg,
+                                           chrono_period_us_t(0),
+                                           nixl_notif_match_t::SUBSTRING),
+                  NIXL_SUCCESS);
+        EXPECT_EQ(msg, "xfer-req3-done");
+
+        // Nothing else matches, waiting gives up after the timeout
+        EXPECT_EQ(remote_agent_->waitNotif(local_agent_name, "req", msg, chrono_period_us_t(1000)),
+                  NIXL_IN_PROG);
+
+        // Unmatched messages are still returned by getNotifs, in arrival order
+        nixl_notifs_t notif_map;
+        EXPECT_EQ(remote_agent_->getNotifs(notif_map), NIXL_SUCCESS);
+        EXPECT_EQ(notif_map.size(), 2u);
+        EXPECT_EQ(notif_map[local_agent_name], std::vector<nixl_blob_t>{"other"});
+        EXPECT_EQ(notif_map["third_agent"], std::vector<nixl_blob_t>{"req1:done"});
+
+        notif_map.clear();
+        EXPECT_EQ(remote_agent_->getNotifs(notif_map), NIXL_SUCCESS);
+        EXPECT_TRUE(notif_map.empty());
+    }
+
     TEST_F(dualAgentBridgeFixture, QueryXferBackendTest) {
         nixl_b_params_t local_params, remote_params;
         nixlBackendH *local_backend, *remote_backend;
@@ -528,6 +1675,69 @@ namespace agent {
         EXPECT_EQ(local_agent_->releaseXferReq(xfer_req), NIXL_SUCCESS);
     }
 
+    TEST(localCopyTest, LocalDramXferTest) {
+        ScopedEnv env;
+        env.addVar("NIXL_LOCAL_COPY_THREADS", "2");
+        agentHelper helper(local_agent_name);
+        nixlAgent *agent = helper.getAgent();
+
+        nixl_b_params_t params;
+        nixlBackendH *backend;
+        ASSERT_EQ(helper.createBackendWithGMock(params, backend), NIXL_SUCCESS);
+        // The agent copies the data itself, the backend never sees the transfer
+        EXPECT_CALL(helper.getGMockEngine(), postXfer).Times(0);
+
+        // Large enough to be split over the copy threads
+        constexpr size_t len = 8 << 20;
+        std::vector<char> src(len), dst(len, 0);
+        for (size_t i = 0; i < len; ++i) {
+            src[i] = static_cast<char>(i * 7);
+        }
+
+        nixl_reg_dlist_t reg_dlist(DRAM_SEG);
+        reg_dlist.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(src.data()), len, 0));
+        reg_dlist.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(dst.data()), len, 0));
+        nixl_opt_args_t extra_params;
+        extra_params.backends.push_back(backend);
+        ASSERT_EQ(agent->registerMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+
+        nixl_xfer_dlist_t src_dlist(DRAM_SEG), dst_dlist(DRAM_SEG);
+        src_dlist.addDesc(nixlBasicDesc(reinterpret_cast<uintptr_t>(src.data()), len, 0));
+        dst_dlist.addDesc(nixlBasicDesc(reinterpret_cast<uintptr_t>(dst.data()), len, 0));
+
+        auto transfer = [&](nixl_xfer_op_t op, const std::string &msg) {
+            nixlXferReqH *xfer_req = nullptr;
+            extra_params.notif = msg;
+            ASSERT_EQ(agent->createXferReq(
+                          op, src_dlist, dst_dlist, local_agent_name, xfer_req, &extra_params),
+                      NIXL_SUCCESS);
+
+            nixlBackendH *backend_out;
+            EXPECT_EQ(agent->queryXferBackend(xfer_req, backend_out), NIXL_SUCCESS);
+            EXPECT_EQ(backend_out, backend);
+
+            nixl_status_t status = agent->postXferReq(xfer_req);
+            while (status == NIXL_IN_PROG) {
+                status = agent->getXferStatus(xfer_req);
+            }
+            EXPECT_EQ(status, NIXL_SUCCESS);
+            EXPECT_EQ(agent->releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+            nixl_notifs_t notif_map;
+            EXPECT_EQ(agent->getNotifs(notif_map), NIXL_SUCCESS);
+            EXPECT_EQ(notif_map[local_agent_name], std::vector<nixl_blob_t>{msg});
+        };
+
+        transfer(NIXL_WRITE, "written");
+        EXPECT_EQ(src, dst);
+
+        std::fill(src.begin(), src.end(), 0);
+        transfer(NIXL_READ, "read");
+        EXPECT_EQ(src, dst);
+
+        EXPECT_EQ(agent->deregisterMem(reg_dlist, &extra_params), NIXL_SUCCESS);
+    }
+
     TEST_F(dualAgentBridgeFixture, MakeConnectionTest) {
         nixl_b_params_t local_params, remote_params;
         nixlBackendH *local_backend, *remote_backend;
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#include "common.h"
+#include "local_md_store.h"
+
+namespace metadata {
+
+class localMDStoreTest : public ::testing::Test {
+protected:
+    void
+    SetUp() override {
+        dir_ = std::filesystem::temp_directory_path() /
+            ("nixl_local_md_test_" + std::to_string(getpid()));
+        publisher_ = std::make_unique<nixlLocalMDStore>(dir_);
+        reader_ = std::make_unique<nixlLocalMDStore>(dir_);
+    }
+
+    void
+    TearDown() override {
+        reader_.reset();
+        publisher_.reset();
+        std::filesystem::remove_all(dir_);
+    }
+
+    static constexpr const char *label = "metadata";
+
+    std::string dir_;
+    // Stand-ins for two processes on the same host
+    std::unique_ptr<nixlLocalMDStore> publisher_;
+    std::unique_ptr<nixlLocalMDStore> reader_;
+};
+
+TEST_F(localMDStoreTest, PublishAndFetch) {
+    nixl_blob_t md;
+    EXPECT_EQ(reader_->fetch("agent", label, md), NIXL_ERR_NOT_FOUND);
+
+    const nixl_blob_t blob("binary\0metadata", 15);
+    ASSERT_EQ(publisher_->publish("agent", label, blob), NIXL_SUCCESS);
+    ASSERT_EQ(reader_->fetch("agent", label, md), NIXL_SUCCESS);
+    EXPECT_EQ(md, blob);
+
+    // Labels are separate entries
+    EXPECT_EQ(reader_->fetch("agent", "partial", md), NIXL_ERR_NOT_FOUND);
+    EXPECT_TRUE(reader_->poll().empty());
+}
+
+TEST_F(localMDStoreTest, NamesStayInDirectory) {
+    ASSERT_EQ(publisher_->publish("host/../rank.0", "a.b", "md"), NIXL_SUCCESS);
+
+    size_t num_files = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(dir_)) {
+        EXPECT_EQ(entry.path().parent_path(), std::filesystem::path(dir_));
+        ++num_files;
+    }
+    EXPECT_EQ(num_files, 1u);
+
+    nixl_blob_t md;
+    ASSERT_EQ(reader_->fetch("host/../rank.0", "a.b", md), NIXL_SUCCESS);
+    EXPECT_EQ(md, "md");
+    EXPECT_EQ(reader_->fetch("host/../rank", "0.a.b", md), NIXL_ERR_NOT_FOUND);
+}
+
+TEST_F(localMDStoreTest, PollReportsUpdates) {
+    ASSERT_EQ(publisher_->publish("agent", label, std::string(1000, 'a')), NIXL_SUCCESS);
+    nixl_blob_t md;
+    ASSERT_EQ(reader_->fetch("agent", label, md), NIXL_SUCCESS);
+
+    // Fits the existing file, rewritten in place
+    ASSERT_EQ(publisher_->publish("agent", label, std::string(1100, 'b')), NIXL_SUCCESS);
+    auto changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].agentName, "agent");
+    EXPECT_FALSE(changes[0].invalidated);
+    EXPECT_EQ(changes[0].metadata, std::string(1100, 'b'));
+    EXPECT_TRUE(reader_->poll().empty());
+
+    // Outgrows the file, which is replaced by a new one
+    ASSERT_EQ(publisher_->publish("agent", label, std::string(100000, 'c')), NIXL_SUCCESS);
+    changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_FALSE(changes[0].invalidated);
+    EXPECT_EQ(changes[0].metadata, std::string(100000, 'c'));
+    EXPECT_TRUE(reader_->poll().empty());
+
+    ASSERT_EQ(publisher_->publish("agent", label, "d"), NIXL_SUCCESS);
+    changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].metadata, "d");
+}
+
+TEST_F(localMDStoreTest, PollReportsInvalidation) {
+    ASSERT_EQ(publisher_->publish("agent", label, "md"), NIXL_SUCCESS);
+    ASSERT_EQ(publisher_->publish("other", label, "md"), NIXL_SUCCESS);
+    nixl_blob_t md;
+    ASSERT_EQ(reader_->fetch("agent", label, md), NIXL_SUCCESS);
+    ASSERT_EQ(reader_->fetch("other", label, md), NIXL_SUCCESS);
+
+    ASSERT_EQ(publisher_->invalidate("agent"), NIXL_SUCCESS);
+    EXPECT_EQ(publisher_->invalidate("agent"), NIXL_ERR_NOT_FOUND);
+
+    const auto changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].agentName, "agent");
+    EXPECT_TRUE(changes[0].invalidated);
+    EXPECT_TRUE(reader_->poll().empty());
+    EXPECT_EQ(reader_->fetch("agent", label, md), NIXL_ERR_NOT_FOUND);
+
+    // Forgotten entries are no longer reported
+    reader_->forget("other");
+    ASSERT_EQ(publisher_->invalidate("other"), NIXL_SUCCESS);
+    EXPECT_TRUE(reader_->poll().empty());
+}
+
+TEST_F(localMDStoreTest, DestructionInvalidates) {
+    ASSERT_EQ(publisher_->publish("agent", label, "md"), NIXL_SUCCESS);
+    nixl_blob_t md;
+    ASSERT_EQ(reader_->fetch("agent", label, md), NIXL_SUCCESS);
+
+    publisher_.reset();
+    const auto changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_TRUE(changes[0].invalidated);
+    EXPECT_TRUE(std::filesystem::is_empty(dir_));
+}
+
+TEST_F(localMDStoreTest, WaitForPublish) {
+    nixl_blob_t md;
+    ASSERT_EQ(reader_->fetch("agent", label, md), NIXL_ERR_NOT_FOUND);
+    reader_->waitFor("agent", label);
+    EXPECT_TRUE(reader_->poll().empty());
+
+    ASSERT_EQ(publisher_->publish("agent", label, "md"), NIXL_SUCCESS);
+    std::vector<nixlLocalMDStore::change> changes;
+    for (int i = 0; i < 100 && changes.empty(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        changes = reader_->poll();
+    }
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_FALSE(changes[0].invalidated);
+    EXPECT_EQ(changes[0].metadata, "md");
+
+    // Watched from then on
+    ASSERT_EQ(publisher_->invalidate("agent"), NIXL_SUCCESS);
+    changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_TRUE(changes[0].invalidated);
+}
+
+TEST_F(localMDStoreTest, ExitedPublisherIsInvalidated) {
+    int ready[2], done[2];
+    ASSERT_EQ(pipe(ready), 0);
+    ASSERT_EQ(pipe(done), 0);
+
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        close(done[1]);
+        // Exits without running the destructor that would invalidate the metadata
+        auto *store = new nixlLocalMDStore(dir_);
+        const char status = store->publish("agent", label, "md") == NIXL_SUCCESS;
+        char unused;
+        if (write(ready[1], &status, 1) != 1 || read(done[0], &unused, 1) < 0) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+
+    char status = 0;
+    ASSERT_EQ(read(ready[0], &status, 1), 1);
+    ASSERT_EQ(status, 1);
+    nixl_blob_t md;
+    ASSERT_EQ(reader_->fetch("agent", label, md), NIXL_SUCCESS);
+
+    close(done[1]);
+    ASSERT_EQ(waitpid(pid, nullptr, 0), pid);
+    const auto changes = reader_->poll();
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_TRUE(changes[0].invalidated);
+    EXPECT_EQ(reader_->fetch("agent", label, md), NIXL_ERR_NOT_FOUND);
+
+    close(ready[0]);
+    close(ready[1]);
+    close(done[0]);
+}
+
+TEST_F(localMDStoreTest, EmptyDirDisablesStore) {
+    gtest::ScopedEnv env;
+    env.addVar(LOCAL_MD_DIR_VAR, "");
+    EXPECT_FALSE(nixlLocalMDStore::dirFromEnv());
+    EXPECT_EQ(nixlLocalMDStore::createFromEnv(), nullptr);
+
+    env.addVar(LOCAL_MD_DIR_VAR, dir_);
+    EXPECT_EQ(nixlLocalMDStore::dirFromEnv(), dir_);
+}
+
+} // namespace metadata
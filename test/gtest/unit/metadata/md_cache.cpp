@@ -0,0 +1,301 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "md_cache.h"
+
+namespace metadata {
+
+// In-memory stand-in for etcd, delivering watch events synchronously on put and remove
+class memMDStore : public nixlMDStoreClient {
+public:
+    struct watchState {
+        std::string prefix;
+        int64_t fromRevision;
+        nixl_md_watch_cb_t onEvents;
+        std::function<void()> onError;
+    };
+
+    class memWatch : public nixlMDWatch {
+    public:
+        memWatch(memMDStore &store, std::list<watchState>::iterator it) : store_(store), it_(it) {}
+
+        ~memWatch() override {
+            store_.watches_.erase(it_);
+        }
+
+    private:
+        memMDStore &store_;
+        std::list<watchState>::iterator it_;
+    };
+
+    nixl_status_t
+    getPrefix(const std::string &prefix,
+              std::vector<nixlMDKeyValue> &kvs,
+              int64_t &revision) override {
+        ++rangeReads;
+        kvs.clear();
+        for (auto it = kvs_.lower_bound(prefix);
+             it != kvs_.end() && it->first.compare(0, prefix.size(), prefix) == 0;
+             ++it) {
+            kvs.push_back({it->first, it->second});
+        }
+        revision = revision_;
+        return NIXL_SUCCESS;
+    }
+
+    std::unique_ptr<nixlMDWatch>
+    watchPrefix(const std::string &prefix,
+                int64_t from_revision,
+                nixl_md_watch_cb_t on_events,
+                std::function<void()> on_error) override {
+        EXPECT_EQ(from_revision, revision_ + 1);
+        watches_.push_back({prefix, from_revision, std::move(on_events), std::move(on_error)});
+        return std::make_unique<memWatch>(*this, std::prev(watches_.end()));
+    }
+
+    void
+    put(const std::string &key, const nixl_blob_t &value) {
+        kvs_[key] = value;
+        notify({{false, key, value}});
+    }
+
+    // Remove all keys under the prefix, like the agent's rmdir on invalidation
+    void
+    removePrefix(const std::string &prefix) {
+        std::vector<nixlMDWatchEvent> events;
+        auto it = kvs_.lower_bound(prefix);
+        while (it != kvs_.end() && it->first.compare(0, prefix.size(), prefix) == 0) {
+            events.push_back({true, it->first, {}});
+            it = kvs_.erase(it);
+        }
+        notify(events);
+    }
+
+    void
+    breakWatches() {
+        for (auto &watch : watches_) {
+            watch.onError();
+        }
+    }
+
+    size_t
+    activeWatches() const {
+        return watches_.size();
+    }
+
+    int rangeReads = 0;
+
+private:
+    void
+    notify(const std::vector<nixlMDWatchEvent> &events) {
+        ++revision_;
+        for (auto &watch : watches_) {
+            std::vector<nixlMDWatchEvent> matching;
+            for (const auto &event : events) {
+                if (event.key.compare(0, watch.prefix.size(), watch.prefix) == 0) {
+                    matching.push_back(event);
+                }
+            }
+            if (!matching.empty()) {
+                watch.onEvents(matching);
+            }
+        }
+    }
+
+    std::map<std::string, nixl_blob_t> kvs_;
+    std::list<watchState> watches_;
+    int64_t revision_ = 0;
+};
+
+class remoteMDCacheTest : public ::testing::Test {
+protected:
+    static constexpr const char *nsPrefix = "/nixl/agents/";
+    static constexpr const char *label = "metadata";
+
+    void
+    publish(const std::string &agent_name, const nixl_blob_t &md = {}) {
+        store_.put(cache_.makeKey(agent_name, ""), "");
+        store_.put(cache_.makeKey(agent_name, label), md.empty() ? "md_" + agent_name : md);
+    }
+
+    void
+    invalidate(const std::string &agent_name) {
+        store_.removePrefix(cache_.makeKey(agent_name, ""));
+    }
+
+    memMDStore store_;
+    nixlRemoteMDCache cache_{store_, nsPrefix};
+};
+
+TEST_F(remoteMDCacheTest, PrefetchReadsNamespaceOnce) {
+    constexpr int num_agents = 512;
+    for (int i = 0; i < num_agents; ++i) {
+        publish("agent" + std::to_string(i));
+    }
+
+    EXPECT_FALSE(cache_.isWatching());
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    EXPECT_TRUE(cache_.isWatching());
+    EXPECT_EQ(store_.rangeReads, 1);
+    EXPECT_EQ(store_.activeWatches(), 1u);
+    EXPECT_EQ(cache_.agentsWithLabel(label).size(), size_t(num_agents));
+
+    for (int i = 0; i < num_agents; ++i) {
+        const std::string agent_name = "agent" + std::to_string(i);
+        nixl_blob_t md;
+        ASSERT_TRUE(cache_.lookup(agent_name, label, md));
+        EXPECT_EQ(md, "md_" + agent_name);
+    }
+
+    // A healthy watch makes further prefetches free
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    EXPECT_EQ(store_.rangeReads, 1);
+    EXPECT_EQ(store_.activeWatches(), 1u);
+}
+
+TEST_F(remoteMDCacheTest, WatchUpdatesCache) {
+    publish("a");
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+
+    nixl_blob_t md;
+    EXPECT_FALSE(cache_.lookup("b", label, md));
+    publish("b");
+    ASSERT_TRUE(cache_.lookup("b", label, md));
+    EXPECT_EQ(md, "md_b");
+
+    publish("a", "md_a_v2");
+    ASSERT_TRUE(cache_.lookup("a", label, md));
+    EXPECT_EQ(md, "md_a_v2");
+
+    // Removing a single label keeps the agent's other metadata
+    store_.put(cache_.makeKey("a", "partial"), "md_a_partial");
+    ASSERT_TRUE(cache_.lookup("a", "partial", md));
+    store_.removePrefix(cache_.makeKey("a", "partial"));
+    EXPECT_FALSE(cache_.lookup("a", "partial", md));
+    EXPECT_TRUE(cache_.lookup("a", label, md));
+
+    EXPECT_EQ(store_.rangeReads, 1);
+}
+
+TEST_F(remoteMDCacheTest, WantedAgentReadyOnPublish) {
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    cache_.want("late", label);
+    EXPECT_TRUE(cache_.takeReady().empty());
+
+    publish("other");
+    EXPECT_TRUE(cache_.takeReady().empty());
+
+    publish("late");
+    const auto ready = cache_.takeReady();
+    ASSERT_EQ(ready.size(), 1u);
+    EXPECT_EQ(ready[0].first, "late");
+    EXPECT_EQ(ready[0].second, "md_late");
+
+    // Reported once only
+    publish("late", "md_late_v2");
+    EXPECT_TRUE(cache_.takeReady().empty());
+}
+
+TEST_F(remoteMDCacheTest, InvalidationOfTrackedAgents) {
+    publish("tracked");
+    publish("untracked");
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    cache_.track("tracked");
+
+    invalidate("untracked");
+    EXPECT_TRUE(cache_.takeInvalidated().empty());
+
+    invalidate("tracked");
+    EXPECT_EQ(cache_.takeInvalidated(), std::vector<std::string>{"tracked"});
+    EXPECT_TRUE(cache_.takeInvalidated().empty());
+
+    nixl_blob_t md;
+    EXPECT_FALSE(cache_.lookup("tracked", label, md));
+    EXPECT_TRUE(cache_.agentsWithLabel(label).empty());
+}
+
+TEST_F(remoteMDCacheTest, BrokenWatchRereadsNamespace) {
+    publish("a");
+    publish("b");
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    cache_.track("a");
+    cache_.track("b");
+
+    store_.breakWatches();
+    EXPECT_FALSE(cache_.isWatching());
+
+    // Stale entries are not served while the watch is down
+    nixl_blob_t md;
+    EXPECT_FALSE(cache_.lookup("a", label, md));
+
+    // Changes made while no watch was running are picked up by the next read
+    invalidate("a");
+    publish("c");
+    EXPECT_TRUE(cache_.takeInvalidated().empty());
+
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    EXPECT_EQ(store_.rangeReads, 2);
+    EXPECT_EQ(store_.activeWatches(), 1u);
+    EXPECT_EQ(cache_.takeInvalidated(), std::vector<std::string>{"a"});
+    EXPECT_TRUE(cache_.lookup("c", label, md));
+    EXPECT_TRUE(cache_.lookup("b", label, md));
+}
+
+TEST_F(remoteMDCacheTest, BrokenWatchRecovers) {
+    publish("a");
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+    cache_.track("a");
+
+    // Nothing to recover while the watch is healthy
+    ASSERT_EQ(cache_.recover(), NIXL_SUCCESS);
+    EXPECT_EQ(store_.rangeReads, 1);
+
+    store_.breakWatches();
+    invalidate("a");
+    EXPECT_TRUE(cache_.takeInvalidated().empty());
+
+    // The tracked agent invalidated while the watch was down is reported without a prefetch
+    ASSERT_EQ(cache_.recover(), NIXL_SUCCESS);
+    EXPECT_TRUE(cache_.isWatching());
+    EXPECT_EQ(store_.rangeReads, 2);
+    EXPECT_EQ(store_.activeWatches(), 1u);
+    EXPECT_EQ(cache_.takeInvalidated(), std::vector<std::string>{"a"});
+
+    ASSERT_EQ(cache_.recover(), NIXL_SUCCESS);
+    EXPECT_EQ(store_.rangeReads, 2);
+}
+
+TEST_F(remoteMDCacheTest, KeysOutsideNamespaceIgnored) {
+    store_.put("/other/ns//x/metadata", "md_x");
+    store_.put(std::string(nsPrefix) + "/" + label, "no_agent");
+    publish("host/rank0");
+    ASSERT_EQ(cache_.prefetch(), NIXL_SUCCESS);
+
+    EXPECT_EQ(cache_.agentsWithLabel(label), std::vector<std::string>{"host/rank0"});
+    nixl_blob_t md;
+    EXPECT_TRUE(cache_.lookup("host/rank0", label, md));
+    EXPECT_FALSE(cache_.lookup("x", label, md));
+}
+
+} // namespace metadata
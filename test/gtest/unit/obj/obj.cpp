@@ -106,8 +106,11 @@ public:
                    uintptr_t data_ptr,
                    size_t data_len,
                    size_t offset,
-                   put_object_callback_t callback) {
-        pendingCallbacks_.push_back([callback, this]() { callback(simulateSuccess_); });
+                   put_object_callback_t callback,
+                   const obj_cancel_token_t &cancel_token) {
+        pendingCallbacks_.push_back([callback, cancel_token, this]() {
+            callback(simulateSuccess_ && !(cancel_token && cancel_token->load()));
+        });
     }
 
     void
@@ -115,8 +118,13 @@ public:
                    uintptr_t data_ptr,
                    size_t data_len,
                    size_t offset,
-                   get_object_callback_t callback) {
-        pendingCallbacks_.push_back([callback, data_ptr, data_len, offset, this]() {
+                   get_object_callback_t callback,
+                   const obj_cancel_token_t &cancel_token) {
+        pendingCallbacks_.push_back([callback, data_ptr, data_len, offset, cancel_token, this]() {
+            if (cancel_token && cancel_token->load()) {
+                callback(false);
+                return;
+            }
             if (simulateSuccess_ && data_ptr && data_len > 0) {
                 char *buffer = reinterpret_cast<char *>(data_ptr);
                 for (size_t i = 0; i < data_len; ++i) {
@@ -263,14 +271,22 @@ public:
     }
 
     void
-    putObjectAsync(std::string_view, uintptr_t, size_t, size_t, put_object_callback_t callback)
-        override {
+    putObjectAsync(std::string_view,
+                   uintptr_t,
+                   size_t,
+                   size_t,
+                   put_object_callback_t callback,
+                   const obj_cancel_token_t &) override {
         callback(true);
     }
 
     void
-    getObjectAsync(std::string_view, uintptr_t, size_t, size_t, get_object_callback_t callback)
-        override {
+    getObjectAsync(std::string_view,
+                   uintptr_t,
+                   size_t,
+                   size_t,
+                   get_object_callback_t callback,
+                   const obj_cancel_token_t &) override {
         callback(true);
     }
 
@@ -875,6 +891,60 @@ TEST_F(objTestFixture, CancelTransfer) {
     EXPECT_EQ(status, NIXL_SUCCESS);
 }
 
+TEST_F(objTestFixture, CancelXferAbortsRequests) {
+    mockS3Client_->setSimulateSuccess(true);
+
+    nixlBlobDesc local_desc, remote_desc;
+    local_desc.devId = 1;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-cancel-xfer-key";
+
+    nixlBackendMD *local_metadata = nullptr;
+    nixlBackendMD *remote_metadata = nullptr;
+
+    ASSERT_EQ(objEngine_->registerMem(local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+    ASSERT_EQ(objEngine_->registerMem(remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs(DRAM_SEG);
+    nixl_meta_dlist_t remote_descs(OBJ_SEG);
+
+    std::vector<char> test_buffer(1024);
+    for (size_t i = 0; i < 2; ++i) {
+        local_descs.addDesc(nixlMetaDesc(
+            reinterpret_cast<uintptr_t>(test_buffer.data()) + i * 512, 512, 1));
+        remote_descs.addDesc(nixlMetaDesc(i * 512, 512, 2));
+    }
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ(objEngine_->prepXfer(
+                  NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+              NIXL_SUCCESS);
+
+    ASSERT_EQ(objEngine_->postXfer(
+                  NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+              NIXL_IN_PROG);
+    EXPECT_EQ(mockS3Client_->getPendingCount(), 2);
+
+    // The aborted requests still have to complete before the buffers are released
+    EXPECT_EQ(objEngine_->cancelXfer(handle), NIXL_IN_PROG);
+    EXPECT_EQ(objEngine_->checkXfer(handle), NIXL_IN_PROG);
+    mockS3Client_->execAsync();
+    EXPECT_EQ(objEngine_->checkXfer(handle), NIXL_ERR_CANCELED);
+    EXPECT_EQ(test_buffer[0], 0);
+
+    // A repost of the canceled request is not aborted
+    ASSERT_EQ(objEngine_->postXfer(
+                  NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+              NIXL_IN_PROG);
+    mockS3Client_->execAsync();
+    EXPECT_EQ(objEngine_->checkXfer(handle), NIXL_SUCCESS);
+    EXPECT_EQ(test_buffer[0], 'A');
+
+    EXPECT_EQ(objEngine_->releaseReqH(handle), NIXL_SUCCESS);
+    EXPECT_EQ(objEngine_->deregisterMem(local_metadata), NIXL_SUCCESS);
+    EXPECT_EQ(objEngine_->deregisterMem(remote_metadata), NIXL_SUCCESS);
+}
+
 TEST_F(objTestFixture, ReadFromOffset) {
     mockS3Client_->setSimulateSuccess(true);
 
@@ -1100,14 +1170,22 @@ public:
     }
 
     void
-    putObjectAsync(std::string_view, uintptr_t, size_t, size_t, put_object_callback_t callback)
-        override {
+    putObjectAsync(std::string_view,
+                   uintptr_t,
+                   size_t,
+                   size_t,
+                   put_object_callback_t callback,
+                   const obj_cancel_token_t &) override {
         callback(true);
     }
 
     void
-    getObjectAsync(std::string_view, uintptr_t, size_t, size_t, get_object_callback_t callback)
-        override {
+    getObjectAsync(std::string_view,
+                   uintptr_t,
+                   size_t,
+                   size_t,
+                   get_object_callback_t callback,
+                   const obj_cancel_token_t &) override {
         callback(true);
     }
 
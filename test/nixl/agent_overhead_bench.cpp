@@ -0,0 +1,409 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Overhead of the agent API, measured on the LOOPBACK backend so no transport cost is included.
+ * Every case runs for each descriptor count and thread count. Each thread has its own target
+ * agent, and the initiator agent is shared, as it is by the threads of an inference server.
+ * Usage: agent_overhead_bench [num_descs] [num_threads] [min_time_ms] [json_file] [telemetry]
+ *   num_descs and num_threads are comma separated lists, e.g. 1,64,4096 and 1,4
+ *   json_file receives the results in the Google Benchmark JSON format, so that runs can be
+ *   compared over time with its tools, e.g. compare.py. "-" skips it.
+ *   telemetry is 1 to capture agent telemetry, which adds its cost to every transfer.
+ */
+
+#include "nixl.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t kDescLen = 64;
+
+struct benchResult {
+    std::string name;
+    size_t threads;
+    uint64_t iterations;
+    // Wall time of one call as seen by the calling thread
+    double nsPerOp;
+    // Calls per second of all threads together
+    double opsPerSec;
+};
+
+// The state of one benchmark thread: its target agent, buffers and prepared handles
+struct threadCtx {
+    std::unique_ptr<nixlAgent> target;
+    std::string targetName;
+    std::string targetMD;
+    nixl_opt_args_t targetArgs;
+    std::vector<char> localBuf;
+    std::vector<char> remoteBuf;
+    std::vector<char> scratchBuf;
+    nixl_xfer_dlist_t localDescs{DRAM_SEG};
+    nixl_xfer_dlist_t remoteDescs{DRAM_SEG};
+    nixl_reg_dlist_t scratchReg{DRAM_SEG};
+    nixlDlistH *localSide = nullptr;
+    nixlDlistH *remoteSide = nullptr;
+    nixlXferReqH *req = nullptr;
+    nixlXferPlanH *plan = nullptr;
+};
+
+std::vector<size_t>
+parseList(const std::string &list) {
+    std::vector<size_t> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(std::max(std::atoi(item.c_str()), 1));
+        }
+    }
+    return items;
+}
+
+// The buffer cut into count descriptors of kDescLen bytes
+template<typename dlist_t, typename desc_t>
+dlist_t
+cutBuffer(const std::vector<char> &buf, size_t count) {
+    dlist_t dlist(DRAM_SEG);
+    for (size_t i = 0; i < count; ++i) {
+        dlist.addDesc(desc_t(reinterpret_cast<uintptr_t>(buf.data()) + i * kDescLen, kDescLen, 0));
+    }
+    return dlist;
+}
+
+std::unique_ptr<nixlAgent>
+createAgent(const std::string &name, size_t threads, bool telemetry, nixl_opt_args_t &args) {
+    nixlAgentConfig cfg;
+    cfg.syncMode = (threads > 1) ? nixl_thread_sync_t::NIXL_THREAD_SYNC_RW :
+                                   nixl_thread_sync_t::NIXL_THREAD_SYNC_DEFAULT;
+    cfg.captureTelemetry = telemetry;
+    auto agent = std::make_unique<nixlAgent>(name, cfg);
+
+    nixl_mem_list_t mems;
+    nixl_b_params_t params;
+    nixlBackendH *backend;
+    if ((agent->getPluginParams("LOOPBACK", mems, params) != NIXL_SUCCESS) ||
+        (agent->createBackend("LOOPBACK", params, backend) != NIXL_SUCCESS)) {
+        std::cerr << "failed to create the LOOPBACK backend, is NIXL_PLUGIN_DIR set?"
+                  << std::endl;
+        return nullptr;
+    }
+    args.backends = {backend};
+    return agent;
+}
+
+// Calls op from every thread until min_time has passed, after one warm up call each
+template<typename Op>
+bool
+runCase(const std::string &name,
+        std::vector<threadCtx> &ctxs,
+        std::chrono::milliseconds min_time,
+        std::vector<benchResult> &results,
+        Op &&op) {
+    const size_t threads = ctxs.size();
+    std::vector<uint64_t> iterations(threads, 0);
+    std::vector<double> elapsed_ns(threads, 0);
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            if (!op(ctxs[t])) {
+                failed = true;
+            }
+            ready++;
+            while (ready.load() < threads) {
+                std::this_thread::yield();
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            uint64_t count = 0;
+            while (!stop.load(std::memory_order_relaxed) && !failed.load()) {
+                if (!op(ctxs[t])) {
+                    failed = true;
+                    break;
+                }
+                count++;
+            }
+            elapsed_ns[t] =
+                std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start)
+                    .count();
+            iterations[t] = count;
+        });
+    }
+
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(min_time);
+    stop = true;
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    if (failed) {
+        std::cerr << name << " failed" << std::endl;
+        return false;
+    }
+
+    benchResult result{name, threads, 0, 0, 0};
+    double total_ns = 0;
+    double wall_ns = 0;
+    for (size_t t = 0; t < threads; ++t) {
+        result.iterations += iterations[t];
+        total_ns += elapsed_ns[t];
+        wall_ns = std::max(wall_ns, elapsed_ns[t]);
+    }
+    if (result.iterations > 0) {
+        result.nsPerOp = total_ns / result.iterations;
+        result.opsPerSec = result.iterations / wall_ns * 1e9;
+    }
+
+    std::cout << std::left << std::setw(48) << name << std::right << std::setw(14)
+              << std::fixed << std::setprecision(1) << result.nsPerOp << std::setw(16)
+              << std::setprecision(0) << result.opsPerSec << std::setw(14) << result.iterations
+              << std::endl;
+    results.push_back(std::move(result));
+    return true;
+}
+
+bool
+runSuite(size_t descs,
+         size_t threads,
+         std::chrono::milliseconds min_time,
+         bool telemetry,
+         std::vector<benchResult> &results) {
+    nixl_opt_args_t init_args;
+    auto initiator = createAgent("overhead_bench_init", threads, telemetry, init_args);
+    if (!initiator) {
+        return false;
+    }
+
+    std::vector<threadCtx> ctxs(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        threadCtx &ctx = ctxs[t];
+        ctx.targetName = "overhead_bench_target" + std::to_string(t);
+        ctx.target = createAgent(ctx.targetName, threads, telemetry, ctx.targetArgs);
+        if (!ctx.target) {
+            return false;
+        }
+
+        ctx.localBuf.resize(descs * kDescLen);
+        ctx.remoteBuf.resize(descs * kDescLen);
+        ctx.scratchBuf.resize(descs * kDescLen);
+        ctx.localDescs = cutBuffer<nixl_xfer_dlist_t, nixlBasicDesc>(ctx.localBuf, descs);
+        ctx.remoteDescs = cutBuffer<nixl_xfer_dlist_t, nixlBasicDesc>(ctx.remoteBuf, descs);
+        ctx.scratchReg = cutBuffer<nixl_reg_dlist_t, nixlBlobDesc>(ctx.scratchBuf, descs);
+
+        if ((initiator->registerMem(cutBuffer<nixl_reg_dlist_t, nixlBlobDesc>(ctx.localBuf, descs),
+                                    &init_args) != NIXL_SUCCESS) ||
+            (ctx.target->registerMem(
+                 cutBuffer<nixl_reg_dlist_t, nixlBlobDesc>(ctx.remoteBuf, descs),
+                 &ctx.targetArgs) != NIXL_SUCCESS) ||
+            (ctx.target->getLocalMD(ctx.targetMD) != NIXL_SUCCESS)) {
+            std::cerr << "failed to register memory" << std::endl;
+            return false;
+        }
+
+        std::string name;
+        if ((initiator->loadRemoteMD(ctx.targetMD, name) != NIXL_SUCCESS) ||
+            (initiator->prepXferDlist(
+                 NIXL_INIT_AGENT, ctx.localDescs, ctx.localSide, &init_args) != NIXL_SUCCESS) ||
+            (initiator->prepXferDlist(
+                 ctx.targetName, ctx.remoteDescs, ctx.remoteSide, &init_args) != NIXL_SUCCESS) ||
+            (initiator->createXferReq(NIXL_WRITE,
+                                      ctx.localDescs,
+                                      ctx.remoteDescs,
+                                      ctx.targetName,
+                                      ctx.req,
+                                      &init_args) != NIXL_SUCCESS) ||
+            (initiator->compileXferPlan(NIXL_WRITE,
+                                        ctx.localDescs,
+                                        ctx.remoteDescs,
+                                        ctx.targetName,
+                                        ctx.plan,
+                                        &init_args) != NIXL_SUCCESS)) {
+            std::cerr << "failed to load metadata or prepare transfers" << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<int> indices(descs);
+    for (size_t i = 0; i < descs; ++i) {
+        indices[i] = static_cast<int>(i);
+    }
+
+    const std::string suffix =
+        "/descs:" + std::to_string(descs) + "/threads:" + std::to_string(threads);
+    bool ok = true;
+
+    ok = ok && runCase("BM_registerMem" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        return (initiator->registerMem(ctx.scratchReg, &init_args) == NIXL_SUCCESS) &&
+            (initiator->deregisterMem(ctx.scratchReg, &init_args) == NIXL_SUCCESS);
+    });
+
+    ok = ok && runCase("BM_createXferReq" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        nixlXferReqH *req = nullptr;
+        if (initiator->createXferReq(NIXL_WRITE,
+                                     ctx.localDescs,
+                                     ctx.remoteDescs,
+                                     ctx.targetName,
+                                     req,
+                                     &init_args) != NIXL_SUCCESS) {
+            return false;
+        }
+        return initiator->releaseXferReq(req) == NIXL_SUCCESS;
+    });
+
+    ok = ok && runCase("BM_makeXferReq" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        nixlXferReqH *req = nullptr;
+        if (initiator->makeXferReq(
+                NIXL_WRITE, ctx.localSide, indices, ctx.remoteSide, indices, req, &init_args) !=
+            NIXL_SUCCESS) {
+            return false;
+        }
+        return initiator->releaseXferReq(req) == NIXL_SUCCESS;
+    });
+
+    // The same request as BM_createXferReq, instantiated from a plan compiled once
+    const std::vector<int64_t> offsets = {0};
+    ok = ok &&
+        runCase("BM_makeXferReqFromPlan" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+             nixlXferReqH *req = nullptr;
+             if (initiator->makeXferReq(ctx.plan, offsets, offsets, req) != NIXL_SUCCESS) {
+                 return false;
+             }
+             return initiator->releaseXferReq(req) == NIXL_SUCCESS;
+         });
+
+    ok = ok && runCase("BM_postXferReq" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        nixl_status_t status = initiator->postXferReq(ctx.req);
+        while (status == NIXL_IN_PROG) {
+            status = initiator->getXferStatus(ctx.req);
+        }
+        return status == NIXL_SUCCESS;
+    });
+
+    // The poll of a request that completed, as done by callers polling many requests
+    ok = ok && runCase("BM_getXferStatus" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        return initiator->getXferStatus(ctx.req) == NIXL_SUCCESS;
+    });
+
+    // One notification sent and received per call, through the target of the thread
+    ok = ok && runCase("BM_getNotifs" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        nixl_notifs_t notifs;
+        return (initiator->genNotif(ctx.targetName, "notif") == NIXL_SUCCESS) &&
+            (ctx.target->getNotifs(notifs) == NIXL_SUCCESS) && (notifs.size() == 1);
+    });
+
+    ok = ok && runCase("BM_loadRemoteMD" + suffix, ctxs, min_time, results, [&](threadCtx &ctx) {
+        std::string name;
+        return (initiator->invalidateRemoteMD(ctx.targetName) == NIXL_SUCCESS) &&
+            (initiator->loadRemoteMD(ctx.targetMD, name) == NIXL_SUCCESS);
+    });
+
+    for (auto &ctx : ctxs) {
+        initiator->releaseXferReq(ctx.req);
+        initiator->releaseXferPlan(ctx.plan);
+        initiator->releasedDlistH(ctx.localSide);
+        initiator->releasedDlistH(ctx.remoteSide);
+    }
+    return ok;
+}
+
+void
+writeJson(const std::string &path,
+          const char *executable,
+          const std::vector<benchResult> &results) {
+    const std::time_t now = std::time(nullptr);
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+
+    std::ofstream out(path);
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+        << "    \"executable\": \"" << executable << "\",\n"
+        << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "\n  },\n"
+        << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const benchResult &result = results[i];
+        out << "    {\n"
+            << "      \"name\": \"" << result.name << "\",\n"
+            << "      \"run_name\": \"" << result.name << "\",\n"
+            << "      \"run_type\": \"iteration\",\n"
+            << "      \"threads\": " << result.threads << ",\n"
+            << "      \"iterations\": " << result.iterations << ",\n"
+            << "      \"real_time\": " << std::fixed << std::setprecision(3) << result.nsPerOp
+            << ",\n"
+            << "      \"cpu_time\": " << result.nsPerOp << ",\n"
+            << "      \"time_unit\": \"ns\",\n"
+            << "      \"items_per_second\": " << result.opsPerSec << "\n"
+            << "    }" << ((i + 1 < results.size()) ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const auto desc_counts = parseList((argc > 1) ? argv[1] : "1,64,4096");
+    const auto thread_counts = parseList((argc > 2) ? argv[2] : "1,4");
+    const std::chrono::milliseconds min_time((argc > 3) ? std::max(std::atoi(argv[3]), 1) : 200);
+    const std::string json_path = (argc > 4) ? argv[4] : "-";
+    const bool telemetry = (argc > 5) && (std::atoi(argv[5]) != 0);
+
+    if (desc_counts.empty() || thread_counts.empty()) {
+        std::cerr << "usage: " << argv[0]
+                  << " [num_descs] [num_threads] [min_time_ms] [json_file] [telemetry]"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(48) << "benchmark" << std::right << std::setw(14)
+              << "ns/op" << std::setw(16) << "ops/s" << std::setw(14) << "iterations"
+              << std::endl;
+
+    std::vector<benchResult> results;
+    for (const size_t threads : thread_counts) {
+        for (const size_t descs : desc_counts) {
+            if (!runSuite(descs, threads, min_time, telemetry, results)) {
+                return 1;
+            }
+        }
+    }
+
+    if (json_path != "-") {
+        writeJson(json_path, argv[0], results);
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Bandwidth of transfers between DRAM buffers of one agent, copied by the agent's local copy
+ * engine, against a single std::memcpy. The LOOPBACK backend only provides the registrations.
+ * Usage: local_copy_bench [size_mb] [num_descs] [num_threads] [iters]
+ *   num_threads is a comma separated list of NIXL_LOCAL_COPY_THREADS values, e.g. 1,4,16
+ */
+
+#include "nixl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr char kAgentName[] = "local_copy_bench";
+
+std::vector<std::string>
+splitList(const std::string &list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// The buffer cut into count descriptors
+nixl_xfer_dlist_t
+cutBuffer(const std::vector<char> &buf, size_t count) {
+    nixl_xfer_dlist_t dlist(DRAM_SEG);
+    const size_t step = buf.size() / count;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t len = (i == count - 1) ? buf.size() - i * step : step;
+        dlist.addDesc(nixlBasicDesc(reinterpret_cast<uintptr_t>(buf.data()) + i * step, len, 0));
+    }
+    return dlist;
+}
+
+void
+printRow(const std::string &name, size_t bytes, size_t iters, double seconds) {
+    std::cout << std::left << std::setw(24) << name << std::right << std::setw(14) << std::fixed
+              << std::setprecision(2) << bytes * iters / seconds / 1e9 << std::endl;
+}
+
+// Returns the elapsed seconds of iters transfers, or a negative value on failure
+double
+runAgent(const std::string &threads,
+         std::vector<char> &src,
+         std::vector<char> &dst,
+         size_t num_descs,
+         size_t iters) {
+    setenv("NIXL_LOCAL_COPY_THREADS", threads.c_str(), 1);
+    nixlAgent agent(kAgentName, nixlAgentConfig(false));
+    unsetenv("NIXL_LOCAL_COPY_THREADS");
+
+    nixl_mem_list_t mems;
+    nixl_b_params_t params;
+    nixlBackendH *backend;
+    nixl_opt_args_t args;
+    if ((agent.getPluginParams("LOOPBACK", mems, params) != NIXL_SUCCESS) ||
+        (agent.createBackend("LOOPBACK", params, backend) != NIXL_SUCCESS)) {
+        std::cerr << "failed to create the LOOPBACK backend, is NIXL_PLUGIN_DIR set?"
+                  << std::endl;
+        return -1;
+    }
+    args.backends = {backend};
+
+    nixl_reg_dlist_t reg(DRAM_SEG);
+    reg.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(src.data()), src.size(), 0));
+    reg.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(dst.data()), dst.size(), 0));
+    nixlXferReqH *req = nullptr;
+    if ((agent.registerMem(reg, &args) != NIXL_SUCCESS) ||
+        (agent.createXferReq(NIXL_WRITE,
+                             cutBuffer(src, num_descs),
+                             cutBuffer(dst, num_descs),
+                             kAgentName,
+                             req,
+                             &args) != NIXL_SUCCESS)) {
+        std::cerr << "failed to register memory or create the transfer" << std::endl;
+        return -1;
+    }
+
+    double seconds = 0;
+    // One warm up transfer faults the pages in and starts the copy threads
+    for (size_t it = 0; it <= iters; ++it) {
+        const auto start = std::chrono::steady_clock::now();
+        nixl_status_t status = agent.postXferReq(req);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus(req);
+        }
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "transfer failed with status " << status << std::endl;
+            return -1;
+        }
+        if (it > 0) {
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                           .count();
+        }
+    }
+
+    agent.releaseXferReq(req);
+    agent.deregisterMem(reg, &args);
+    return seconds;
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const size_t size_mb = (argc > 1) ? std::max(std::atoi(argv[1]), 1) : 1024;
+    const size_t num_descs = (argc > 2) ? std::max(std::atoi(argv[2]), 1) : 1;
+    const auto thread_counts = splitList((argc > 3) ? argv[3] : "1,2,4,8");
+    const size_t iters = (argc > 4) ? std::max(std::atoi(argv[4]), 1) : 10;
+    const size_t bytes = size_mb << 20;
+
+    std::vector<char> src(bytes, 's');
+    std::vector<char> dst(bytes, 'd');
+
+    std::cout << "size: " << size_mb << " MiB, descs: " << num_descs << ", iterations: " << iters
+              << std::endl;
+    std::cout << std::left << std::setw(24) << "copy" << std::right << std::setw(14) << "GB/s"
+              << std::endl;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t it = 0; it < iters; ++it) {
+        std::memcpy(dst.data(), src.data(), bytes);
+    }
+    printRow("memcpy",
+             bytes,
+             iters,
+             std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    for (const auto &threads : thread_counts) {
+        const double seconds = runAgent(threads, src, dst, num_descs, iters);
+        if (seconds < 0) {
+            return 1;
+        }
+        printRow("agent/threads:" + threads, bytes, iters, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Startup benchmark for metadata exchange between agents on the same host.
+ * Every agent needs the metadata of every other agent, which is exchanged either over
+ * the listener sockets or through the node-local store selected by NIXL_LOCAL_MD_DIR.
+ * Usage: local_md_bench [num_agents] [backend] [base_port]
+ *   backend may be "none" to exchange metadata without any backend connection info
+ */
+
+#include "nixl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr char kLocalMDDirVar[] = "NIXL_LOCAL_MD_DIR";
+constexpr size_t kBufLen = 1 << 20;
+constexpr auto kTimeout = std::chrono::seconds(120);
+
+struct benchAgent {
+    std::unique_ptr<nixlAgent> agent;
+    std::vector<char> buf;
+};
+
+std::string
+agentName(size_t i) {
+    return "local_md_bench_" + std::to_string(i);
+}
+
+bool
+createAgents(std::vector<benchAgent> &agents,
+             size_t num_agents,
+             const std::string &backend,
+             bool listen,
+             int base_port) {
+    for (size_t i = 0; i < num_agents; ++i) {
+        nixlAgentConfig cfg(false,
+                            listen,
+                            static_cast<uint16_t>(base_port + i),
+                            nixl_thread_sync_t::NIXL_THREAD_SYNC_STRICT,
+                            1,
+                            0,
+                            1000);
+        benchAgent entry;
+        entry.agent = std::make_unique<nixlAgent>(agentName(i), cfg);
+        entry.buf.resize(kBufLen);
+
+        nixl_opt_args_t args;
+        if (backend != "none") {
+            nixl_mem_list_t mems;
+            nixl_b_params_t params;
+            nixlBackendH *handle;
+            if ((entry.agent->getPluginParams(backend, mems, params) != NIXL_SUCCESS) ||
+                (entry.agent->createBackend(backend, params, handle) != NIXL_SUCCESS)) {
+                std::cerr << "failed to create backend " << backend << std::endl;
+                return false;
+            }
+            args.backends.push_back(handle);
+
+            nixl_reg_dlist_t reg(DRAM_SEG);
+            reg.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(entry.buf.data()), kBufLen, 0));
+            if (entry.agent->registerMem(reg, &args) != NIXL_SUCCESS) {
+                std::cerr << "failed to register memory" << std::endl;
+                return false;
+            }
+        }
+        agents.push_back(std::move(entry));
+    }
+    return true;
+}
+
+bool
+waitAllLoaded(std::vector<benchAgent> &agents) {
+    nixl_xfer_dlist_t empty(DRAM_SEG);
+    const auto deadline = std::chrono::steady_clock::now() + kTimeout;
+    for (size_t i = 0; i < agents.size(); ++i) {
+        for (size_t j = 0; j < agents.size(); ++j) {
+            if (i == j) {
+                continue;
+            }
+            while (agents[i].agent->checkRemoteMD(agentName(j), empty) != NIXL_SUCCESS) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    std::cerr << agentName(i) << " did not load " << agentName(j) << std::endl;
+                    return false;
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+    }
+    return true;
+}
+
+// Each agent sends its metadata to the listener of every other agent
+bool
+exchangeSocket(std::vector<benchAgent> &agents, int base_port) {
+    for (size_t i = 0; i < agents.size(); ++i) {
+        for (size_t j = 0; j < agents.size(); ++j) {
+            if (i == j) {
+                continue;
+            }
+            nixl_opt_args_t args;
+            args.ipAddr = "127.0.0.1";
+            args.port = base_port + static_cast<int>(j);
+            if (agents[i].agent->sendLocalMD(&args) != NIXL_SUCCESS) {
+                return false;
+            }
+        }
+    }
+    return waitAllLoaded(agents);
+}
+
+// Each agent publishes its metadata once and reads every other agent's from the store
+bool
+exchangeLocal(std::vector<benchAgent> &agents) {
+    for (auto &entry : agents) {
+        if (entry.agent->sendLocalMD() != NIXL_SUCCESS) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < agents.size(); ++i) {
+        for (size_t j = 0; j < agents.size(); ++j) {
+            if ((i != j) && (agents[i].agent->fetchRemoteMD(agentName(j)) != NIXL_SUCCESS)) {
+                return false;
+            }
+        }
+    }
+    return waitAllLoaded(agents);
+}
+
+void
+report(const std::string &mode, size_t num_agents, double ms) {
+    const size_t pairs = num_agents * (num_agents - 1);
+    std::cout << std::left << std::setw(8) << mode << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12) << ms << " ms total" << std::setw(12)
+              << ms * 1000 / pairs << " us per agent pair" << std::endl;
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const size_t num_agents = (argc > 1) ? std::max(std::atoi(argv[1]), 2) : 64;
+    const std::string backend = (argc > 2) ? argv[2] : "UCX";
+    const int base_port = (argc > 3) ? std::atoi(argv[3]) : 20000;
+
+    std::cout << "agents: " << num_agents << ", backend: " << backend << std::endl;
+
+    // The node-local store is only used by agents created while the variable is set
+    unsetenv(kLocalMDDirVar);
+    {
+        std::vector<benchAgent> agents;
+        if (!createAgents(agents, num_agents, backend, true, base_port)) {
+            return 1;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (!exchangeSocket(agents, base_port)) {
+            std::cerr << "socket metadata exchange failed" << std::endl;
+            return 1;
+        }
+        report("socket", num_agents,
+               std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                   .count());
+    }
+
+    const auto dir = std::filesystem::temp_directory_path() /
+        ("nixl_local_md_bench_" + std::to_string(getpid()));
+    setenv(kLocalMDDirVar, dir.c_str(), 1);
+    {
+        std::vector<benchAgent> agents;
+        if (!createAgents(agents, num_agents, backend, false, base_port)) {
+            return 1;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        if (!exchangeLocal(agents)) {
+            std::cerr << "node-local metadata exchange failed" << std::endl;
+            return 1;
+        }
+        report("local", num_agents,
+               std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                   .count());
+    }
+    unsetenv(kLocalMDDirVar);
+    std::filesystem::remove_all(dir);
+    return 0;
+}
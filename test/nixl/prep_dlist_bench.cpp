@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Microbenchmark for prepXferDlist latency and the memory held by prepped handles.
+ * Only the preferred backend is populated at prep time, the others are populated
+ * by the first makeXferReq that selects them.
+ * Usage: prep_dlist_bench [backends] [num_descs] [num_handles] [iters]
+ *   backends is a comma separated list, e.g. UCX or UCX,LIBFABRIC
+ */
+
+#include "nixl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr size_t kDescLen = 64;
+
+size_t
+residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+std::vector<std::string>
+splitList(const std::string &list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+bool
+createBackends(nixlAgent &agent, const std::vector<std::string> &names, nixl_opt_args_t &args) {
+    for (const auto &name : names) {
+        nixl_mem_list_t mems;
+        nixl_b_params_t params;
+        nixlBackendH *backend;
+
+        if ((agent.getPluginParams(name, mems, params) != NIXL_SUCCESS) ||
+            (agent.createBackend(name, params, backend) != NIXL_SUCCESS)) {
+            std::cerr << "failed to create backend " << name << std::endl;
+            return false;
+        }
+        args.backends.push_back(backend);
+    }
+    return true;
+}
+
+template<typename Func>
+double
+timeUs(Func &&func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const auto backend_names = splitList((argc > 1) ? argv[1] : "UCX");
+    const size_t num_descs = (argc > 2) ? std::max(std::atoi(argv[2]), 1) : 100000;
+    const size_t num_handles = (argc > 3) ? std::max(std::atoi(argv[3]), 1) : 16;
+    const size_t iters = (argc > 4) ? std::max(std::atoi(argv[4]), 1) : 10;
+
+    nixlAgentConfig cfg(true);
+    nixlAgent initiator("prep_bench_init", cfg);
+    nixlAgent target("prep_bench_target", cfg);
+    nixl_opt_args_t init_args;
+    nixl_opt_args_t target_args;
+
+    if (backend_names.empty() || !createBackends(initiator, backend_names, init_args) ||
+        !createBackends(target, backend_names, target_args)) {
+        return 1;
+    }
+
+    std::vector<char> init_buf(num_descs * kDescLen);
+    std::vector<char> target_buf(num_descs * kDescLen);
+    nixl_reg_dlist_t init_reg(DRAM_SEG);
+    nixl_reg_dlist_t target_reg(DRAM_SEG);
+    init_reg.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(init_buf.data()),
+                                  init_buf.size(), 0));
+    target_reg.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(target_buf.data()),
+                                    target_buf.size(), 0));
+
+    std::string target_md;
+    std::string target_name;
+    if ((initiator.registerMem(init_reg, &init_args) != NIXL_SUCCESS) ||
+        (target.registerMem(target_reg, &target_args) != NIXL_SUCCESS) ||
+        (target.getLocalMD(target_md) != NIXL_SUCCESS) ||
+        (initiator.loadRemoteMD(target_md, target_name) != NIXL_SUCCESS)) {
+        std::cerr << "failed to register memory or exchange metadata" << std::endl;
+        return 1;
+    }
+
+    nixl_xfer_dlist_t init_descs(DRAM_SEG);
+    nixl_xfer_dlist_t target_descs(DRAM_SEG);
+    for (size_t i = 0; i < num_descs; ++i) {
+        init_descs.addDesc(
+            nixlBasicDesc(reinterpret_cast<uintptr_t>(init_buf.data()) + i * kDescLen, kDescLen, 0));
+        target_descs.addDesc(nixlBasicDesc(
+            reinterpret_cast<uintptr_t>(target_buf.data()) + i * kDescLen, kDescLen, 0));
+    }
+
+    double local_prep_us = 0;
+    double remote_prep_us = 0;
+    double first_make_us = 0;
+    double next_make_us = 0;
+    std::vector<int> indices(num_descs);
+    for (size_t i = 0; i < num_descs; ++i) {
+        indices[i] = static_cast<int>(i);
+    }
+
+    // Make the transfer with the last backend, which is the one populated on demand
+    nixl_opt_args_t make_args;
+    make_args.backends.push_back(init_args.backends.back());
+
+    for (size_t it = 0; it < iters; ++it) {
+        nixlDlistH *local_side = nullptr;
+        nixlDlistH *remote_side = nullptr;
+        nixlXferReqH *req = nullptr;
+
+        local_prep_us += timeUs([&]() {
+            initiator.prepXferDlist(NIXL_INIT_AGENT, init_descs, local_side);
+        });
+        remote_prep_us += timeUs([&]() {
+            initiator.prepXferDlist(target_name, target_descs, remote_side);
+        });
+        if (!local_side || !remote_side) {
+            std::cerr << "prepXferDlist failed" << std::endl;
+            return 1;
+        }
+
+        first_make_us += timeUs([&]() {
+            initiator.makeXferReq(
+                NIXL_WRITE, local_side, indices, remote_side, indices, req, &make_args);
+        });
+        if (!req) {
+            std::cerr << "makeXferReq failed" << std::endl;
+            return 1;
+        }
+        initiator.releaseXferReq(req);
+
+        next_make_us += timeUs([&]() {
+            initiator.makeXferReq(
+                NIXL_WRITE, local_side, indices, remote_side, indices, req, &make_args);
+        });
+        initiator.releaseXferReq(req);
+
+        initiator.releasedDlistH(local_side);
+        initiator.releasedDlistH(remote_side);
+    }
+
+    // Memory held by prepped handles that were never used to make a transfer
+    std::vector<nixlDlistH *> held(num_handles, nullptr);
+    const size_t rss_before = residentBytes();
+    for (auto &handle : held) {
+        initiator.prepXferDlist(target_name, target_descs, handle);
+    }
+    const size_t rss_after = residentBytes();
+    for (auto &handle : held) {
+        initiator.releasedDlistH(handle);
+    }
+
+    std::cout << "backends: " << backend_names.size() << ", descs: " << num_descs
+              << ", iterations: " << iters << std::endl;
+    std::cout << std::left << std::setw(28) << "stage" << std::right << std::setw(14)
+              << "avg us" << std::setw(14) << "ns/desc" << std::endl;
+    const auto print = [&](const char *stage, double total_us) {
+        const double avg_us = total_us / iters;
+        std::cout << std::left << std::setw(28) << stage << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14) << avg_us << std::setw(14)
+                  << avg_us * 1000.0 / num_descs << std::endl;
+    };
+    print("prepXferDlist local", local_prep_us);
+    print("prepXferDlist remote", remote_prep_us);
+    print("makeXferReq first use", first_make_us);
+    print("makeXferReq next use", next_make_us);
+
+    const double delta = (rss_after > rss_before) ? double(rss_after - rss_before) : 0.0;
+    std::cout << "RSS held by " << num_handles << " prepped remote handles: " << std::fixed
+              << std::setprecision(2) << delta / (1024.0 * 1024.0) << " MiB ("
+              << std::setprecision(1) << delta / (num_handles * num_descs) << " B/desc)"
+              << std::endl;
+
+    initiator.invalidateRemoteMD(target_name);
+    initiator.deregisterMem(init_reg, &init_args);
+    target.deregisterMem(target_reg, &target_args);
+    return 0;
+}
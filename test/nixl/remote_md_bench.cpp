@@ -0,0 +1,209 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Benchmark for loading the metadata of a peer with many registered regions over UCX
+ * loopback, and for the first and later transfers to those regions. Remote keys are
+ * unpacked on first use per region and worker, so the load only copies the packed keys
+ * and the first transfer to each region pays for unpacking.
+ * Usage: remote_md_bench [num_regions] [num_workers] [region_len] [iters]
+ */
+
+#include "nixl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+size_t
+residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+double
+sinceUs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+nixlBackendH *
+createUcx(nixlAgent &agent, size_t num_workers) {
+    nixl_mem_list_t mems;
+    nixl_b_params_t params;
+    nixlBackendH *backend = nullptr;
+    if (agent.getPluginParams("UCX", mems, params) != NIXL_SUCCESS) {
+        return nullptr;
+    }
+    params["num_workers"] = std::to_string(num_workers);
+    if (agent.createBackend("UCX", params, backend) != NIXL_SUCCESS) {
+        return nullptr;
+    }
+    return backend;
+}
+
+// Posts the request and waits for it, progressing the target as well
+double
+runXfer(nixlAgent &initiator, nixlAgent &target, nixlXferReqH *req) {
+    const auto start = std::chrono::steady_clock::now();
+    nixl_status_t ret = initiator.postXferReq(req);
+    nixl_notifs_t notifs;
+    while (ret == NIXL_IN_PROG) {
+        target.getNotifs(notifs);
+        ret = initiator.getXferStatus(req);
+    }
+    if (ret != NIXL_SUCCESS) {
+        std::cerr << "transfer failed: " << nixlEnumStrings::statusStr(ret) << std::endl;
+        std::exit(1);
+    }
+    return sinceUs(start);
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    const size_t num_regions = (argc > 1) ? std::max(std::atoi(argv[1]), 1) : 100000;
+    const size_t num_workers = (argc > 2) ? std::max(std::atoi(argv[2]), 1) : 4;
+    const size_t region_len = (argc > 3) ? std::max(std::atoi(argv[3]), 8) : 64;
+    const size_t iters = (argc > 4) ? std::max(std::atoi(argv[4]), 1) : 5;
+
+    nixlAgent initiator("remote_md_bench_init", nixlAgentConfig(false));
+    nixlAgent target("remote_md_bench_target", nixlAgentConfig(false));
+    nixl_opt_args_t init_args;
+    nixl_opt_args_t target_args;
+    nixlBackendH *init_backend = createUcx(initiator, num_workers);
+    nixlBackendH *target_backend = createUcx(target, num_workers);
+    if (!init_backend || !target_backend) {
+        std::cerr << "failed to create the UCX backend" << std::endl;
+        return 1;
+    }
+    init_args.backends.push_back(init_backend);
+    target_args.backends.push_back(target_backend);
+
+    // Every target region is registered separately, so each has its own remote key
+    std::vector<char> init_buf(num_regions * region_len);
+    std::vector<char> target_buf(num_regions * region_len);
+    nixl_reg_dlist_t init_reg(DRAM_SEG);
+    nixl_reg_dlist_t target_reg(DRAM_SEG);
+    init_reg.addDesc(nixlBlobDesc(reinterpret_cast<uintptr_t>(init_buf.data()),
+                                  init_buf.size(), 0));
+    for (size_t i = 0; i < num_regions; ++i) {
+        target_reg.addDesc(nixlBlobDesc(
+            reinterpret_cast<uintptr_t>(target_buf.data()) + i * region_len, region_len, 0));
+    }
+
+    std::string target_md;
+    if ((initiator.registerMem(init_reg, &init_args) != NIXL_SUCCESS) ||
+        (target.registerMem(target_reg, &target_args) != NIXL_SUCCESS) ||
+        (target.getLocalMD(target_md) != NIXL_SUCCESS)) {
+        std::cerr << "failed to register memory" << std::endl;
+        return 1;
+    }
+
+    std::cout << "regions: " << num_regions << ", workers: " << num_workers
+              << ", region length: " << region_len << ", metadata: " << target_md.size() / 1024
+              << " KiB" << std::endl;
+
+    std::string target_name;
+    double load_us = 0;
+    size_t rss_delta = 0;
+    for (size_t it = 0; it < iters; ++it) {
+        const size_t rss_before = residentBytes();
+        const auto start = std::chrono::steady_clock::now();
+        if (initiator.loadRemoteMD(target_md, target_name) != NIXL_SUCCESS) {
+            std::cerr << "loadRemoteMD failed" << std::endl;
+            return 1;
+        }
+        load_us += sinceUs(start);
+        const size_t rss_after = residentBytes();
+        rss_delta = std::max(rss_delta, (rss_after > rss_before) ? rss_after - rss_before : 0);
+        if (it + 1 < iters) {
+            initiator.invalidateRemoteMD(target_name);
+        }
+    }
+
+    // One request writing a single region, and one writing every region
+    nixl_xfer_dlist_t one_local(DRAM_SEG);
+    nixl_xfer_dlist_t one_remote(DRAM_SEG);
+    one_local.addDesc(nixlBasicDesc(reinterpret_cast<uintptr_t>(init_buf.data()), region_len, 0));
+    one_remote.addDesc(nixlBasicDesc(
+        reinterpret_cast<uintptr_t>(target_buf.data()) + (num_regions / 2) * region_len,
+        region_len,
+        0));
+    nixl_xfer_dlist_t all_local(DRAM_SEG);
+    nixl_xfer_dlist_t all_remote(DRAM_SEG);
+    for (size_t i = 0; i < num_regions; ++i) {
+        all_local.addDesc(nixlBasicDesc(
+            reinterpret_cast<uintptr_t>(init_buf.data()) + i * region_len, region_len, 0));
+        all_remote.addDesc(nixlBasicDesc(
+            reinterpret_cast<uintptr_t>(target_buf.data()) + i * region_len, region_len, 0));
+    }
+
+    nixlXferReqH *one_req = nullptr;
+    nixlXferReqH *all_req = nullptr;
+    if ((initiator.createXferReq(NIXL_WRITE, one_local, one_remote, target_name, one_req) !=
+         NIXL_SUCCESS) ||
+        (initiator.createXferReq(NIXL_WRITE, all_local, all_remote, target_name, all_req) !=
+         NIXL_SUCCESS)) {
+        std::cerr << "createXferReq failed" << std::endl;
+        return 1;
+    }
+
+    const size_t rss_before_xfer = residentBytes();
+    const double first_one_us = runXfer(initiator, target, one_req);
+    const double next_one_us = runXfer(initiator, target, one_req);
+    const double first_all_us = runXfer(initiator, target, all_req);
+    const size_t rss_after_all = residentBytes();
+    const double next_all_us = runXfer(initiator, target, all_req);
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "loadRemoteMD:              " << std::setw(12) << load_us / iters << " us ("
+              << load_us * 1000.0 / iters / num_regions << " ns/region)" << std::endl;
+    std::cout << "RSS after load:            " << std::setw(12) << rss_delta / 1024.0 << " KiB ("
+              << double(rss_delta) / num_regions << " B/region)" << std::endl;
+    std::cout << "single region, first xfer: " << std::setw(12) << first_one_us << " us"
+              << std::endl;
+    std::cout << "single region, next xfer:  " << std::setw(12) << next_one_us << " us"
+              << std::endl;
+    std::cout << "all regions, first xfer:   " << std::setw(12) << first_all_us << " us"
+              << std::endl;
+    std::cout << "all regions, next xfer:    " << std::setw(12) << next_all_us << " us"
+              << std::endl;
+    const size_t rss_touched =
+        (rss_after_all > rss_before_xfer) ? rss_after_all - rss_before_xfer : 0;
+    std::cout << "RSS after touching all:    " << std::setw(12) << rss_touched / 1024.0
+              << " KiB more" << std::endl;
+
+    initiator.releaseXferReq(one_req);
+    initiator.releaseXferReq(all_req);
+    initiator.invalidateRemoteMD(target_name);
+    initiator.deregisterMem(init_reg, &init_args);
+    target.deregisterMem(target_reg, &target_args);
+    return 0;
+}
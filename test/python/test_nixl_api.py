@@ -181,6 +181,21 @@ def test_empty_notif_tag(two_connected_agents):
         found = agent2.check_remote_xfer_done(agent1.name, b"")
 
 
+@pytest.mark.timeout(5)
+def test_notif_matching(two_connected_agents):
+    agent1, agent2 = two_connected_agents
+
+    for msg in [b"req1:done", b"other", b"req2:done", b"req1:extra"]:
+        agent1.send_notif(agent2.name, msg)
+
+    # Notifications from one agent arrive in order, so all of them are in once the last one is
+    assert agent2.wait_notif(agent1.name, b"req1:extra", timeout_s=4) == b"req1:extra"
+    assert agent2.pop_matching_notifs(agent1.name, b"req") == [b"req1:done", b"req2:done"]
+    assert agent2.wait_notif(agent1.name, b"req") is None
+    assert agent2.check_remote_xfer_done(agent1.name, b"the", tag_is_prefix=False)
+    assert agent2.get_new_notifs() == {}
+
+
 def test_improper_get_xfer_descs(one_empty_agent, one_reg_list):
     # xfer list should be 3-tuple, not 4-tuple
     bad_list = [(1, 2, 3, 4)]
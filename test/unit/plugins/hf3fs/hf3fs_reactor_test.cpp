@@ -0,0 +1,380 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// Exercises the HF3FS completion reactor and IOR/IOV pooling against a mock
+// usrbio implementation that services IOs with pread/pwrite on a local file.
+
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "hf3fs_backend.h"
+#include "temp_file.h"
+
+#define TEST_ASSERT(cond, msg)                                                           \
+    do {                                                                                 \
+        if (!(cond)) {                                                                   \
+            std::cerr << "FAIL " << __FILE__ << ":" << __LINE__ << ": " << msg << std::endl; \
+            std::exit(EXIT_FAILURE);                                                     \
+        }                                                                                \
+    } while (0)
+
+namespace {
+
+class mockUsrbio : public hf3fsUsrbio {
+public:
+    int ior_creates = 0;
+    int ior_destroys = 0;
+    int iov_creates = 0;
+    int iov_destroys = 0;
+    int fail_next_io = 0; // Errno to report for the next completed IO
+
+    int
+    extractMountPoint(char *hf3fs_mount_point, int size, const char *path) override {
+        snprintf(hf3fs_mount_point, size, "%s", path);
+        return 0;
+    }
+
+    int
+    regFd(int, uint64_t) override {
+        return 0;
+    }
+
+    void
+    deregFd(int) override {}
+
+    int
+    iorCreate(hf3fs_ior *ior, const char *, int, bool, int, int) override {
+        const std::lock_guard<std::mutex> lock(mutex);
+        iors[ior] = std::make_unique<iorState>();
+        ior_creates++;
+        return 0;
+    }
+
+    void
+    iorDestroy(hf3fs_ior *ior) override {
+        const std::lock_guard<std::mutex> lock(mutex);
+        iors.erase(ior);
+        ior_destroys++;
+    }
+
+    int
+    iovCreate(hf3fs_iov *iov, const char *, size_t size, size_t, int) override {
+        iov->base = static_cast<uint8_t *>(malloc(size));
+        iov->size = size;
+        const std::lock_guard<std::mutex> lock(mutex);
+        iov_creates++;
+        return 0;
+    }
+
+    int
+    iovWrap(hf3fs_iov *iov, void *buf, const uint8_t *, const char *, size_t size, size_t, int)
+        override {
+        iov->base = static_cast<uint8_t *>(buf);
+        iov->size = size;
+        return 0;
+    }
+
+    void
+    iovDestroy(hf3fs_iov *iov) override {
+        free(iov->base);
+        const std::lock_guard<std::mutex> lock(mutex);
+        iov_destroys++;
+    }
+
+    int
+    prepIo(const hf3fs_ior *ior,
+           const hf3fs_iov *,
+           bool read,
+           void *ptr,
+           int fd,
+           size_t off,
+           uint64_t len,
+           const void *userdata) override {
+        iorState &state = getState(ior);
+        const std::lock_guard<std::mutex> lock(state.mutex);
+        state.pending.push_back({read, ptr, fd, off, len, userdata});
+        return 0;
+    }
+
+    int
+    submitIos(const hf3fs_ior *ior) override {
+        iorState &state = getState(ior);
+        const std::lock_guard<std::mutex> lock(state.mutex);
+        for (const auto &io : state.pending) {
+            ssize_t ret = io.read ? pread(io.fd, io.ptr, io.len, io.off) :
+                                    pwrite(io.fd, io.ptr, io.len, io.off);
+            hf3fs_cqe cqe{};
+            cqe.result = ret < 0 ? -errno : ret;
+            if (fail_next_io != 0) {
+                cqe.result = -fail_next_io;
+                fail_next_io = 0;
+            }
+            cqe.userdata = io.userdata;
+            state.done.push_back(cqe);
+        }
+        state.pending.clear();
+        state.cv.notify_all();
+        return 0;
+    }
+
+    int
+    waitForIos(const hf3fs_ior *ior,
+               hf3fs_cqe *cqes,
+               int cqec,
+               int min_results,
+               const struct timespec *abs_timeout) override {
+        iorState &state = getState(ior);
+        std::unique_lock<std::mutex> lock(state.mutex);
+        if (min_results > 0) {
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            auto timeout = std::chrono::seconds(abs_timeout->tv_sec - now.tv_sec) +
+                std::chrono::nanoseconds(abs_timeout->tv_nsec - now.tv_nsec);
+            state.cv.wait_for(lock, timeout, [&] { return int(state.done.size()) >= min_results; });
+        }
+        int n = 0;
+        while (n < cqec && !state.done.empty()) {
+            cqes[n++] = state.done.front();
+            state.done.pop_front();
+        }
+        return n > 0 ? n : -ETIMEDOUT;
+    }
+
+private:
+    struct pendingIO {
+        bool read;
+        void *ptr;
+        int fd;
+        size_t off;
+        uint64_t len;
+        const void *userdata;
+    };
+
+    struct iorState {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<pendingIO> pending;
+        std::deque<hf3fs_cqe> done;
+    };
+
+    iorState &
+    getState(const hf3fs_ior *ior) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return *iors.at(const_cast<hf3fs_ior *>(ior));
+    }
+
+    std::mutex mutex;
+    std::map<hf3fs_ior *, std::unique_ptr<iorState>> iors;
+};
+
+constexpr size_t block_size = 4096;
+constexpr int num_blocks = 8;
+
+struct testEnv {
+    std::shared_ptr<mockUsrbio> usrbio = std::make_shared<mockUsrbio>();
+    nixl_b_params_t custom_params;
+    std::unique_ptr<nixlHf3fsEngine> engine;
+    std::unique_ptr<tempFile> file;
+    nixlBackendMD *file_md = nullptr;
+
+    explicit testEnv(const std::string &reactor_threads) {
+        custom_params["mem_config"] = "dram";
+        custom_params["mount_point"] = "/tmp";
+        custom_params["reactor_threads"] = reactor_threads;
+        custom_params["ior_pool_size"] = "4";
+
+        nixlBackendInitParams init;
+        init.localAgent = "hf3fs_reactor_test";
+        init.type = "HF3FS";
+        init.customParams = &custom_params;
+        init.enableProgTh = false;
+        init.pthrDelay = 0;
+        init.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_STRICT;
+        init.enableTelemetry_ = false;
+
+        engine = std::make_unique<nixlHf3fsEngine>(&init, usrbio);
+        TEST_ASSERT(!engine->getInitErr(), "engine init failed");
+
+        char path[] = "/tmp/nixl_hf3fs_reactor_XXXXXX";
+        int fd = mkstemp(path);
+        TEST_ASSERT(fd >= 0, "mkstemp failed");
+        close(fd);
+        file = std::make_unique<tempFile>(path, O_RDWR);
+
+        nixlBlobDesc desc;
+        desc.addr = 0;
+        desc.len = block_size * num_blocks;
+        desc.devId = file->fd;
+        TEST_ASSERT(engine->registerMem(desc, FILE_SEG, file_md) == NIXL_SUCCESS,
+                    "file registration failed");
+    }
+
+    ~testEnv() {
+        engine->deregisterMem(file_md);
+    }
+
+    nixlBackendReqH *
+    prep(nixl_xfer_op_t op, std::vector<uint8_t> &buf, nixlBackendMD *buf_md) {
+        nixl_meta_dlist_t local(DRAM_SEG);
+        nixl_meta_dlist_t remote(FILE_SEG);
+        for (int i = 0; i < num_blocks; i++) {
+            nixlMetaDesc mem;
+            mem.addr = reinterpret_cast<uintptr_t>(buf.data()) + i * block_size;
+            mem.len = block_size;
+            mem.devId = 0;
+            mem.metadataP = buf_md;
+            local.addDesc(mem);
+
+            nixlMetaDesc blk;
+            blk.addr = i * block_size;
+            blk.len = block_size;
+            blk.devId = file->fd;
+            blk.metadataP = file_md;
+            remote.addDesc(blk);
+        }
+
+        nixlBackendReqH *handle = nullptr;
+        TEST_ASSERT(engine->prepXfer(op, local, remote, "", handle) == NIXL_SUCCESS,
+                    "prepXfer failed");
+        return handle;
+    }
+
+    nixl_status_t
+    run(nixl_xfer_op_t op, std::vector<uint8_t> &buf, nixlBackendMD *buf_md) {
+        nixlBackendReqH *handle = prep(op, buf, buf_md);
+        nixl_meta_dlist_t unused(DRAM_SEG);
+        nixl_status_t status = engine->postXfer(op, unused, unused, "", handle);
+        while (status == NIXL_IN_PROG) {
+            status = engine->checkXfer(handle);
+        }
+        engine->releaseReqH(handle);
+        return status;
+    }
+};
+
+nixlBackendMD *
+registerBuffer(testEnv &env, std::vector<uint8_t> &buf) {
+    nixlBlobDesc desc;
+    desc.addr = reinterpret_cast<uintptr_t>(buf.data());
+    desc.len = buf.size();
+    desc.devId = 0;
+    nixlBackendMD *md = nullptr;
+    TEST_ASSERT(env.engine->registerMem(desc, DRAM_SEG, md) == NIXL_SUCCESS,
+                "buffer registration failed");
+    return md;
+}
+
+void
+testRoundTripReusesResources() {
+    testEnv env("1");
+    std::vector<uint8_t> src(block_size * num_blocks);
+    std::vector<uint8_t> dst(block_size * num_blocks);
+    nixlBackendMD *src_md = registerBuffer(env, src);
+    nixlBackendMD *dst_md = registerBuffer(env, dst);
+
+    constexpr int iterations = 100;
+    for (int i = 0; i < iterations; i++) {
+        for (size_t j = 0; j < src.size(); j++) {
+            src[j] = uint8_t(i + j);
+        }
+        std::fill(dst.begin(), dst.end(), 0);
+        TEST_ASSERT(env.run(NIXL_WRITE, src, src_md) == NIXL_SUCCESS, "write failed");
+        TEST_ASSERT(env.run(NIXL_READ, dst, dst_md) == NIXL_SUCCESS, "read failed");
+        TEST_ASSERT(src == dst, "data mismatch at iteration " << i);
+    }
+
+    // One pooled IOR per direction and one IOV per descriptor serve every iteration
+    TEST_ASSERT(env.usrbio->ior_creates == 2, "IORs not reused: " << env.usrbio->ior_creates);
+    TEST_ASSERT(env.usrbio->iov_creates == num_blocks,
+                "IOVs not reused: " << env.usrbio->iov_creates);
+
+    env.engine->deregisterMem(src_md);
+    env.engine->deregisterMem(dst_md);
+    std::cout << "PASS round trip reuses IORs and IOVs" << std::endl;
+}
+
+void
+testConcurrentRequests() {
+    testEnv env("2");
+    constexpr int num_reqs = 16;
+    std::vector<std::vector<uint8_t>> bufs(num_reqs,
+                                           std::vector<uint8_t>(block_size * num_blocks, 0x5a));
+    std::vector<nixlBackendMD *> mds;
+    std::vector<nixlBackendReqH *> handles;
+    for (auto &buf : bufs) {
+        mds.push_back(registerBuffer(env, buf));
+        handles.push_back(env.prep(NIXL_READ, buf, mds.back()));
+    }
+
+    // Repost every handle several times with all of them in flight together
+    nixl_meta_dlist_t unused(DRAM_SEG);
+    for (int round = 0; round < 10; round++) {
+        for (auto &handle : handles) {
+            nixl_status_t status = env.engine->postXfer(NIXL_READ, unused, unused, "", handle);
+            TEST_ASSERT(status == NIXL_IN_PROG || status == NIXL_SUCCESS, "postXfer failed");
+        }
+        for (auto &handle : handles) {
+            nixl_status_t status;
+            do {
+                status = env.engine->checkXfer(handle);
+            } while (status == NIXL_IN_PROG);
+            TEST_ASSERT(status == NIXL_SUCCESS, "checkXfer failed in round " << round);
+        }
+    }
+
+    for (size_t i = 0; i < handles.size(); i++) {
+        env.engine->releaseReqH(handles[i]);
+        env.engine->deregisterMem(mds[i]);
+    }
+    std::cout << "PASS concurrent requests on a shared reactor" << std::endl;
+}
+
+void
+testFailedIONotPooled() {
+    testEnv env("1");
+    std::vector<uint8_t> buf(block_size * num_blocks, 0x11);
+    nixlBackendMD *md = registerBuffer(env, buf);
+
+    env.usrbio->fail_next_io = EIO;
+    TEST_ASSERT(env.run(NIXL_WRITE, buf, md) == NIXL_ERR_BACKEND, "IO error not reported");
+    TEST_ASSERT(env.usrbio->ior_destroys == 1, "failed IOR returned to the pool");
+    TEST_ASSERT(env.usrbio->iov_destroys == num_blocks, "failed IOVs returned to the pool");
+
+    TEST_ASSERT(env.run(NIXL_WRITE, buf, md) == NIXL_SUCCESS, "write after failure failed");
+
+    env.engine->deregisterMem(md);
+    std::cout << "PASS failed request resources are not pooled" << std::endl;
+}
+
+} // namespace
+
+int
+main() {
+    testRoundTripReusesResources();
+    testConcurrentRequests();
+    testFailedIONotPooled();
+    return 0;
+}
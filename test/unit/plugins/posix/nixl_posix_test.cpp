@@ -32,6 +32,9 @@
 #include <stdexcept>
 #include <cstdio>
 #include <getopt.h>
+#include <chrono>
+#include <memory>
+#include <vector>
 
 namespace {
     const size_t page_size = sysconf(_SC_PAGESIZE);
@@ -731,6 +734,138 @@ test_posix_repost (std::string test_files_dir_path_abs_path, bool use_uring) {
     return 0;
 }
 
+int
+test_posix_cancel(std::string test_files_dir_path_abs_path, bool use_uring) {
+    constexpr int num_transfers = 64;
+    constexpr size_t transfer_size = 1024 * 1024; // 1MB
+    const std::string agent_name = "POSIXCancelTester";
+    nixl_b_params_t params;
+    if (use_uring) {
+        params["use_uring"] = "true";
+        params["use_aio"] = "false";
+    } else {
+        params["use_aio"] = "true";
+        params["use_uring"] = "false";
+    }
+
+    print_segment_title("NIXL STORAGE CANCEL TEST STARTING (POSIX PLUGIN)");
+
+    nixlBackendH *posix = nullptr;
+    nixlAgentConfig cfg;
+    nixlAgent agent(agent_name, cfg);
+    if (agent.createBackend("POSIX", params, posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to create POSIX backend" << std::endl;
+        return 1;
+    }
+
+    print_segment_title(phase_title("Allocating buffers and files"));
+    std::vector<std::unique_ptr<void, PosixMemalignDeleter>> buffers;
+    std::vector<tempFile> fd;
+    fd.reserve(num_transfers);
+    nixl_reg_dlist_t dram_for_posix(DRAM_SEG);
+    nixl_xfer_dlist_t dram_for_posix_xfer(DRAM_SEG);
+    nixl_reg_dlist_t file_for_posix(FILE_SEG);
+    nixl_xfer_dlist_t file_for_posix_xfer(FILE_SEG);
+
+    for (int i = 0; i < num_transfers; ++i) {
+        void *ptr;
+        if (posix_memalign(&ptr, page_size, transfer_size) != 0) {
+            std::cerr << "DRAM allocation failed" << std::endl;
+            return 1;
+        }
+        buffers.emplace_back(ptr);
+        fill_test_pattern(ptr, read_write_test_phrase, transfer_size);
+
+        std::string file_path = test_files_dir_path_abs_path + "/" +
+            generate_timestamped_filename(test_file_name) + "_cancel_" + std::to_string(i);
+        try {
+            fd.emplace_back(file_path, O_RDWR | O_CREAT, std_file_permissions);
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Failed to open file: " << file_path << " - " << e.what() << std::endl;
+            return 1;
+        }
+
+        const nixlBlobDesc dram_desc((uintptr_t)ptr, transfer_size, 0, "");
+        const nixlBlobDesc file_desc(0, transfer_size, fd[i].fd, "");
+        dram_for_posix.addDesc(dram_desc);
+        dram_for_posix_xfer.addDesc(dram_desc);
+        file_for_posix.addDesc(file_desc);
+        file_for_posix_xfer.addDesc(file_desc);
+    }
+
+    if (agent.registerMem(dram_for_posix) != NIXL_SUCCESS ||
+        agent.registerMem(file_for_posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to register memory with NIXL" << std::endl;
+        return 1;
+    }
+
+    print_segment_title(phase_title("Canceling a posted write"));
+    nixlXferReqH *treq = nullptr;
+    nixl_status_t status = agent.createXferReq(
+        NIXL_WRITE, dram_for_posix_xfer, file_for_posix_xfer, agent_name, treq);
+    if (status != NIXL_SUCCESS) {
+        std::cerr << "Failed to create write transfer request - status: "
+                  << nixlEnumStrings::statusStr(status) << std::endl;
+        return 1;
+    }
+
+    status = agent.postXferReq(treq);
+    if (status < 0) {
+        std::cerr << "Failed to post write transfer request - status: "
+                  << nixlEnumStrings::statusStr(status) << std::endl;
+        agent.releaseXferReq(treq);
+        return 1;
+    }
+
+    if (status == NIXL_IN_PROG) {
+        status = agent.cancelXferReq(treq);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus(treq);
+        }
+    }
+
+    // IOs that were already done can complete the whole transfer before the cancel
+    if (status != NIXL_ERR_CANCELED && status != NIXL_SUCCESS) {
+        std::cerr << "Unexpected status of the canceled transfer: "
+                  << nixlEnumStrings::statusStr(status) << std::endl;
+        agent.releaseXferReq(treq);
+        return 1;
+    }
+    std::cout << "Canceled transfer finished with status: " << nixlEnumStrings::statusStr(status)
+              << std::endl;
+
+    print_segment_title(phase_title("Reposting the canceled write"));
+    status = agent.postXferReq(treq);
+    while (status == NIXL_IN_PROG) {
+        status = agent.getXferStatus(treq);
+    }
+    if (status != NIXL_SUCCESS) {
+        std::cerr << "Repost after cancel failed - status: " << nixlEnumStrings::statusStr(status)
+                  << std::endl;
+        agent.releaseXferReq(treq);
+        return 1;
+    }
+
+    print_segment_title(phase_title("Posting past the deadline"));
+    nixl_opt_args_t extra_params;
+    extra_params.deadline = std::chrono::steady_clock::now();
+    status = agent.postXferReq(treq, &extra_params);
+    if (status != NIXL_ERR_CANCELED || agent.getXferStatus(treq) != NIXL_ERR_CANCELED) {
+        std::cerr << "Post past the deadline was not canceled - status: "
+                  << nixlEnumStrings::statusStr(status) << std::endl;
+        agent.releaseXferReq(treq);
+        return 1;
+    }
+
+    print_segment_title("Freeing resources");
+    agent.releaseXferReq(treq);
+    agent.deregisterMem(file_for_posix);
+    agent.deregisterMem(dram_for_posix);
+
+    return 0;
+}
+
 int
 main (int argc, char *argv[]) {
     if (page_size <= 0) {
@@ -813,5 +948,13 @@ main (int argc, char *argv[]) {
         return 1;
     }
 
+    phase_num = 1;
+
+    ret = test_posix_cancel(test_files_dir_path_abs_path, use_uring);
+    if (ret != 0) {
+        std::cerr << "Cancel Test failed" << std::endl;
+        return 1;
+    }
+
     return 0;
 }
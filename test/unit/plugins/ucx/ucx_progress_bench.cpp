@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Small message latency vs. idle CPU usage of the UCX shared progress thread for different
+ * spin budgets ("progress_spin_us"). Usage: ucx_progress_bench [iterations] [spin_us ...]
+ */
+
+#include <time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ucx_backend.h"
+#include "test_utils.h"
+
+namespace {
+
+constexpr const char *kInitiator = "Agent0";
+constexpr const char *kTarget = "Agent1";
+constexpr std::chrono::milliseconds kIdleWindow{500};
+
+std::unique_ptr<nixlUcxEngine>
+createEngine(const std::string &name, int spin_us) {
+    nixl_b_params_t custom_params = {{"progress_spin_us", std::to_string(spin_us)}};
+    nixlBackendInitParams init_params;
+    init_params.localAgent = name;
+    init_params.enableProgTh = true;
+    init_params.customParams = &custom_params;
+    init_params.type = "UCX";
+
+    auto engine = nixlUcxEngine::create(init_params);
+    nixl_exit_on_failure(engine && !engine->getInitErr(), "Failed to initialize engine", name);
+    return engine;
+}
+
+void
+connectEngines(nixlUcxEngine &initiator, nixlUcxEngine &target) {
+    std::string initiator_conn, target_conn;
+    initiator.getConnInfo(initiator_conn);
+    target.getConnInfo(target_conn);
+
+    nixl_status_t ret = initiator.loadRemoteConnInfo(kTarget, target_conn);
+    nixl_exit_on_failure(ret, "Failed to load remote conn info", kInitiator);
+    ret = target.loadRemoteConnInfo(kInitiator, initiator_conn);
+    nixl_exit_on_failure(ret, "Failed to load remote conn info", kTarget);
+    nixl_exit_on_failure(initiator.connect(kTarget), "Failed to connect", kInitiator);
+    nixl_exit_on_failure(target.connect(kInitiator), "Failed to connect", kTarget);
+}
+
+void
+waitNotif(nixlUcxEngine &engine) {
+    notif_list_t notifs;
+    while (notifs.empty()) {
+        nixl_exit_on_failure(engine.getNotifs(notifs), "Failed to get notifications");
+    }
+}
+
+double
+processCpuSeconds() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void
+runBenchmark(int spin_us, size_t iterations) {
+    auto initiator = createEngine(kInitiator, spin_us);
+    auto target = createEngine(kTarget, spin_us);
+    connectEngines(*initiator, *target);
+
+    std::thread responder([&]() {
+        for (size_t i = 0; i < iterations; ++i) {
+            waitNotif(*target);
+            nixl_exit_on_failure(target->genNotif(kInitiator, "pong"), "genNotif failed", kTarget);
+        }
+    });
+
+    std::vector<double> rtt_us;
+    rtt_us.reserve(iterations);
+    for (size_t i = 0; i < iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        nixl_exit_on_failure(initiator->genNotif(kTarget, "ping"), "genNotif failed", kInitiator);
+        waitNotif(*initiator);
+        rtt_us.push_back(
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+                .count());
+    }
+    responder.join();
+
+    // Let the progress threads fall back to blocking and measure what they burn while idle
+    std::this_thread::sleep_for(std::chrono::milliseconds(spin_us / 1000 + 10));
+    const double cpu_start = processCpuSeconds();
+    std::this_thread::sleep_for(kIdleWindow);
+    const double idle_cpu =
+        (processCpuSeconds() - cpu_start) / std::chrono::duration<double>(kIdleWindow).count();
+
+    std::sort(rtt_us.begin(), rtt_us.end());
+    const auto stats = initiator->getProgressStats();
+    nixl_exit_on_failure(stats.has_value(), "Missing progress thread stats", kInitiator);
+    const double avg_drain_us = stats->eventWakeups ?
+        double(stats->eventDrainSum) / stats->eventWakeups :
+        0.0;
+
+    std::cout << std::fixed << std::setprecision(2) << std::setw(8) << spin_us << std::setw(12)
+              << rtt_us[rtt_us.size() / 2] << std::setw(12) << rtt_us[rtt_us.size() * 99 / 100]
+              << std::setw(12) << idle_cpu * 100 << std::setw(12) << stats->blockingWaits
+              << std::setw(12) << avg_drain_us << "\n";
+}
+
+} // namespace
+
+int
+main(int argc, char **argv) {
+    size_t iterations = 10000;
+    std::vector<int> spin_budgets = {0, 10, 50, 200};
+
+    if (argc > 1) {
+        iterations = std::max(std::strtoul(argv[1], nullptr, 10), 1UL);
+    }
+    if (argc > 2) {
+        spin_budgets.clear();
+        for (int i = 2; i < argc; ++i) {
+            spin_budgets.push_back(std::atoi(argv[i]));
+        }
+    }
+
+    std::cout << std::setw(8) << "spin_us" << std::setw(12) << "p50_rtt_us" << std::setw(12)
+              << "p99_rtt_us" << std::setw(12) << "idle_cpu_%" << std::setw(12) << "blocks"
+              << std::setw(12) << "drain_us" << "\n";
+    for (const int spin_us : spin_budgets) {
+        runBenchmark(spin_us, iterations);
+    }
+    return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2025-2026 Amazon.com, Inc. and affiliates.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Unit test for load-aware rail selection in nixlLibfabricRailManager.
+ */
+
+#include "libfabric/libfabric_rail_manager.h"
+#include "libfabric/libfabric_common.h"
+#include "common/nixl_log.h"
+#include "libfabric_mock_stubs.h"
+
+#include <iostream>
+#include <set>
+#include <vector>
+
+// Number of fake EFA devices to create
+static const size_t NUM_FAKE_RAILS = 4;
+
+// --- Unconditional __wrap_* functions (no isTesting gate needed) ---
+
+extern "C" int
+__wrap_numa_max_node() {
+    return 1;
+}
+
+extern "C" int
+__wrap_numa_num_configured_nodes() {
+    return 2;
+}
+
+extern "C" int
+__wrap_fi_getinfo(uint32_t /*version*/,
+                  const char * /*node*/,
+                  const char * /*service*/,
+                  uint64_t /*flags*/,
+                  const struct fi_info * /*hints*/,
+                  struct fi_info **info) {
+    // Build a linked list of NUM_FAKE_RAILS fake EFA devices
+    fi_info *head = nullptr;
+    fi_info *prev = nullptr;
+    for (size_t i = 0; i < NUM_FAKE_RAILS; ++i) {
+        fi_info *fi = malloc_zero<fi_info>();
+
+        fi->domain_attr = malloc_zero<fi_domain_attr>();
+        std::string name = "efa_" + std::to_string(i);
+        fi->domain_attr->name = strdup(name.c_str());
+
+        fi->fabric_attr = malloc_zero<fi_fabric_attr>();
+        fi->fabric_attr->prov_name = strdup("efa");
+        fi->fabric_attr->name = strdup("efa");
+
+        fi->ep_attr = malloc_zero<fi_ep_attr>();
+        fi->ep_attr->type = FI_EP_RDM;
+
+        fi->nic = malloc_zero<fid_nic>();
+        fi->nic->bus_attr = malloc_zero<fi_bus_attr>();
+        fi->nic->bus_attr->bus_type = FI_BUS_PCI;
+        fi->nic->bus_attr->attr.pci.domain_id = 0;
+        fi->nic->bus_attr->attr.pci.bus_id = static_cast<uint8_t>(i);
+        fi->nic->bus_attr->attr.pci.device_id = 0;
+        fi->nic->bus_attr->attr.pci.function_id = 0;
+
+        fi->nic->link_attr = malloc_zero<fi_link_attr>();
+        fi->nic->link_attr->speed = 100ull * NIXL_LIBFABRIC_GIGA;
+
+        if (prev) {
+            prev->next = fi;
+        } else {
+            head = fi;
+        }
+        prev = fi;
+    }
+    *info = head;
+    return 0;
+}
+
+extern "C" int
+__wrap_fi_fabric(struct fi_fabric_attr * /*attr*/, struct fid_fabric **fabric, void * /*context*/) {
+    *fabric = mock_fabric_create();
+    return 0;
+}
+
+// --- Test helpers ---
+
+#define TEST_ASSERT(cond, msg)                                                           \
+    do {                                                                                 \
+        if (!(cond)) {                                                                   \
+            std::cerr << "FAIL: " << (msg) << " [" << __FILE__ << ":" << __LINE__ << "]" \
+                      << std::endl;                                                      \
+            return 1;                                                                    \
+        }                                                                                \
+    } while (0)
+
+// --- Tests ---
+
+static const size_t MB = 1024 * 1024;
+
+static int
+testEqualLoadRoundRobin(nixlLibfabricRailManager &mgr) {
+    NIXL_INFO << "  testEqualLoadRoundRobin";
+
+    const std::vector<size_t> rails = {0, 1, 2, 3};
+    std::set<size_t> chosen;
+    for (size_t i = 0; i < rails.size(); ++i) {
+        chosen.insert(rails[mgr.selectLeastLoadedRail(rails)]);
+    }
+    TEST_ASSERT(chosen.size() == rails.size(), "idle rails are used round-robin");
+
+    return 0;
+}
+
+static int
+testLeastOutstandingBytes(nixlLibfabricRailManager &mgr) {
+    NIXL_INFO << "  testLeastOutstandingBytes";
+
+    const std::vector<size_t> rails = {0, 1, 2};
+    mgr.getRail(0).recordSubmit(2 * MB);
+    mgr.getRail(1).recordSubmit(MB);
+    mgr.getRail(2).recordSubmit(4 * MB);
+
+    for (size_t i = 0; i < 8; ++i) {
+        TEST_ASSERT(rails[mgr.selectLeastLoadedRail(rails)] == 1, "least loaded rail selected");
+    }
+
+    // Latency 0 only releases outstanding bytes (failed post), no bandwidth sample
+    mgr.getRail(0).recordCompletion(2 * MB, 0);
+    mgr.getRail(1).recordCompletion(MB, 0);
+    mgr.getRail(2).recordCompletion(4 * MB, 0);
+    for (size_t rail_id : rails) {
+        TEST_ASSERT(mgr.getRail(rail_id).getLoad().outstanding_bytes == 0, "load released");
+        TEST_ASSERT(mgr.getRail(rail_id).getLoad().bandwidth == 0.0, "no bandwidth sample");
+    }
+
+    return 0;
+}
+
+static int
+testEvenStripesWithoutSamples(nixlLibfabricRailManager &mgr) {
+    NIXL_INFO << "  testEvenStripesWithoutSamples";
+
+    std::vector<size_t> stripes;
+    mgr.computeStripeSizes({0, 1, 2, 3}, 4 * MB + 3, stripes);
+    TEST_ASSERT(stripes.size() == 4, "one stripe per rail");
+    TEST_ASSERT(stripes[0] == MB && stripes[1] == MB && stripes[2] == MB, "even stripes");
+    TEST_ASSERT(stripes[3] == MB + 3, "last stripe takes the remainder");
+
+    return 0;
+}
+
+static int
+testBandwidthWeightedStripes(nixlLibfabricRailManager &mgr) {
+    NIXL_INFO << "  testBandwidthWeightedStripes";
+
+    // Rail 0 completes at 10 B/ns, rail 1 at 30 B/ns, rail 2 was never sampled
+    mgr.getRail(0).recordSubmit(MB);
+    mgr.getRail(0).recordCompletion(MB, MB / 10);
+    mgr.getRail(1).recordSubmit(3 * MB);
+    mgr.getRail(1).recordCompletion(3 * MB, MB / 10);
+    // Small transfers are latency-bound and must not be sampled
+    mgr.getRail(2).recordSubmit(1024);
+    mgr.getRail(2).recordCompletion(1024, 1);
+
+    TEST_ASSERT(mgr.getRail(2).getLoad().bandwidth == 0.0, "small transfer not sampled");
+
+    std::vector<size_t> stripes;
+    mgr.computeStripeSizes({0, 1}, 4 * MB, stripes);
+    TEST_ASSERT(stripes[0] == MB && stripes[1] == 3 * MB, "stripes weighted by bandwidth");
+
+    // Unsampled rail gets the average weight (20 B/ns) -> 1/6, 3/6, 2/6
+    mgr.computeStripeSizes({0, 1, 2}, 6 * MB, stripes);
+    TEST_ASSERT(stripes[0] == MB && stripes[1] == 3 * MB && stripes[2] == 2 * MB,
+                "unsampled rail weighted with average bandwidth");
+
+    mgr.computeStripeSizes({0, 1, 2}, 7, stripes);
+    TEST_ASSERT(stripes[0] + stripes[1] + stripes[2] == 7, "stripes cover the transfer");
+
+    return 0;
+}
+
+static int
+testBandwidthAwareSingleRail(nixlLibfabricRailManager &mgr) {
+    NIXL_INFO << "  testBandwidthAwareSingleRail";
+
+    // Rail 1 has more bytes queued but drains 3x faster than rail 0
+    mgr.getRail(0).recordSubmit(MB);
+    mgr.getRail(1).recordSubmit(2 * MB);
+    TEST_ASSERT(mgr.selectLeastLoadedRail({0, 1}) == 1, "faster rail drains first");
+
+    mgr.getRail(1).recordSubmit(2 * MB);
+    TEST_ASSERT(mgr.selectLeastLoadedRail({0, 1}) == 0, "congested fast rail avoided");
+
+    mgr.getRail(0).recordCompletion(MB, 0);
+    mgr.getRail(1).recordCompletion(4 * MB, 0);
+    return 0;
+}
+
+int
+main() {
+    NIXL_INFO << "=== Rail Load Balancing Test ===";
+    NIXL_INFO << "Using mock stubs (__wrap_fi_getinfo, __wrap_fi_fabric, etc.)";
+
+    // Construct rail manager with mocked hardware (NUM_FAKE_RAILS rails)
+    nixlLibfabricRailManager mgr(0);
+    TEST_ASSERT(mgr.getNumRails() == NUM_FAKE_RAILS,
+                "expected " + std::to_string(NUM_FAKE_RAILS) + " rails");
+
+    int res;
+    if ((res = testEqualLoadRoundRobin(mgr)) != 0) return res;
+    if ((res = testLeastOutstandingBytes(mgr)) != 0) return res;
+    if ((res = testEvenStripesWithoutSamples(mgr)) != 0) return res;
+    if ((res = testBandwidthWeightedStripes(mgr)) != 0) return res;
+    if ((res = testBandwidthAwareSingleRail(mgr)) != 0) return res;
+
+    NIXL_INFO << "=== All rail load balancing tests PASSED ===";
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Microbenchmark for libfabric request pool allocate/release throughput.
+ * Usage: request_pool_bench [max_threads] [ops_per_thread] [batch]
+ */
+
+#include "libfabric/libfabric_rail.h"
+#include "libfabric/libfabric_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static double
+runThreads(DataRequestPool &pool, size_t num_threads, size_t ops_per_thread, size_t batch) {
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&pool, ops_per_thread, batch]() {
+            std::vector<nixlLibfabricReq *> held(batch);
+            for (size_t i = 0; i < ops_per_thread; i += batch) {
+                for (size_t j = 0; j < batch; ++j) {
+                    held[j] = pool.allocate(nixlLibfabricReq::WRITE, static_cast<uint32_t>(i + j));
+                }
+                for (size_t j = 0; j < batch; ++j) {
+                    pool.release(held[j]);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int
+main(int argc, char **argv) {
+    const size_t max_threads = (argc > 1) ? std::max(std::atoi(argv[1]), 1) : 8;
+    const size_t ops_per_thread = (argc > 2) ? std::max(std::atoi(argv[2]), 1) : 1000000;
+    const size_t batch = (argc > 3) ? std::max(std::atoi(argv[3]), 1) : 16;
+
+    std::cout << std::setw(8) << "threads" << std::setw(16) << "Mops/s" << std::setw(16)
+              << "ns/op" << std::setw(12) << "pool_size" << "\n";
+
+    for (size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        DataRequestPool pool(NIXL_LIBFABRIC_DATA_REQUESTS_PER_RAIL, 0);
+        if (pool.initialize() != NIXL_SUCCESS) {
+            std::cerr << "Failed to initialize data request pool" << std::endl;
+            return 1;
+        }
+
+        // Warm up so that pool expansion is not part of the measurement
+        runThreads(pool, num_threads, batch, batch);
+        const double seconds = runThreads(pool, num_threads, ops_per_thread, batch);
+        const double total_ops = static_cast<double>(num_threads) * ops_per_thread;
+
+        std::cout << std::setw(8) << num_threads << std::fixed << std::setprecision(2)
+                  << std::setw(16) << total_ops / seconds / 1e6 << std::setw(16)
+                  << seconds * 1e9 * num_threads / total_ops << std::setw(12)
+                  << pool.getTotalRequestCount() << "\n";
+    }
+
+    return 0;
+}
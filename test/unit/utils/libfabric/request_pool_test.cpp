@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Unit test for the lock-free libfabric request pools.
+ */
+
+#include "libfabric/libfabric_rail.h"
+#include "libfabric/libfabric_common.h"
+#include "common/nixl_log.h"
+#include "libfabric_mock_stubs.h"
+
+#include <atomic>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+static const size_t POOL_SIZE = 8;
+static const size_t NUM_THREADS = 4;
+static const size_t OPS_PER_THREAD = 100000;
+
+// --- Test helpers ---
+
+#define TEST_ASSERT(cond, msg)                                                           \
+    do {                                                                                 \
+        if (!(cond)) {                                                                   \
+            std::cerr << "FAIL: " << (msg) << " [" << __FILE__ << ":" << __LINE__ << "]" \
+                      << std::endl;                                                      \
+            return 1;                                                                    \
+        }                                                                                \
+    } while (0)
+
+// --- Tests ---
+
+static int
+testAllocateRelease() {
+    NIXL_INFO << "  testAllocateRelease";
+
+    DataRequestPool pool(POOL_SIZE, 0);
+    TEST_ASSERT(pool.initialize() == NIXL_SUCCESS, "data pool initialized");
+
+    nixlLibfabricReq *req = pool.allocate(nixlLibfabricReq::READ, 42);
+    TEST_ASSERT(req != nullptr, "request allocated");
+    TEST_ASSERT(req->in_use, "request marked in use");
+    TEST_ASSERT(req->xfer_id == 42, "xfer_id assigned");
+    TEST_ASSERT(req->operation_type == nixlLibfabricReq::READ, "operation type assigned");
+    TEST_ASSERT(pool.getActiveRequestCount() == 1, "one active request");
+
+    pool.release(req);
+    TEST_ASSERT(!req->in_use, "request no longer in use");
+    TEST_ASSERT(pool.getActiveRequestCount() == 0, "no active requests after release");
+
+    // Double release must be ignored and must not corrupt the free list
+    pool.release(req);
+    TEST_ASSERT(pool.getActiveRequestCount() == 0, "double release ignored");
+
+    nixlLibfabricReq *first = pool.allocate(nixlLibfabricReq::WRITE, 1);
+    nixlLibfabricReq *second = pool.allocate(nixlLibfabricReq::WRITE, 2);
+    TEST_ASSERT(first && second && first != second, "distinct requests after double release");
+    pool.release(first);
+    pool.release(second);
+
+    return 0;
+}
+
+static int
+testFindByContext() {
+    NIXL_INFO << "  testFindByContext";
+
+    DataRequestPool pool(POOL_SIZE, 0);
+    TEST_ASSERT(pool.initialize() == NIXL_SUCCESS, "data pool initialized");
+
+    nixlLibfabricReq *req = pool.allocate(nixlLibfabricReq::WRITE, 7);
+    TEST_ASSERT(req != nullptr, "request allocated");
+    TEST_ASSERT(RequestPool::findByContext(&req->ctx) == req, "context maps back to request");
+    TEST_ASSERT(RequestPool::findByContext(nullptr) == nullptr, "null context");
+    pool.release(req);
+
+    return 0;
+}
+
+static int
+testExpansionKeepsPointers() {
+    NIXL_INFO << "  testExpansionKeepsPointers";
+
+    DataRequestPool pool(POOL_SIZE, 3);
+    TEST_ASSERT(pool.initialize() == NIXL_SUCCESS, "data pool initialized");
+
+    std::vector<nixlLibfabricReq *> reqs;
+    for (size_t i = 0; i < POOL_SIZE; ++i) {
+        reqs.push_back(pool.allocate(nixlLibfabricReq::WRITE, i + 1));
+        TEST_ASSERT(reqs.back() != nullptr, "request allocated");
+    }
+    TEST_ASSERT(pool.getTotalRequestCount() == POOL_SIZE, "pool not expanded yet");
+    TEST_ASSERT(pool.getPoolUtilization() == 100, "pool fully utilized");
+
+    // Pool is exhausted, this allocation expands it
+    reqs.push_back(pool.allocate(nixlLibfabricReq::WRITE, POOL_SIZE + 1));
+    TEST_ASSERT(reqs.back() != nullptr, "request allocated after expansion");
+    TEST_ASSERT(pool.getTotalRequestCount() == 2 * POOL_SIZE, "pool expanded by one block");
+    TEST_ASSERT(reqs.back()->rail_id == 3, "expanded request has rail id");
+    TEST_ASSERT(reqs.back()->buffer == nullptr, "expanded request initialized");
+
+    // Requests handed out before the expansion are untouched
+    for (size_t i = 0; i < POOL_SIZE; ++i) {
+        TEST_ASSERT(reqs[i]->in_use, "in-flight request still in use");
+        TEST_ASSERT(reqs[i]->xfer_id == i + 1, "in-flight request still valid");
+        TEST_ASSERT(RequestPool::findByContext(&reqs[i]->ctx) == reqs[i], "context still valid");
+    }
+
+    std::set<size_t> indices;
+    for (nixlLibfabricReq *req : reqs) {
+        indices.insert(req->pool_index);
+        pool.release(req);
+    }
+    TEST_ASSERT(indices.size() == reqs.size(), "pool indices are unique");
+    TEST_ASSERT(pool.getActiveRequestCount() == 0, "all requests released");
+
+    return 0;
+}
+
+static int
+testConcurrentAllocateRelease() {
+    NIXL_INFO << "  testConcurrentAllocateRelease";
+
+    DataRequestPool pool(POOL_SIZE, 0);
+    TEST_ASSERT(pool.initialize() == NIXL_SUCCESS, "data pool initialized");
+
+    // Each thread holds a few requests at a time so that the pool has to expand, and checks
+    // that nobody else got the same request meanwhile
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&pool, &failed, t]() {
+            std::vector<nixlLibfabricReq *> held;
+            for (size_t i = 0; i < OPS_PER_THREAD && !failed; ++i) {
+                const uint32_t id = static_cast<uint32_t>(t * OPS_PER_THREAD + i + 1);
+                nixlLibfabricReq *req = pool.allocate(nixlLibfabricReq::WRITE, id);
+                if (!req) {
+                    failed = true;
+                    break;
+                }
+                req->chunk_offset = id;
+                held.push_back(req);
+
+                if (held.size() == 3 || i + 1 == OPS_PER_THREAD) {
+                    for (nixlLibfabricReq *h : held) {
+                        if (h->chunk_offset != h->xfer_id) {
+                            failed = true;
+                        }
+                        pool.release(h);
+                    }
+                    held.clear();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    TEST_ASSERT(!failed, "no request was handed out twice");
+    TEST_ASSERT(pool.getActiveRequestCount() == 0, "all requests released");
+    TEST_ASSERT(pool.getTotalRequestCount() <= NUM_THREADS * 3 + POOL_SIZE,
+                "pool did not grow beyond the number of concurrently held requests");
+
+    return 0;
+}
+
+static int
+testControlPoolExpansion() {
+    NIXL_INFO << "  testControlPoolExpansion";
+
+    fid_fabric *fabric = mock_fabric_create();
+    fid_domain *domain = nullptr;
+    TEST_ASSERT(fi_domain(fabric, nullptr, &domain, nullptr) == 0, "mock domain created");
+
+    {
+        ControlRequestPool pool(POOL_SIZE, 1);
+        TEST_ASSERT(pool.initialize(domain) == NIXL_SUCCESS, "control pool initialized");
+
+        std::set<void *> buffers;
+        std::vector<nixlLibfabricReq *> reqs;
+        for (size_t i = 0; i < 2 * POOL_SIZE + 1; ++i) {
+            nixlLibfabricReq *req = pool.allocate(64, i + 1);
+            TEST_ASSERT(req != nullptr, "control request allocated");
+            TEST_ASSERT(req->buffer != nullptr && req->mr != nullptr, "buffer assigned");
+            TEST_ASSERT(req->buffer_size == 64, "buffer size set to requested size");
+            buffers.insert(req->buffer);
+            reqs.push_back(req);
+        }
+        TEST_ASSERT(buffers.size() == reqs.size(), "control buffers are unique");
+        TEST_ASSERT(pool.getTotalRequestCount() == 3 * POOL_SIZE, "pool expanded twice");
+        TEST_ASSERT(pool.allocate(NIXL_LIBFABRIC_SEND_RECV_BUFFER_SIZE + 1, 0) == nullptr,
+                    "oversized control request rejected");
+
+        for (nixlLibfabricReq *req : reqs) {
+            pool.release(req);
+        }
+        TEST_ASSERT(pool.getActiveRequestCount() == 0, "all control requests released");
+        pool.cleanup();
+    }
+
+    fi_close(&domain->fid);
+    fi_close(&fabric->fid);
+    return 0;
+}
+
+int
+main() {
+    NIXL_INFO << "=== Request Pool Test ===";
+
+    int res;
+    if ((res = testAllocateRelease()) != 0) return res;
+    if ((res = testFindByContext()) != 0) return res;
+    if ((res = testExpansionKeepsPointers()) != 0) return res;
+    if ((res = testConcurrentAllocateRelease()) != 0) return res;
+    if ((res = testControlPoolExpansion()) != 0) return res;
+
+    NIXL_INFO << "=== All request pool tests PASSED ===";
+    return 0;
+}